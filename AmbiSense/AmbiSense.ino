@@ -20,11 +20,15 @@
 #include <EEPROM.h>  
 #include "config.h"
 #include "eeprom_manager.h"
+#include "settings_store.h"
+#include "settings_schema.h"
 #include "led_controller.h"
 #include "radar_manager.h"
 #include "web_interface.h"
 #include "wifi_manager.h"
 #include "espnow_manager.h"  // For ESP-NOW support
+#include "telemetry.h"
+#include "profiler.h"
 
 #define WIFI_RESET_BUTTON_PIN 7
 #define SHORT_PRESS_TIME 2000
@@ -41,7 +45,7 @@ bool buttonPreviouslyPressed = false;
 bool systemEnabled = true;
 
 unsigned long previousMillis = 0;
-int animationInterval = 30;
+int animationInterval = ANIMATION_INTERVAL_MS;
 
 // Flags for handling WiFi reset and device restart
 bool shouldResetWifi = false;
@@ -52,6 +56,35 @@ int ledSegmentMode = DEFAULT_LED_SEGMENT_MODE;
 int ledSegmentStart = DEFAULT_LED_SEGMENT_START;  
 int ledSegmentLength = DEFAULT_LED_SEGMENT_LENGTH;
 int totalSystemLeds = DEFAULT_TOTAL_SYSTEM_LEDS;
+bool ledSegmentReversed = false;
+
+unsigned long bootLedsReadyMs = 0;
+unsigned long bootFirstLightMs = 0;
+unsigned long bootNetworkReadyMs = 0;
+volatile bool networkReady = false;
+
+// Brings up everything the LEDs don't need. WiFi association, the ESP-NOW
+// channel switch and the web server all wait on the radio, so they run here
+// rather than holding the stairs dark in setup().
+static void bringUpNetwork() {
+  wifiManager.begin();
+  
+  // Initialize ESP-NOW for master-slave communication
+  setupESPNOW();
+  
+  setupWebServer();
+  
+  bootNetworkReadyMs = millis();
+  networkReady = true;
+  Serial.printf("Network ready after %lu ms\n", bootNetworkReadyMs);
+}
+
+static void networkInitTask(void* parameter) {
+  telemetryRegisterTask("netinit", xTaskGetCurrentTaskHandle());
+  bringUpNetwork();
+  telemetryUnregisterTask(xTaskGetCurrentTaskHandle());
+  vTaskDelete(nullptr);
+}
 
 // Function to check for factory reset during boot
 void checkForFactoryReset() {
@@ -77,8 +110,11 @@ void setup() {
   Serial.begin(115200);
   delay(100); // Give serial a moment to initialize
   
-  Serial.println("\n\nAmbiSense v4.3.0 - Radar-Controlled LED System");
+  Serial.println("\n\nAmbiSense v" FIRMWARE_VERSION " - Radar-Controlled LED System");
   Serial.println("Copyright © 2025 TechPosts Media.");
+  
+  // Count allocations from the start, so the LED buffers are included
+  telemetryBegin();
 
   // Set up reset button
   pinMode(WIFI_RESET_BUTTON_PIN, INPUT_PULLUP);
@@ -108,25 +144,25 @@ void setup() {
   
   // Initialize EEPROM before WiFi to ensure settings are loaded
   setupEEPROM();
+  publishSettingsSnapshot();
   
   // Initialize hardware components
   setupLEDs();
   updateLEDConfig();
   
   setupRadar();
-  
-  // Initialize WiFi AFTER other hardware is set up
-  wifiManager.begin();
-  
-  // Initialize ESP-NOW for master-slave communication
-  setupESPNOW();
-  
-  // Setup Web server LAST after WiFi is connected
-  setupWebServer();
+  bootLedsReadyMs = millis();
   
   pinMode(WIFI_RESET_BUTTON_PIN, INPUT_PULLUP);
+  
+  // loop() starts rendering while the network comes up
+  if (xTaskCreatePinnedToCore(networkInitTask, "netinit", NETWORK_INIT_TASK_STACK_SIZE, nullptr,
+                              NETWORK_INIT_TASK_PRIORITY, nullptr, NETWORK_INIT_TASK_CORE) != pdPASS) {
+    Serial.println("ERROR: Failed to start network init task, starting network inline");
+    bringUpNetwork();
+  }
 
-  Serial.println("System ready.");
+  Serial.printf("System ready. LEDs live after %lu ms\n", bootLedsReadyMs);
   
   // Log current device role
   if (deviceRole == DEVICE_ROLE_MASTER) {
@@ -142,46 +178,88 @@ void setup() {
   // Show min/max distance configuration
   Serial.printf("Min Distance: %d cm, Max Distance: %d cm\n", minDistance, maxDistance);
   
-  // Log the CRC for debugging
-  uint8_t currentCRC = calculateSystemCRC();
-  Serial.printf("Settings CRC: 0x%02X\n", currentCRC);
+  // Log the settings store headroom for debugging
+  Serial.printf("Settings store: %u free entries\n", (unsigned)settingsStoreFreeEntries());
 }
 
 void loop() {
+  PROFILE_ZONE(PROFILE_ZONE_LOOP);
+  
   // Handle button input
   handleButton();
   
   // Process pending actions
   handlePendingActions();
   
-  // Process web server client requests
-  server.handleClient();
+  // Run at most one settings request handed over by the web server task
+  serviceWebRequests();
+  
+  // Commit scheduled settings changes once they have settled
+  {
+    PROFILE_ZONE(PROFILE_ZONE_SETTINGS_SAVE);
+    processSettingsSave();
+  }
   
   if (!systemEnabled) {
     for (int i = 0; i < numLeds; i++) {
       strip.setPixelColor(i, 0);
     }
     strip.show();
-    wifiManager.process();
+    if (networkReady) wifiManager.process();
     return;
   }
 
-  // Process WiFi and radar
-  wifiManager.process();
-  processRadarReading();
+  // Process WiFi and radar. Until the network task finishes, the radio
+  // belongs to it.
+  if (networkReady) {
+    PROFILE_ZONE(PROFILE_ZONE_WIFI);
+    wifiManager.process();
+  }
+  {
+    PROFILE_ZONE(PROFILE_ZONE_RADAR);
+    processRadarReading();
+  }
+  
+  // Master: combine its own and the slaves' readings
+  {
+    PROFILE_ZONE(PROFILE_ZONE_FUSION);
+    processPendingSensorData();
+  }
+
+  // Slaves in distributed mode draw the scene sent by the master
+  {
+    PROFILE_ZONE(PROFILE_ZONE_SCENE);
+    processPendingSceneState();
+  }
+  
+  // ESP-NOW discovery, health checks and periodic segment map resend
+  if (networkReady) {
+    PROFILE_ZONE(PROFILE_ZONE_ESPNOW);
+    espnowMaintenance();
+  }
 
   // Handle animation updates at specified interval
   unsigned long currentMillis = millis();
   if (currentMillis - previousMillis >= animationInterval) {
     previousMillis = currentMillis;
 
-    // Only use updateLEDs directly for non-standard modes
-    // Standard mode is handled in processRadarReading() and ESP-NOW logic
-    if (lightMode != LIGHT_MODE_STANDARD) {
+    // Only animated scenes are drawn on the timer; standard mode with a
+    // plain background is handled in processRadarReading() and ESP-NOW logic
+    if (isSceneAnimated() && !isFollowingMasterScene()) {
+      PROFILE_ZONE(PROFILE_ZONE_ANIMATION);
       updateLEDs(currentDistance);
     }
   }
   
+  // Dither steps, level changes and transitions of a frame that is not changing
+  refreshLEDOutput();
+  
+  // Time to first light: the first frame drawn after power-up
+  if (bootFirstLightMs == 0 && getRenderFrame() > 0) {
+    bootFirstLightMs = millis();
+    Serial.printf("First light after %lu ms\n", bootFirstLightMs);
+  }
+  
   // Check if WiFi reset button is held for a long time
   static bool longPressDetected = false;
   static unsigned long buttonPressStartTime = 0;
@@ -239,6 +317,7 @@ void handlePendingActions() {
   if (shouldResetWifi && (millis() - resetRequestTime > 2000)) {
     shouldResetWifi = false;
     Serial.println("Executing WiFi reset...");
+    flushSettingsSave();
     wifiManager.resetWifiSettings();
     // resetWifiSettings() will restart the device
   }
@@ -247,6 +326,7 @@ void handlePendingActions() {
   if (shouldRestartDevice && (millis() - resetRequestTime > 2000)) {
     shouldRestartDevice = false;
     Serial.println("Restarting device...");
+    flushSettingsSave();
     ESP.restart();
   }
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <Arduino.h>
+
+/*
+ * Blending for layered scenes. A scene is built bottom-up in the RGB color
+ * frame: each layer only visits the span of pixels it covers and blends its
+ * colors into what the layers below left there. All arithmetic is 8-bit
+ * fixed point (opacity 255 = 1.0), so a layer costs a few integer ops per
+ * pixel it touches and nothing for the rest of the strip.
+ */
+
+enum BlendMode : uint8_t {
+  BLEND_ADD,    // Saturating sum, for lights that overlap
+  BLEND_MAX,    // Brighter of the two per channel, for glows over a background
+  BLEND_ALPHA   // Cover what is below by the layer's opacity
+};
+
+// An 8-bit fraction as a weight out of 256, so 0 and 255 are exact
+static inline uint16_t blendWeight(uint8_t fraction) {
+  return fraction + (fraction >> 7);
+}
+
+// Scale a channel by an 8-bit fraction
+static inline uint8_t scaleChannel(uint8_t value, uint8_t fraction) {
+  return (value * blendWeight(fraction)) >> 8;
+}
+
+/**
+ * Blend one layer pixel into the frame
+ * @param pixel Frame pixel, RGB
+ * @param r Layer color
+ * @param g Layer color
+ * @param b Layer color
+ * @param mode How the layer combines with the frame
+ * @param opacity Layer opacity (0-255)
+ */
+static inline void blendPixel(uint8_t* pixel, uint8_t r, uint8_t g, uint8_t b, BlendMode mode, uint8_t opacity) {
+  switch (mode) {
+    case BLEND_ADD:
+      pixel[0] = min(255, pixel[0] + scaleChannel(r, opacity));
+      pixel[1] = min(255, pixel[1] + scaleChannel(g, opacity));
+      pixel[2] = min(255, pixel[2] + scaleChannel(b, opacity));
+      break;
+    case BLEND_MAX:
+      pixel[0] = max(pixel[0], scaleChannel(r, opacity));
+      pixel[1] = max(pixel[1], scaleChannel(g, opacity));
+      pixel[2] = max(pixel[2], scaleChannel(b, opacity));
+      break;
+    case BLEND_ALPHA: {
+      uint16_t cover = blendWeight(opacity);
+      uint16_t keep = 256 - cover;
+      pixel[0] = (r * cover + pixel[0] * keep) >> 8;
+      pixel[1] = (g * cover + pixel[1] * keep) >> 8;
+      pixel[2] = (b * cover + pixel[2] * keep) >> 8;
+      break;
+    }
+  }
+}
+
+#endif // COMPOSITOR_H
@@ -70,22 +70,27 @@ input:checked+.toggle-slider:before{transform:translateX(26px)}
 // Complete JavaScript functionality (minified but preserving all features)
 const char full_js[] PROGMEM = R"literal(
 function showSavedNotification(){if(window.savedNotificationTimeout){clearTimeout(window.savedNotificationTimeout)}const notification=document.getElementById('settingsSaved');notification.classList.remove('show');setTimeout(()=>{notification.classList.add('show');window.savedNotificationTimeout=setTimeout(()=>{notification.classList.remove('show')},3000)},10)}
-function updateDistance(){fetch('/distance').then(response=>response.text()).then(distance=>{distance=parseInt(distance);document.getElementById('liveDistance').innerHTML=distance+'<span class="distance-unit">cm</span>';const minDist=parseInt(document.getElementById('minDist')?.value||'30');const maxDist=parseInt(document.getElementById('maxDist')?.value||'300');const percentage=Math.min(100,Math.max(0,((distance-minDist)/(maxDist-minDist))*100));const ledVisualizer=document.getElementById('ledVisualizer');const directionLightElement=document.getElementById('directionLight');if(directionLightElement&&directionLightElement.checked){const position=100-percentage;ledVisualizer.style.width='30%';ledVisualizer.style.left=`${position-15}%`}else{ledVisualizer.style.width=(100-percentage)+'%';ledVisualizer.style.left='0'}const redElement=document.getElementById('redValue');const greenElement=document.getElementById('greenValue');const blueElement=document.getElementById('blueValue');if(redElement&&greenElement&&blueElement){const red=parseInt(redElement.value);const green=parseInt(greenElement.value);const blue=parseInt(blueElement.value);ledVisualizer.style.background=`rgb(${red}, ${green}, ${blue})`}}).catch(error=>{console.error("Error fetching distance:",error)}).finally(()=>{setTimeout(updateDistance,500)})}
+function showDistance(distance){document.getElementById('liveDistance').innerHTML=distance+'<span class="distance-unit">cm</span>';const minDist=parseInt(document.getElementById('minDist')?.value||'30');const maxDist=parseInt(document.getElementById('maxDist')?.value||'300');const percentage=Math.min(100,Math.max(0,((distance-minDist)/(maxDist-minDist))*100));const ledVisualizer=document.getElementById('ledVisualizer');const directionLightElement=document.getElementById('directionLight');if(directionLightElement&&directionLightElement.checked){const position=100-percentage;ledVisualizer.style.width='30%';ledVisualizer.style.left=`${position-15}%`}else{ledVisualizer.style.width=(100-percentage)+'%';ledVisualizer.style.left='0'}const redElement=document.getElementById('redValue');const greenElement=document.getElementById('greenValue');const blueElement=document.getElementById('blueValue');if(redElement&&greenElement&&blueElement){const red=parseInt(redElement.value);const green=parseInt(greenElement.value);const blue=parseInt(blueElement.value);ledVisualizer.style.background=`rgb(${red}, ${green}, ${blue})`}}function updateDistance(){if(window.EventSource&&!window.distanceStreamFailed){const es=new EventSource('/events?hz=10');es.onmessage=e=>{showDistance(parseInt(e.data.split(',')[0]))};es.onerror=()=>{es.close();window.distanceStreamFailed=true;setTimeout(updateDistance,500)};return}fetch('/distance').then(response=>response.text()).then(distance=>{showDistance(parseInt(distance))}).catch(error=>{console.error("Error fetching distance:",error)}).finally(()=>{setTimeout(updateDistance,500)})}
 function updateColorPreview(){const redElement=document.getElementById('redValue');const greenElement=document.getElementById('greenValue');const blueElement=document.getElementById('blueValue');const colorPreview=document.getElementById('colorPreview');if(redElement&&greenElement&&blueElement&&colorPreview){const red=parseInt(redElement.value);const green=parseInt(greenElement.value);const blue=parseInt(blueElement.value);colorPreview.style.background=`rgb(${red}, ${green}, ${blue})`}}
 function autoSaveChanges(settingId,value){let params='';if(settingId==='numLeds')params='numLeds='+value;else if(settingId==='minDist')params='minDist='+value;else if(settingId==='maxDist')params='maxDist='+value;else if(settingId==='brightness')params='brightness='+value;else if(settingId==='redValue')params='redValue='+value;else if(settingId==='greenValue')params='greenValue='+value;else if(settingId==='blueValue')params='blueValue='+value;else if(settingId==='lightSpan')params='lightSpan='+value;else return;const affectedControl=document.getElementById(settingId);const originalValue=affectedControl.value;fetch('/set?'+params).then(response=>{if(!response.ok){throw new Error('Server returned status: '+response.status)}return response.json()}).then(data=>{if(data.status==='success'){showSavedNotification()}else if(data.status==='error'){affectedControl.value=originalValue;const displayElement=document.getElementById(settingId+(settingId.includes('Value')?'Display':'Value'));if(displayElement){displayElement.textContent=originalValue}alert('Error saving setting: '+(data.message||'Unknown error'))}}).catch(error=>{console.error('Error saving setting:',error);affectedControl.value=originalValue;const displayElement=document.getElementById(settingId+(settingId.includes('Value')?'Display':'Value'));if(displayElement){displayElement.textContent=originalValue}alert('Failed to save setting. Please try again.')})}
 function setBackgroundMode(enabled){fetch('/setBackgroundMode?enabled='+enabled).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
+function setBackgroundLayer(value){fetch('/setBatch?backgroundLayer='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function setDirectionalLight(enabled){fetch('/setDirectionalLight?enabled='+enabled).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function setMotionSmoothing(enabled){fetch('/setMotionSmoothing?enabled='+enabled).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function setLightMode(mode){fetch('/setLightMode?mode='+mode).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function updateMotionParam(param,value){fetch('/setMotionSmoothingParam?param='+param+'&value='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function setEffectSpeed(value){fetch('/setEffectSpeed?value='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
 function setEffectIntensity(value){fetch('/setEffectIntensity?value='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
-function saveAdvancedSettings(){const settings={lightSpan:document.getElementById('lightSpan').value,trailLength:document.getElementById('trailLength').value,centerShift:document.getElementById('centerShift').value,positionSmoothing:document.getElementById('positionSmoothing').value,velocitySmoothing:document.getElementById('velocitySmoothing').value,predictionFactor:document.getElementById('predictionFactor').value,positionPGain:document.getElementById('positionPGain').value,positionIGain:document.getElementById('positionIGain').value,backgroundMode:document.getElementById('backgroundMode').checked,directionLight:document.getElementById('directionLight').checked,motionSmoothing:document.getElementById('motionSmoothing').checked};const promises=[];promises.push(fetch('/set?lightSpan='+settings.lightSpan));promises.push(fetch('/setTrailLength?value='+settings.trailLength));promises.push(fetch('/setCenterShift?value='+settings.centerShift));promises.push(fetch('/setMotionSmoothingParam?param=positionSmoothingFactor&value='+(settings.positionSmoothing/100)));promises.push(fetch('/setMotionSmoothingParam?param=velocitySmoothingFactor&value='+(settings.velocitySmoothing/100)));promises.push(fetch('/setMotionSmoothingParam?param=predictionFactor&value='+(settings.predictionFactor/100)));promises.push(fetch('/setMotionSmoothingParam?param=positionPGain&value='+(settings.positionPGain/100)));promises.push(fetch('/setMotionSmoothingParam?param=positionIGain&value='+(settings.positionIGain/100)));promises.push(fetch('/setBackgroundMode?enabled='+settings.backgroundMode));promises.push(fetch('/setDirectionalLight?enabled='+settings.directionLight));promises.push(fetch('/setMotionSmoothing?enabled='+settings.motionSmoothing));Promise.all(promises).then(()=>{showSavedNotification();alert('All advanced settings saved successfully!')}).catch(error=>{console.error('Error saving settings:',error);alert('Some settings failed to save. Please try again.')})}
-function loadAdvancedSettings(){fetch('/settings').then(r=>r.json()).then(data=>{document.getElementById('lightSpan').value=data.movingLightSpan||40;document.getElementById('lightSpanValue').textContent=data.movingLightSpan||40;document.getElementById('trailLength').value=data.trailLength||0;document.getElementById('trailLengthValue').textContent=data.trailLength||0;document.getElementById('centerShift').value=data.centerShift||0;document.getElementById('centerShiftValue').textContent=data.centerShift||0;document.getElementById('positionSmoothing').value=Math.round((data.positionSmoothingFactor||0.2)*100);document.getElementById('positionSmoothingValue').textContent=Math.round((data.positionSmoothingFactor||0.2)*100);document.getElementById('velocitySmoothing').value=Math.round((data.velocitySmoothingFactor||0.1)*100);document.getElementById('velocitySmoothingValue').textContent=Math.round((data.velocitySmoothingFactor||0.1)*100);document.getElementById('predictionFactor').value=Math.round((data.predictionFactor||0.5)*100);document.getElementById('predictionFactorValue').textContent=Math.round((data.predictionFactor||0.5)*100);document.getElementById('positionPGain').value=Math.round((data.positionPGain||0.1)*100);document.getElementById('positionPGainValue').textContent=Math.round((data.positionPGain||0.1)*100);document.getElementById('positionIGain').value=Math.round((data.positionIGain||0.01)*100);document.getElementById('positionIGainValue').textContent=Math.round((data.positionIGain||0.01)*100);if(document.getElementById('backgroundMode'))document.getElementById('backgroundMode').checked=data.backgroundMode||false;if(document.getElementById('directionLight'))document.getElementById('directionLight').checked=data.directionLightEnabled||false;if(document.getElementById('motionSmoothing'))document.getElementById('motionSmoothing').checked=data.motionSmoothingEnabled||false;setupAdvancedSliders()}).catch(e=>console.error('Error loading advanced settings:',e))}
+function setTransitionTime(value){fetch('/setBatch?transitionMs='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
+function setPalette(value){fetch('/setBatch?palette='+value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>console.error('Error:',error))}
+function applyCustomPalette(){const stops=[0,128,255].map((position,i)=>position+':'+document.getElementById('paletteStop'+i).value.substring(1)).join(',');fetch('/setPalette?stops='+stops).then(response=>response.json()).then(data=>{if(data.status!=='success')throw new Error(data.message);document.getElementById('palette').value='6';showSavedNotification()}).catch(error=>{console.error('Error:',error);alert('Palette was not saved: '+error.message)})}
+function loadPalette(){fetch('/getPalette').then(r=>r.json()).then(data=>{document.getElementById('palette').value=data.palette;if(data.custom.length===3){data.custom.forEach((stop,i)=>{document.getElementById('paletteStop'+i).value='#'+stop.color.toLowerCase()})}}).catch(e=>console.error('Error loading palette:',e))}
+function saveAdvancedSettings(){const settings={lightSpan:document.getElementById('lightSpan').value,trailLength:document.getElementById('trailLength').value,centerShift:document.getElementById('centerShift').value,positionSmoothing:document.getElementById('positionSmoothing').value,velocitySmoothing:document.getElementById('velocitySmoothing').value,predictionFactor:document.getElementById('predictionFactor').value,positionPGain:document.getElementById('positionPGain').value,positionIGain:document.getElementById('positionIGain').value,backgroundMode:document.getElementById('backgroundMode').checked,directionLight:document.getElementById('directionLight').checked,motionSmoothing:document.getElementById('motionSmoothing').checked};const body=new URLSearchParams({lightSpan:settings.lightSpan,trailLength:settings.trailLength,centerShift:settings.centerShift,positionSmoothingFactor:settings.positionSmoothing/100,velocitySmoothingFactor:settings.velocitySmoothing/100,predictionFactor:settings.predictionFactor/100,positionPGain:settings.positionPGain/100,positionIGain:settings.positionIGain/100,backgroundMode:settings.backgroundMode,directionalLight:settings.directionLight,motionSmoothing:settings.motionSmoothing});fetch('/setBatch',{method:'POST',body:body}).then(r=>r.json()).then(data=>{if(data.status!=='success')throw new Error(data.message);showSavedNotification();alert('All advanced settings saved successfully!')}).catch(error=>{console.error('Error saving settings:',error);alert('Settings were not saved: '+error.message)})}
+function loadAdvancedSettings(){fetch('/settings').then(r=>r.json()).then(data=>{document.getElementById('lightSpan').value=data.movingLightSpan||40;document.getElementById('lightSpanValue').textContent=data.movingLightSpan||40;document.getElementById('trailLength').value=data.trailLength||0;document.getElementById('trailLengthValue').textContent=data.trailLength||0;document.getElementById('centerShift').value=data.centerShift||0;document.getElementById('centerShiftValue').textContent=data.centerShift||0;document.getElementById('positionSmoothing').value=Math.round((data.positionSmoothingFactor||0.2)*100);document.getElementById('positionSmoothingValue').textContent=Math.round((data.positionSmoothingFactor||0.2)*100);document.getElementById('velocitySmoothing').value=Math.round((data.velocitySmoothingFactor||0.1)*100);document.getElementById('velocitySmoothingValue').textContent=Math.round((data.velocitySmoothingFactor||0.1)*100);document.getElementById('predictionFactor').value=Math.round((data.predictionFactor||0.5)*100);document.getElementById('predictionFactorValue').textContent=Math.round((data.predictionFactor||0.5)*100);document.getElementById('positionPGain').value=Math.round((data.positionPGain||0.1)*100);document.getElementById('positionPGainValue').textContent=Math.round((data.positionPGain||0.1)*100);document.getElementById('positionIGain').value=Math.round((data.positionIGain||0.01)*100);document.getElementById('positionIGainValue').textContent=Math.round((data.positionIGain||0.01)*100);if(document.getElementById('backgroundMode'))document.getElementById('backgroundMode').checked=data.backgroundMode||false;if(document.getElementById('backgroundLayer'))document.getElementById('backgroundLayer').value=data.backgroundLayer||0;if(document.getElementById('directionLight'))document.getElementById('directionLight').checked=data.directionLightEnabled||false;if(document.getElementById('motionSmoothing'))document.getElementById('motionSmoothing').checked=data.motionSmoothingEnabled||false;setupAdvancedSliders()}).catch(e=>console.error('Error loading advanced settings:',e))}
 function setupAdvancedSliders(){const sliders=document.querySelectorAll('#lightSpan,#positionSmoothing,#velocitySmoothing,#predictionFactor,#positionPGain,#positionIGain');sliders.forEach(slider=>{const valueDisplay=document.getElementById(slider.id+'Value');slider.oninput=function(){valueDisplay.textContent=this.value}})}
 function addSelectedSlave(){const selected=document.querySelector('input[name="selectedSlave"]:checked');if(selected){addSlave(selected.value)}else{alert('Please select a slave device first')}}
 function removeSelectedSlave(){const selected=document.querySelector('input[name="selectedNode"]:checked');if(selected){removeSlave(selected.value)}else{alert('Please select a node to remove')}}
-document.addEventListener('DOMContentLoaded',function(){updateDistance();if(document.getElementById('lightSpan')){loadAdvancedSettings()}document.getElementById('loadingOverlay').style.display='none'})
+document.addEventListener('DOMContentLoaded',function(){updateDistance();if(document.getElementById('lightSpan')){loadAdvancedSettings()}if(document.getElementById('palette')){loadPalette()}if(document.getElementById('transitionMs')){fetch('/settings').then(r=>r.json()).then(data=>{document.getElementById('transitionMs').value=data.transitionMs;document.getElementById('transitionMsValue').textContent=data.transitionMs}).catch(e=>console.error('Error loading settings:',e))}document.getElementById('loadingOverlay').style.display='none'})
 )literal";
 
 // Base HTML template with placeholders
@@ -151,6 +156,11 @@ const char basic_tab_full[] PROGMEM = R"literal(
 </div>
 </div>
 <div class="form-group">
+<label>Power Budget (mA)</label>
+<input type="number" min="0" max="60000" step="100" class="led-count-input" id="powerBudget" value="0">
+<small class="input-description">Brightness is reduced when the LEDs would draw more than this (0 = no limit)</small>
+</div>
+<div class="form-group">
 <label>Minimum Distance (cm)</label>
 <div class="slider-container">
 <input type="range" min="0" max="500" value="30" class="slider" id="minDist">
@@ -205,8 +215,8 @@ Reset Min/Max Distance to Defaults
 // Basic tab JavaScript
 const char basic_tab_js[] PROGMEM = R"literal(
 <script>
-window.onload=function(){loadCurrentSettings();const sliders=document.querySelectorAll('.slider');sliders.forEach(slider=>{const valueDisplay=document.getElementById(slider.id+(slider.id.includes('Value')?'Display':'Value'));slider.oninput=function(){valueDisplay.textContent=this.value;if(['redValue','greenValue','blueValue'].includes(this.id)){updateColorPreview()}};slider.addEventListener('change',function(){autoSaveChanges(this.id,this.value)})});const numLedsInput=document.getElementById('numLeds');numLedsInput.oninput=function(){const lengthInMeters=(parseInt(this.value)/60).toFixed(1);document.getElementById('ledDensity').textContent=lengthInMeters;updateColorPreview()};numLedsInput.addEventListener('change',function(){autoSaveChanges('numLeds',this.value)});document.getElementById('saveButton').addEventListener('click',function(){const numLeds=document.getElementById('numLeds').value;const minDist=document.getElementById('minDist').value;const maxDist=document.getElementById('maxDist').value;const brightness=document.getElementById('brightness').value;const redValue=document.getElementById('redValue').value;const greenValue=document.getElementById('greenValue').value;const blueValue=document.getElementById('blueValue').value;fetch('/set?numLeds='+numLeds+'&minDist='+minDist+'&maxDist='+maxDist+'&brightness='+brightness+'&redValue='+redValue+'&greenValue='+greenValue+'&blueValue='+blueValue).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>{console.error("Error saving settings:",error)})})};
-function loadCurrentSettings(){fetch('/settings').then(response=>response.json()).then(settings=>{document.getElementById('numLeds').value=settings.numLeds;document.getElementById('ledDensity').textContent=(settings.numLeds/60).toFixed(1);document.getElementById('minDist').value=settings.minDistance;document.getElementById('minDistValue').textContent=settings.minDistance;document.getElementById('maxDist').value=settings.maxDistance;document.getElementById('maxDistValue').textContent=settings.maxDistance;document.getElementById('brightness').value=settings.brightness;document.getElementById('brightnessValue').textContent=settings.brightness;document.getElementById('redValue').value=settings.redValue;document.getElementById('redValueDisplay').textContent=settings.redValue;document.getElementById('greenValue').value=settings.greenValue;document.getElementById('greenValueDisplay').textContent=settings.greenValue;document.getElementById('blueValue').value=settings.blueValue;document.getElementById('blueValueDisplay').textContent=settings.blueValue;updateColorPreview();document.getElementById('loadingOverlay').style.display='none'}).catch(error=>{console.error('Error loading settings:',error);document.getElementById('loadingOverlay').style.display='none'})}
+window.onload=function(){loadCurrentSettings();const sliders=document.querySelectorAll('.slider');sliders.forEach(slider=>{const valueDisplay=document.getElementById(slider.id+(slider.id.includes('Value')?'Display':'Value'));slider.oninput=function(){valueDisplay.textContent=this.value;if(['redValue','greenValue','blueValue'].includes(this.id)){updateColorPreview()}};slider.addEventListener('change',function(){autoSaveChanges(this.id,this.value)})});const numLedsInput=document.getElementById('numLeds');numLedsInput.oninput=function(){const lengthInMeters=(parseInt(this.value)/60).toFixed(1);document.getElementById('ledDensity').textContent=lengthInMeters;updateColorPreview()};numLedsInput.addEventListener('change',function(){autoSaveChanges('numLeds',this.value)});document.getElementById('powerBudget').addEventListener('change',function(){fetch('/setBatch?powerBudget='+this.value).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}else{alert('Error saving setting: '+(data.message||'Unknown error'))}}).catch(error=>console.error('Error saving setting:',error))});document.getElementById('saveButton').addEventListener('click',function(){const numLeds=document.getElementById('numLeds').value;const minDist=document.getElementById('minDist').value;const maxDist=document.getElementById('maxDist').value;const brightness=document.getElementById('brightness').value;const redValue=document.getElementById('redValue').value;const greenValue=document.getElementById('greenValue').value;const blueValue=document.getElementById('blueValue').value;fetch('/set?numLeds='+numLeds+'&minDist='+minDist+'&maxDist='+maxDist+'&brightness='+brightness+'&redValue='+redValue+'&greenValue='+greenValue+'&blueValue='+blueValue).then(response=>response.json()).then(data=>{if(data.status==='success'){showSavedNotification()}}).catch(error=>{console.error("Error saving settings:",error)})})};
+function loadCurrentSettings(){fetch('/settings').then(response=>response.json()).then(settings=>{document.getElementById('numLeds').value=settings.numLeds;document.getElementById('ledDensity').textContent=(settings.numLeds/60).toFixed(1);document.getElementById('powerBudget').value=settings.powerBudget;document.getElementById('minDist').value=settings.minDistance;document.getElementById('minDistValue').textContent=settings.minDistance;document.getElementById('maxDist').value=settings.maxDistance;document.getElementById('maxDistValue').textContent=settings.maxDistance;document.getElementById('brightness').value=settings.brightness;document.getElementById('brightnessValue').textContent=settings.brightness;document.getElementById('redValue').value=settings.redValue;document.getElementById('redValueDisplay').textContent=settings.redValue;document.getElementById('greenValue').value=settings.greenValue;document.getElementById('greenValueDisplay').textContent=settings.greenValue;document.getElementById('blueValue').value=settings.blueValue;document.getElementById('blueValueDisplay').textContent=settings.blueValue;updateColorPreview();document.getElementById('loadingOverlay').style.display='none'}).catch(error=>{console.error('Error loading settings:',error);document.getElementById('loadingOverlay').style.display='none'})}
 </script>
 )literal";
 
@@ -296,6 +306,15 @@ const char advanced_tab_full[] PROGMEM = R"literal(
 <span class="toggle-slider"></span>
 </label>
 </div>
+<div class="form-group">
+<label>Background</label>
+<select id="backgroundLayer" onchange="setBackgroundLayer(this.value)" style="width:100%;padding:12px;border-radius:8px;background:#333;color:#fff;border:none;font-size:14px;">
+<option value="0">Dim Color</option>
+<option value="1">Color Palette</option>
+<option value="2">Fire</option>
+</select>
+<small class="input-description">Shown under the moving light when Background Mode is on</small>
+</div>
 <div class="toggle-container">
 <span class="toggle-label">Directional Light</span>
 <label class="toggle-switch">
@@ -347,6 +366,36 @@ const char effects_tab_full[] PROGMEM = R"literal(
 <div class="slider-value" id="effectIntensityValue">50</div>
 </div>
 </div>
+<div class="form-group">
+<label>Transition Time (ms)</label>
+<div class="slider-container">
+<input type="range" min="0" max="3000" step="100" value="500" class="slider" id="transitionMs" oninput="document.getElementById('transitionMsValue').textContent=this.value" onchange="setTransitionTime(this.value)">
+<div class="slider-value" id="transitionMsValue">500</div>
+</div>
+<span class="input-description">Crossfade when the mode, color or palette changes (0 = instant)</span>
+</div>
+<div class="form-group">
+<label>Color Palette</label>
+<select id="palette" onchange="setPalette(this.value)" style="width:100%;padding:12px;border-radius:8px;background:#333;color:#fff;border:none;font-size:14px;">
+<option value="0">Rainbow</option>
+<option value="1">Heat</option>
+<option value="2">Ocean</option>
+<option value="3">Forest</option>
+<option value="4">Sunset</option>
+<option value="5">Selected Color</option>
+<option value="6">Custom</option>
+</select>
+<span class="input-description">Colors cycled by Rainbow mode</span>
+</div>
+<div class="form-group">
+<label>Custom Palette</label>
+<div style="display:flex;gap:10px;margin-bottom:10px">
+<input type="color" id="paletteStop0" value="#ff0080">
+<input type="color" id="paletteStop1" value="#0080ff">
+<input type="color" id="paletteStop2" value="#ff0080">
+</div>
+<button class="button" onclick="applyCustomPalette()">Use Custom Palette</button>
+</div>
 )literal";
 
 // Multi-Sensor tab - Mesh Setup & Monitoring
@@ -817,27 +866,20 @@ function scanForAmbiSenseDevices() {
   scanResults.style.display = 'block';
   scanList.innerHTML = '<div style="text-align:center;padding:20px;color:#999">🔍 Scanning for AmbiSense devices...</div>';
   
-  fetch('/scanForSlaves')
-    .then(r => r.json())
-    .then(devices => {
-      scanList.innerHTML = '';
-      
+  // Devices answer the master's ESP-NOW probe; show them as they arrive
+  const poll = url => fetch(url)
+    .then(r => r.json().then(devices => ({devices, scanning: r.headers.get('X-Scan-In-Progress') === '1'})))
+    .then(({devices, scanning}) => {
       if (devices && devices.length > 0) {
-        // Filter for AmbiSense devices only
-        const ambiSenseDevices = devices.filter(device => 
-          device.name && (device.name.includes('AmbiSense') || device.isAmbiSense)
-        );
-        
-        if (ambiSenseDevices.length > 0) {
-          ambiSenseDevices.forEach(device => {
-            const deviceItem = createDeviceItem(device);
-            scanList.appendChild(deviceItem);
-          });
-        } else {
-          scanList.innerHTML = '<div style="text-align:center;padding:20px;color:#999">No AmbiSense devices found in range</div>';
-        }
-      } else {
-        scanList.innerHTML = '<div style="text-align:center;padding:20px;color:#999">No devices found</div>';
+        scanList.innerHTML = '';
+        devices.forEach(device => scanList.appendChild(createDeviceItem(device)));
+      } else if (!scanning) {
+        scanList.innerHTML = '<div style="text-align:center;padding:20px;color:#999">No AmbiSense devices found in range</div>';
+      }
+      
+      if (scanning) {
+        setTimeout(() => poll('/scanForSlaves'), 250);
+        return;
       }
       
       isScanning = false;
@@ -847,6 +889,8 @@ function scanForAmbiSenseDevices() {
       scanList.innerHTML = '<div style="text-align:center;padding:20px;color:#ff6b6b">Scan failed. Please try again.</div>';
       isScanning = false;
     });
+  
+  poll('/scanForSlaves?refresh=1');
 }
 
 // Create device item for scan results
@@ -862,7 +906,7 @@ function createDeviceItem(device) {
   item.innerHTML = `
     <div>
       <div class="device-name">${device.name || 'AmbiSense Device'}</div>
-      <div class="device-mac">${device.mac}</div>
+      <div class="device-mac">${device.mac}${device.leds ? ` · ${device.leds} LEDs · v${device.firmware}` : ''}${device.paired ? ' · paired' : ''}</div>
     </div>
     <div>
       <span class="device-signal ${signalClass}">${signalText} (${device.rssi}dBm)</span>
@@ -1078,27 +1122,8 @@ window.addEventListener('beforeunload', function() {
 </script>
 )literal";
 
-// Utility function to build complete HTML page
-String buildFullPage(const char* tabContent, const char* activeTab, const __FlashStringHelper* tabScripts = nullptr) {
-  String html = FPSTR(html_template_full);
-  
-  // Replace CSS and JS
-  html.replace("%CSS%", FPSTR(full_css));
-  html.replace("%JS%", FPSTR(full_js));
-  
-  // Set active tab
-  html.replace("%BASIC_TAB_ACTIVE%", strcmp(activeTab, "basic") == 0 ? "active" : "");
-  html.replace("%ADVANCED_TAB_ACTIVE%", strcmp(activeTab, "advanced") == 0 ? "active" : "");
-  html.replace("%EFFECTS_TAB_ACTIVE%", strcmp(activeTab, "effects") == 0 ? "active" : "");
-  html.replace("%MESH_TAB_ACTIVE%", strcmp(activeTab, "mesh") == 0 ? "active" : "");
-  html.replace("%NETWORK_TAB_ACTIVE%", strcmp(activeTab, "network") == 0 ? "active" : "");
-  html.replace("%DIAGNOSTICS_TAB_ACTIVE%", strcmp(activeTab, "diagnostics") == 0 ? "active" : "");
-  
-  // Insert tab content and scripts
-  html.replace("%TAB_CONTENT%", FPSTR(tabContent));
-  html.replace("%TAB_SCRIPTS%", tabScripts ? String(tabScripts) : "");
-  
-  return html;
-}
+// Pages are composed from the template above (CSS, JS, active tab, tab content
+// and tab scripts substituted in that order) and gzipped at build time by
+// tools/gen_web_pages.py into web_pages_gz.h. Re-run it after editing this file.
 
 #endif // COMPRESSED_HTML_FULL_H
\ No newline at end of file
@@ -13,6 +13,10 @@
 #define ENABLE_WIFI_LOGGING true
 #define ENABLE_ESPNOW_LOGGING true
 
+// Per-stage timing of the loop and web task, served at /profile.
+// false compiles the timing zones out entirely.
+#define ENABLE_PROFILER true
+
 // 🛠 LED & Sensor Config
 #define LED_PIN 5
 #define DEFAULT_NUM_LEDS 300
@@ -22,6 +26,12 @@
 #define DEFAULT_MAX_DISTANCE 300
 #define EEPROM_INITIALIZED_MARKER 123
 #define EEPROM_SIZE 1024
+#define SETTINGS_SAVE_DELAY_MS 2000  // Quiet time before scheduled settings changes are committed
+
+// Settings store (NVS records, see settings_store.h)
+#define SETTINGS_STORE_NAMESPACE "ambisense"
+#define SETTINGS_STORE_MAX_RECORDS 12         // Records tracked by the unchanged-save index
+#define SETTINGS_STORE_MAX_RECORD_SIZE 256    // Largest record payload in bytes
 
 // LED Distribution modes
 #define LED_SEGMENT_MODE_CONTINUOUS 0
@@ -30,6 +40,44 @@
 // LED limits
 #define MAX_SUPPORTED_LEDS 2000
 
+// Frames a slave may replay to resync stateful effects after packet loss
+#define MAX_RENDER_CATCHUP_FRAMES 64
+
+// Output stage: every channel goes through a gamma curve with the brightness
+// folded in. Levels between two strip steps are dithered with a pattern over
+// LED position and frame number, so a distributed strip dithers like one long
+// strip. A frame that isn't redrawn keeps its pattern; with
+// ENABLE_DITHER_REFRESH it is re-shown every LED_DITHER_REFRESH_MS while any
+// level below LED_DITHER_MAX_LEVEL strip steps has a fraction (one step
+// higher up isn't visible).
+#define LED_GAMMA 2.2f
+#define ENABLE_TEMPORAL_DITHERING true
+#define ENABLE_DITHER_REFRESH false
+#define LED_DITHER_REFRESH_MS 40
+#define LED_DITHER_MAX_LEVEL 32
+
+// Power limiter: the current of each frame is estimated from the strip data
+// as it is written, and the brightness of the next frames is scaled so the
+// estimate stays under the budget. Cuts apply at once, recovery is ramped.
+#define DEFAULT_POWER_BUDGET_MA 0   // 0 = no limit
+#define MAX_POWER_BUDGET_MA 60000
+#define LED_CHANNEL_MA 20           // One color channel at full level (WS2812B)
+#define LED_IDLE_MA 1               // Each LED, lit or not
+#define POWER_LIMIT_RAMP 2          // Recovery per frame, in 1/256 of full brightness
+
+// Effect frame period
+#define ANIMATION_INTERVAL_MS 30
+
+// Crossfade between scenes when the light mode, color, palette or background
+// changes (0 = switch at once)
+#define DEFAULT_TRANSITION_MS 500
+#define MAX_TRANSITION_MS 5000
+#define TRANSITION_TIME_UNIT_MS 20  // Resolution of the duration sent to slaves
+
+// Render benchmark (/benchmark)
+#define RENDER_BENCHMARK_LEDS 1000
+#define RENDER_BENCHMARK_ITERATIONS 20
+
 #define ENABLE_MOCK_DEVICES false
 
 // Default color (white)
@@ -66,6 +114,24 @@
 #define LIGHT_MODE_DUAL_SCAN 9
 #define LIGHT_MODE_MOTION_PARTICLES 10
 
+// Color palettes. Rainbow mode cycles through the selected one; fire, solid,
+// breathing and theater chase always use heat or the selected color.
+#define PALETTE_RAINBOW 0
+#define PALETTE_HEAT 1
+#define PALETTE_OCEAN 2
+#define PALETTE_FOREST 3
+#define PALETTE_SUNSET 4
+#define PALETTE_COLOR 5    // Black to the selected color
+#define PALETTE_CUSTOM 6   // User palette (/setPalette)
+#define PALETTE_COUNT 7
+
+// What background mode shows under standard mode's moving light
+#define BACKGROUND_LAYER_COLOR 0    // Selected color, dimmed
+#define BACKGROUND_LAYER_PALETTE 1  // Selected palette, cycling like rainbow mode
+#define BACKGROUND_LAYER_FIRE 2     // Fire effect
+#define BACKGROUND_LAYER_COUNT 3
+#define BACKGROUND_LAYER_LEVEL 64   // Background opacity (about 5% of full output after gamma)
+
 #define DEFAULT_MOTION_SMOOTHING_ENABLED true
 #define DEFAULT_POSITION_SMOOTHING_FACTOR 0.2
 #define DEFAULT_VELOCITY_SMOOTHING_FACTOR 0.1
@@ -74,6 +140,8 @@
 #define DEFAULT_POSITION_I_GAIN 0.01
 #define DEFAULT_EFFECT_SPEED 50
 #define DEFAULT_EFFECT_INTENSITY 50
+#define DEFAULT_PALETTE PALETTE_RAINBOW
+#define DEFAULT_BACKGROUND_LAYER BACKGROUND_LAYER_COLOR
 
 // 🎯 LD2410 Config
 #define RADAR_SERIAL Serial1
@@ -87,24 +155,74 @@
 // 📡 Web Server
 #define WEB_SERVER_PORT 80
 
+// The web server runs in its own task; handlers that change render state are
+// handed to loop() one per iteration
+#define WEB_TASK_STACK_SIZE 8192
+#define WEB_TASK_PRIORITY 1        // Same as the Arduino loop task, so single-core chips time-slice
+#define WEB_TASK_CORE 0            // The Arduino loop runs on core 1 on dual-core chips
+#define WEB_HANDLER_BUDGET_US 5000 // Loop-side handlers slower than this are counted and logged
+#define WEB_MAX_REQUEST_ARGS 32      // Enough for a full /setBatch from the advanced page
+#define WEB_MAX_REQUEST_BYTES 1024 // Total argument size accepted by a settings request
+
+// WiFi, ESP-NOW and the web server are brought up by a one-shot task while
+// loop() already drives the LEDs
+#define NETWORK_INIT_TASK_STACK_SIZE 6144
+#define NETWORK_INIT_TASK_PRIORITY 1
+#define NETWORK_INIT_TASK_CORE 0
+
+// Memory telemetry (/telemetry), sampled from the web task
+#define TELEMETRY_SAMPLE_INTERVAL_MS 5000
+#define TELEMETRY_HISTORY_SIZE 48  // 4 minutes of samples
+#define TELEMETRY_MAX_TASKS 4      // loop, web, netinit and one spare
+
+// Live telemetry push (/events, Server-Sent Events)
+#define EVENT_STREAM_MAX_CLIENTS 3
+#define EVENT_STREAM_DEFAULT_HZ 10      // Frame rate when the client doesn't ask (?hz=)
+#define EVENT_STREAM_MAX_HZ 30
+#define EVENT_STREAM_KEEPALIVE_MS 15000 // Comment frame when nothing has changed
+#define EVENT_STREAM_STALL_MS 5000      // Drop a client that can't take data for this long
+
 // ESP-NOW Master-Slave configuration
 #define DEVICE_ROLE_MASTER 1
 #define DEVICE_ROLE_SLAVE 2
-#define MAX_SLAVE_DEVICES 5
+#define MAX_SLAVE_DEVICES 19  // ESP-NOW allows 20 peers; the master also registers the broadcast peer
+#define LEGACY_MAX_SLAVE_DEVICES 5  // Slave list size before the versioned peer table
 #define DEFAULT_DEVICE_ROLE DEVICE_ROLE_MASTER
 
 // ESP-NOW improvements
 #define ESPNOW_CHANNEL 1
 #define ESPNOW_RETRY_COUNT 3
 #define ESPNOW_TIMEOUT_MS 5000
+#define SCENE_BROADCAST_INTERVAL_MS ANIMATION_INTERVAL_MS // A changed scene goes out at most once per frame
+#define SCENE_KEEPALIVE_MS 1000  // An unchanged scene is repeated so slaves keep following it
 #define AMBISENSE_DEVICE_PREFIX "AmbiSense"
+#define FIRMWARE_VERSION "4.3.0"
 #define CONNECTION_HEALTH_TIMEOUT 10000
 
+// ESP-NOW discovery: the master broadcasts probes, every device in range answers
+// with an announce on the same channel
+#define ESPNOW_DISCOVERY_DURATION_MS 1000      // Probing window started by a scan
+#define ESPNOW_DISCOVERY_PROBE_INTERVAL_MS 300 // Broadcasts aren't acknowledged - repeat the probe
+#define ESPNOW_DISCOVERY_MAX_PEERS (MAX_SLAVE_DEVICES + 1)
+#define ESPNOW_DISCOVERY_PEER_TIMEOUT_MS 60000 // Forget devices not heard from for this long
+#define ESPNOW_ANNOUNCE_MAX_JITTER_MS 50       // Spread answers so they don't collide
+
+// Receive-side fault injection for bench testing health checks and sensor handoff
+// (loss, duplication and reordering are set at runtime via /setFaultInjection)
+#define ENABLE_ESPNOW_FAULT_INJECTION false
+
 // Sensor priority modes
 #define SENSOR_PRIORITY_MOST_RECENT 0
 #define SENSOR_PRIORITY_SLAVE_FIRST 1  
 #define SENSOR_PRIORITY_MASTER_FIRST 2
 #define SENSOR_PRIORITY_ZONE_BASED 3
+#define SENSOR_PRIORITY_FUSION 4
+
+// Sensor fusion (SENSOR_PRIORITY_FUSION)
+#define FUSION_STALE_MS 1500           // Readings fade out of the fused position over this time
+#define FUSION_MIN_ENERGY_WEIGHT 0.05f // Weight floor for readings without radar energy
+#define FUSION_TRACKER_ALPHA 0.35f     // Position gain of the alpha-beta tracker
+#define FUSION_TRACKER_BETA 0.05f      // Velocity gain of the alpha-beta tracker
 
 // Default setting
 #define DEFAULT_SENSOR_PRIORITY_MODE SENSOR_PRIORITY_ZONE_BASED
@@ -130,12 +248,17 @@ extern float positionPGain;
 extern float positionIGain;
 extern int effectSpeed;
 extern int effectIntensity;
+extern int colorPalette;
+extern int powerBudgetMa;
+extern int backgroundLayer;
+extern int transitionMs;
 
 // LED Distribution globals - declared as extern since they're defined in AmbiSense.ino
 extern int ledSegmentMode;
 extern int ledSegmentStart;
 extern int ledSegmentLength;
 extern int totalSystemLeds;
+extern bool ledSegmentReversed;  // Set from the segment map, not stored on its own
 
 // ESP-NOW global variables
 extern uint8_t deviceRole;  // Master or slave role
@@ -144,7 +267,14 @@ extern uint8_t slaveAddresses[MAX_SLAVE_DEVICES][6];  // MAC addresses of slave
 extern uint8_t numSlaveDevices;  // Number of paired slave devices
 extern uint8_t sensorPriorityMode;  // How to prioritize sensors
 
-// EEPROM memory layout - explicitly define segments to avoid conflicts
+// Boot milestones in ms since start (0 = not reached yet)
+extern unsigned long bootLedsReadyMs;     // Strip and radar initialized from stored settings
+extern unsigned long bootFirstLightMs;    // First rendered frame shown
+extern unsigned long bootNetworkReadyMs;  // WiFi, ESP-NOW and web server up
+extern volatile bool networkReady;
+
+// EEPROM memory layout. Settings now live in the settings store; this layout
+// is only read to migrate them once. WiFi credentials are still kept here.
 // System settings section (0-19)
 #define EEPROM_SYSTEM_START    0
 #define EEPROM_ADDR_MARKER     (EEPROM_SYSTEM_START + 0)
@@ -190,7 +320,7 @@ extern uint8_t sensorPriorityMode;  // How to prioritize sensors
 #define EEPROM_ESPNOW_START     70
 #define EEPROM_ADDR_DEVICE_ROLE    (EEPROM_ESPNOW_START + 0)  // 1 byte
 #define EEPROM_ADDR_MASTER_MAC     (EEPROM_ESPNOW_START + 1)  // 6 bytes
-#define EEPROM_ADDR_PAIRED_SLAVES  (EEPROM_ESPNOW_START + 7)  // 1 byte for count + 6*MAX_SLAVES bytes
+#define EEPROM_ADDR_LEGACY_PAIRED_SLAVES (EEPROM_ESPNOW_START + 7)  // Old slave list (count + 6*5 bytes), migrated on load
 #define EEPROM_ADDR_SENSOR_PRIORITY_MODE (EEPROM_ESPNOW_START + 50)  // 1 byte
 
 // WiFi credentials section (100-299)
@@ -213,4 +343,27 @@ extern uint8_t sensorPriorityMode;  // How to prioritize sensors
 #define EEPROM_ADDR_TOTAL_SYSTEM_LEDS_L  (EEPROM_LED_DIST_START + 5)
 #define EEPROM_ADDR_TOTAL_SYSTEM_LEDS_H  (EEPROM_LED_DIST_START + 6)
 
+// LED segment map section (320-559) - one entry per device, own CRC byte
+#define EEPROM_SEGMENT_MAP_START         320
+#define EEPROM_ADDR_SEGMENT_MAP_CRC      (EEPROM_SEGMENT_MAP_START + 0)
+#define EEPROM_ADDR_SEGMENT_MAP_COUNT    (EEPROM_SEGMENT_MAP_START + 1)
+#define EEPROM_ADDR_SEGMENT_MAP_TOTAL_L  (EEPROM_SEGMENT_MAP_START + 2)
+#define EEPROM_ADDR_SEGMENT_MAP_TOTAL_H  (EEPROM_SEGMENT_MAP_START + 3)
+#define EEPROM_ADDR_SEGMENT_MAP_ENTRIES  (EEPROM_SEGMENT_MAP_START + 4)  // MAC(6) start(2) length(2) flags(1)
+#define EEPROM_SEGMENT_MAP_ENTRY_SIZE    11
+
+// Sensor geometry section (560-629) - stair position of each sensor, own CRC byte
+#define EEPROM_SENSOR_GEOMETRY_START     560
+#define EEPROM_ADDR_SENSOR_GEOMETRY_CRC  (EEPROM_SENSOR_GEOMETRY_START + 0)
+#define EEPROM_ADDR_SENSOR_GEOMETRY      (EEPROM_SENSOR_GEOMETRY_START + 1)  // offset(2) orientation(1) per sensor
+#define EEPROM_SENSOR_GEOMETRY_ENTRY_SIZE 3
+
+// Paired slave table (630-759) - versioned record with its own CRC byte
+#define EEPROM_PEER_TABLE_START          630
+#define EEPROM_ADDR_PEER_TABLE_VERSION   (EEPROM_PEER_TABLE_START + 0)
+#define EEPROM_ADDR_PEER_TABLE_COUNT     (EEPROM_PEER_TABLE_START + 1)
+#define EEPROM_ADDR_PEER_TABLE_CRC       (EEPROM_PEER_TABLE_START + 2)
+#define EEPROM_ADDR_PEER_TABLE_MACS      (EEPROM_PEER_TABLE_START + 3)  // 6 bytes per slave
+#define EEPROM_PEER_TABLE_VERSION        1
+
 #endif // CONFIG_H
\ No newline at end of file
@@ -2,7 +2,11 @@
 #include <Arduino.h>
 #include "config.h"
 #include "eeprom_manager.h"
+#include "settings_store.h"
+#include "settings_schema.h"
 #include "led_controller.h"
+#include "espnow_manager.h"
+#include "palette.h"
 
 // 📌 Global Variables (defined in main file, declared in config.h)
 int minDistance, maxDistance, brightness, movingLightSpan, numLeds;
@@ -17,6 +21,10 @@ bool backgroundMode;
 int lightMode;
 int effectSpeed = DEFAULT_EFFECT_SPEED;
 int effectIntensity = DEFAULT_EFFECT_INTENSITY;
+int colorPalette = DEFAULT_PALETTE;
+int powerBudgetMa = DEFAULT_POWER_BUDGET_MA;
+int backgroundLayer = DEFAULT_BACKGROUND_LAYER;
+int transitionMs = DEFAULT_TRANSITION_MS;
 
 // Motion smoothing settings
 bool motionSmoothingEnabled = DEFAULT_MOTION_SMOOTHING_ENABLED;
@@ -29,9 +37,594 @@ float positionIGain = DEFAULT_POSITION_I_GAIN;
 // LED Distribution settings - these are declared extern since they're defined in AmbiSense.ino
 // Remove the definitions here to avoid multiple definition errors
 
+// Deferred save requested by scheduleSettingsSave()
+static uint16_t pendingSaveSections = 0;
+static unsigned long settingsSaveRequestTime = 0;
+static SettingsSaveStats saveStats = {};
+
+// One record per section, in SETTINGS_SECTION_* bit order. Bump a version
+// whenever that record's layout changes; older records then read as missing
+// and the section falls back to its defaults.
+struct SettingsSection {
+  const char* key;
+  uint8_t version;
+};
+
+static const SettingsSection settingsSections[SETTINGS_SECTION_COUNT] = {
+  {"system",   1},
+  {"advanced", 1},
+  {"motion",   1},
+  {"espnow",   1},
+  {"peers",    1},
+  {"leddist",  1},
+  {"segmap",   1},
+  {"geometry", 1},
+  {"render",   4},
+};
+
+// Written once the store holds a complete set of settings; until then the
+// old EEPROM layout is migrated on every boot
+#define SETTINGS_COMPLETE_KEY "complete"
+#define SETTINGS_WEAR_KEY     "wear"
+
+// Stored form of each section - fixed-width fields, independent of the globals' types
+struct SystemRecord {
+  int16_t minDistance;
+  int16_t maxDistance;
+  uint16_t numLeds;
+  uint16_t movingLightSpan;
+  uint8_t brightness;
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+};
+
+struct AdvancedRecord {
+  int16_t centerShift;
+  uint8_t trailLength;
+  uint8_t directionLight;
+  uint8_t backgroundMode;
+  uint8_t lightMode;
+  uint8_t effectSpeed;
+  uint8_t effectIntensity;
+};
+
+struct MotionRecord {
+  float positionSmoothingFactor;
+  float velocitySmoothingFactor;
+  float predictionFactor;
+  float positionPGain;
+  float positionIGain;
+  uint8_t enabled;
+};
+
+struct EspnowRecord {
+  uint8_t deviceRole;
+  uint8_t sensorPriorityMode;
+  uint8_t masterAddress[6];
+};
+
+struct PeerTableRecord {
+  uint8_t count;
+  uint8_t addresses[MAX_SLAVE_DEVICES][6];
+};
+
+struct LEDDistributionRecord {
+  uint16_t start;
+  uint16_t length;
+  uint16_t totalLeds;
+  uint8_t mode;
+};
+
+struct RenderRecord {
+  uint8_t palette;
+  CustomPalette customPalette;
+  uint32_t powerBudgetMa;
+  uint8_t backgroundLayer;
+  uint16_t transitionMs;
+};
+
+static_assert(sizeof(PeerTableRecord) <= SETTINGS_STORE_MAX_RECORD_SIZE, "Peer table record too large");
+static_assert(sizeof(segment_map_t) <= SETTINGS_STORE_MAX_RECORD_SIZE, "Segment map record too large");
+static_assert(sizeof(sensorGeometry) <= SETTINGS_STORE_MAX_RECORD_SIZE, "Sensor geometry record too large");
+
+static bool commitSettingsSections(uint16_t sections);
+static void migrateLegacySettings();
+
+// Copy one section from the store into the globals
+static bool loadSection(int index) {
+  const SettingsSection& section = settingsSections[index];
+  
+  switch (1 << index) {
+    case SETTINGS_SECTION_SYSTEM: {
+      SystemRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record))) return false;
+      minDistance = record.minDistance;
+      maxDistance = record.maxDistance;
+      numLeds = record.numLeds;
+      movingLightSpan = record.movingLightSpan;
+      brightness = record.brightness;
+      redValue = record.red;
+      greenValue = record.green;
+      blueValue = record.blue;
+      return true;
+    }
+    case SETTINGS_SECTION_ADVANCED: {
+      AdvancedRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record))) return false;
+      centerShift = record.centerShift;
+      trailLength = record.trailLength;
+      directionLightEnabled = record.directionLight != 0;
+      backgroundMode = record.backgroundMode != 0;
+      lightMode = record.lightMode;
+      effectSpeed = record.effectSpeed;
+      effectIntensity = record.effectIntensity;
+      return true;
+    }
+    case SETTINGS_SECTION_MOTION: {
+      MotionRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record))) return false;
+      positionSmoothingFactor = record.positionSmoothingFactor;
+      velocitySmoothingFactor = record.velocitySmoothingFactor;
+      predictionFactor = record.predictionFactor;
+      positionPGain = record.positionPGain;
+      positionIGain = record.positionIGain;
+      motionSmoothingEnabled = record.enabled != 0;
+      return true;
+    }
+    case SETTINGS_SECTION_ESPNOW: {
+      EspnowRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record))) return false;
+      deviceRole = record.deviceRole;
+      if (deviceRole != DEVICE_ROLE_MASTER && deviceRole != DEVICE_ROLE_SLAVE) {
+        deviceRole = DEFAULT_DEVICE_ROLE;
+      }
+      sensorPriorityMode = record.sensorPriorityMode;
+      if (sensorPriorityMode > SENSOR_PRIORITY_FUSION) {
+        sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
+      }
+      memcpy(masterAddress, record.masterAddress, 6);
+      return true;
+    }
+    case SETTINGS_SECTION_PEER_TABLE: {
+      PeerTableRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record)) ||
+          record.count > MAX_SLAVE_DEVICES) {
+        return false;
+      }
+      numSlaveDevices = record.count;
+      memcpy(slaveAddresses, record.addresses, sizeof(record.addresses));
+      return true;
+    }
+    case SETTINGS_SECTION_LED_DISTRIBUTION: {
+      LEDDistributionRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record))) return false;
+      ledSegmentMode = record.mode;
+      if (ledSegmentMode != LED_SEGMENT_MODE_CONTINUOUS && 
+          ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED) {
+        ledSegmentMode = LED_SEGMENT_MODE_CONTINUOUS;
+      }
+      ledSegmentStart = record.start;
+      ledSegmentLength = record.length;
+      totalSystemLeds = record.totalLeds;
+      validateLEDDistributionSettings();
+      return true;
+    }
+    case SETTINGS_SECTION_SEGMENT_MAP: {
+      segment_map_t map;
+      if (!settingsStoreRead(section.key, section.version, &map, sizeof(map)) ||
+          map.count > MAX_SEGMENT_MAP_ENTRIES || !validateSegmentMap(map)) {
+        return false;
+      }
+      map.packetType = ESPNOW_PACKET_SEGMENT_MAP;
+      ledSegmentMap = map;
+      return true;
+    }
+    case SETTINGS_SECTION_SENSOR_GEOMETRY: {
+      sensor_geometry_t geometry[MAX_SLAVE_DEVICES + 1];
+      if (!settingsStoreRead(section.key, section.version, geometry, sizeof(geometry))) return false;
+      for (int s = 0; s <= MAX_SLAVE_DEVICES; s++) {
+        sensorGeometry[s].offset = geometry[s].offset;
+        sensorGeometry[s].orientation = (geometry[s].orientation < 0) ? -1 : 1;
+      }
+      return true;
+    }
+    case SETTINGS_SECTION_RENDER: {
+      RenderRecord record;
+      if (!settingsStoreRead(section.key, section.version, &record, sizeof(record)) ||
+          !setCustomPalette(record.customPalette.stops, record.customPalette.count)) {
+        return false;
+      }
+      colorPalette = record.palette;
+      powerBudgetMa = record.powerBudgetMa;
+      backgroundLayer = record.backgroundLayer;
+      transitionMs = record.transitionMs;
+      return true;
+    }
+  }
+  
+  return false;
+}
+
+// Write one section from the globals to the store
+static SettingsStoreResult storeSection(int index) {
+  const SettingsSection& section = settingsSections[index];
+  
+  switch (1 << index) {
+    case SETTINGS_SECTION_SYSTEM: {
+      // Ensure min is always less than max with clear debugging
+      if (minDistance >= maxDistance) {
+        Serial.printf("WARNING: Invalid min/max detected before save: %d/%d\n", minDistance, maxDistance);
+        minDistance = DEFAULT_MIN_DISTANCE;
+        maxDistance = DEFAULT_MAX_DISTANCE;
+      }
+      
+      SystemRecord record = {};
+      record.minDistance = minDistance;
+      record.maxDistance = maxDistance;
+      record.numLeds = numLeds;
+      record.movingLightSpan = movingLightSpan;
+      record.brightness = brightness;
+      record.red = redValue;
+      record.green = greenValue;
+      record.blue = blueValue;
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_ADVANCED: {
+      AdvancedRecord record = {};
+      record.centerShift = centerShift;
+      record.trailLength = trailLength;
+      record.directionLight = directionLightEnabled ? 1 : 0;
+      record.backgroundMode = backgroundMode ? 1 : 0;
+      record.lightMode = lightMode;
+      record.effectSpeed = effectSpeed;
+      record.effectIntensity = effectIntensity;
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_MOTION: {
+      MotionRecord record = {};
+      record.positionSmoothingFactor = positionSmoothingFactor;
+      record.velocitySmoothingFactor = velocitySmoothingFactor;
+      record.predictionFactor = predictionFactor;
+      record.positionPGain = positionPGain;
+      record.positionIGain = positionIGain;
+      record.enabled = motionSmoothingEnabled ? 1 : 0;
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_ESPNOW: {
+      EspnowRecord record = {};
+      record.deviceRole = deviceRole;
+      record.sensorPriorityMode = sensorPriorityMode;
+      memcpy(record.masterAddress, masterAddress, 6);
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_PEER_TABLE: {
+      // Unused slots are zeroed so stale addresses don't change the CRC
+      PeerTableRecord record = {};
+      record.count = numSlaveDevices;
+      memcpy(record.addresses, slaveAddresses, numSlaveDevices * 6);
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_LED_DISTRIBUTION: {
+      LEDDistributionRecord record = {};
+      record.start = ledSegmentStart;
+      record.length = ledSegmentLength;
+      record.totalLeds = totalSystemLeds;
+      record.mode = ledSegmentMode;
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+    case SETTINGS_SECTION_SEGMENT_MAP:
+      return settingsStoreWrite(section.key, section.version, &ledSegmentMap, sizeof(ledSegmentMap));
+    case SETTINGS_SECTION_SENSOR_GEOMETRY:
+      return settingsStoreWrite(section.key, section.version, sensorGeometry, sizeof(sensorGeometry));
+    case SETTINGS_SECTION_RENDER: {
+      RenderRecord record = {};
+      record.palette = colorPalette;
+      record.customPalette = getCustomPalette();
+      record.powerBudgetMa = powerBudgetMa;
+      record.backgroundLayer = backgroundLayer;
+      record.transitionMs = transitionMs;
+      return settingsStoreWrite(section.key, section.version, &record, sizeof(record));
+    }
+  }
+  
+  return SETTINGS_STORE_FAILED;
+}
+
+// Defaults for a section whose record is missing or damaged
+static void resetSection(int index) {
+  switch (1 << index) {
+    case SETTINGS_SECTION_SYSTEM:           resetSystemSettings(); break;
+    case SETTINGS_SECTION_ADVANCED:         resetAdvancedSettings(); break;
+    case SETTINGS_SECTION_MOTION:           resetMotionSettings(); break;
+    case SETTINGS_SECTION_ESPNOW:           resetEspnowSettings(); break;
+    case SETTINGS_SECTION_PEER_TABLE:       numSlaveDevices = 0; break;
+    case SETTINGS_SECTION_LED_DISTRIBUTION: resetLEDDistributionSettings(); break;
+    case SETTINGS_SECTION_SEGMENT_MAP:      resetSegmentMapSettings(); break;
+    case SETTINGS_SECTION_SENSOR_GEOMETRY:  resetSensorGeometrySettings(); break;
+    case SETTINGS_SECTION_RENDER:           resetRenderSettings(); break;
+  }
+}
+
+void setupEEPROM() {
+  Serial.println("Initializing settings store...");
+  
+  if (!settingsStoreBegin()) {
+    // Run with what the old layout holds; changes won't survive a restart
+    Serial.println("ERROR: Settings store unavailable! Settings will not be saved.");
+    migrateLegacySettings();
+    return;
+  }
+  
+  settingsStoreRead(SETTINGS_WEAR_KEY, 1, &saveStats.lifetimeWrites, sizeof(saveStats.lifetimeWrites));
+  
+  if (!settingsStoreContains(SETTINGS_COMPLETE_KEY)) {
+    migrateLegacySettings();
+    return;
+  }
+  
+  // One keyed lookup per section. The ESP-NOW section is read before the
+  // peer table, so a damaged ESP-NOW record can't clear a good peer list.
+  uint16_t damagedSections = 0;
+  for (int i = 0; i < SETTINGS_SECTION_COUNT; i++) {
+    if (!loadSection(i)) {
+      Serial.printf("WARNING: %s settings missing or corrupted! Using defaults.\n", settingsSections[i].key);
+      resetSection(i);
+      damagedSections |= 1 << i;
+    }
+  }
+  
+  // Perform final validation of key values
+  validateAllSettings();
+  
+  // Store the restored defaults so the warning isn't repeated on every boot
+  if (damagedSections != 0) {
+    commitSettingsSections(damagedSections);
+  }
+  
+  Serial.println("Settings loaded");
+}
+
+void validateLEDDistributionSettings() {
+  if (ledSegmentStart < 0 || ledSegmentStart > MAX_SUPPORTED_LEDS) {
+    ledSegmentStart = 0;
+  }
+  
+  if (ledSegmentLength < 1 || ledSegmentLength > MAX_SUPPORTED_LEDS) {
+    ledSegmentLength = numLeds;
+  }
+  
+  if (totalSystemLeds < 1 || totalSystemLeds > MAX_SUPPORTED_LEDS) {
+    totalSystemLeds = numLeds;
+  }
+}
+
+void saveSettings() {
+  Serial.println("Saving settings...");
+  
+  // Validate critical settings before saving
+  validateAllSettings();
+  
+  // Every section is written, so this covers anything that was scheduled
+  pendingSaveSections = 0;
+  if (commitSettingsSections(SETTINGS_SECTION_ALL)) {
+    // A full set is stored; the old EEPROM layout is never needed again
+    uint8_t complete = 1;
+    settingsStoreWrite(SETTINGS_COMPLETE_KEY, 1, &complete, sizeof(complete));
+  }
+}
+
+void scheduleSettingsSave(uint16_t sections) {
+  if (pendingSaveSections != 0) {
+    saveStats.coalescedChanges++;
+  }
+  
+  // Each new change restarts the quiet period
+  pendingSaveSections |= sections;
+  settingsSaveRequestTime = millis();
+}
+
+void processSettingsSave() {
+  if (pendingSaveSections != 0 && millis() - settingsSaveRequestTime >= SETTINGS_SAVE_DELAY_MS) {
+    flushSettingsSave();
+  }
+}
+
+void flushSettingsSave() {
+  if (pendingSaveSections == 0) return;
+  
+  uint16_t sections = pendingSaveSections;
+  pendingSaveSections = 0;
+  
+  if (ENABLE_DEBUG_LOGGING) {
+    Serial.printf("Saving changed settings sections (0x%03X)\n", sections);
+  }
+  
+  validateAllSettings();
+  commitSettingsSections(sections);
+}
+
+uint16_t getPendingSettingsSections() {
+  return pendingSaveSections;
+}
+
+const SettingsSaveStats& getSettingsSaveStats() {
+  return saveStats;
+}
+
+// Store the given sections. Records whose contents haven't changed cost no
+// flash write. Returns false if any record could not be written.
+static bool commitSettingsSections(uint16_t sections) {
+  bool allStored = true;
+  uint32_t written = 0;
+  
+  for (int i = 0; i < SETTINGS_SECTION_COUNT; i++) {
+    if (!(sections & (1 << i))) continue;
+    
+    switch (storeSection(i)) {
+      case SETTINGS_STORE_WRITTEN:
+        saveStats.writes++;
+        saveStats.sectionWrites[i]++;
+        written++;
+        break;
+      case SETTINGS_STORE_UNCHANGED:
+        saveStats.skippedWrites++;
+        break;
+      default:
+        Serial.printf("ERROR: Failed to save %s settings!\n", settingsSections[i].key);
+        allStored = false;
+        break;
+    }
+  }
+  
+  if (written > 0) {
+    saveStats.lifetimeWrites += written;
+    settingsStoreWrite(SETTINGS_WEAR_KEY, 1, &saveStats.lifetimeWrites, sizeof(saveStats.lifetimeWrites));
+    
+    if (ENABLE_DEBUG_LOGGING) {
+      Serial.printf("Settings saved: %u records written\n", (unsigned)written);
+    }
+  }
+  
+  return allStored;
+}
+
+bool saveSystemSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_SYSTEM);
+}
+
+bool saveAdvancedSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_ADVANCED);
+}
+
+bool saveMotionSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_MOTION);
+}
+
+bool saveEspnowSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_ESPNOW | SETTINGS_SECTION_PEER_TABLE);
+}
+
+bool saveSlavePeerTable() {
+  return commitSettingsSections(SETTINGS_SECTION_PEER_TABLE);
+}
+
+bool saveLEDDistributionSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_LED_DISTRIBUTION);
+}
+
+bool saveSegmentMapSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_SEGMENT_MAP);
+}
+
+bool saveSensorGeometrySettings() {
+  return commitSettingsSections(SETTINGS_SECTION_SENSOR_GEOMETRY);
+}
+
+bool saveRenderSettings() {
+  return commitSettingsSections(SETTINGS_SECTION_RENDER);
+}
+
+void resetAllSettings() {
+  // Reset all settings to defaults
+  resetSystemSettings();
+  resetAdvancedSettings();
+  resetMotionSettings();
+  resetEspnowSettings();
+  resetLEDDistributionSettings();
+  resetSegmentMapSettings();
+  resetSensorGeometrySettings();
+  resetRenderSettings();
+  
+  // Store the defaults
+  saveSettings();
+}
+
+void resetSystemSettings() {
+  minDistance = DEFAULT_MIN_DISTANCE;
+  maxDistance = DEFAULT_MAX_DISTANCE;
+  brightness = DEFAULT_BRIGHTNESS;
+  movingLightSpan = DEFAULT_MOVING_LIGHT_SPAN;
+  redValue = DEFAULT_RED;
+  greenValue = DEFAULT_GREEN;
+  blueValue = DEFAULT_BLUE;
+  numLeds = DEFAULT_NUM_LEDS;
+}
+
+void resetAdvancedSettings() {
+  centerShift = DEFAULT_CENTER_SHIFT;
+  trailLength = DEFAULT_TRAIL_LENGTH;
+  directionLightEnabled = DEFAULT_DIRECTION_LIGHT;
+  backgroundMode = DEFAULT_BACKGROUND_MODE;
+  lightMode = DEFAULT_LIGHT_MODE;
+  effectSpeed = DEFAULT_EFFECT_SPEED;
+  effectIntensity = DEFAULT_EFFECT_INTENSITY;
+}
+
+void resetMotionSettings() {
+  motionSmoothingEnabled = DEFAULT_MOTION_SMOOTHING_ENABLED;
+  positionSmoothingFactor = DEFAULT_POSITION_SMOOTHING_FACTOR;
+  velocitySmoothingFactor = DEFAULT_VELOCITY_SMOOTHING_FACTOR;
+  predictionFactor = DEFAULT_PREDICTION_FACTOR;
+  positionPGain = DEFAULT_POSITION_P_GAIN;
+  positionIGain = DEFAULT_POSITION_I_GAIN;
+}
+
+void resetEspnowSettings() {
+  deviceRole = DEFAULT_DEVICE_ROLE;
+  sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
+  
+  // Clear master address
+  for (int i = 0; i < 6; i++) {
+    masterAddress[i] = 0;
+  }
+  
+  // Clear slave addresses
+  numSlaveDevices = 0;
+  for (int s = 0; s < MAX_SLAVE_DEVICES; s++) {
+    for (int i = 0; i < 6; i++) {
+      slaveAddresses[s][i] = 0;
+    }
+  }
+}
+
+void resetLEDDistributionSettings() {
+  ledSegmentMode = DEFAULT_LED_SEGMENT_MODE;
+  ledSegmentStart = DEFAULT_LED_SEGMENT_START;
+  ledSegmentLength = DEFAULT_LED_SEGMENT_LENGTH;
+  totalSystemLeds = DEFAULT_TOTAL_SYSTEM_LEDS;
+  ledSegmentReversed = false;
+}
+
+void resetSensorGeometrySettings() {
+  // Every sensor looks along the path from its start, like a single-sensor install
+  for (int s = 0; s <= MAX_SLAVE_DEVICES; s++) {
+    sensorGeometry[s].offset = 0;
+    sensorGeometry[s].orientation = 1;
+  }
+}
+
+void resetRenderSettings() {
+  colorPalette = DEFAULT_PALETTE;
+  resetCustomPalette();
+  powerBudgetMa = DEFAULT_POWER_BUDGET_MA;
+  backgroundLayer = DEFAULT_BACKGROUND_LAYER;
+  transitionMs = DEFAULT_TRANSITION_MS;
+}
+
+void resetSegmentMapSettings() {
+  memset(&ledSegmentMap, 0, sizeof(ledSegmentMap));
+  ledSegmentMap.packetType = ESPNOW_PACKET_SEGMENT_MAP;
+}
+
+// ---------------------------------------------------------------------------
+// Old EEPROM layout. Only read, once, to carry an existing install's settings
+// over to the record store. The EEPROM copy is never modified, so a migration
+// cut short by a power loss simply runs again on the next boot.
+// ---------------------------------------------------------------------------
+
 // Magic marker for EEPROM validation
 #define EEPROM_MAGIC_MARKER 0xA55A
-#define EEPROM_DATA_VERSION 1
 
 // EEPROM Header structure for validation
 struct EEPROMHeader {
@@ -45,131 +638,135 @@ struct EEPROMHeader {
   uint8_t  reserved[1];     // Reserved for future use
 };
 
-// Additional validation function for critical settings
-void validateCriticalSettings() {
-  bool settingsChanged = false;
-  
-  // Check for invalid min/max distance values (most critical for UI)
-  if (minDistance < 0 || minDistance > 500 || maxDistance < 50 || maxDistance > 1000 || minDistance >= maxDistance) {
-    Serial.println("CRITICAL: Invalid min/max distance values detected, restoring defaults");
-    minDistance = DEFAULT_MIN_DISTANCE;
-    maxDistance = DEFAULT_MAX_DISTANCE;
-    settingsChanged = true;
-  }
-  
-  // Check for invalid LED count
-  if (numLeds <= 0 || numLeds > 2000) {
-    Serial.println("CRITICAL: Invalid LED count detected, restoring default");
-    numLeds = DEFAULT_NUM_LEDS;
-    settingsChanged = true;
-  }
-  
-  // Save if changes were made
-  if (settingsChanged) {
-    // Only update the affected fields
-    EEPROM.write(EEPROM_ADDR_MIN_DIST_L, minDistance & 0xFF);
-    EEPROM.write(EEPROM_ADDR_MIN_DIST_H, (minDistance >> 8) & 0xFF);
-    EEPROM.write(EEPROM_ADDR_MAX_DIST_L, maxDistance & 0xFF);
-    EEPROM.write(EEPROM_ADDR_MAX_DIST_H, (maxDistance >> 8) & 0xFF);
-    EEPROM.write(EEPROM_ADDR_NUM_LEDS_L, numLeds & 0xFF);
-    EEPROM.write(EEPROM_ADDR_NUM_LEDS_H, (numLeds >> 8) & 0xFF);
-    
-    // Recalculate and update CRC
-    EEPROM.write(EEPROM_ADDR_CRC, calculateSystemCRC());
-    
-    // Commit changes
-    EEPROM.commit();
-    
-    // Log the corrected values
-    Serial.printf("Corrected settings - Min: %d, Max: %d, LEDs: %d\n", 
-                 minDistance, maxDistance, numLeds);
+// Section checksums of the EEPROM layout
+static uint8_t calculateSystemCRC() {
+  uint8_t crc = 0;
+  
+  for (int i = EEPROM_SYSTEM_START; i < EEPROM_ADVANCED_START; i++) {
+    if (i != EEPROM_ADDR_MARKER) { // Skip marker address for CRC calculation
+      crc ^= EEPROM.read(i);
+    }
   }
+  
+  return crc;
 }
 
-void setupEEPROM() {
-  Serial.println("Initializing EEPROM...");
+static uint8_t calculateAdvancedCRC() {
+  uint8_t crc = 0;
   
-  // Initialize EEPROM with specified size
-  if (!EEPROM.begin(EEPROM_SIZE)) {
-    Serial.println("ERROR: Failed to initialize EEPROM!");
-    delay(1000);
-    return;
+  for (int i = EEPROM_ADVANCED_START; i < EEPROM_MOTION_START; i++) {
+    crc ^= EEPROM.read(i);
   }
   
-  // Read header
-  EEPROMHeader header;
-  EEPROM.get(0, header);
+  return crc;
+}
+
+static uint8_t calculateMotionCRC() {
+  uint8_t crc = 0;
   
-  // Check if header is valid
-  if (header.magicMarker != EEPROM_MAGIC_MARKER) {
-    Serial.println("First time initialization or corrupted EEPROM. Setting up with defaults.");
-    
-    // Initialize header with magic marker
-    header.magicMarker = EEPROM_MAGIC_MARKER;
-    header.dataVersion = EEPROM_DATA_VERSION;
-    
-    // Set defaults for all settings
-    resetSystemSettings();
-    resetAdvancedSettings();
-    resetMotionSettings();
-    resetEspnowSettings();
-    resetLEDDistributionSettings();
-    
-    // Save all settings and update CRCs
-    saveSettings();
-    
-    // Write the header
-    EEPROM.put(0, header);
-    EEPROM.commit();
-    
-    Serial.println("EEPROM initialized with defaults");
-    return;
+  for (int i = EEPROM_MOTION_START; i < EEPROM_ESPNOW_START; i++) {
+    crc ^= EEPROM.read(i);
   }
   
-  // Check individual section CRCs
-  bool systemValid = (header.systemSettings == calculateSystemCRC());
-  bool advancedValid = (header.advancedSettings == calculateAdvancedCRC());
-  bool motionValid = (header.motionSettings == calculateMotionCRC());
-  bool espnowValid = (header.espnowSettings == calculateEspnowCRC());
-  bool ledDistValid = (header.ledDistSettings == calculateLEDDistributionCRC());
+  return crc;
+}
+
+static uint8_t calculateEspnowCRC() {
+  uint8_t crc = 0;
   
-  if (!systemValid || !advancedValid || !motionValid || !espnowValid || !ledDistValid) {
-    Serial.println("CRC mismatch detected in one or more sections");
-    Serial.printf("System: %d, Advanced: %d, Motion: %d, ESPNOW: %d, LEDDist: %d\n", 
-                 systemValid, advancedValid, motionValid, espnowValid, ledDistValid);
+  for (int i = EEPROM_ESPNOW_START; i < EEPROM_WIFI_START; i++) {
+    crc ^= EEPROM.read(i);
   }
   
-  // Load settings with corruption detection per section
-  loadSettings(systemValid, advancedValid, motionValid, espnowValid);
+  return crc;
+}
+
+static uint8_t calculateLEDDistributionCRC() {
+  uint8_t crc = 0;
   
-  // Load LED distribution settings separately
-  if (ledDistValid) {
-    loadLEDDistributionSettings();
-  } else {
-    Serial.println("WARNING: LED distribution settings corrupted! Using defaults.");
-    resetLEDDistributionSettings();
+  for (int i = EEPROM_LED_DIST_START; i < EEPROM_LED_DIST_START + 7; i++) {
+    crc ^= EEPROM.read(i);
   }
   
-  // If any section was corrupted, save the restored values
-  if (!systemValid || !advancedValid || !motionValid || !espnowValid || !ledDistValid) {
-    Serial.println("Saving restored values for corrupted sections");
-    saveSettings();
+  return crc;
+}
+
+static uint8_t calculatePeerTableCRC() {
+  // Seeded so a blank (all-zero) section does not pass as valid data
+  uint8_t crc = 0x5A;
+  
+  int count = min((int)EEPROM.read(EEPROM_ADDR_PEER_TABLE_COUNT), MAX_SLAVE_DEVICES);
+  int end = EEPROM_ADDR_PEER_TABLE_MACS + (count * 6);
+  
+  crc ^= EEPROM.read(EEPROM_ADDR_PEER_TABLE_VERSION);
+  for (int i = EEPROM_ADDR_PEER_TABLE_COUNT; i < end; i++) {
+    if (i != EEPROM_ADDR_PEER_TABLE_CRC) {
+      crc ^= EEPROM.read(i);
+    }
   }
   
-  // Perform final validation of key values
-  validateAllSettings();
+  return crc;
+}
+
+static uint8_t calculateSensorGeometryCRC() {
+  // Seeded so a blank (all-zero) section does not pass as valid data
+  uint8_t crc = 0x5A;
+  
+  int end = EEPROM_ADDR_SENSOR_GEOMETRY + ((MAX_SLAVE_DEVICES + 1) * EEPROM_SENSOR_GEOMETRY_ENTRY_SIZE);
+  for (int i = EEPROM_ADDR_SENSOR_GEOMETRY; i < end; i++) {
+    crc ^= EEPROM.read(i);
+  }
+  
+  return crc;
+}
+
+static uint8_t calculateSegmentMapCRC() {
+  // Seeded so a blank (all-zero) section does not pass as valid data
+  uint8_t crc = 0x5A;
+  
+  int count = min((int)EEPROM.read(EEPROM_ADDR_SEGMENT_MAP_COUNT), MAX_SEGMENT_MAP_ENTRIES);
+  int end = EEPROM_ADDR_SEGMENT_MAP_ENTRIES + (count * EEPROM_SEGMENT_MAP_ENTRY_SIZE);
   
-  Serial.println("EEPROM initialization complete");
+  for (int i = EEPROM_ADDR_SEGMENT_MAP_COUNT; i < end; i++) {
+    crc ^= EEPROM.read(i);
+  }
+  
+  return crc;
 }
 
-// MAINTAIN ORIGINAL FUNCTION SIGNATURES FOR WEB INTERFACE COMPATIBILITY
-void loadSettings() {
-  // Load all sections with full validation
-  loadSettings(true, true, true, true);
-  loadLEDDistributionSettings();
+static void loadLegacySlavePeerTable() {
+  uint8_t version = EEPROM.read(EEPROM_ADDR_PEER_TABLE_VERSION);
+  uint8_t count = EEPROM.read(EEPROM_ADDR_PEER_TABLE_COUNT);
+  
+  if (version == EEPROM_PEER_TABLE_VERSION && count <= MAX_SLAVE_DEVICES &&
+      EEPROM.read(EEPROM_ADDR_PEER_TABLE_CRC) == calculatePeerTableCRC()) {
+    numSlaveDevices = count;
+    for (int s = 0; s < numSlaveDevices; s++) {
+      for (int i = 0; i < 6; i++) {
+        slaveAddresses[s][i] = EEPROM.read(EEPROM_ADDR_PEER_TABLE_MACS + (s * 6) + i);
+      }
+    }
+    return;
+  }
+  
+  // Older firmware kept up to 5 slaves inside the ESP-NOW section
+  uint8_t legacyCount = EEPROM.read(EEPROM_ADDR_LEGACY_PAIRED_SLAVES);
+  if (legacyCount > 0 && legacyCount <= LEGACY_MAX_SLAVE_DEVICES) {
+    numSlaveDevices = legacyCount;
+    for (int s = 0; s < numSlaveDevices; s++) {
+      for (int i = 0; i < 6; i++) {
+        slaveAddresses[s][i] = EEPROM.read(EEPROM_ADDR_LEGACY_PAIRED_SLAVES + 1 + (s * 6) + i);
+      }
+    }
+    
+    Serial.printf("Migrated %d paired slaves from the pre-versioned list\n", numSlaveDevices);
+    return;
+  }
+  
+  numSlaveDevices = 0;
 }
 
-void loadSettings(bool systemValid, bool advancedValid, bool motionValid, bool espnowValid) {
+static void loadLegacySettings(bool systemValid, bool advancedValid, bool motionValid, bool espnowValid) {
   // Load system settings
   if (systemValid) {
     // Read system settings
@@ -202,7 +799,7 @@ void loadSettings(bool systemValid, bool advancedValid, bool motionValid, bool e
   // Load advanced settings
   if (advancedValid) {
     // Read advanced features
-    int16_t loadedCenterShift;
+    int16_t loadedCenterShift = 0;
     EEPROM.get(EEPROM_ADDR_CENTER_SHIFT_L, loadedCenterShift);
     centerShift = loadedCenterShift;
     
@@ -256,7 +853,7 @@ void loadSettings(bool systemValid, bool advancedValid, bool motionValid, bool e
     
     // Load sensor priority mode
     sensorPriorityMode = EEPROM.read(EEPROM_ADDR_SENSOR_PRIORITY_MODE);
-    if (sensorPriorityMode > SENSOR_PRIORITY_ZONE_BASED) {
+    if (sensorPriorityMode > SENSOR_PRIORITY_FUSION) {
       sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
     }
     
@@ -264,24 +861,16 @@ void loadSettings(bool systemValid, bool advancedValid, bool motionValid, bool e
     for (int i = 0; i < 6; i++) {
       masterAddress[i] = EEPROM.read(EEPROM_ADDR_MASTER_MAC + i);
     }
-    
-    // Paired slaves
-    numSlaveDevices = EEPROM.read(EEPROM_ADDR_PAIRED_SLAVES);
-    numSlaveDevices = constrain(numSlaveDevices, 0, MAX_SLAVE_DEVICES);
-    
-    for (int s = 0; s < numSlaveDevices; s++) {
-      for (int i = 0; i < 6; i++) {
-        slaveAddresses[s][i] = EEPROM.read(EEPROM_ADDR_PAIRED_SLAVES + 1 + (s * 6) + i);
-      }
-    }
   } else {
     Serial.println("WARNING: ESP-NOW settings corrupted! Using defaults.");
     resetEspnowSettings();
   }
+  
+  // Paired slaves have their own versioned record
+  loadLegacySlavePeerTable();
 }
 
-// MOVED OUTSIDE: All the functions that were incorrectly nested inside loadSettings()
-void loadLEDDistributionSettings() {
+static void loadLegacyLEDDistributionSettings() {
   ledSegmentMode = EEPROM.read(EEPROM_ADDR_LED_SEGMENT_MODE);
   if (ledSegmentMode != LED_SEGMENT_MODE_CONTINUOUS && 
       ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED) {
@@ -304,350 +893,107 @@ void loadLEDDistributionSettings() {
                 ledSegmentMode, ledSegmentStart, ledSegmentLength, totalSystemLeds);
 }
 
-void validateLEDDistributionSettings() {
-  if (ledSegmentStart < 0 || ledSegmentStart > MAX_SUPPORTED_LEDS) {
-    ledSegmentStart = 0;
-  }
-  
-  if (ledSegmentLength < 1 || ledSegmentLength > MAX_SUPPORTED_LEDS) {
-    ledSegmentLength = numLeds;
+static void loadLegacySensorGeometrySettings() {
+  if (EEPROM.read(EEPROM_ADDR_SENSOR_GEOMETRY_CRC) != calculateSensorGeometryCRC()) {
+    Serial.println("WARNING: Sensor geometry corrupted! Using defaults.");
+    resetSensorGeometrySettings();
+    return;
   }
   
-  if (totalSystemLeds < 1 || totalSystemLeds > MAX_SUPPORTED_LEDS) {
-    totalSystemLeds = numLeds;
+  for (int s = 0; s <= MAX_SLAVE_DEVICES; s++) {
+    int addr = EEPROM_ADDR_SENSOR_GEOMETRY + (s * EEPROM_SENSOR_GEOMETRY_ENTRY_SIZE);
+    sensorGeometry[s].offset = (int16_t)(EEPROM.read(addr) | (EEPROM.read(addr + 1) << 8));
+    sensorGeometry[s].orientation = ((int8_t)EEPROM.read(addr + 2) < 0) ? -1 : 1;
   }
 }
 
-void validateAllSettings() {
-  // Validate system settings
-  if (minDistance < 0 || minDistance > 500) minDistance = DEFAULT_MIN_DISTANCE;
-  if (maxDistance < 50 || maxDistance > 1000) maxDistance = DEFAULT_MAX_DISTANCE;
-  
-  // Ensure min is always less than max with a reasonable gap
-  if (minDistance >= maxDistance) {
-    // Fix by resetting both to defaults
-    minDistance = DEFAULT_MIN_DISTANCE;
-    maxDistance = DEFAULT_MAX_DISTANCE;
+static void loadLegacySegmentMapSettings() {
+  segment_map_t map;
+  memset(&map, 0, sizeof(map));
+  map.packetType = ESPNOW_PACKET_SEGMENT_MAP;
+  
+  uint8_t count = EEPROM.read(EEPROM_ADDR_SEGMENT_MAP_COUNT);
+  if (count > MAX_SEGMENT_MAP_ENTRIES || 
+      EEPROM.read(EEPROM_ADDR_SEGMENT_MAP_CRC) != calculateSegmentMapCRC()) {
+    Serial.println("WARNING: LED segment map corrupted! Using per-device segments.");
+    resetSegmentMapSettings();
+    return;
   }
   
-  if (brightness < 0 || brightness > 255) brightness = DEFAULT_BRIGHTNESS;
-  if (movingLightSpan < 1 || movingLightSpan > 300) movingLightSpan = DEFAULT_MOVING_LIGHT_SPAN;
-  if (numLeds < 1 || numLeds > 2000) numLeds = DEFAULT_NUM_LEDS;
-  
-  // Validate advanced settings
-  if (centerShift < -100 || centerShift > 100) centerShift = DEFAULT_CENTER_SHIFT;
-  if (trailLength < 0 || trailLength > 100) trailLength = DEFAULT_TRAIL_LENGTH;
-  if (lightMode < 0 || lightMode > 10) lightMode = DEFAULT_LIGHT_MODE;
-  if (effectSpeed < 1 || effectSpeed > 100) effectSpeed = DEFAULT_EFFECT_SPEED;
-  if (effectIntensity < 1 || effectIntensity > 100) effectIntensity = DEFAULT_EFFECT_INTENSITY;
-  
-  // Validate motion parameters
-  positionSmoothingFactor = constrain(positionSmoothingFactor, 0.0, 1.0);
-  velocitySmoothingFactor = constrain(velocitySmoothingFactor, 0.0, 1.0);
-  predictionFactor = constrain(predictionFactor, 0.0, 1.0);
-  positionPGain = constrain(positionPGain, 0.0, 1.0);
-  positionIGain = constrain(positionIGain, 0.0, 0.1);
-  
-  // Validate LED distribution settings
-  validateLEDDistributionSettings();
-  
-  // Log important values after validation
-  Serial.printf("Validated Min/Max: %d/%d\n", minDistance, maxDistance);
-}
-
-void saveSettings() {
-  Serial.println("Saving settings to EEPROM...");
-  
-  // Validate critical settings before saving
-  validateAllSettings();
+  map.count = count;
+  map.totalLeds = EEPROM.read(EEPROM_ADDR_SEGMENT_MAP_TOTAL_L) | 
+                  (EEPROM.read(EEPROM_ADDR_SEGMENT_MAP_TOTAL_H) << 8);
   
-  // Save all sections with explicit commit after each section
-  saveSystemSettings();
-  saveAdvancedSettings();
-  saveMotionSettings();
-  saveEspnowSettings();
-  saveLEDDistributionSettings();
-  
-  // Calculate CRCs
-  uint8_t systemCRC = calculateSystemCRC();
-  uint8_t advancedCRC = calculateAdvancedCRC();
-  uint8_t motionCRC = calculateMotionCRC();
-  uint8_t espnowCRC = calculateEspnowCRC();
-  uint8_t ledDistCRC = calculateLEDDistributionCRC();
-  
-  // Update header with magic marker and CRCs
-  EEPROMHeader header;
-  header.magicMarker = EEPROM_MAGIC_MARKER;
-  header.dataVersion = EEPROM_DATA_VERSION;
-  header.systemSettings = systemCRC;
-  header.advancedSettings = advancedCRC;
-  header.motionSettings = motionCRC;
-  header.espnowSettings = espnowCRC;
-  header.ledDistSettings = ledDistCRC;
-  header.reserved[0] = 0;
-  
-  // Write header to EEPROM
-  EEPROM.put(0, header);
-  
-  // Explicitly commit the data to flash and verify success
-  bool committed = EEPROM.commit();
-  if (committed) {
-    Serial.println("EEPROM committed successfully");
+  for (int s = 0; s < map.count; s++) {
+    led_segment_entry_t& entry = map.entries[s];
+    int addr = EEPROM_ADDR_SEGMENT_MAP_ENTRIES + (s * EEPROM_SEGMENT_MAP_ENTRY_SIZE);
     
-    // Additional verification for debug
-    if (ENABLE_DEBUG_LOGGING) {
-      int storedMinDist = EEPROM.read(EEPROM_ADDR_MIN_DIST_L) | (EEPROM.read(EEPROM_ADDR_MIN_DIST_H) << 8);
-      int storedMaxDist = EEPROM.read(EEPROM_ADDR_MAX_DIST_L) | (EEPROM.read(EEPROM_ADDR_MAX_DIST_H) << 8);
-      Serial.printf("Verification - Min: %d (exp:%d), Max: %d (exp:%d)\n", 
-                 storedMinDist, minDistance, storedMaxDist, maxDistance);
-    }
-  } else {
-    // Try again with a delay if the first commit fails
-    Serial.println("ERROR: EEPROM commit failed! Retrying...");
-    delay(100);
-    if (EEPROM.commit()) {
-      Serial.println("EEPROM commit succeeded on retry");
-    } else {
-      Serial.println("ERROR: EEPROM commit failed on retry!");
+    for (int i = 0; i < 6; i++) {
+      entry.mac[i] = EEPROM.read(addr + i);
     }
+    entry.start = EEPROM.read(addr + 6) | (EEPROM.read(addr + 7) << 8);
+    entry.length = EEPROM.read(addr + 8) | (EEPROM.read(addr + 9) << 8);
+    entry.flags = EEPROM.read(addr + 10);
   }
-}
-
-void saveSystemSettings() {
-  // Store system values
-  EEPROM.write(EEPROM_ADDR_MARKER, EEPROM_INITIALIZED_MARKER);
-  
-  // Ensure min is always less than max with clear debugging
-  if (minDistance >= maxDistance) {
-    Serial.printf("WARNING: Invalid min/max detected before save: %d/%d\n", minDistance, maxDistance);
-    minDistance = DEFAULT_MIN_DISTANCE;
-    maxDistance = DEFAULT_MAX_DISTANCE;
-  }
-  
-  // Save min/max distance with explicit byte ordering
-  EEPROM.write(EEPROM_ADDR_MIN_DIST_L, minDistance & 0xFF);
-  EEPROM.write(EEPROM_ADDR_MIN_DIST_H, (minDistance >> 8) & 0xFF);
-  
-  EEPROM.write(EEPROM_ADDR_MAX_DIST_L, maxDistance & 0xFF);
-  EEPROM.write(EEPROM_ADDR_MAX_DIST_H, (maxDistance >> 8) & 0xFF);
-  
-  EEPROM.write(EEPROM_ADDR_BRIGHTNESS, brightness);
-  EEPROM.write(EEPROM_ADDR_LIGHT_SPAN, movingLightSpan);
-  
-  EEPROM.write(EEPROM_ADDR_RED, redValue);
-  EEPROM.write(EEPROM_ADDR_GREEN, greenValue);
-  EEPROM.write(EEPROM_ADDR_BLUE, blueValue);
-  
-  EEPROM.write(EEPROM_ADDR_NUM_LEDS_L, numLeds & 0xFF);
-  EEPROM.write(EEPROM_ADDR_NUM_LEDS_H, (numLeds >> 8) & 0xFF);
   
-  // Add CRC for integrity check
-  EEPROM.write(EEPROM_ADDR_CRC, calculateSystemCRC());
-  
-  // Ensure this section is committed
-  EEPROM.commit();
-  
-  // Debug log for troubleshooting
-  if (ENABLE_DEBUG_LOGGING) {
-    Serial.printf("Saving Min: %d (0x%02X,0x%02X), Max: %d (0x%02X,0x%02X)\n", 
-                minDistance, 
-                minDistance & 0xFF, (minDistance >> 8) & 0xFF,
-                maxDistance,
-                maxDistance & 0xFF, (maxDistance >> 8) & 0xFF);
+  if (!validateSegmentMap(map)) {
+    Serial.println("WARNING: LED segment map invalid! Using per-device segments.");
+    resetSegmentMapSettings();
+    return;
   }
-}
-
-void saveAdvancedSettings() {
-  // Save advanced features
-  EEPROM.put(EEPROM_ADDR_CENTER_SHIFT_L, (int16_t)centerShift);
-  EEPROM.write(EEPROM_ADDR_TRAIL_LENGTH, trailLength);
-  EEPROM.write(EEPROM_ADDR_DIRECTION_LIGHT, directionLightEnabled ? 1 : 0);
-  EEPROM.write(EEPROM_ADDR_BACKGROUND_MODE, backgroundMode ? 1 : 0);
-  EEPROM.write(EEPROM_ADDR_LIGHT_MODE, lightMode);
-  EEPROM.write(EEPROM_ADDR_EFFECT_SPEED, effectSpeed);
-  EEPROM.write(EEPROM_ADDR_EFFECT_INTENSITY, effectIntensity);
-  
-  // Add explicit commit
-  EEPROM.commit();
-}
-
-void saveMotionSettings() {
-  // Save motion smoothing settings
-  EEPROM.write(EEPROM_ADDR_MOTION_SMOOTHING, motionSmoothingEnabled ? 1 : 0);
-  
-  // Store smoothing factors (16-bit values)
-  EEPROM.write(EEPROM_ADDR_SMOOTHING_FACTOR_L, (int)(positionSmoothingFactor * 100) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_SMOOTHING_FACTOR_H, ((int)(positionSmoothingFactor * 100) >> 8) & 0xFF);
-  
-  EEPROM.write(EEPROM_ADDR_VELOCITY_FACTOR_L, (int)(velocitySmoothingFactor * 100) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_VELOCITY_FACTOR_H, ((int)(velocitySmoothingFactor * 100) >> 8) & 0xFF);
-  
-  EEPROM.write(EEPROM_ADDR_PREDICTION_FACTOR_L, (int)(predictionFactor * 100) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_PREDICTION_FACTOR_H, ((int)(predictionFactor * 100) >> 8) & 0xFF);
   
-  EEPROM.write(EEPROM_ADDR_POSITION_P_GAIN_L, (int)(positionPGain * 1000) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_POSITION_P_GAIN_H, ((int)(positionPGain * 1000) >> 8) & 0xFF);
+  ledSegmentMap = map;
   
-  EEPROM.write(EEPROM_ADDR_POSITION_I_GAIN_L, (int)(positionIGain * 1000) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_POSITION_I_GAIN_H, ((int)(positionIGain * 1000) >> 8) & 0xFF);
-  
-  // Add explicit commit
-  EEPROM.commit();
+  Serial.printf("Loaded LED segment map - %d segments, path: %d LEDs\n", 
+                ledSegmentMap.count, ledSegmentMap.totalLeds);
 }
 
-void saveEspnowSettings() {
-  // Save ESP-NOW settings
-  EEPROM.write(EEPROM_ADDR_DEVICE_ROLE, deviceRole);
-  
-  // Save sensor priority mode
-  EEPROM.write(EEPROM_ADDR_SENSOR_PRIORITY_MODE, sensorPriorityMode);
-  
-  // Save master MAC address
-  for (int i = 0; i < 6; i++) {
-    EEPROM.write(EEPROM_ADDR_MASTER_MAC + i, masterAddress[i]);
-  }
+static void migrateLegacySettings() {
+  // Read header
+  // Zeroed so a read outside the EEPROM fails the magic check
+  EEPROMHeader header = {};
+  EEPROM.get(0, header);
   
-  // Save paired slaves
-  EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES, numSlaveDevices);
-  for (int s = 0; s < numSlaveDevices; s++) {
-    for (int i = 0; i < 6; i++) {
-      EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES + 1 + (s * 6) + i, slaveAddresses[s][i]);
-    }
+  if (header.magicMarker != EEPROM_MAGIC_MARKER) {
+    Serial.println("No saved settings found. Setting up with defaults.");
+    resetAllSettings();
+    return;
   }
   
-  // Add explicit commit
-  EEPROM.commit();
-}
-
-void saveLEDDistributionSettings() {
-  // Use additional EEPROM addresses for LED distribution settings
-  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_MODE, ledSegmentMode);
-  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_START_L, ledSegmentStart & 0xFF);
-  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_START_H, (ledSegmentStart >> 8) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_LENGTH_L, ledSegmentLength & 0xFF);
-  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_LENGTH_H, (ledSegmentLength >> 8) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_TOTAL_SYSTEM_LEDS_L, totalSystemLeds & 0xFF);
-  EEPROM.write(EEPROM_ADDR_TOTAL_SYSTEM_LEDS_H, (totalSystemLeds >> 8) & 0xFF);
-  
-  EEPROM.commit();
-}
-
-void resetAllSettings() {
-  // Reset all settings to defaults
-  resetSystemSettings();
-  resetAdvancedSettings();
-  resetMotionSettings();
-  resetEspnowSettings();
-  resetLEDDistributionSettings();
-  
-  // Save the defaults to EEPROM
-  saveSettings();
-}
-
-void resetSystemSettings() {
-  minDistance = DEFAULT_MIN_DISTANCE;
-  maxDistance = DEFAULT_MAX_DISTANCE;
-  brightness = DEFAULT_BRIGHTNESS;
-  movingLightSpan = DEFAULT_MOVING_LIGHT_SPAN;
-  redValue = DEFAULT_RED;
-  greenValue = DEFAULT_GREEN;
-  blueValue = DEFAULT_BLUE;
-  numLeds = DEFAULT_NUM_LEDS;
-}
-
-void resetAdvancedSettings() {
-  centerShift = DEFAULT_CENTER_SHIFT;
-  trailLength = DEFAULT_TRAIL_LENGTH;
-  directionLightEnabled = DEFAULT_DIRECTION_LIGHT;
-  backgroundMode = DEFAULT_BACKGROUND_MODE;
-  lightMode = DEFAULT_LIGHT_MODE;
-  effectSpeed = DEFAULT_EFFECT_SPEED;
-  effectIntensity = DEFAULT_EFFECT_INTENSITY;
-}
-
-void resetMotionSettings() {
-  motionSmoothingEnabled = DEFAULT_MOTION_SMOOTHING_ENABLED;
-  positionSmoothingFactor = DEFAULT_POSITION_SMOOTHING_FACTOR;
-  velocitySmoothingFactor = DEFAULT_VELOCITY_SMOOTHING_FACTOR;
-  predictionFactor = DEFAULT_PREDICTION_FACTOR;
-  positionPGain = DEFAULT_POSITION_P_GAIN;
-  positionIGain = DEFAULT_POSITION_I_GAIN;
-}
-
-void resetEspnowSettings() {
-  deviceRole = DEFAULT_DEVICE_ROLE;
-  sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
-  
-  // Clear master address
-  for (int i = 0; i < 6; i++) {
-    masterAddress[i] = 0;
-  }
+  Serial.println("Migrating settings from the EEPROM layout...");
   
-  // Clear slave addresses
-  numSlaveDevices = 0;
-  for (int s = 0; s < MAX_SLAVE_DEVICES; s++) {
-    for (int i = 0; i < 6; i++) {
-      slaveAddresses[s][i] = 0;
-    }
-  }
-}
-
-void resetLEDDistributionSettings() {
-  ledSegmentMode = DEFAULT_LED_SEGMENT_MODE;
-  ledSegmentStart = DEFAULT_LED_SEGMENT_START;
-  ledSegmentLength = DEFAULT_LED_SEGMENT_LENGTH;
-  totalSystemLeds = DEFAULT_TOTAL_SYSTEM_LEDS;
-}
-
-// CRC calculation functions
-uint8_t calculateSystemCRC() {
-  uint8_t crc = 0;
+  // Check individual section CRCs
+  bool systemValid = (header.systemSettings == calculateSystemCRC());
+  bool advancedValid = (header.advancedSettings == calculateAdvancedCRC());
+  bool motionValid = (header.motionSettings == calculateMotionCRC());
+  bool espnowValid = (header.espnowSettings == calculateEspnowCRC());
+  bool ledDistValid = (header.ledDistSettings == calculateLEDDistributionCRC());
   
-  for (int i = EEPROM_SYSTEM_START; i < EEPROM_ADVANCED_START; i++) {
-    if (i != EEPROM_ADDR_MARKER) { // Skip marker address for CRC calculation
-      crc ^= EEPROM.read(i);
-    }
+  if (!systemValid || !advancedValid || !motionValid || !espnowValid || !ledDistValid) {
+    Serial.println("CRC mismatch detected in one or more sections");
+    Serial.printf("System: %d, Advanced: %d, Motion: %d, ESPNOW: %d, LEDDist: %d\n", 
+                 systemValid, advancedValid, motionValid, espnowValid, ledDistValid);
   }
   
-  return crc;
-}
-
-uint8_t calculateAdvancedCRC() {
-  uint8_t crc = 0;
+  // Load settings with corruption detection per section
+  loadLegacySettings(systemValid, advancedValid, motionValid, espnowValid);
   
-  for (int i = EEPROM_ADVANCED_START; i < EEPROM_MOTION_START; i++) {
-    crc ^= EEPROM.read(i);
+  if (ledDistValid) {
+    loadLegacyLEDDistributionSettings();
+  } else {
+    Serial.println("WARNING: LED distribution settings corrupted! Using defaults.");
+    resetLEDDistributionSettings();
   }
   
-  return crc;
-}
-
-uint8_t calculateMotionCRC() {
-  uint8_t crc = 0;
-  
-  for (int i = EEPROM_MOTION_START; i < EEPROM_ESPNOW_START; i++) {
-    crc ^= EEPROM.read(i);
-  }
+  // These carry their own checksums
+  loadLegacySegmentMapSettings();
+  loadLegacySensorGeometrySettings();
   
-  return crc;
-}
-
-uint8_t calculateEspnowCRC() {
-  uint8_t crc = 0;
+  // Not part of the EEPROM layout
+  resetRenderSettings();
   
-  for (int i = EEPROM_ESPNOW_START; i < EEPROM_WIFI_START; i++) {
-    crc ^= EEPROM.read(i);
-  }
+  // Writes every record, then marks the store complete
+  saveSettings();
   
-  return crc;
+  Serial.println("Settings migrated to the record store");
 }
-
-uint8_t calculateLEDDistributionCRC() {
-  uint8_t crc = 0;
-  
-  for (int i = EEPROM_LED_DIST_START; i < EEPROM_LED_DIST_START + 7; i++) {
-    crc ^= EEPROM.read(i);
-  }
-  
-  return crc;
-}
\ No newline at end of file
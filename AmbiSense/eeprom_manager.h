@@ -1,45 +1,85 @@
 #ifndef EEPROM_MANAGER_H
 #define EEPROM_MANAGER_H
 
+#include <Arduino.h>
+
+// Settings sections, as a bitmask for scheduleSettingsSave()
+#define SETTINGS_SECTION_SYSTEM           0x01
+#define SETTINGS_SECTION_ADVANCED         0x02
+#define SETTINGS_SECTION_MOTION           0x04
+#define SETTINGS_SECTION_ESPNOW           0x08
+#define SETTINGS_SECTION_PEER_TABLE       0x10
+#define SETTINGS_SECTION_LED_DISTRIBUTION 0x20
+#define SETTINGS_SECTION_SEGMENT_MAP      0x40
+#define SETTINGS_SECTION_SENSOR_GEOMETRY  0x80
+#define SETTINGS_SECTION_RENDER           0x100
+#define SETTINGS_SECTION_ALL              0x1FF
+#define SETTINGS_SECTION_COUNT            9
+
+// Flash write accounting for the settings store
+struct SettingsSaveStats {
+  uint32_t writes;            // Section records written since boot
+  uint32_t skippedWrites;     // Section saves with unchanged contents, so flash was left alone
+  uint32_t coalescedChanges;  // Changes folded into a save that was already pending
+  uint32_t lifetimeWrites;    // Records written over the life of the device (kept in the store)
+  uint32_t sectionWrites[SETTINGS_SECTION_COUNT];  // Per section, in bit order
+};
+
 /**
- * Initializes the EEPROM module
+ * Loads all settings from the settings store. On the first boot after an
+ * update, settings in the old EEPROM layout are migrated instead.
  */
 void setupEEPROM();
 
 /**
- * Saves all settings to EEPROM
+ * Saves all settings to the settings store
  */
 void saveSettings();
 
 /**
- * Loads all settings from EEPROM
+ * Marks settings sections as changed. They are written once no further
+ * changes have arrived for SETTINGS_SAVE_DELAY_MS, so a burst of updates
+ * (e.g. a slider drag) costs at most one flash commit.
+ * @param sections SETTINGS_SECTION_* bits
+ */
+void scheduleSettingsSave(uint16_t sections = SETTINGS_SECTION_ALL);
+
+/**
+ * Writes scheduled sections once they are due. Call once per loop iteration.
  */
-void loadSettings();
+void processSettingsSave();
 
 /**
- * Loads settings with selective validation
+ * Writes scheduled sections immediately, e.g. before a restart
  */
-void loadSettings(bool systemValid, bool advancedValid, bool motionValid, bool espnowValid);
+void flushSettingsSave();
 
 /**
- * Validate all settings
+ * Get the sections waiting for the deferred save
+ * @return SETTINGS_SECTION_* bits, 0 if nothing is pending
  */
-void validateAllSettings();
+uint16_t getPendingSettingsSections();
 
 /**
- * Perform validation of critical settings like min/max distance
- * Used to detect and fix corrupted values
+ * Get flash write counters for the settings store
+ * @return Counters since boot, plus the lifetime commit count
  */
-void validateCriticalSettings();
+const SettingsSaveStats& getSettingsSaveStats();
 
 /**
- * Save individual section settings
+ * Save individual section settings now. Each writes only its own record
+ * and skips the flash write if nothing changed.
+ * @return false if the record could not be written
  */
-void saveSystemSettings();
-void saveAdvancedSettings();
-void saveMotionSettings();
-void saveEspnowSettings();
-void saveLEDDistributionSettings();
+bool saveSystemSettings();
+bool saveAdvancedSettings();
+bool saveMotionSettings();
+bool saveEspnowSettings();
+bool saveLEDDistributionSettings();
+bool saveSegmentMapSettings();
+bool saveSensorGeometrySettings();
+bool saveRenderSettings();
+bool saveSlavePeerTable();
 
 /**
  * Reset settings to defaults
@@ -50,20 +90,9 @@ void resetAdvancedSettings();
 void resetMotionSettings();
 void resetEspnowSettings();
 void resetLEDDistributionSettings();
-
-/**
- * Calculate CRCs for different sections
- */
-uint8_t calculateSystemCRC();
-uint8_t calculateAdvancedCRC();
-uint8_t calculateMotionCRC();
-uint8_t calculateEspnowCRC();
-uint8_t calculateLEDDistributionCRC();
-
-/**
- * Load LED distribution settings from EEPROM
- */
-void loadLEDDistributionSettings();
+void resetSegmentMapSettings();
+void resetSensorGeometrySettings();
+void resetRenderSettings();
 
 /**
  * Validate LED distribution settings
@@ -3,7 +3,7 @@
 #include "led_controller.h"
 #include "config.h"
 #include "eeprom_manager.h"  // Add this include for LED distribution functions
-#include <EEPROM.h>
+#include "settings_schema.h"
 
 // Array to store latest readings from each sensor
 sensor_data_t latestSensorData[MAX_SLAVE_DEVICES + 1]; // +1 for the master's own reading
@@ -11,6 +11,12 @@ sensor_data_t latestSensorData[MAX_SLAVE_DEVICES + 1]; // +1 for the master's ow
 // Global variable for sensor priority mode
 uint8_t sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
 
+// Per-device segment table (loaded from flash on the master, received on slaves)
+segment_map_t ledSegmentMap = {0};
+
+// Stair position of every sensor (0 = master), used by fusion mode
+sensor_geometry_t sensorGeometry[MAX_SLAVE_DEVICES + 1];
+
 // LED distribution mode globals (these should be declared as extern in header)
 extern int ledSegmentMode;
 extern int ledSegmentStart;
@@ -22,6 +28,9 @@ struct ConnectionHealth {
   unsigned long lastReceived;
   uint32_t packetsReceived;
   uint32_t packetsLost;
+  uint16_t lastSequence;
+  uint32_t recentSequences;  // Bit n set: lastSequence - n was received
+  bool hasSequence;
   bool isHealthy;
 };
 
@@ -37,58 +46,352 @@ struct ZoneSwitchingState {
 
 static ZoneSwitchingState zoneState = {false, 0, 0, false};
 
+// Single alpha-beta tracker fed with the fused stair position (fusion mode)
+struct FusionTracker {
+  float position;
+  float velocity;
+  unsigned long lastUpdateTime;
+  bool initialized;
+};
+
+static FusionTracker fusionTracker = {0, 0, 0, false};
+static float fusionWeights[MAX_SLAVE_DEVICES + 1];
+
+// Sensor slot that produced the last selected distance, -1 while holding
+static int selectedSensor = 0;
+
+// Set when a new local or remote reading is waiting to be combined
+static volatile bool sensorDataPending = false;
+
+// Latest scene from the master, handed from the receive callback to the main loop
+static scene_state_t pendingScene;
+static volatile bool scenePending = false;
+static unsigned long lastSceneReceived = 0;
+
+// Latest scene drawn by the master and the last one broadcast (master only)
+static scene_state_t nextScene;
+static bool nextSceneValid = false;
+static scene_state_t sentScene;
+static unsigned long lastSceneSentMs = 0;
+static portMUX_TYPE sceneMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Receive statistics (callback timing is summed in the WiFi task)
+static espnow_stats_t linkStats;
+static uint64_t rxTimeTotalUs = 0;
+static uint64_t updateLatencyTotalUs = 0;
+static uint32_t updateLatencySamples = 0;
+static volatile unsigned long pendingSensorRxMicros = 0;
+
+// Fault injection settings and the packet held back for reordering
+struct FaultInjectionConfig {
+  uint8_t lossPercent;
+  uint8_t duplicatePercent;
+  uint8_t reorderPercent;
+};
+
+struct HeldPacket {
+  bool valid;
+  uint8_t srcAddr[6];
+  uint8_t data[ESP_NOW_MAX_DATA_LEN];
+  int len;
+};
+
+static FaultInjectionConfig faultConfig = {0, 0, 0};
+static HeldPacket heldPacket;
+
+// Open-addressed MAC -> slave slot table so lookups stay O(1) as slaves are added
+#define PEER_INDEX_SIZE 64  // Power of two, well above MAX_SLAVE_DEVICES
+static int8_t peerIndex[PEER_INDEX_SIZE];
+static portMUX_TYPE peerMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Broadcast address used for the per-frame scene and the segment map
+static const uint8_t broadcastAddress[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+// Set once esp_now_init() succeeded; sends before that would only fail and retry
+static volatile bool espnowReady = false;
+
+// Latest segment map from the master, applied from the main loop (it may save to flash)
+static segment_map_t pendingSegmentMap;
+static volatile bool segmentMapPending = false;
+
+// The stored map is applied by the main loop once ESP-NOW is up: setupESPNOW()
+// runs in the network task, and settings only change on the loop task
+static volatile bool storedSegmentMapPending = false;
+
+// Devices heard from over discovery (written in the WiFi task, master only)
+static discovered_peer_t discoveredPeers[ESPNOW_DISCOVERY_MAX_PEERS];
+static int discoveredPeerCount = 0;
+
+// Master's probing window, opened from the web task and run from the main loop
+static bool discoveryActive = false;
+static unsigned long discoveryEndTime = 0;
+static unsigned long nextProbeTime = 0;
+static portMUX_TYPE discoveryMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Announce to send from the main loop once the random delay has passed
+static volatile bool announcePending = false;
+static volatile unsigned long announceDueTime = 0;
+
 // Callback function for when data is sent
 void OnDataSent(const uint8_t *mac_addr, esp_now_send_status_t status) {
-  if (ENABLE_ESPNOW_LOGGING) {
+  // Only failures: the master sends a scene broadcast with every frame, and
+  // a line per packet would keep the WiFi task busy printing
+  if (ENABLE_ESPNOW_LOGGING && status != ESP_NOW_SEND_SUCCESS) {
     char macStr[18];
     sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
             mac_addr[0], mac_addr[1], mac_addr[2], 
             mac_addr[3], mac_addr[4], mac_addr[5]);
-    Serial.printf("ESP-NOW: Packet to %s status: %s\n", 
-                 macStr, (status == ESP_NOW_SEND_SUCCESS ? "Success" : "Failed"));
+    Serial.printf("ESP-NOW: Packet to %s failed\n", macStr);
+  }
+}
+
+// Track a sensor's packet sequence; returns false for duplicates and stale packets
+static bool trackSensorSequence(uint8_t sensorId, uint16_t sequence) {
+  if (sensorId > MAX_SLAVE_DEVICES) return true;
+  
+  ConnectionHealth& health = slaveHealth[sensorId];
+  
+  // First packet, or the sender restarted its counter
+  if (!health.hasSequence || sequence == 0) {
+    health.lastSequence = sequence;
+    health.recentSequences = 1;
+    health.hasSequence = true;
+    return true;
+  }
+  
+  int16_t delta = (int16_t)(sequence - health.lastSequence);
+  
+  // A big jump ahead, or a packet older than the window, means the sender
+  // restarted and its reset packet was lost
+  if (delta > 1000 || delta <= -32) {
+    health.lastSequence = sequence;
+    health.recentSequences = 1;
+    return true;
+  }
+  
+  if (delta <= 0) {
+    // A late copy of a packet we already have is a duplicate, not a recovered loss
+    int age = -delta;
+    if (health.recentSequences & (1UL << age)) {
+      linkStats.packetsDuplicated++;
+      return false;
+    }
+    health.recentSequences |= 1UL << age;
+    
+    // Arrived after a newer reading - it was counted as lost when the gap opened
+    linkStats.packetsReordered++;
+    if (health.packetsLost > 0) health.packetsLost--;
+    if (linkStats.packetsLost > 0) linkStats.packetsLost--;
+    return false;
   }
+  
+  health.packetsLost += delta - 1;
+  linkStats.packetsLost += delta - 1;
+  health.lastSequence = sequence;
+  health.recentSequences = delta < 32 ? (health.recentSequences << delta) | 1 : 1;
+  return true;
 }
 
-// Updated callback function for when data is received
+static void dispatchPacket(const esp_now_recv_info_t *recv_info, const uint8_t *data, int len);
+static int lookupSlaveSlot(const uint8_t* mac);
+
+// Check a sender against the configured master. The master may have been paired by
+// its softAP MAC, which is the station MAC (used for sending) plus one.
+static bool isFromMaster(const uint8_t* mac) {
+  if (memcmp(mac, masterAddress, 5) != 0) return false;
+  return mac[5] == masterAddress[5] || (uint8_t)(mac[5] + 1) == masterAddress[5];
+}
+
+// Drop, duplicate or reorder received packets to exercise the receive path on a bench
+static void injectFaults(const esp_now_recv_info_t *recv_info, const uint8_t *data, int len) {
+  if (esp_random() % 100 < faultConfig.lossPercent) {
+    linkStats.packetsInjectedLoss++;
+    return;
+  }
+  
+  if (!heldPacket.valid && len <= ESP_NOW_MAX_DATA_LEN && 
+      esp_random() % 100 < faultConfig.reorderPercent) {
+    memcpy(heldPacket.srcAddr, recv_info->src_addr, 6);
+    memcpy(heldPacket.data, data, len);
+    heldPacket.len = len;
+    heldPacket.valid = true;
+    return;
+  }
+  
+  dispatchPacket(recv_info, data, len);
+  
+  if (esp_random() % 100 < faultConfig.duplicatePercent) {
+    dispatchPacket(recv_info, data, len);
+  }
+  
+  // Deliver the held packet after a newer one
+  if (heldPacket.valid) {
+    heldPacket.valid = false;
+    
+    esp_now_recv_info_t heldInfo = *recv_info;
+    heldInfo.src_addr = heldPacket.srcAddr;
+    dispatchPacket(&heldInfo, heldPacket.data, heldPacket.len);
+  }
+}
+
+// Callback function for when data is received
 void OnDataReceive(const esp_now_recv_info_t *recv_info, const uint8_t *data, int len) {
-  if (len == sizeof(sensor_data_t)) {
+  unsigned long startMicros = micros();
+  
+  if (ENABLE_ESPNOW_FAULT_INJECTION) {
+    injectFaults(recv_info, data, len);
+  } else {
+    dispatchPacket(recv_info, data, len);
+  }
+  
+  unsigned long elapsed = micros() - startMicros;
+  linkStats.packetsReceived++;
+  rxTimeTotalUs += elapsed;
+  if (elapsed > linkStats.rxTimeMaxUs) {
+    linkStats.rxTimeMaxUs = elapsed;
+  }
+}
+
+// Answer after a random delay, so devices hearing the same probe don't all reply at once
+static void scheduleAnnounce() {
+  announceDueTime = millis() + esp_random() % (ESPNOW_ANNOUNCE_MAX_JITTER_MS + 1);
+  announcePending = true;
+}
+
+// Add or refresh a device in the discovery table (runs in the WiFi task)
+static void recordAnnounce(const esp_now_recv_info_t *recv_info, const discovery_announce_t& announce) {
+  if (deviceRole != DEVICE_ROLE_MASTER || announce.protocolVersion != DISCOVERY_PROTOCOL_VERSION) {
+    return;
+  }
+  
+  unsigned long now = millis();
+  
+  portENTER_CRITICAL(&discoveryMux);
+  int slot = -1;
+  int oldest = 0;
+  for (int i = 0; i < discoveredPeerCount; i++) {
+    if (memcmp(discoveredPeers[i].mac, recv_info->src_addr, 6) == 0) {
+      slot = i;
+      break;
+    }
+    if (now - discoveredPeers[i].lastSeen > now - discoveredPeers[oldest].lastSeen) {
+      oldest = i;
+    }
+  }
+  
+  // A full table gives up the device heard from least recently
+  if (slot < 0) {
+    slot = discoveredPeerCount < ESPNOW_DISCOVERY_MAX_PEERS ? discoveredPeerCount++ : oldest;
+  }
+  
+  discovered_peer_t& peer = discoveredPeers[slot];
+  memcpy(peer.mac, recv_info->src_addr, 6);
+  peer.role = announce.role;
+  peer.flags = announce.flags;
+  peer.numLeds = announce.numLeds;
+  peer.rssi = recv_info->rx_ctrl ? recv_info->rx_ctrl->rssi : 0;
+  memcpy(peer.name, announce.name, DEVICE_NAME_SIZE);
+  peer.name[DEVICE_NAME_SIZE - 1] = '\0';
+  memcpy(peer.firmware, announce.firmware, FIRMWARE_VERSION_SIZE);
+  peer.firmware[FIRMWARE_VERSION_SIZE - 1] = '\0';
+  peer.lastSeen = now;
+  portEXIT_CRITICAL(&discoveryMux);
+  
+  if (ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Announce from %s (role %d, %d LEDs, v%s)\n",
+                 peer.name, peer.role, peer.numLeds, peer.firmware);
+  }
+}
+
+// Hand a received packet to the handler for its type
+static void dispatchPacket(const esp_now_recv_info_t *recv_info, const uint8_t *data, int len) {
+  // Scenes and segment maps are broadcast - ignore those from other installations
+  bool isBroadcastPacket = (len == sizeof(scene_state_t) && data[0] == ESPNOW_PACKET_SCENE_STATE) ||
+                           (len == sizeof(segment_map_t) && data[0] == ESPNOW_PACKET_SEGMENT_MAP);
+  if (isBroadcastPacket && !isFromMaster(recv_info->src_addr)) {
+    return;
+  }
+  
+  if (len == sizeof(scene_state_t) && data[0] == ESPNOW_PACKET_SCENE_STATE) {
+    scene_state_t scene;
+    memcpy(&scene, data, sizeof(scene_state_t));
+    
+    // Rendering happens in the main loop, not in the WiFi task
+    processSceneState(scene);
+  }
+  else if (len == sizeof(segment_map_t) && data[0] == ESPNOW_PACKET_SEGMENT_MAP) {
+    segment_map_t map;
+    memcpy(&map, data, sizeof(segment_map_t));
+    
+    if (ENABLE_ESPNOW_LOGGING) {
+      Serial.printf("ESP-NOW: Received segment map - %d segments, path: %d LEDs\n", 
+                   map.count, map.totalLeds);
+    }
+    
+    processSegmentMap(map);
+  }
+  else if (len == sizeof(discovery_probe_t) && data[0] == ESPNOW_PACKET_DISCOVERY_PROBE) {
+    scheduleAnnounce();
+  }
+  else if (len == sizeof(discovery_announce_t) && data[0] == ESPNOW_PACKET_ANNOUNCE) {
+    discovery_announce_t announce;
+    memcpy(&announce, data, sizeof(discovery_announce_t));
+    recordAnnounce(recv_info, announce);
+  }
+  else if (len == sizeof(sensor_data_t)) {
     sensor_data_t sensorData;
     memcpy(&sensorData, data, sizeof(sensor_data_t));
     
     const uint8_t *mac_addr = recv_info->src_addr;
+    
     char macStr[18];
     sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
             mac_addr[0], mac_addr[1], mac_addr[2], 
             mac_addr[3], mac_addr[4], mac_addr[5]);
     
-    if (ENABLE_ESPNOW_LOGGING) {
-      Serial.printf("ESP-NOW: Received sensor data from %s - ID: %d, Distance: %d cm\n", 
-                   macStr, sensorData.sensorId, sensorData.distance);
+    // Slaves all report themselves as sensor 1 - use their pairing slot instead.
+    // A device that isn't paired (or no longer is) has no slot and is ignored,
+    // so it can't feed another sensor's sequence tracking and fusion. The slot
+    // is used under the same lock that removeSlaveSlot() moves slots with, so
+    // the reading can't land in the slot of a device that moved into its place.
+    portENTER_CRITICAL(&peerMux);
+    int slot = lookupSlaveSlot(mac_addr);
+    bool fresh = false;
+    bool stored = false;
+    if (slot >= 0) {
+      sensorData.sensorId = slot;
+      // Duplicates and packets overtaken by a newer reading carry nothing new
+      fresh = trackSensorSequence(slot, sensorData.sequence);
+      if (fresh) {
+        updateConnectionHealth(slot);
+        stored = processSensorData(sensorData);
+      }
     }
+    portEXIT_CRITICAL(&peerMux);
     
-    // Update connection health
-    updateConnectionHealth(sensorData.sensorId);
-    
-    // Process the received distance data
-    processSensorData(sensorData);
-  }
-  else if (len == sizeof(led_segment_data_t)) {
-    led_segment_data_t segmentData;
-    memcpy(&segmentData, data, sizeof(led_segment_data_t));
+    if (slot < 0) {
+      linkStats.packetsUnpaired++;
+      if (ENABLE_ESPNOW_LOGGING) {
+        Serial.printf("ESP-NOW: Ignoring sensor data from unpaired device %s\n", macStr);
+      }
+      return;
+    }
     
     if (ENABLE_ESPNOW_LOGGING) {
-      Serial.printf("ESP-NOW: Received LED segment data - Distance: %d, Start: %d, Total: %d\n", 
-                   segmentData.distance, segmentData.startLed, segmentData.totalLeds);
+      Serial.printf("ESP-NOW: Received sensor data from %s - ID: %d, Distance: %d cm\n", 
+                   macStr, sensorData.sensorId, sensorData.distance);
+      if (fresh && !stored && deviceRole == DEVICE_ROLE_MASTER) {
+        Serial.printf("ESP-NOW: Discarding invalid distance %d from sensor %d\n", 
+                     sensorData.distance, sensorData.sensorId);
+      }
     }
-    
-    // Process LED segment data (for distributed mode)
-    processLEDSegmentData(segmentData);
   }
 }
 
 // Initialize ESP-NOW with improved error handling and channel management
 void setupESPNOW() {
   Serial.println("ESP-NOW: Initializing...");
+  espnowReady = false;
   
   // Force specific channel for all devices
   WiFi.disconnect(true);
@@ -121,24 +424,8 @@ void setupESPNOW() {
     }
   }
   
-  // Get device role from EEPROM
-  deviceRole = EEPROM.read(EEPROM_ADDR_DEVICE_ROLE);
-  if (deviceRole != DEVICE_ROLE_MASTER && deviceRole != DEVICE_ROLE_SLAVE) {
-    deviceRole = DEFAULT_DEVICE_ROLE; // Default to master if not set
-    EEPROM.write(EEPROM_ADDR_DEVICE_ROLE, deviceRole);
-    EEPROM.commit();
-  }
-  
-  // Get sensor priority mode from EEPROM
-  sensorPriorityMode = EEPROM.read(EEPROM_ADDR_SENSOR_PRIORITY_MODE);
-  if (sensorPriorityMode > SENSOR_PRIORITY_ZONE_BASED) {
-    sensorPriorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
-    EEPROM.write(EEPROM_ADDR_SENSOR_PRIORITY_MODE, sensorPriorityMode);
-    EEPROM.commit();
-  }
-  
-  // Load LED distribution settings from EEPROM (function from eeprom_manager)
-  loadLEDDistributionSettings();
+  // Role, priority mode, peers and LED distribution were loaded (and
+  // validated) by setupEEPROM()
   
   // Set up callback functions
   esp_now_register_send_cb(OnDataSent);
@@ -147,6 +434,16 @@ void setupESPNOW() {
   // Initialize connection health monitoring
   initializeConnectionHealth();
   
+  // Scenes, segment maps and discovery all go out as broadcasts
+  esp_now_del_peer(broadcastAddress);
+  esp_now_peer_info_t broadcastPeer = {};
+  memcpy(broadcastPeer.peer_addr, broadcastAddress, 6);
+  broadcastPeer.channel = ESPNOW_CHANNEL;
+  broadcastPeer.encrypt = false;
+  if (esp_now_add_peer(&broadcastPeer) != ESP_OK) {
+    Serial.println("ESP-NOW: Failed to add broadcast peer");
+  }
+  
   // Configure peers based on role
   if (deviceRole == DEVICE_ROLE_MASTER) {
     Serial.println("ESP-NOW: Configuring device as MASTER");
@@ -156,15 +453,22 @@ void setupESPNOW() {
     configureSlavePeer();
   }
   
+  // Our own segment comes from the map now that the MAC addresses are known
+  storedSegmentMapPending = true;
+  espnowReady = true;
+  
+  // Let a master that is already running see this slave without probing
+  if (deviceRole == DEVICE_ROLE_SLAVE) {
+    scheduleAnnounce();
+  }
+  
   Serial.printf("ESP-NOW: Initialization complete. LED Mode: %s\n", 
                (ledSegmentMode == LED_SEGMENT_MODE_DISTRIBUTED) ? "Distributed" : "Continuous");
 }
 
 // Configure master device peers
 void configureMasterPeers() {
-  // Read number of paired slaves
-  numSlaveDevices = EEPROM.read(EEPROM_ADDR_PAIRED_SLAVES);
-  numSlaveDevices = constrain(numSlaveDevices, 0, MAX_SLAVE_DEVICES);
+  rebuildPeerIndex();
   
   if (ENABLE_ESPNOW_LOGGING) {
     Serial.printf("ESP-NOW: Master configuring %d slave devices\n", numSlaveDevices);
@@ -173,10 +477,7 @@ void configureMasterPeers() {
   // Register all slave devices as peers
   for (int i = 0; i < numSlaveDevices; i++) {
     uint8_t macAddr[6];
-    for (int j = 0; j < 6; j++) {
-      macAddr[j] = EEPROM.read(EEPROM_ADDR_PAIRED_SLAVES + 1 + (i * 6) + j);
-      slaveAddresses[i][j] = macAddr[j]; // Store in global array
-    }
+    memcpy(macAddr, slaveAddresses[i], 6);
     
     // Remove peer if it already exists
     esp_now_del_peer(macAddr);
@@ -203,13 +504,94 @@ void configureMasterPeers() {
   }
 }
 
-// Configure slave device peer
-void configureSlavePeer() {
-  // Read master MAC address
-  for (int i = 0; i < 6; i++) {
-    masterAddress[i] = EEPROM.read(EEPROM_ADDR_MASTER_MAC + i);
+static inline uint8_t peerHash(const uint8_t* mac) {
+  // The vendor prefix is shared by every board - hash the device-specific bytes
+  return (mac[3] * 31 + mac[4] * 7 + mac[5]) & (PEER_INDEX_SIZE - 1);
+}
+
+// Callers hold peerMux
+static void fillPeerIndex() {
+  memset(peerIndex, -1, sizeof(peerIndex));
+  
+  for (int i = 0; i < numSlaveDevices; i++) {
+    uint8_t h = peerHash(slaveAddresses[i]);
+    while (peerIndex[h] >= 0) {
+      h = (h + 1) & (PEER_INDEX_SIZE - 1);
+    }
+    peerIndex[h] = i;
+  }
+}
+
+void rebuildPeerIndex() {
+  portENTER_CRITICAL(&peerMux);
+  fillPeerIndex();
+  portEXIT_CRITICAL(&peerMux);
+}
+
+// Callers hold peerMux
+static int lookupSlaveSlot(const uint8_t* mac) {
+  uint8_t h = peerHash(mac);
+  for (int probes = 0; probes < PEER_INDEX_SIZE && peerIndex[h] >= 0; probes++) {
+    int i = peerIndex[h];
+    if (i < numSlaveDevices && memcmp(slaveAddresses[i], mac, 6) == 0) {
+      return i + 1;
+    }
+    h = (h + 1) & (PEER_INDEX_SIZE - 1);
   }
+  return -1;
+}
+
+int findSlaveSlot(const uint8_t* mac) {
+  portENTER_CRITICAL(&peerMux);
+  int slot = lookupSlaveSlot(mac);
+  portEXIT_CRITICAL(&peerMux);
   
+  return slot;
+}
+
+// A slot starts over: no health history, sequence or reading. Callers hold peerMux.
+static void clearSlaveSlot(int slot) {
+  slaveHealth[slot] = {millis(), 0, 0, 0, 0, false, false};
+  latestSensorData[slot] = {};
+  latestSensorData[slot].sensorId = slot;
+  fusionWeights[slot] = 0;
+}
+
+bool addSlaveSlot(const uint8_t* mac) {
+  if (numSlaveDevices >= MAX_SLAVE_DEVICES) return false;
+  
+  portENTER_CRITICAL(&peerMux);
+  clearSlaveSlot(numSlaveDevices + 1);
+  memcpy(slaveAddresses[numSlaveDevices], mac, 6);
+  numSlaveDevices++;
+  fillPeerIndex();
+  portEXIT_CRITICAL(&peerMux);
+  return true;
+}
+
+void removeSlaveSlot(int index) {
+  if (index < 0 || index >= numSlaveDevices) return;
+  
+  // Sensor slot n belongs to slave n - 1; everything kept per slot moves with it
+  portENTER_CRITICAL(&peerMux);
+  for (int i = index; i < numSlaveDevices - 1; i++) {
+    memcpy(slaveAddresses[i], slaveAddresses[i + 1], 6);
+    sensorGeometry[i + 1] = sensorGeometry[i + 2];
+    slaveHealth[i + 1] = slaveHealth[i + 2];
+    latestSensorData[i + 1] = latestSensorData[i + 2];
+    latestSensorData[i + 1].sensorId = i + 1;
+    fusionWeights[i + 1] = fusionWeights[i + 2];
+  }
+  clearSlaveSlot(numSlaveDevices);
+  sensorGeometry[numSlaveDevices].offset = 0;
+  sensorGeometry[numSlaveDevices].orientation = 1;
+  numSlaveDevices--;
+  fillPeerIndex();
+  portEXIT_CRITICAL(&peerMux);
+}
+
+// Configure slave device peer
+void configureSlavePeer() {
   // Check if master MAC is valid (not all zeros)
   bool validMaster = false;
   for (int i = 0; i < 6; i++) {
@@ -271,6 +653,9 @@ void initializeConnectionHealth() {
     slaveHealth[i].lastReceived = millis();
     slaveHealth[i].packetsReceived = 0;
     slaveHealth[i].packetsLost = 0;
+    slaveHealth[i].lastSequence = 0;
+    slaveHealth[i].recentSequences = 0;
+    slaveHealth[i].hasSequence = false;
     slaveHealth[i].isHealthy = false;
   }
   
@@ -313,8 +698,8 @@ void checkConnectionHealth() {
 }
 
 // Send sensor data (called by slave devices) with improved error handling
-void sendSensorData(int distance, int8_t direction) {
-  if (deviceRole != DEVICE_ROLE_SLAVE) return;
+void sendSensorData(int distance, int8_t direction, uint8_t energy) {
+  if (deviceRole != DEVICE_ROLE_SLAVE || !espnowReady) return;
   
   // Check if master MAC is valid
   bool validMaster = false;
@@ -334,12 +719,25 @@ void sendSensorData(int distance, int8_t direction) {
     return;
   }
   
+  // Sequence numbers let the master count lost, duplicated and reordered packets.
+  // The first reading after boot carries 0 ("sender restarted") so the master
+  // resyncs even when the test message was lost.
+  static bool firstReading = true;
+  static uint16_t sequence = 0;
+  if (firstReading) {
+    firstReading = false;
+  } else if (++sequence == 0) {
+    sequence = 1; // 0 is reserved for "sender restarted"
+  }
+  
   // Prepare sensor data
   sensor_data_t sensorData;
   sensorData.sensorId = 1; 
+  sensorData.sequence = sequence;
   sensorData.distance = distance;
   sensorData.direction = direction;
   sensorData.battery = 100;
+  sensorData.energy = energy;
   sensorData.timestamp = millis();
   
   // Send with retry logic
@@ -368,122 +766,347 @@ void sendSensorData(int distance, int8_t direction) {
   }
 }
 
-// Send LED segment data to slaves (for distributed mode)
-void sendLEDSegmentData(int distance, int globalStartPos) {
-  if (deviceRole != DEVICE_ROLE_MASTER || 
-      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED ||
-      numSlaveDevices == 0) {
-    return;
+// Check a MAC against both interfaces of this device (slaves may be paired by either)
+static bool isOwnMac(const uint8_t* mac) {
+  uint8_t ownMac[6];
+  
+  WiFi.macAddress(ownMac);
+  if (memcmp(mac, ownMac, 6) == 0) return true;
+  
+  WiFi.softAPmacAddress(ownMac);
+  return memcmp(mac, ownMac, 6) == 0;
+}
+
+const led_segment_entry_t* findSegmentEntry(const segment_map_t& map, const uint8_t* mac) {
+  for (int i = 0; i < map.count && i < MAX_SEGMENT_MAP_ENTRIES; i++) {
+    if (memcmp(map.entries[i].mac, mac, 6) == 0) {
+      return &map.entries[i];
+    }
+  }
+  return NULL;
+}
+
+// Compare two maps field by field (struct padding is not meaningful)
+static bool segmentMapsEqual(const segment_map_t& a, const segment_map_t& b) {
+  if (a.count != b.count || a.totalLeds != b.totalLeds) return false;
+  
+  for (int i = 0; i < a.count && i < MAX_SEGMENT_MAP_ENTRIES; i++) {
+    const led_segment_entry_t& x = a.entries[i];
+    const led_segment_entry_t& y = b.entries[i];
+    if (memcmp(x.mac, y.mac, 6) != 0 || x.start != y.start ||
+        x.length != y.length || x.flags != y.flags) {
+      return false;
+    }
   }
   
-  led_segment_data_t segmentData;
-  segmentData.sensorId = 0; // Master
-  segmentData.distance = distance;
-  segmentData.direction = 0;
-  segmentData.timestamp = millis();
-  segmentData.totalLeds = totalSystemLeds;
-  segmentData.lightMode = lightMode;
-  segmentData.brightness = brightness;
-  segmentData.redValue = redValue;
-  segmentData.greenValue = greenValue;
-  segmentData.blueValue = blueValue;
+  return true;
+}
+
+bool validateSegmentMap(const segment_map_t& map) {
+  if (map.count > MAX_SEGMENT_MAP_ENTRIES) return false;
+  if (map.count == 0) return true;
+  if (map.totalLeds < 1 || map.totalLeds > MAX_SUPPORTED_LEDS) return false;
   
-  // Send to all slaves with their specific segment information
-  for (int i = 0; i < numSlaveDevices; i++) {
-    // Calculate segment for this slave (assuming equal distribution)
-    int ledsPerDevice = totalSystemLeds / (numSlaveDevices + 1); // +1 for master
-    int slaveSegmentStart = (i + 1) * ledsPerDevice;
-    
-    segmentData.startLed = slaveSegmentStart;
-    segmentData.segmentLength = ledsPerDevice;
+  for (int i = 0; i < map.count; i++) {
+    const led_segment_entry_t& entry = map.entries[i];
     
-    esp_err_t result = esp_now_send(slaveAddresses[i], 
-                                   (uint8_t*)&segmentData, 
-                                   sizeof(led_segment_data_t));
+    // Segments may leave gaps but must lie on the path
+    if (entry.length < 1 || entry.start + entry.length > map.totalLeds) {
+      return false;
+    }
     
-    if (result != ESP_OK && ENABLE_ESPNOW_LOGGING) {
-      Serial.printf("ESP-NOW: Failed to send LED segment data to slave %d (error: %d)\n", 
-                   i, result);
+    // One segment per device
+    for (int j = 0; j < i; j++) {
+      if (memcmp(map.entries[j].mac, entry.mac, 6) == 0) {
+        return false;
+      }
     }
   }
   
-  if (ENABLE_ESPNOW_LOGGING) {
-    Serial.printf("ESP-NOW: Sent LED segment data - Distance: %d, Global start: %d\n", 
-                 distance, globalStartPos);
+  return true;
+}
+
+void applySegmentMap(const segment_map_t& map, bool persist) {
+  if (map.count == 0) return;
+  
+  int start = ledSegmentStart;
+  int length = ledSegmentLength;
+  bool reversed = false;
+  
+  // Devices without an entry keep their own segment but follow the path length
+  const led_segment_entry_t* entry = NULL;
+  for (int i = 0; i < map.count && i < MAX_SEGMENT_MAP_ENTRIES; i++) {
+    if (isOwnMac(map.entries[i].mac)) {
+      entry = &map.entries[i];
+      break;
+    }
+  }
+  
+  if (entry != NULL) {
+    start = entry->start;
+    length = entry->length;
+    reversed = (entry->flags & SEGMENT_FLAG_REVERSED) != 0;
+  }
+  
+  bool changed = (start != ledSegmentStart || length != ledSegmentLength ||
+                  map.totalLeds != totalSystemLeds);
+  
+  ledSegmentStart = start;
+  ledSegmentLength = length;
+  totalSystemLeds = map.totalLeds;
+  ledSegmentReversed = reversed;
+  
+  if (changed) {
+    publishSettingsSnapshot();
+    if (persist) scheduleSettingsSave(SETTINGS_SECTION_LED_DISTRIBUTION);
+  }
+  
+  if (changed && ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Segment applied - Start: %d, Length: %d, Total: %d%s\n", 
+                 ledSegmentStart, ledSegmentLength, totalSystemLeds, 
+                 ledSegmentReversed ? " (reversed)" : "");
   }
 }
 
-// Process LED segment data (on slave devices)
-void processLEDSegmentData(led_segment_data_t segmentData) {
-  if (deviceRole != DEVICE_ROLE_SLAVE || 
-      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED) {
+bool setSegmentMap(const segment_map_t& map) {
+  if (deviceRole != DEVICE_ROLE_MASTER || !validateSegmentMap(map)) {
+    return false;
+  }
+  
+  ledSegmentMap = map;
+  ledSegmentMap.packetType = ESPNOW_PACKET_SEGMENT_MAP;
+  
+  applySegmentMap(ledSegmentMap, true);
+  scheduleSettingsSave(SETTINGS_SECTION_SEGMENT_MAP);
+  sendSegmentMap();
+  
+  Serial.printf("ESP-NOW: Segment map set - %d segments over %d LEDs\n", 
+                ledSegmentMap.count, ledSegmentMap.totalLeds);
+  return true;
+}
+
+// Send the whole segment map to every slave; each one picks out its own entry
+void sendSegmentMap() {
+  if (deviceRole != DEVICE_ROLE_MASTER || 
+      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED ||
+      numSlaveDevices == 0 || ledSegmentMap.count == 0) {
     return;
   }
   
-  // Update local settings from master
-  brightness = segmentData.brightness;
-  redValue = segmentData.redValue;
-  greenValue = segmentData.greenValue;
-  blueValue = segmentData.blueValue;
+  ledSegmentMap.packetType = ESPNOW_PACKET_SEGMENT_MAP;
   
-  // Calculate global LED position from distance
-  int globalStartPos = map(segmentData.distance, minDistance, maxDistance, 
-                          0, segmentData.totalLeds - movingLightSpan);
+  esp_err_t result = esp_now_send(broadcastAddress, (uint8_t*)&ledSegmentMap, sizeof(segment_map_t));
   
-  // Update LED segment based on the received data
-  updateLEDSegment(globalStartPos, segmentData);
+  if (result != ESP_OK && ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Failed to broadcast segment map (error: %d)\n", result);
+  }
 }
 
-// Update LED segment for distributed mode
-void updateLEDSegment(int globalStartPos, led_segment_data_t segmentData) {
-  strip.clear();
+// Queue a segment map received from the master (runs in the WiFi task)
+void processSegmentMap(const segment_map_t& map) {
+  if (deviceRole != DEVICE_ROLE_SLAVE || 
+      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED ||
+      !validateSegmentMap(map)) {
+    return;
+  }
   
-  // Calculate which part of the moving light belongs to this segment
-  for (int i = 0; i < movingLightSpan; i++) {
-    int globalLedPos = globalStartPos + i;
-    int localLedPos = globalLedPos - ledSegmentStart;
+  portENTER_CRITICAL(&sceneMux);
+  pendingSegmentMap = map;
+  segmentMapPending = true;
+  portEXIT_CRITICAL(&sceneMux);
+}
+
+// Broadcast the latest scene if the slaves don't have it yet. Changes go out
+// at most every SCENE_BROADCAST_INTERVAL_MS (later ones from the main loop),
+// an unchanged scene every SCENE_KEEPALIVE_MS so lost packets heal.
+static void flushSceneState(unsigned long now, bool force) {
+  if (!nextSceneValid || !espnowReady) return;
+  
+  unsigned long elapsed = now - lastSceneSentMs;
+  if (!force) {
+    if (lastSceneSentMs != 0 && elapsed < SCENE_BROADCAST_INTERVAL_MS) return;
     
-    // Check if this LED position belongs to this device's segment
-    if (localLedPos >= 0 && localLedPos < numLeds) {
-      strip.setPixelColor(localLedPos, strip.Color(segmentData.redValue, 
-                                                  segmentData.greenValue, 
-                                                  segmentData.blueValue));
-    }
+    // Every frame of a scene that doesn't animate looks the same
+    scene_state_t next = nextScene;
+    if (!isSceneAnimated()) next.frame = sentScene.frame;
+    bool changed = memcmp(&next, &sentScene, sizeof(scene_state_t)) != 0;
+    if (!changed && elapsed < SCENE_KEEPALIVE_MS) return;
   }
   
-  strip.show();
+  // One broadcast regardless of the number of slaves
+  esp_err_t result = esp_now_send(broadcastAddress, (uint8_t*)&nextScene, sizeof(scene_state_t));
+  sentScene = nextScene;
+  lastSceneSentMs = now;
   
-  if (ENABLE_ESPNOW_LOGGING) {
-    Serial.printf("ESP-NOW: Updated LED segment - Global start: %d, Local LEDs updated\n", 
-                 globalStartPos);
+  if (result != ESP_OK && ENABLE_ESPNOW_LOGGING) {
+    static unsigned long lastErrorTime = 0;
+    if (millis() - lastErrorTime > 1000) {
+      Serial.printf("ESP-NOW: Failed to broadcast scene (error: %d)\n", result);
+      lastErrorTime = millis();
+    }
   }
 }
 
-// Process received sensor data (called by master device)
-void processSensorData(sensor_data_t sensorData) {
-  if (deviceRole != DEVICE_ROLE_MASTER) return;
+// Hand the scene just drawn to the slaves (for distributed mode)
+void sendSceneState(int startLed) {
+  if (!espnowReady || deviceRole != DEVICE_ROLE_MASTER || 
+      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED ||
+      numSlaveDevices == 0) {
+    return;
+  }
   
-  // Validate incoming data
-  if (sensorData.distance < 0 || sensorData.distance > 500) {
-    if (ENABLE_ESPNOW_LOGGING) {
-      Serial.printf("ESP-NOW: Discarding invalid distance %d from sensor %d\n", 
-                  sensorData.distance, sensorData.sensorId);
-    }
+  // Compared byte for byte with the last broadcast, so padding must be clear
+  scene_state_t scene;
+  memset(&scene, 0, sizeof(scene));
+  scene.packetType = ESPNOW_PACKET_SCENE_STATE;
+  scene.lightMode = lightMode;
+  scene.brightness = brightness;
+  scene.flags = (backgroundMode ? SCENE_FLAG_BACKGROUND : 0) |
+                (directionLightEnabled ? SCENE_FLAG_DIRECTION_LIGHT : 0);
+  scene.redValue = redValue;
+  scene.greenValue = greenValue;
+  scene.blueValue = blueValue;
+  scene.direction = getMotionDirection();
+  scene.frame = getRenderFrame() - 1; // renderScene() already advanced past the frame just drawn
+  scene.startLed = startLed;
+  scene.totalLeds = totalSystemLeds;
+  scene.movingLightSpan = movingLightSpan;
+  scene.trailLength = trailLength;
+  scene.effectSpeed = effectSpeed;
+  scene.effectIntensity = effectIntensity;
+  scene.palette = colorPalette;
+  scene.backgroundLayer = backgroundLayer;
+  scene.transitionTime = min(transitionMs / TRANSITION_TIME_UNIT_MS, 255);
+  
+  nextScene = scene;
+  nextSceneValid = true;
+  flushSceneState(millis(), false);
+}
+
+// Queue a scene received from the master (runs in the WiFi task)
+void processSceneState(const scene_state_t& scene) {
+  if (deviceRole != DEVICE_ROLE_SLAVE || 
+      ledSegmentMode != LED_SEGMENT_MODE_DISTRIBUTED) {
     return;
   }
   
-  // Store the latest reading from this sensor
-  if (sensorData.sensorId <= MAX_SLAVE_DEVICES) {
-    latestSensorData[sensorData.sensorId] = sensorData;
+  portENTER_CRITICAL(&sceneMux);
+  pendingScene = scene;
+  scenePending = true;
+  portEXIT_CRITICAL(&sceneMux);
+  
+  lastSceneReceived = millis();
+}
+
+// Render the latest scene from the master on this slave's segment
+void processPendingSceneState() {
+  if (segmentMapPending) {
+    segment_map_t map;
+    portENTER_CRITICAL(&sceneMux);
+    map = pendingSegmentMap;
+    segmentMapPending = false;
+    portEXIT_CRITICAL(&sceneMux);
     
-    if (ENABLE_ESPNOW_LOGGING) {
-      Serial.printf("ESP-NOW: Stored data from sensor %d: Distance = %d cm\n", 
-                   sensorData.sensorId, sensorData.distance);
+    // The master resends the map periodically - only touch flash when it changed
+    if (!segmentMapsEqual(map, ledSegmentMap)) {
+      ledSegmentMap = map;
+      scheduleSettingsSave(SETTINGS_SECTION_SEGMENT_MAP);
     }
+    applySegmentMap(ledSegmentMap, true);
+  }
+  
+  if (!scenePending) return;
+  
+  scene_state_t scene;
+  portENTER_CRITICAL(&sceneMux);
+  scene = pendingScene;
+  scenePending = false;
+  portEXIT_CRITICAL(&sceneMux);
+  
+  // Render with the master's settings; our own persisted ones stay as they are
+  SceneSettings settings;
+  settings.lightMode = scene.lightMode;
+  settings.brightness = scene.brightness;
+  settings.redValue = scene.redValue;
+  settings.greenValue = scene.greenValue;
+  settings.blueValue = scene.blueValue;
+  settings.backgroundMode = (scene.flags & SCENE_FLAG_BACKGROUND) != 0;
+  settings.directionLightEnabled = (scene.flags & SCENE_FLAG_DIRECTION_LIGHT) != 0;
+  settings.movingLightSpan = scene.movingLightSpan;
+  settings.trailLength = scene.trailLength;
+  settings.effectSpeed = scene.effectSpeed;
+  settings.effectIntensity = scene.effectIntensity;
+  settings.colorPalette = scene.palette < PALETTE_COUNT ? scene.palette : colorPalette;
+  settings.backgroundLayer = scene.backgroundLayer < BACKGROUND_LAYER_COUNT ? scene.backgroundLayer : backgroundLayer;
+  settings.transitionMs = scene.transitionTime * TRANSITION_TIME_UNIT_MS;
+  setFollowedScene(settings);
+  setMotionDirection(scene.direction);
+  
+  // Draw exactly the frame the master drew, over our part of the system strip
+  setRenderWindow(ledSegmentStart, scene.totalLeds, ledSegmentLength, ledSegmentReversed);
+  syncRenderTimebase(scene.frame, scene.startLed);
+  renderScene(scene.startLed);
+}
+
+bool isFollowingMasterScene() {
+  return deviceRole == DEVICE_ROLE_SLAVE &&
+         ledSegmentMode == LED_SEGMENT_MODE_DISTRIBUTED &&
+         lastSceneReceived != 0 &&
+         millis() - lastSceneReceived < ESPNOW_TIMEOUT_MS;
+}
+
+// Process received sensor data (called by master device, under peerMux)
+bool processSensorData(sensor_data_t sensorData) {
+  if (deviceRole != DEVICE_ROLE_MASTER) return false;
+  
+  // Validate incoming data
+  if (sensorData.distance < 0 || sensorData.distance > 500) return false;
+  if (sensorData.sensorId > MAX_SLAVE_DEVICES) return false;
+  
+  // Store the latest reading from this sensor, timed by our own clock
+  sensorData.timestamp = millis();
+  latestSensorData[sensorData.sensorId] = sensorData;
+  
+  // LEDs are updated from the main loop, not from the WiFi task
+  if (!sensorDataPending) {
+    pendingSensorRxMicros = micros();
   }
+  sensorDataPending = true;
+  return true;
+}
+
+// Store the master's own radar reading (called from the main loop)
+void updateLocalSensorReading(int distance, int8_t direction, uint8_t energy) {
+  if (deviceRole != DEVICE_ROLE_MASTER) return;
   
-  // Update LEDs based on combined sensor data
+  latestSensorData[0].sensorId = 0;
+  latestSensorData[0].distance = distance;
+  latestSensorData[0].direction = direction;
+  latestSensorData[0].energy = energy;
+  latestSensorData[0].timestamp = millis();
+  
+  sensorDataPending = true;
+}
+
+void processPendingSensorData() {
+  if (!sensorDataPending || deviceRole != DEVICE_ROLE_MASTER || numSlaveDevices == 0) {
+    return;
+  }
+  
+  unsigned long rxMicros = pendingSensorRxMicros;
+  sensorDataPending = false;
   updateLEDsWithMultiSensorData();
+  
+  // Time from the oldest unhandled packet to the LEDs showing it
+  if (rxMicros != 0) {
+    unsigned long latency = micros() - rxMicros;
+    pendingSensorRxMicros = 0;
+    updateLatencyTotalUs += latency;
+    updateLatencySamples++;
+    if (latency > linkStats.updateLatencyMaxUs) {
+      linkStats.updateLatencyMaxUs = latency;
+    }
+  }
 }
 
 // Enhanced LED update with improved zone-based switching and LED distribution
@@ -499,11 +1122,6 @@ void updateLEDsWithMultiSensorData() {
     lastHealthCheck = currentTime;
   }
   
-  // Store master's own sensor reading
-  latestSensorData[0].sensorId = 0;
-  latestSensorData[0].distance = currentDistance;
-  latestSensorData[0].timestamp = currentTime;
-  
   int selectedDistance = 0;
   
   // Implementation based on the selected sensor priority mode
@@ -528,34 +1146,30 @@ void updateLEDsWithMultiSensorData() {
       break;
     }
     
+    case SENSOR_PRIORITY_FUSION: {
+      selectedDistance = handleFusionPriority(currentTime);
+      break;
+    }
+    
     default: {
       selectedDistance = handleMostRecentPriority(currentTime);
       break;
     }
   }
   
-  // Apply constraints and update LEDs
-  selectedDistance = constrain(selectedDistance, minDistance, maxDistance);
+  // Remember which sensor drove this update
+  selectedSensor = findSelectedSensor(selectedDistance, currentTime);
+  
+  // Apply constraints and update LEDs. Fused positions are in the stair
+  // frame, which reaches past the radar range of any one sensor.
+  int rangeStart, rangeEnd;
+  getPositionRange(&rangeStart, &rangeEnd);
+  selectedDistance = constrain(selectedDistance, rangeStart, rangeEnd);
   currentDistance = selectedDistance;
   
-  if (lightMode == LIGHT_MODE_STANDARD) {
-    if (ledSegmentMode == LED_SEGMENT_MODE_DISTRIBUTED) {
-      // Calculate global LED position
-      int globalStartPos = map(selectedDistance, minDistance, maxDistance, 
-                              0, totalSystemLeds - movingLightSpan);
-      
-      // Update master's segment
-      int localStartPos = globalStartPos - ledSegmentStart;
-      localStartPos = constrain(localStartPos, 0, numLeds - movingLightSpan);
-      
-      updateStandardMode(localStartPos);
-      
-      // Send segment data to slaves
-      sendLEDSegmentData(selectedDistance, globalStartPos);
-    } else {
-      // Continuous mode - normal LED update
-      updateLEDs(selectedDistance);
-    }
+  if (!isSceneAnimated()) {
+    // In distributed mode this renders the master's segment and broadcasts the scene
+    updateLEDs(selectedDistance);
   }
 }
 
@@ -701,20 +1315,174 @@ int handleZoneBasedPriority(unsigned long currentTime) {
   return zoneState.lastSelectedDistance;
 }
 
+// Fuse all sensors in the stair frame and track one position - no hard handoff
+int handleFusionPriority(unsigned long currentTime) {
+  float weightSum = 0;
+  float positionSum = 0;
+  
+  for (int i = 0; i <= numSlaveDevices; i++) {
+    fusionWeights[i] = 0;
+    
+    unsigned long age = currentTime - latestSensorData[i].timestamp;
+    if (latestSensorData[i].timestamp == 0 || age >= FUSION_STALE_MS || 
+        latestSensorData[i].distance <= 0) {
+      continue;
+    }
+    
+    // Older readings fade out instead of being dropped at a fixed boundary
+    float freshness = 1.0f - (float)age / FUSION_STALE_MS;
+    
+    // Radar energy tells how sure the sensor is that someone is there
+    float confidence = max(latestSensorData[i].energy / 100.0f, FUSION_MIN_ENERGY_WEIGHT);
+    
+    float weight = freshness * confidence;
+    
+    // Map the reading into the shared stair frame
+    const sensor_geometry_t& geometry = sensorGeometry[i];
+    float position = geometry.offset + 
+                     (geometry.orientation < 0 ? -1 : 1) * latestSensorData[i].distance;
+    
+    fusionWeights[i] = weight;
+    weightSum += weight;
+    positionSum += weight * position;
+  }
+  
+  if (weightSum > 0) {
+    for (int i = 0; i <= numSlaveDevices; i++) {
+      fusionWeights[i] /= weightSum;
+    }
+  }
+  
+  float dt = (currentTime - fusionTracker.lastUpdateTime) / 1000.0f;
+  dt = constrain(dt, 0.001f, 1.0f);
+  fusionTracker.lastUpdateTime = currentTime;
+  
+  if (weightSum <= 0) {
+    // Nobody seen - hold the last position and let the velocity die out
+    fusionTracker.velocity *= 0.5f;
+    return fusionTracker.initialized ? (int)fusionTracker.position : currentDistance;
+  }
+  
+  float measured = positionSum / weightSum;
+  
+  if (!fusionTracker.initialized) {
+    fusionTracker.position = measured;
+    fusionTracker.velocity = 0;
+    fusionTracker.initialized = true;
+    return (int)measured;
+  }
+  
+  // Alpha-beta update: predict, then correct by a fraction of the residual
+  float predicted = fusionTracker.position + fusionTracker.velocity * dt;
+  float residual = measured - predicted;
+  
+  fusionTracker.position = predicted + FUSION_TRACKER_ALPHA * residual;
+  fusionTracker.velocity += FUSION_TRACKER_BETA * residual / dt;
+  fusionTracker.velocity = constrain(fusionTracker.velocity, -200.0f, 200.0f); // Maximum 2 m/s
+  
+  return (int)fusionTracker.position;
+}
+
+bool setSensorGeometry(uint8_t sensorId, int offset, int orientation) {
+  if (sensorId > MAX_SLAVE_DEVICES) return false;
+  
+  sensorGeometry[sensorId].offset = constrain(offset, -32768, 32767);
+  sensorGeometry[sensorId].orientation = (orientation < 0) ? -1 : 1;
+  scheduleSettingsSave(SETTINGS_SECTION_SENSOR_GEOMETRY);
+  
+  // Re-acquire instead of sliding across the old frame
+  fusionTracker.initialized = false;
+  
+  if (ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Sensor %d geometry - Offset: %d cm, Orientation: %d\n", 
+                 sensorId, sensorGeometry[sensorId].offset, sensorGeometry[sensorId].orientation);
+  }
+  return true;
+}
+
+void getPositionRange(int* start, int* end) {
+  *start = minDistance;
+  *end = maxDistance;
+  if (deviceRole != DEVICE_ROLE_MASTER || numSlaveDevices == 0 ||
+      sensorPriorityMode != SENSOR_PRIORITY_FUSION) {
+    return;
+  }
+  
+  // Everything any sensor can see, in stair coordinates
+  for (int i = 0; i <= numSlaveDevices; i++) {
+    const sensor_geometry_t& geometry = sensorGeometry[i];
+    int direction = (geometry.orientation < 0) ? -1 : 1;
+    int nearEdge = geometry.offset + direction * minDistance;
+    int farEdge = geometry.offset + direction * maxDistance;
+    *start = min(*start, min(nearEdge, farEdge));
+    *end = max(*end, max(nearEdge, farEdge));
+  }
+}
+
+void copySensorReadings(sensor_data_t* readings) {
+  portENTER_CRITICAL(&peerMux);
+  memcpy(readings, latestSensorData, sizeof(latestSensorData));
+  portEXIT_CRITICAL(&peerMux);
+}
+
+float getSensorFusionWeight(uint8_t sensorId) {
+  if (sensorId <= MAX_SLAVE_DEVICES) {
+    return fusionWeights[sensorId];
+  }
+  return 0;
+}
+
+// Fusion: the heaviest contributor. Other modes: the freshest sensor reporting the selected distance
+int findSelectedSensor(int distance, unsigned long currentTime) {
+  int best = -1;
+  
+  if (sensorPriorityMode == SENSOR_PRIORITY_FUSION) {
+    float bestWeight = 0;
+    for (int i = 0; i <= numSlaveDevices; i++) {
+      if (fusionWeights[i] > bestWeight) {
+        bestWeight = fusionWeights[i];
+        best = i;
+      }
+    }
+    return best;
+  }
+  
+  unsigned long newest = 0;
+  for (int i = 0; i <= numSlaveDevices; i++) {
+    if (latestSensorData[i].distance != distance) continue;
+    if (currentTime - latestSensorData[i].timestamp > 5000) continue;
+    if (best < 0 || latestSensorData[i].timestamp > newest) {
+      newest = latestSensorData[i].timestamp;
+      best = i;
+    }
+  }
+  return best;
+}
+
+int getSelectedSensor() {
+  // Without slaves the local radar is the only source
+  if (deviceRole != DEVICE_ROLE_MASTER || numSlaveDevices == 0) {
+    return 0;
+  }
+  return selectedSensor;
+}
+
 // Set the sensor priority mode
 void setSensorPriorityMode(uint8_t mode) {
-  if (mode <= SENSOR_PRIORITY_ZONE_BASED) {
+  if (mode <= SENSOR_PRIORITY_FUSION) {
     sensorPriorityMode = mode;
-    EEPROM.write(EEPROM_ADDR_SENSOR_PRIORITY_MODE, sensorPriorityMode);
-    EEPROM.commit();
+    scheduleSettingsSave(SETTINGS_SECTION_ESPNOW);
     
     // Reset zone state when changing modes
     if (mode == SENSOR_PRIORITY_ZONE_BASED) {
       zoneState.initialized = false;
     }
+    if (mode == SENSOR_PRIORITY_FUSION) {
+      fusionTracker.initialized = false;
+    }
     
     if (ENABLE_ESPNOW_LOGGING) {
-      const char* modeNames[] = {"Most Recent", "Slave First", "Master First", "Zone-Based"};
+      const char* modeNames[] = {"Most Recent", "Slave First", "Master First", "Zone-Based", "Fusion"};
       Serial.printf("ESP-NOW: Sensor priority mode set to %s (%d)\n", 
                    modeNames[mode], mode);
     }
@@ -730,7 +1498,7 @@ uint8_t getSensorPriorityMode() {
 void setLEDSegmentMode(int mode) {
   if (mode == LED_SEGMENT_MODE_CONTINUOUS || mode == LED_SEGMENT_MODE_DISTRIBUTED) {
     ledSegmentMode = mode;
-    saveLEDDistributionSettings();  // This function is from eeprom_manager
+    scheduleSettingsSave(SETTINGS_SECTION_LED_DISTRIBUTION);
     
     if (ENABLE_ESPNOW_LOGGING) {
       Serial.printf("ESP-NOW: LED segment mode set to %s\n", 
@@ -748,7 +1516,7 @@ void setLEDSegmentInfo(int start, int length, int total) {
   ledSegmentLength = constrain(length, 1, total);
   totalSystemLeds = constrain(total, 1, MAX_SUPPORTED_LEDS);
   
-  saveLEDDistributionSettings();  // This function is from eeprom_manager
+  scheduleSettingsSave(SETTINGS_SECTION_LED_DISTRIBUTION);
   
   Serial.printf("ESP-NOW: LED segment info set - Start: %d, Length: %d, Total: %d\n", 
                 ledSegmentStart, ledSegmentLength, totalSystemLeds);
@@ -776,6 +1544,41 @@ uint32_t getSensorPacketCount(uint8_t sensorId) {
   return 0;
 }
 
+uint32_t getSensorPacketsLost(uint8_t sensorId) {
+  if (sensorId <= MAX_SLAVE_DEVICES) {
+    return slaveHealth[sensorId].packetsLost;
+  }
+  return 0;
+}
+
+void getESPNOWStats(espnow_stats_t* stats) {
+  *stats = linkStats;
+  stats->rxTimeAvgUs = linkStats.packetsReceived ? 
+                       (uint32_t)(rxTimeTotalUs / linkStats.packetsReceived) : 0;
+  stats->updateLatencyAvgUs = updateLatencySamples ? 
+                              (uint32_t)(updateLatencyTotalUs / updateLatencySamples) : 0;
+}
+
+void resetESPNOWStats() {
+  memset(&linkStats, 0, sizeof(linkStats));
+  rxTimeTotalUs = 0;
+  updateLatencyTotalUs = 0;
+  updateLatencySamples = 0;
+}
+
+void setFaultInjection(uint8_t lossPercent, uint8_t duplicatePercent, uint8_t reorderPercent) {
+  faultConfig.lossPercent = min((int)lossPercent, 100);
+  faultConfig.duplicatePercent = min((int)duplicatePercent, 100);
+  faultConfig.reorderPercent = min((int)reorderPercent, 100);
+  
+  if (!ENABLE_ESPNOW_FAULT_INJECTION) {
+    Serial.println("ESP-NOW: Fault injection is compiled out (ENABLE_ESPNOW_FAULT_INJECTION)");
+  } else {
+    Serial.printf("ESP-NOW: Fault injection - Loss: %d%%, Duplicate: %d%%, Reorder: %d%%\n", 
+                 faultConfig.lossPercent, faultConfig.duplicatePercent, faultConfig.reorderPercent);
+  }
+}
+
 // Get last received time for diagnostics
 unsigned long getSensorLastReceived(uint8_t sensorId) {
   if (sensorId <= MAX_SLAVE_DEVICES) {
@@ -824,6 +1627,15 @@ void printESPNOWDiagnostics() {
                     zoneState.usingSlaveReading ? "Slave" : "Master",
                     millis() - zoneState.lastSwitchTime);
     }
+    
+    if (sensorPriorityMode == SENSOR_PRIORITY_FUSION) {
+      Serial.printf("Fusion Tracker: Position %.1f cm, Velocity %.1f cm/s\n",
+                    fusionTracker.position, fusionTracker.velocity);
+      for (int i = 0; i <= numSlaveDevices; i++) {
+        Serial.printf("Sensor %d: Offset %d cm, Orientation %d, Weight %.2f\n",
+                      i, sensorGeometry[i].offset, sensorGeometry[i].orientation, fusionWeights[i]);
+      }
+    }
   } else {
     char macStr[18];
     sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
@@ -832,6 +1644,17 @@ void printESPNOWDiagnostics() {
     Serial.printf("Master MAC: %s\n", macStr);
   }
   
+  // Receive path statistics
+  espnow_stats_t stats;
+  getESPNOWStats(&stats);
+  Serial.printf("Packets: %lu received, %lu lost, %lu duplicated, %lu reordered, %lu unpaired\n",
+                (unsigned long)stats.packetsReceived, (unsigned long)stats.packetsLost,
+                (unsigned long)stats.packetsDuplicated, (unsigned long)stats.packetsReordered,
+                (unsigned long)stats.packetsUnpaired);
+  Serial.printf("Receive CPU: avg %lu us, max %lu us; Update latency: avg %lu us, max %lu us\n",
+                (unsigned long)stats.rxTimeAvgUs, (unsigned long)stats.rxTimeMaxUs,
+                (unsigned long)stats.updateLatencyAvgUs, (unsigned long)stats.updateLatencyMaxUs);
+  
   // Memory usage
   Serial.printf("Free Heap: %d bytes\n", ESP.getFreeHeap());
   Serial.printf("Min Free Heap: %d bytes\n", ESP.getMinFreeHeap());
@@ -845,36 +1668,14 @@ void synchronizeAllDevices() {
   
   Serial.println("ESP-NOW: Synchronizing all devices...");
   
-  // Send current settings to all slaves
-  led_segment_data_t syncData;
-  syncData.sensorId = 0;
-  syncData.distance = currentDistance;
-  syncData.direction = 0;
-  syncData.timestamp = millis();
-  syncData.totalLeds = totalSystemLeds;
-  syncData.lightMode = lightMode;
-  syncData.brightness = brightness;
-  syncData.redValue = redValue;
-  syncData.greenValue = greenValue;
-  syncData.blueValue = blueValue;
+  // Segment layout first, so slaves draw the scene in the right place
+  sendSegmentMap();
   
-  for (int i = 0; i < numSlaveDevices; i++) {
-    // Calculate segment for this slave
-    int ledsPerDevice = totalSystemLeds / (numSlaveDevices + 1);
-    syncData.startLed = (i + 1) * ledsPerDevice;
-    syncData.segmentLength = ledsPerDevice;
-    
-    esp_err_t result = esp_now_send(slaveAddresses[i], 
-                                    (uint8_t*)&syncData, 
-                                    sizeof(led_segment_data_t));
-    
-    if (result == ESP_OK) {
-      Serial.printf("ESP-NOW: Sync data sent to slave %d\n", i);
-    } else {
-      Serial.printf("ESP-NOW: Failed to sync slave %d (error: %d)\n", i, result);
-    }
-    
-    delay(10); // Small delay between sends
+  // Then the scene, sent now even if the slaves already have it
+  if (nextSceneValid) {
+    flushSceneState(millis(), true);
+  } else {
+    updateLEDs(currentDistance);  // Draws and broadcasts the first one
   }
   
   Serial.println("ESP-NOW: Synchronization complete");
@@ -919,16 +1720,11 @@ void emergencyStopAllLEDs() {
     strip.clear();
     strip.show();
     
-    // Send emergency stop to all slaves
-    led_segment_data_t stopData = {0};
-    stopData.sensorId = 255; // Special ID for emergency stop
-    stopData.distance = 0;
-    stopData.timestamp = millis();
-    stopData.brightness = 0;
-    
-    for (int i = 0; i < numSlaveDevices; i++) {
-      esp_now_send(slaveAddresses[i], (uint8_t*)&stopData, sizeof(led_segment_data_t));
-      delay(5);
+    // Slaves draw the current scene at zero brightness
+    if (nextSceneValid) {
+      scene_state_t stopScene = nextScene;
+      stopScene.brightness = 0;
+      esp_now_send(broadcastAddress, (uint8_t*)&stopScene, sizeof(scene_state_t));
     }
   } else {
     // Slave emergency stop
@@ -973,15 +1769,107 @@ void checkPacketLoss() {
   }
 }
 
-// Auto-discovery mode for new slaves
+// Broadcast a probe; every device in range answers with an announce
+static void sendDiscoveryProbe() {
+  discovery_probe_t probe;
+  probe.packetType = ESPNOW_PACKET_DISCOVERY_PROBE;
+  probe.protocolVersion = DISCOVERY_PROTOCOL_VERSION;
+  
+  esp_err_t result = esp_now_send(broadcastAddress, (uint8_t*)&probe, sizeof(probe));
+  if (result != ESP_OK && ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Failed to send discovery probe (error: %d)\n", result);
+  }
+}
+
+// Broadcast this device's role and capabilities
+static void sendAnnounce() {
+  static const uint8_t noMaster[6] = {0};
+  
+  discovery_announce_t announce = {};
+  announce.packetType = ESPNOW_PACKET_ANNOUNCE;
+  announce.protocolVersion = DISCOVERY_PROTOCOL_VERSION;
+  announce.role = deviceRole;
+  if (deviceRole == DEVICE_ROLE_SLAVE && memcmp(masterAddress, noMaster, 6) != 0) {
+    announce.flags |= ANNOUNCE_FLAG_PAIRED;
+  }
+  announce.numLeds = numLeds;
+  
+  // Same name as the setup AP, so the device is recognizable in both places
+  snprintf(announce.name, sizeof(announce.name), AMBISENSE_DEVICE_PREFIX "-%04X",
+           (unsigned)(ESP.getEfuseMac() & 0xFFFF));
+  strncpy(announce.firmware, FIRMWARE_VERSION, sizeof(announce.firmware) - 1);
+  
+  esp_err_t result = esp_now_send(broadcastAddress, (uint8_t*)&announce, sizeof(announce));
+  if (ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Announce %s\n", result == ESP_OK ? "sent" : "failed");
+  }
+}
+
+// Send due announces and probes (main loop)
+static void serviceDiscovery(unsigned long now) {
+  if (announcePending && (long)(now - announceDueTime) >= 0) {
+    announcePending = false;
+    sendAnnounce();
+  }
+  
+  bool probeDue = false;
+  bool finished = false;
+  portENTER_CRITICAL(&discoveryMux);
+  if (discoveryActive) {
+    if ((long)(now - discoveryEndTime) >= 0) {
+      discoveryActive = false;
+      finished = true;
+    } else if ((long)(now - nextProbeTime) >= 0) {
+      nextProbeTime = now + ESPNOW_DISCOVERY_PROBE_INTERVAL_MS;
+      probeDue = true;
+    }
+  }
+  portEXIT_CRITICAL(&discoveryMux);
+  
+  if (probeDue) {
+    sendDiscoveryProbe();
+  }
+  if (finished && ENABLE_ESPNOW_LOGGING) {
+    Serial.println("ESP-NOW: Discovery finished");
+  }
+}
+
+// Open a discovery window; probes go out from the main loop
 void startSlaveDiscovery(unsigned long duration) {
-  if (deviceRole != DEVICE_ROLE_MASTER) return;
+  if (deviceRole != DEVICE_ROLE_MASTER || !espnowReady) return;
   
-  Serial.printf("ESP-NOW: Starting slave discovery for %lu seconds\n", duration / 1000);
+  unsigned long now = millis();
+  portENTER_CRITICAL(&discoveryMux);
+  discoveryActive = true;
+  discoveryEndTime = now + duration;
+  nextProbeTime = now;
+  portEXIT_CRITICAL(&discoveryMux);
   
-  // Implementation would involve listening for discovery packets
-  // and automatically adding responsive slaves
-  // This is a framework for future enhancement
+  if (ENABLE_ESPNOW_LOGGING) {
+    Serial.printf("ESP-NOW: Starting slave discovery for %lu ms\n", duration);
+  }
+}
+
+bool isSlaveDiscoveryActive() {
+  portENTER_CRITICAL(&discoveryMux);
+  bool active = discoveryActive;
+  portEXIT_CRITICAL(&discoveryMux);
+  return active;
+}
+
+int getDiscoveredPeers(discovered_peer_t* peers, int maxPeers) {
+  unsigned long now = millis();
+  int count = 0;
+  
+  portENTER_CRITICAL(&discoveryMux);
+  for (int i = 0; i < discoveredPeerCount && count < maxPeers; i++) {
+    if (now - discoveredPeers[i].lastSeen <= ESPNOW_DISCOVERY_PEER_TIMEOUT_MS) {
+      peers[count++] = discoveredPeers[i];
+    }
+  }
+  portEXIT_CRITICAL(&discoveryMux);
+  
+  return count;
 }
 
 // Network performance metrics
@@ -1011,12 +1899,28 @@ void espnowMaintenance() {
   static unsigned long lastMaintenance = 0;
   unsigned long currentTime = millis();
   
+  if (storedSegmentMapPending) {
+    storedSegmentMapPending = false;
+    applySegmentMap(ledSegmentMap, false);
+  }
+  
+  serviceDiscovery(currentTime);
+  
+  // Scene changes held back by the rate limit, and keepalives
+  if (deviceRole == DEVICE_ROLE_MASTER && ledSegmentMode == LED_SEGMENT_MODE_DISTRIBUTED &&
+      numSlaveDevices > 0) {
+    flushSceneState(currentTime, false);
+  }
+  
   if (currentTime - lastMaintenance > 5000) { // Every 5 seconds
     lastMaintenance = currentTime;
     
     checkConnectionHealth();
     checkPacketLoss();
     
+    // Resend the segment map so slaves that rebooted or missed it pick it up
+    sendSegmentMap();
+    
     // Additional maintenance tasks can be added here
   }
 }
\ No newline at end of file
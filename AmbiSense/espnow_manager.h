@@ -8,30 +8,142 @@
 // Data structure for ESP-NOW communication
 typedef struct sensor_data_t {
   uint8_t sensorId;     // Identifier for the sending sensor
+  uint16_t sequence;    // Per-sender packet counter (0 = sender restarted)
   int distance;         // Distance reading in cm
   int8_t direction;     // -1: moving closer, 0: stationary, 1: moving away
   uint8_t battery;      // Battery level (if applicable)
-  uint32_t timestamp;   // Milliseconds since boot
+  uint8_t energy;       // Radar target energy (0-100), used as fusion confidence
+  uint32_t timestamp;   // Milliseconds since boot (the master stores its receive time)
 } sensor_data_t;
 
-typedef struct led_segment_data_t {
-  uint8_t sensorId;
-  int distance;
-  int8_t direction;
-  uint32_t timestamp;
-  
-  // LED segment control
-  int startLed;      // Which LED this device should start from
-  int segmentLength; // How many LEDs this device controls
-  int totalLeds;     // Total LEDs in the system
-  uint8_t lightMode; // Current light mode
-  uint8_t brightness; // Current brightness
+// Where a sensor sits in the shared stair frame (cm along the walking path)
+typedef struct sensor_geometry_t {
+  int16_t offset;       // Stair position of the sensor
+  int8_t orientation;   // 1: readings grow along the path, -1: sensor faces back down it
+} sensor_geometry_t;
+
+// Packet type marker for scene state packets
+#define ESPNOW_PACKET_SCENE_STATE 0xA5
+
+// Scene flags
+#define SCENE_FLAG_BACKGROUND      0x01
+#define SCENE_FLAG_DIRECTION_LIGHT 0x02
+
+// Compact scene description broadcast by the master every frame (distributed mode).
+// Slaves run the same renderer on it for their own segment - no pixel data is sent.
+typedef struct scene_state_t {
+  uint8_t packetType;       // ESPNOW_PACKET_SCENE_STATE
+  uint8_t lightMode;
+  uint8_t brightness;
+  uint8_t flags;            // SCENE_FLAG_* bits
   uint8_t redValue;
   uint8_t greenValue;
   uint8_t blueValue;
-} led_segment_data_t;
+  int8_t direction;         // Last motion direction (-1, 0, 1)
+  uint32_t frame;           // Master render frame counter (shared timebase)
+  int16_t startLed;         // Global LED index of the motion window (center shift applied)
+  uint16_t totalLeds;       // Total LEDs in the system
+  uint16_t movingLightSpan;
+  uint8_t trailLength;
+  uint8_t effectSpeed;
+  uint8_t effectIntensity;
+  uint8_t palette;          // PALETTE_* for palette effects (a custom palette stays per device)
+  uint8_t backgroundLayer;  // BACKGROUND_LAYER_* under the moving light
+  uint8_t transitionTime;   // Crossfade duration in TRANSITION_TIME_UNIT_MS steps
+} scene_state_t;
+
+// Packet type marker for segment map packets
+#define ESPNOW_PACKET_SEGMENT_MAP 0xA6
+
+// Segment flags
+#define SEGMENT_FLAG_REVERSED 0x01  // Strip is fed from the top of its run
+
+// One entry per device, including the master
+#define MAX_SEGMENT_MAP_ENTRIES (MAX_SLAVE_DEVICES + 1)
+
+// Where one device's strip sits along the stairs. Global LED indices follow the
+// walking path, so a landing or corner without LEDs is simply a gap between the
+// end of one segment and the start of the next.
+typedef struct __attribute__((packed)) led_segment_entry_t {
+  uint8_t mac[6];           // Device that owns this segment
+  uint16_t start;           // Global index of the segment's first LED
+  uint16_t length;          // LEDs in the segment
+  uint8_t flags;            // SEGMENT_FLAG_* bits
+} led_segment_entry_t;
+
+// Segment table for the whole installation, kept by the master and sent to all
+// slaves as a single packet (distributed mode)
+typedef struct __attribute__((packed)) segment_map_t {
+  uint8_t packetType;       // ESPNOW_PACKET_SEGMENT_MAP
+  uint8_t count;            // Used entries (0 = every device uses its own segment settings)
+  uint16_t totalLeds;       // Length of the walking path in LEDs, gaps included
+  led_segment_entry_t entries[MAX_SEGMENT_MAP_ENTRIES];
+} segment_map_t;
+
+static_assert(sizeof(segment_map_t) <= ESP_NOW_MAX_DATA_LEN, "Segment map must fit in one ESP-NOW packet");
+
+// Packet type markers for discovery
+#define ESPNOW_PACKET_DISCOVERY_PROBE 0xA7  // Master asking which devices are in range
+#define ESPNOW_PACKET_ANNOUNCE        0xA8  // A device describing itself
+
+#define DISCOVERY_PROTOCOL_VERSION 1
+
+// Announce flags
+#define ANNOUNCE_FLAG_PAIRED 0x01  // Device already has a master configured
+
+#define DEVICE_NAME_SIZE 16  // "AmbiSense-XXXX", as used for the setup AP
+#define FIRMWARE_VERSION_SIZE 12
+
+// Broadcast by the master; every device that hears it answers with an announce
+typedef struct __attribute__((packed)) discovery_probe_t {
+  uint8_t packetType;       // ESPNOW_PACKET_DISCOVERY_PROBE
+  uint8_t protocolVersion;
+} discovery_probe_t;
+
+// Broadcast by a device at startup and in answer to a probe
+typedef struct __attribute__((packed)) discovery_announce_t {
+  uint8_t packetType;       // ESPNOW_PACKET_ANNOUNCE
+  uint8_t protocolVersion;
+  uint8_t role;             // DEVICE_ROLE_*
+  uint8_t flags;            // ANNOUNCE_FLAG_* bits
+  uint16_t numLeds;         // LEDs on this device's strip
+  char name[DEVICE_NAME_SIZE];
+  char firmware[FIRMWARE_VERSION_SIZE];
+} discovery_announce_t;
+
+// Sensor packets are recognized by length alone
+static_assert(sizeof(discovery_announce_t) != sizeof(sensor_data_t),
+              "Announce must not be mistaken for an untagged packet");
+
+// A device that answered discovery, as kept by the master
+typedef struct discovered_peer_t {
+  uint8_t mac[6];           // Address the announce came from (the one to pair)
+  uint8_t role;
+  uint8_t flags;
+  uint16_t numLeds;
+  int8_t rssi;
+  char name[DEVICE_NAME_SIZE];
+  char firmware[FIRMWARE_VERSION_SIZE];
+  unsigned long lastSeen;   // millis() of the last announce
+} discovered_peer_t;
+
+// Receive-path statistics for the ESP-NOW link
+typedef struct espnow_stats_t {
+  uint32_t packetsReceived;     // Packets handled by the receive callback
+  uint32_t packetsLost;         // Gaps in sensor packet sequence numbers
+  uint32_t packetsDuplicated;   // Sensor packets received more than once
+  uint32_t packetsReordered;    // Sensor packets older than one already received
+  uint32_t packetsInjectedLoss; // Packets dropped by fault injection
+  uint32_t packetsUnpaired;     // Sensor packets from devices that are not paired
+  uint32_t rxTimeAvgUs;         // Receive callback CPU time per packet
+  uint32_t rxTimeMaxUs;
+  uint32_t updateLatencyAvgUs;  // Sensor packet receipt to LED update
+  uint32_t updateLatencyMaxUs;
+} espnow_stats_t;
 
 extern sensor_data_t latestSensorData[MAX_SLAVE_DEVICES + 1];
+extern sensor_geometry_t sensorGeometry[MAX_SLAVE_DEVICES + 1];
+extern segment_map_t ledSegmentMap;
 
 /**
  * Initialize ESP-NOW communication with improved error handling
@@ -49,6 +161,33 @@ void configureMasterPeers();
  */
 void configureSlavePeer();
 
+/**
+ * Rebuild the MAC to slot lookup after the paired slave list changes
+ */
+void rebuildPeerIndex();
+
+/**
+ * Find the sensor slot of a paired slave in constant time
+ * @param mac Slave MAC address
+ * @return Sensor slot (1..numSlaveDevices), or -1 if the MAC is not paired
+ */
+int findSlaveSlot(const uint8_t* mac);
+
+/**
+ * Pair another slave in the next free slot, which starts with no health
+ * history, sequence or reading
+ * @param mac Slave MAC address
+ * @return false if all slots are taken
+ */
+bool addSlaveSlot(const uint8_t* mac);
+
+/**
+ * Unpair a slave. The slaves after it move down one slot together with
+ * their geometry, health, sequence tracking and latest reading.
+ * @param index Position in slaveAddresses (slot - 1)
+ */
+void removeSlaveSlot(int index);
+
 /**
  * Send test message from slave to master
  */
@@ -74,14 +213,30 @@ void checkConnectionHealth();
  * Send sensor data from slave to master with retry logic
  * @param distance The current distance reading
  * @param direction The detected direction of movement
+ * @param energy Radar target energy (0-100)
  */
-void sendSensorData(int distance, int8_t direction);
+void sendSensorData(int distance, int8_t direction, uint8_t energy);
 
 /**
- * Process received sensor data (called by master device)
+ * Process received sensor data (called by master device). The receive
+ * callback calls it while holding the peer table lock, so it must not log.
  * @param sensorData The sensor data structure received
+ * @return false if the reading was discarded
+ */
+bool processSensorData(sensor_data_t sensorData);
+
+/**
+ * Store the master's own radar reading alongside the slave readings
+ * @param distance The current distance reading
+ * @param direction The detected direction of movement
+ * @param energy Radar target energy (0-100)
+ */
+void updateLocalSensorReading(int distance, int8_t direction, uint8_t energy);
+
+/**
+ * Combine new sensor readings and update the LEDs - call this from the main loop
  */
-void processSensorData(sensor_data_t sensorData);
+void processPendingSensorData();
 
 /**
  * Update LEDs with combined sensor data using enhanced algorithms
@@ -95,10 +250,57 @@ int handleMostRecentPriority(unsigned long currentTime);
 int handleSlaveFirstPriority(unsigned long currentTime);
 int handleMasterFirstPriority(unsigned long currentTime);
 int handleZoneBasedPriority(unsigned long currentTime);
+int handleFusionPriority(unsigned long currentTime);
+
+/**
+ * Set a sensor's position in the stair frame used by fusion mode
+ * @param sensorId Sensor slot (0 = master, 1.. = paired slaves)
+ * @param offset Stair position of the sensor in cm
+ * @param orientation 1 if readings grow along the path, -1 if they shrink
+ * @return True if the sensor slot exists
+ */
+bool setSensorGeometry(uint8_t sensorId, int offset, int orientation);
+
+/**
+ * Get the range of positions the LEDs are spread over: the radar's distance
+ * range, or in fusion mode the part of the stair frame the sensors cover
+ * (their offsets plus the radar range, in either direction)
+ * @param start Lowest position in cm
+ * @param end Highest position in cm
+ */
+void getPositionRange(int* start, int* end);
+
+/**
+ * Copy the latest reading of every sensor slot. The receive callback stores
+ * readings from the WiFi task; the copy is taken under the same lock.
+ * @param readings MAX_SLAVE_DEVICES + 1 entries, slot 0 is the master
+ */
+void copySensorReadings(sensor_data_t* readings);
+
+/**
+ * Get a sensor's weight in the last fused position (fusion mode)
+ * @param sensorId Sensor slot
+ * @return Normalized weight (0.0-1.0)
+ */
+float getSensorFusionWeight(uint8_t sensorId);
+
+/**
+ * Find the sensor that produced a selected distance
+ * @param distance Distance chosen by the priority mode
+ * @param currentTime Current time in ms
+ * @return Sensor slot, or -1 if no fresh sensor matches
+ */
+int findSelectedSensor(int distance, unsigned long currentTime);
+
+/**
+ * Get the sensor that drove the last LED update
+ * @return Sensor slot (0 = master), or -1 while holding the last position
+ */
+int getSelectedSensor();
 
 /**
  * Set the sensor priority mode
- * @param mode The priority mode to set (0-3)
+ * @param mode The priority mode to set (0-4)
  */
 void setSensorPriorityMode(uint8_t mode);
 
@@ -118,24 +320,70 @@ void setLEDSegmentInfo(int start, int length, int total);
 void getLEDSegmentInfo(int* start, int* length, int* total);
 
 /**
- * Send LED segment data to slaves (for distributed mode)
- * @param distance Current distance reading
- * @param globalStartPos Global LED position
+ * Validate a segment map (entries inside the path, no duplicate devices)
+ * @param map Segment map to check
+ * @return True if the map can be used
+ */
+bool validateSegmentMap(const segment_map_t& map);
+
+/**
+ * Replace the master's segment map, apply this device's entry, save and distribute it
+ * @param map New segment map
+ * @return True if the map was valid and applied
+ */
+bool setSegmentMap(const segment_map_t& map);
+
+/**
+ * Apply this device's entry of the segment map to the LED distribution settings
+ * @param map Segment map to look up
+ * @param persist Save the settings if they changed
+ */
+void applySegmentMap(const segment_map_t& map, bool persist);
+
+/**
+ * Find a device's entry in a segment map
+ * @param map Segment map to search
+ * @param mac Device MAC address
+ * @return Entry for the device, or NULL if it has none
+ */
+const led_segment_entry_t* findSegmentEntry(const segment_map_t& map, const uint8_t* mac);
+
+/**
+ * Send the segment map to all slaves (master, distributed mode only)
+ */
+void sendSegmentMap();
+
+/**
+ * Queue a segment map received from the master (called from the receive callback)
+ * @param map Segment map packet
+ */
+void processSegmentMap(const segment_map_t& map);
+
+/**
+ * Broadcast the scene just drawn to all slaves (master, distributed mode only).
+ * Unchanged scenes and changes faster than SCENE_BROADCAST_INTERVAL_MS are
+ * held back; espnowMaintenance() sends the latest one when it is due.
+ * @param startLed Global LED index of the motion window
+ */
+void sendSceneState(int startLed);
+
+/**
+ * Queue a scene received from the master (called from the receive callback)
+ * @param scene Scene state packet
  */
-void sendLEDSegmentData(int distance, int globalStartPos);
+void processSceneState(const scene_state_t& scene);
 
 /**
- * Process LED segment data (on slave devices)
- * @param segmentData LED segment data structure
+ * Apply a queued segment map and render the most recent queued scene, if any -
+ * call this from the main loop
  */
-void processLEDSegmentData(struct led_segment_data_t segmentData);
+void processPendingSceneState();
 
 /**
- * Update LED segment for distributed mode
- * @param globalStartPos Global LED start position
- * @param segmentData LED segment data
+ * Check whether this slave is currently rendering scenes from the master
+ * @return True if a scene was received recently
  */
-void updateLEDSegment(int globalStartPos, struct led_segment_data_t segmentData);
+bool isFollowingMasterScene();
 
 /**
  * Get connection health status for diagnostics
@@ -151,6 +399,32 @@ bool getSensorHealth(uint8_t sensorId);
  */
 uint32_t getSensorPacketCount(uint8_t sensorId);
 
+/**
+ * Get number of sensor packets missing from the sequence
+ * @param sensorId The sensor ID to check
+ * @return Number of packets lost
+ */
+uint32_t getSensorPacketsLost(uint8_t sensorId);
+
+/**
+ * Get ESP-NOW receive statistics
+ * @param stats Structure to fill
+ */
+void getESPNOWStats(espnow_stats_t* stats);
+
+/**
+ * Clear ESP-NOW receive statistics
+ */
+void resetESPNOWStats();
+
+/**
+ * Configure receive fault injection (needs ENABLE_ESPNOW_FAULT_INJECTION)
+ * @param lossPercent Chance of dropping a packet
+ * @param duplicatePercent Chance of handling a packet twice
+ * @param reorderPercent Chance of holding a packet back until after the next one
+ */
+void setFaultInjection(uint8_t lossPercent, uint8_t duplicatePercent, uint8_t reorderPercent);
+
 /**
  * Get last received time for diagnostics
  * @param sensorId The sensor ID to check
@@ -196,11 +470,26 @@ void processEmergencyStop();
 void checkPacketLoss();
 
 /**
- * Auto-discovery mode for new slaves
+ * Probe for devices in range over ESP-NOW (master only). Answers keep
+ * arriving in the peer table while the window is open; returns immediately.
  * @param duration Discovery duration in milliseconds
  */
 void startSlaveDiscovery(unsigned long duration);
 
+/**
+ * Check whether a discovery window is open
+ * @return True while probes are still being sent
+ */
+bool isSlaveDiscoveryActive();
+
+/**
+ * Copy the devices that answered discovery or announced themselves
+ * @param peers Destination array
+ * @param maxPeers Size of the destination array
+ * @return Number of peers copied
+ */
+int getDiscoveredPeers(discovered_peer_t* peers, int maxPeers);
+
 /**
  * Network performance metrics
  * @param totalPacketsReceived Total packets received across all sensors
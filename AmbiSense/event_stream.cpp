@@ -0,0 +1,177 @@
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include "config.h"
+#include "web_interface.h"
+#include "event_stream.h"
+#include "led_controller.h"
+#include "radar_manager.h"
+#include "espnow_manager.h"
+
+// Longest frame: "data:-2147483648,-200,-1,65535\n\n"
+#define EVENT_FRAME_SIZE 48
+
+struct EventClient {
+  WiFiClient client;
+  bool active;
+  uint16_t intervalMs;
+  unsigned long lastFrameTime;   // Last frame considered for this client
+  unsigned long lastSendTime;    // Last time the socket accepted data
+  char pending[EVENT_FRAME_SIZE];  // Frame the socket hasn't fully taken yet
+  uint8_t pendingLength;
+  uint8_t pendingOffset;
+
+  // Values in the last data frame, for change detection
+  bool sentOnce;
+  int lastDistance;
+  int lastVelocity;
+  int lastSensor;
+  int lastFps;
+};
+
+static EventClient eventClients[EVENT_STREAM_MAX_CLIENTS];
+
+// Render rate, measured once a second from the shared frame counter
+static uint32_t fpsFrameMark = 0;
+static unsigned long fpsTimeMark = 0;
+static int measuredFps = 0;
+
+static void dropClient(EventClient& ec) {
+  ec.client.stop();
+  ec.active = false;
+
+  if (ENABLE_DEBUG_LOGGING) {
+    Serial.println("[Events] Stream client dropped");
+  }
+}
+
+// Write as much of the pending frame as the socket takes right now.
+// Returns false if the connection has failed.
+static bool flushPending(EventClient& ec, unsigned long now) {
+  while (ec.pendingOffset < ec.pendingLength) {
+    int n = send(ec.client.fd(), ec.pending + ec.pendingOffset,
+                 ec.pendingLength - ec.pendingOffset, MSG_DONTWAIT);
+    if (n > 0) {
+      ec.pendingOffset += n;
+      ec.lastSendTime = now;
+    } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return true;  // Send buffer full - finish on a later loop
+    } else {
+      return false;
+    }
+  }
+
+  ec.pendingLength = 0;
+  ec.pendingOffset = 0;
+  return true;
+}
+
+void handleEventStream() {
+  int slot = -1;
+  for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+    if (!eventClients[i].active) {
+      slot = i;
+      break;
+    }
+  }
+
+  if (slot < 0) {
+    // The page falls back to polling
+    server.send(503, "text/plain", "Too many stream clients");
+    return;
+  }
+
+  int hz = server.hasArg("hz") ? server.arg("hz").toInt() : EVENT_STREAM_DEFAULT_HZ;
+  hz = constrain(hz, 1, EVENT_STREAM_MAX_HZ);
+
+  EventClient& ec = eventClients[slot];
+  ec.client = server.client();
+  ec.client.setNoDelay(true);
+  ec.active = true;
+  ec.intervalMs = 1000 / hz;
+  ec.lastFrameTime = 0;
+  ec.lastSendTime = millis();
+  ec.pendingLength = 0;
+  ec.pendingOffset = 0;
+  ec.sentOnce = false;
+
+  // Write the response head ourselves; the connection stays open after the handler returns
+  static const char header[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 3000\n\n";
+  ec.client.write((const uint8_t*)header, sizeof(header) - 1);
+
+  if (ENABLE_DEBUG_LOGGING) {
+    Serial.printf("[Events] Stream client %d connected at %d Hz\n", slot, hz);
+  }
+}
+
+void processEventStream() {
+  unsigned long now = millis();
+
+  if (now - fpsTimeMark >= 1000) {
+    uint32_t frame = getRenderFrame();
+    measuredFps = (int)((frame - fpsFrameMark) * 1000UL / (now - fpsTimeMark));
+    fpsFrameMark = frame;
+    fpsTimeMark = now;
+  }
+
+  for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+    EventClient& ec = eventClients[i];
+    if (!ec.active) continue;
+
+    if (!flushPending(ec, now)) {
+      dropClient(ec);
+      continue;
+    }
+
+    // Backpressure: while the last frame is still queued, skip new ones
+    if (ec.pendingLength > 0) {
+      if (now - ec.lastSendTime > EVENT_STREAM_STALL_MS) {
+        dropClient(ec);
+      }
+      continue;
+    }
+
+    if (now - ec.lastFrameTime < ec.intervalMs) continue;
+    ec.lastFrameTime = now;
+
+    int distance = currentDistance;
+    int velocity = (int)getEstimatedVelocity();
+    int sensor = getSelectedSensor();
+    int fps = measuredFps;
+
+    bool changed = !ec.sentOnce || distance != ec.lastDistance || velocity != ec.lastVelocity ||
+                   sensor != ec.lastSensor || fps != ec.lastFps;
+
+    if (changed) {
+      ec.pendingLength = snprintf(ec.pending, sizeof(ec.pending), "data:%d,%d,%d,%d\n\n",
+                                  distance, velocity, sensor, fps);
+      ec.sentOnce = true;
+      ec.lastDistance = distance;
+      ec.lastVelocity = velocity;
+      ec.lastSensor = sensor;
+      ec.lastFps = fps;
+    } else if (now - ec.lastSendTime >= EVENT_STREAM_KEEPALIVE_MS) {
+      // Comment line - keeps proxies and the browser from timing out, and finds dead sockets
+      ec.pendingLength = snprintf(ec.pending, sizeof(ec.pending), ":\n\n");
+    } else {
+      continue;
+    }
+
+    if (!flushPending(ec, now)) {
+      dropClient(ec);
+    }
+  }
+}
+
+int getEventStreamClientCount() {
+  int count = 0;
+  for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+    if (eventClients[i].active) count++;
+  }
+  return count;
+}
@@ -0,0 +1,30 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+/*
+ * Live telemetry over Server-Sent Events (/events).
+ * Each frame is one text line: "data:<distance>,<velocity>,<sensor>,<fps>"
+ * (cm, cm/s, sensor slot or -1, render frames per second). Frames are only
+ * sent when a value changed; a comment line keeps idle connections alive.
+ */
+
+/**
+ * Route handler for /events - takes over the connection as a stream.
+ * Optional ?hz= sets the frame rate (1-EVENT_STREAM_MAX_HZ).
+ */
+void handleEventStream();
+
+/**
+ * Sends due frames to connected clients without ever blocking the loop.
+ * A client that can't keep up skips frames; one stalled for
+ * EVENT_STREAM_STALL_MS is dropped. Call once per loop iteration.
+ */
+void processEventStream();
+
+/**
+ * Get the number of connected stream clients
+ * @return Active clients
+ */
+int getEventStreamClientCount();
+
+#endif // EVENT_STREAM_H
@@ -0,0 +1,239 @@
+#include <stdarg.h>
+#include <math.h>
+#include "json_writer.h"
+
+JsonWriter::JsonWriter(char* buffer, size_t size)
+  : buffer(buffer), capacity(size), used(0), depth(0), hasItems(0), overflow(size == 0) {
+  if (size > 0) buffer[0] = '\0';
+}
+
+void JsonWriter::beginObject() {
+  separator();
+  open('{');
+}
+
+void JsonWriter::beginObject(const char* name) {
+  key(name);
+  open('{');
+}
+
+void JsonWriter::endObject() {
+  close('}');
+}
+
+void JsonWriter::beginArray() {
+  separator();
+  open('[');
+}
+
+void JsonWriter::beginArray(const char* name) {
+  key(name);
+  open('[');
+}
+
+void JsonWriter::endArray() {
+  close(']');
+}
+
+void JsonWriter::field(const char* name, const char* text) {
+  key(name);
+  appendString(text);
+}
+
+void JsonWriter::field(const char* name, bool flag) {
+  key(name);
+  append(flag ? "true" : "false", flag ? 4 : 5);
+}
+
+void JsonWriter::field(const char* name, int number) {
+  key(name);
+  appendSigned(number);
+}
+
+void JsonWriter::field(const char* name, unsigned int number) {
+  key(name);
+  appendUnsigned(number);
+}
+
+void JsonWriter::field(const char* name, long number) {
+  key(name);
+  appendSigned(number);
+}
+
+void JsonWriter::field(const char* name, unsigned long number) {
+  key(name);
+  appendUnsigned(number);
+}
+
+void JsonWriter::field(const char* name, double number, uint8_t decimals) {
+  key(name);
+  if (isnan(number) || isinf(number)) {
+    append("null", 4);
+  } else {
+    appendf("%.*f", decimals, number);
+  }
+}
+
+void JsonWriter::fieldMac(const char* name, const uint8_t* mac) {
+  key(name);
+  appendf("\"%02X:%02X:%02X:%02X:%02X:%02X\"", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
+
+void JsonWriter::fieldNull(const char* name) {
+  key(name);
+  append("null", 4);
+}
+
+void JsonWriter::value(const char* text) {
+  separator();
+  appendString(text);
+}
+
+void JsonWriter::value(bool flag) {
+  separator();
+  append(flag ? "true" : "false", flag ? 4 : 5);
+}
+
+void JsonWriter::value(int number) {
+  separator();
+  appendSigned(number);
+}
+
+void JsonWriter::value(unsigned int number) {
+  separator();
+  appendUnsigned(number);
+}
+
+void JsonWriter::value(long number) {
+  separator();
+  appendSigned(number);
+}
+
+void JsonWriter::value(unsigned long number) {
+  separator();
+  appendUnsigned(number);
+}
+
+void JsonWriter::value(double number, uint8_t decimals) {
+  separator();
+  if (isnan(number) || isinf(number)) {
+    append("null", 4);
+  } else {
+    appendf("%.*f", decimals, number);
+  }
+}
+
+void JsonWriter::key(const char* name) {
+  separator();
+  appendString(name);
+  append(':');
+}
+
+void JsonWriter::separator() {
+  if (depth == 0) return;
+
+  uint8_t bit = 1 << (depth - 1);
+  if (hasItems & bit) append(',');
+  hasItems |= bit;
+}
+
+void JsonWriter::open(char bracket) {
+  append(bracket);
+  if (depth >= JSON_MAX_DEPTH) {
+    overflow = true;
+    return;
+  }
+  depth++;
+  hasItems &= ~(1 << (depth - 1));
+}
+
+void JsonWriter::close(char bracket) {
+  if (depth > 0) depth--;
+  append(bracket);
+}
+
+void JsonWriter::append(const char* text, size_t length) {
+  if (overflow) return;
+  if (used + length >= capacity) {
+    overflow = true;
+    return;
+  }
+  memcpy(buffer + used, text, length);
+  used += length;
+  buffer[used] = '\0';
+}
+
+void JsonWriter::append(char c) {
+  append(&c, 1);
+}
+
+void JsonWriter::appendf(const char* format, ...) {
+  if (overflow) return;
+
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buffer + used, capacity - used, format, args);
+  va_end(args);
+
+  if (n < 0 || used + n >= capacity) {
+    // Drop the partial value so the output never ends mid-number
+    buffer[used] = '\0';
+    overflow = true;
+    return;
+  }
+  used += n;
+}
+
+// Integers are formatted here rather than with vsnprintf, which dominated
+// the cost of a reply
+void JsonWriter::appendSigned(long number) {
+  if (number < 0) {
+    char digits[24];
+    char* start = digits + sizeof(digits);
+    unsigned long magnitude = 0UL - (unsigned long)number;
+    do {
+      *--start = '0' + magnitude % 10;
+      magnitude /= 10;
+    } while (magnitude);
+    *--start = '-';
+    append(start, digits + sizeof(digits) - start);
+  } else {
+    appendUnsigned(number);
+  }
+}
+
+void JsonWriter::appendUnsigned(unsigned long number) {
+  char digits[24];
+  char* start = digits + sizeof(digits);
+  do {
+    *--start = '0' + number % 10;
+    number /= 10;
+  } while (number);
+  append(start, digits + sizeof(digits) - start);
+}
+
+void JsonWriter::appendString(const char* text) {
+  append('"');
+  if (text) {
+    // Characters that need no escaping are copied a run at a time
+    const char* run = text;
+    const char* p = text;
+    for (; *p; p++) {
+      unsigned char c = (unsigned char)*p;
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+      append(run, p - run);
+      run = p + 1;
+      switch (c) {
+        case '"':  append("\\\"", 2); break;
+        case '\\': append("\\\\", 2); break;
+        case '\n': append("\\n", 2); break;
+        case '\r': append("\\r", 2); break;
+        case '\t': append("\\t", 2); break;
+        default:   appendf("\\u%04x", c); break;
+      }
+    }
+    append(run, p - run);
+  }
+  append('"');
+}
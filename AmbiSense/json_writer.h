@@ -0,0 +1,71 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// Maximum object/array nesting depth
+#define JSON_MAX_DEPTH 8
+
+/**
+ * Builds a JSON document into a caller-supplied buffer (normally on the
+ * stack) without touching the heap. Commas are inserted automatically.
+ * If the buffer fills up, further output is dropped and overflowed()
+ * returns true; the buffer always stays null-terminated.
+ */
+class JsonWriter {
+public:
+  JsonWriter(char* buffer, size_t size);
+
+  // Containers; the keyed forms are for use inside an object
+  void beginObject();
+  void beginObject(const char* key);
+  void endObject();
+  void beginArray();
+  void beginArray(const char* key);
+  void endArray();
+
+  // Object members
+  void field(const char* key, const char* value);
+  void field(const char* key, bool value);
+  void field(const char* key, int value);
+  void field(const char* key, unsigned int value);
+  void field(const char* key, long value);
+  void field(const char* key, unsigned long value);
+  void field(const char* key, double value, uint8_t decimals = 2);
+  void fieldMac(const char* key, const uint8_t* mac);
+  void fieldNull(const char* key);
+
+  // Array elements
+  void value(const char* value);
+  void value(bool value);
+  void value(int value);
+  void value(unsigned int value);
+  void value(long value);
+  void value(unsigned long value);
+  void value(double value, uint8_t decimals = 2);
+
+  const char* c_str() const { return buffer; }
+  size_t length() const { return used; }
+  bool overflowed() const { return overflow; }
+
+private:
+  void key(const char* name);
+  void separator();
+  void open(char bracket);
+  void close(char bracket);
+  void append(const char* text, size_t length);
+  void append(char c);
+  void appendf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  void appendSigned(long number);
+  void appendUnsigned(unsigned long number);
+  void appendString(const char* text);
+
+  char* buffer;
+  size_t capacity;
+  size_t used;
+  uint8_t depth;
+  uint8_t hasItems;  // bit per nesting level
+  bool overflow;
+};
+
+#endif // JSON_WRITER_H
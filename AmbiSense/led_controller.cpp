@@ -2,6 +2,12 @@
 #include <EEPROM.h>  // Add this missing include
 #include "config.h"
 #include "led_controller.h"
+#include "espnow_manager.h"
+#include "eeprom_manager.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "palette.h"
+#include "compositor.h"
 
 // Initialize LED strip - make it global and accessible from other modules
 Adafruit_NeoPixel strip = Adafruit_NeoPixel(DEFAULT_NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
@@ -12,14 +18,119 @@ int effectStep = 0;
 int lastDirection = 0;
 int lastPosition = 0;
 
+// Shared render timebase - the master's frame counter is sent to slaves
+static uint32_t renderFrame = 0;
+static uint32_t renderRngState = 1;
+static bool renderShowEnabled = true;
+
+// Window of the system strip drawn by this device (whole strip unless distributed)
+static int renderOffset = 0;
+static int renderTotal = 0;
+static int renderCount = 0;
+static bool renderReversed = false;
+
 // Track current LED configuration
 static int currentConfiguredLeds = DEFAULT_NUM_LEDS;
 
+// Render buffers, carved from one arena sized to the local strip and
+// allocated on first use. RGB effects draw 3 bytes per LED into colorFrame,
+// palette effects one byte per LED into indexFrame; the output stage turns
+// either into strip data. A frame is one or the other, so indexFrame is the
+// start of colorFrame rather than a copy next to it. fadeFrame (3 bytes per
+// LED) holds the frame a transition fades out from.
+//
+// The strip keeps its own 3 bytes per LED of gamma-corrected, dithered
+// output, so a device needs 3 + RENDER_ARENA_BYTES_PER_LED bytes per LED.
+// The frames can't be dropped for the strip buffer: dithering and the
+// crossfade work from the colors before gamma, which the strip data no
+// longer holds.
+#define RENDER_ARENA_BYTES_PER_LED 6
+static uint8_t* renderArena = nullptr;
+static int renderArenaLeds = 0;
+static uint8_t* colorFrame = nullptr;
+static uint8_t* indexFrame = nullptr;
+static uint8_t* fadeFrame = nullptr;
+static bool frameIndexed = false;  // What colorFrame/indexFrame holds now
+
+// Gamma curve at full scale (0.16 fixed point), built once
+static uint16_t gammaCurve[256];
+static bool gammaCurveReady = false;
+
+// Gamma curve with brightness and the power limit folded in, as 8.8
+// fixed-point strip levels. The fraction is spread over frames by temporal
+// dithering.
+static uint16_t gammaLut[256];
+static uint8_t gammaDither[256];  // 1 where the level is dim and has a fraction
+static int32_t gammaLutLevel = -1;
+static uint16_t gammaLutLimit = 256;
+
+// Active palette expanded to colors, and the palette, color and custom
+// palette revision it was built from
+static uint8_t paletteColors[PALETTE_SIZE][3];
+static uint64_t paletteColorsKey = UINT64_MAX;
+
+// The same palette through the gamma table, in strip byte order (NEO_GRB)
+static uint16_t paletteLut[PALETTE_SIZE][3];
+static uint8_t paletteDither[PALETTE_SIZE];
+static bool paletteLutStale = true;
+
+// Share of the brightness the power budget allows, in 1/256
+static uint16_t powerLimit = 256;
+
+// Last frame handed to the output stage, kept for dither refreshes
+static bool outputIndexed = false;
+static int outputCount = 0;
+static uint8_t outputPhase = 0;
+static bool outputDithered = false;
+static unsigned long lastOutputMs = 0;
+static unsigned long lastShowUs = 0;
+
+// Settings the current frame is rendered with: this device's own, or the
+// master's while a slave follows its scene. Loaded at every entry point, so
+// a slave falls back to its own settings as soon as the master goes quiet.
+static SceneSettings scene;
+static SceneSettings followedScene;
+
+static void loadSceneSettings() {
+  if (isFollowingMasterScene()) {
+    scene = followedScene;
+    return;
+  }
+  scene.lightMode = lightMode;
+  scene.brightness = brightness;
+  scene.redValue = redValue;
+  scene.greenValue = greenValue;
+  scene.blueValue = blueValue;
+  scene.backgroundMode = backgroundMode;
+  scene.directionLightEnabled = directionLightEnabled;
+  scene.movingLightSpan = movingLightSpan;
+  scene.trailLength = trailLength;
+  scene.effectSpeed = effectSpeed;
+  scene.effectIntensity = effectIntensity;
+  scene.colorPalette = colorPalette;
+  scene.backgroundLayer = backgroundLayer;
+  scene.transitionMs = transitionMs;
+}
+
+void setFollowedScene(const SceneSettings& settings) {
+  followedScene = settings;
+}
+
+// Crossfade from the frame shown when the scene changed to the new scene
+static bool transitionActive = false;
+static unsigned long transitionStartMs = 0;
+static unsigned long transitionDurationMs = 0;
+static uint64_t renderedSceneKey = UINT64_MAX;
+
 void setupLEDs() {
   Serial.println("Initializing LED strip");
+  // The strip is constructed with the default length; size it to the stored count
+  if (strip.numPixels() != numLeds) {
+    strip = Adafruit_NeoPixel(numLeds, LED_PIN, NEO_GRB + NEO_KHZ800);
+  }
   strip.begin();
-  strip.setBrightness(brightness);
   strip.show(); // Initialize all pixels to 'off'
+  telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_STRIP, strip.numPixels() * 3);
   currentConfiguredLeds = numLeds;
   Serial.printf("LED strip initialized with %d LEDs\n", numLeds);
 }
@@ -41,9 +152,10 @@ void updateLEDConfig() {
     
     // CRITICAL FIX: Properly reinitialize the strip with new LED count
     // The updateLength() method doesn't work reliably, so we recreate the object
+    telemetryTrackFree(TELEMETRY_SUBSYSTEM_STRIP, strip.numPixels() * 3);
     strip = Adafruit_NeoPixel(numLeds, LED_PIN, NEO_GRB + NEO_KHZ800);
+    telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_STRIP, strip.numPixels() * 3);
     strip.begin();
-    strip.setBrightness(brightness);
     strip.clear();
     strip.show();
     
@@ -63,9 +175,6 @@ void updateLEDConfig() {
       strip.show();
       Serial.println("LED test pattern complete");
     }
-  } else {
-    // Just update brightness if LED count didn't change
-    strip.setBrightness(brightness);
   }
 }
 
@@ -82,11 +191,11 @@ bool validateLEDCount(int requestedLeds) {
     return false;
   }
   
-  // Check available memory for LED buffer
-  size_t ledMemoryRequired = requestedLeds * 3; // 3 bytes per LED (RGB)
+  // Check available memory for the strip buffer and the render arena
+  size_t ledMemoryRequired = requestedLeds * (3 + RENDER_ARENA_BYTES_PER_LED);
   if (ledMemoryRequired > ESP.getFreeHeap() / 4) { // Use max 25% of free heap
-    Serial.printf("ERROR: Insufficient memory for %d LEDs (need %d bytes)\n", 
-                 requestedLeds, ledMemoryRequired);
+    Serial.printf("ERROR: Insufficient memory for %d LEDs (need %u bytes)\n", 
+                 requestedLeds, (unsigned)ledMemoryRequired);
     return false;
   }
   
@@ -113,9 +222,10 @@ void reinitializeLEDStrip(int newLedCount) {
   numLeds = newLedCount;
   
   // Recreate the strip object completely
+  telemetryTrackFree(TELEMETRY_SUBSYSTEM_STRIP, strip.numPixels() * 3);
   strip = Adafruit_NeoPixel(numLeds, LED_PIN, NEO_GRB + NEO_KHZ800);
+  telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_STRIP, strip.numPixels() * 3);
   strip.begin();
-  strip.setBrightness(brightness);
   strip.clear();
   strip.show();
   
@@ -123,10 +233,8 @@ void reinitializeLEDStrip(int newLedCount) {
   
   Serial.printf("LED strip successfully reinitialized with %d LEDs\n", numLeds);
   
-  // Save to EEPROM
-  EEPROM.write(EEPROM_ADDR_NUM_LEDS_L, numLeds & 0xFF);
-  EEPROM.write(EEPROM_ADDR_NUM_LEDS_H, (numLeds >> 8) & 0xFF);
-  EEPROM.commit();
+  // Saved with the rest of the system section once changes settle
+  scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
 }
 
 // Helper function to create a color with a specific intensity
@@ -166,19 +274,511 @@ uint8_t qadd8(uint8_t a, uint8_t b) {
   return (uint8_t)result;
 }
 
+// Advance the frame-seeded generator (xorshift32)
+static uint32_t renderRandom() {
+  renderRngState ^= renderRngState << 13;
+  renderRngState ^= renderRngState >> 17;
+  renderRngState ^= renderRngState << 5;
+  return renderRngState;
+}
+
+// Reseed the generator from the frame counter so every device draws the same sequence
+static void seedRenderRandom(uint32_t frame) {
+  uint32_t seed = (frame + 1) * 0x9E3779B1UL;
+  seed ^= seed >> 16;
+  renderRngState = seed ? seed : 0x5EED1234UL;
+}
+
 // Helper function: Generate random 8-bit number
 uint8_t random8() {
-  return random(256);
+  return renderRandom() & 0xFF;
 }
 
 // Helper function: Generate random number in range
 uint8_t random8(uint8_t lim) {
-  return random(lim);
+  if (lim == 0) return 0;
+  return renderRandom() % lim;
 }
 
 // Helper function: Generate random number in range
 uint8_t random8(uint8_t min, uint8_t lim) {
-  return random(min, lim);
+  if (lim <= min) return min;
+  return min + renderRandom() % (lim - min);
+}
+
+// Length of the (possibly distributed) strip that effects are computed over
+static int renderLength() {
+  return (renderTotal > 0) ? renderTotal : numLeds;
+}
+
+// Number of local LEDs that belong to this device's segment
+static inline int renderCountLocal() {
+  return (renderCount > 0) ? min(renderCount, numLeds) : numLeds;
+}
+
+// Local strip index of a pixel on the full strip, -1 if it is outside this device's segment
+static inline int localPixelIndex(int globalIndex) {
+  int localIndex = globalIndex - renderOffset;
+  int count = renderCountLocal();
+  if (localIndex < 0 || localIndex >= count) return -1;
+  
+  // Segments mounted against the stair direction are fed from their far end
+  return renderReversed ? count - 1 - localIndex : localIndex;
+}
+
+// Set a pixel of the color frame by its local strip index
+static inline void setLocalPixel(int localIndex, uint32_t color) {
+  uint8_t* pixel = colorFrame + localIndex * 3;
+  pixel[0] = color >> 16;
+  pixel[1] = color >> 8;
+  pixel[2] = color;
+}
+
+// Set a pixel by its index on the full strip; pixels outside this device's segment are dropped
+static inline void setGlobalPixel(int globalIndex, uint32_t color) {
+  int localIndex = localPixelIndex(globalIndex);
+  if (localIndex >= 0) {
+    setLocalPixel(localIndex, color);
+  }
+}
+
+// Indexed counterpart of setGlobalPixel()
+static inline void setGlobalIndex(int globalIndex, uint8_t index) {
+  int localIndex = localPixelIndex(globalIndex);
+  if (localIndex >= 0) {
+    indexFrame[localIndex] = index;
+  }
+}
+
+// Global index range covered by this device's segment
+static inline int windowBegin() {
+  return max(0, renderOffset);
+}
+
+static inline int windowEnd() {
+  return min(renderLength(), renderOffset + renderCountLocal());
+}
+
+// Push the frame to the strip unless we are only stepping effect state
+static void showStrip() {
+  if (renderShowEnabled) {
+    PROFILE_ZONE(PROFILE_ZONE_SHOW);
+    strip.show();
+  }
+}
+
+// Size the render arena to the given number of LEDs. One block for all
+// frames, so a transition never allocates; every frame is cleared when the
+// arena is (re)allocated.
+static bool sizeRenderArena(int leds) {
+  if (renderArenaLeds == leds) return true;
+  
+  if (renderArena != nullptr) {
+    free(renderArena);
+    telemetryTrackFree(TELEMETRY_SUBSYSTEM_FRAMEBUFFER, renderArenaLeds * RENDER_ARENA_BYTES_PER_LED);
+  }
+  renderArena = (uint8_t*)calloc(leds, RENDER_ARENA_BYTES_PER_LED);
+  if (renderArena == nullptr) {
+    telemetryTrackAllocFailure(TELEMETRY_SUBSYSTEM_FRAMEBUFFER);
+    renderArenaLeds = 0;
+    colorFrame = indexFrame = fadeFrame = nullptr;
+    transitionActive = false;
+    Serial.println("ERROR: Cannot allocate frame buffers");
+    return false;
+  }
+  renderArenaLeds = leds;
+  colorFrame = renderArena;
+  indexFrame = renderArena;
+  fadeFrame = colorFrame + leds * 3;
+  frameIndexed = false;
+  telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_FRAMEBUFFER, renderArenaLeds * RENDER_ARENA_BYTES_PER_LED);
+  return true;
+}
+
+// Rebuild the gamma table when the brightness or power limit folded into it
+// changed. Integer scaling of the stored curve, so the limiter can move it
+// every frame.
+static void updateGammaLut() {
+  if (!gammaCurveReady) {
+    for (int i = 0; i < 256; i++) {
+      gammaCurve[i] = (uint16_t)(powf(i / 255.0f, LED_GAMMA) * 65535 + 0.5f);
+    }
+    gammaCurveReady = true;
+  }
+  
+  // Brightness times limit, 8.8 fixed point
+  int32_t level = (scene.brightness & 0xFF) * powerLimit;
+  if (level == gammaLutLevel) return;
+  gammaLutLevel = level;
+  gammaLutLimit = powerLimit;
+  
+  for (int i = 0; i < 256; i++) {
+    gammaLut[i] = ((uint32_t)gammaCurve[i] * level) >> 16;
+    gammaDither[i] = (gammaLut[i] & 0xFF) != 0 && gammaLut[i] < (LED_DITHER_MAX_LEVEL << 8);
+  }
+  
+  // The palette table is built from this one
+  paletteLutStale = true;
+}
+
+// Expand the palette an indexed frame will be shown with, if it or anything
+// baked into it changed
+static void selectPalette(uint8_t palette) {
+  uint64_t key = (uint64_t)palette |
+                 (uint64_t)(scene.redValue & 0xFF) << 16 |
+                 (uint64_t)(scene.greenValue & 0xFF) << 24 |
+                 (uint64_t)(scene.blueValue & 0xFF) << 32 |
+                 (uint64_t)getCustomPaletteRevision() << 40;
+  if (key == paletteColorsKey) return;
+  paletteColorsKey = key;
+  
+  expandPalette(palette, scene.redValue, scene.greenValue, scene.blueValue, paletteColors);
+  paletteLutStale = true;
+}
+
+// Run the expanded palette through the gamma table
+static void updatePaletteLut() {
+  if (!paletteLutStale) return;
+  paletteLutStale = false;
+  
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    paletteLut[i][0] = gammaLut[paletteColors[i][1]];
+    paletteLut[i][1] = gammaLut[paletteColors[i][0]];
+    paletteLut[i][2] = gammaLut[paletteColors[i][2]];
+    paletteDither[i] = gammaDither[paletteColors[i][0]] | gammaDither[paletteColors[i][1]] |
+                       gammaDither[paletteColors[i][2]];
+  }
+}
+
+// Start an RGB frame sized to the local strip. Cleared to black unless the
+// effect builds on the previous frame (and that was a color frame).
+static bool beginColorFrame(bool clear = true) {
+  if (!sizeRenderArena(numLeds)) return false;
+  if (clear || frameIndexed) memset(colorFrame, 0, renderArenaLeds * 3);
+  frameIndexed = false;
+  return true;
+}
+
+// Start an indexed frame: size the index buffer to the local strip, clear it
+// to palette index 0 and select the palette it will be shown with
+static bool beginIndexedFrame(uint8_t palette) {
+  if (!sizeRenderArena(numLeds)) return false;
+  memset(indexFrame, 0, renderArenaLeds);
+  frameIndexed = true;
+  selectPalette(palette);
+  return true;
+}
+
+// Where a scene is composed: a color frame and the part of the system strip
+// it holds
+struct LayerTarget {
+  uint8_t* frame;
+  int offset;     // Global index of the first pixel of the segment
+  int count;      // Pixels in the segment
+  int length;     // Length of the system strip
+  bool reversed;  // Segment fed from its far end
+};
+
+struct SceneLayer;
+
+// Draw a layer over the global span [begin, end), already clipped to the target
+typedef void (*LayerDraw)(const SceneLayer& layer, const LayerTarget& target, int begin, int end);
+
+// One layer of a composed scene
+struct SceneLayer {
+  LayerDraw draw;
+  BlendMode blend;
+  uint8_t opacity;
+  int begin;    // Global span [begin, end) the layer covers
+  int end;
+  int origin;   // Global index where a gradient layer is at full strength
+};
+
+// The live color frame and this device's render window
+static LayerTarget renderTarget() {
+  return {colorFrame, renderOffset, renderCountLocal(), renderLength(), renderReversed};
+}
+
+// Blend a layer color into the target pixel at a global index
+static inline void blendLayerPixel(const SceneLayer& layer, const LayerTarget& target, int globalIndex,
+                                   uint8_t r, uint8_t g, uint8_t b) {
+  int localIndex = globalIndex - target.offset;
+  if (target.reversed) localIndex = target.count - 1 - localIndex;
+  blendPixel(target.frame + localIndex * 3, r, g, b, layer.blend, layer.opacity);
+}
+
+// Blend layers bottom-up into the target. Each layer only draws the part of
+// its span that falls inside the target.
+static void composeLayers(const LayerTarget& target, const SceneLayer* layers, int count) {
+  int targetEnd = min(target.offset + target.count, target.length);
+  for (int n = 0; n < count; n++) {
+    const SceneLayer& layer = layers[n];
+    int begin = max(layer.begin, target.offset);
+    int end = min(layer.end, targetEnd);
+    if (begin < end && layer.opacity > 0) {
+      layer.draw(layer, target, begin, end);
+    }
+  }
+}
+
+// Identity of what the scene shows; rendering a different one starts a
+// transition
+static uint64_t sceneKey() {
+  return (uint64_t)(scene.lightMode & 0xFF) |
+         (uint64_t)(scene.redValue & 0xFF) << 8 |
+         (uint64_t)(scene.greenValue & 0xFF) << 16 |
+         (uint64_t)(scene.blueValue & 0xFF) << 24 |
+         (uint64_t)(scene.colorPalette & 0xFF) << 32 |
+         (uint64_t)(scene.backgroundLayer & 0x7F) << 40 |
+         (uint64_t)(scene.backgroundMode ? 1 : 0) << 47 |
+         (uint64_t)getCustomPaletteRevision() << 48;
+}
+
+// Progress of the running transition, 0 (old frame) to 255 (new scene)
+static uint8_t transitionMix() {
+  unsigned long elapsed = millis() - transitionStartMs;
+  if (elapsed >= transitionDurationMs) return 255;
+  return elapsed * 255 / transitionDurationMs;
+}
+
+// Color of a pixel of the last frame before gamma: the color frame, or the
+// index frame through the expanded palette
+static inline const uint8_t* outputColor(int localIndex) {
+  return outputIndexed ? paletteColors[indexFrame[localIndex]] : colorFrame + localIndex * 3;
+}
+
+// Freeze what the strip shows now as the frame to fade out from. During a
+// transition that is the mix of both frames, so the new change fades on from
+// wherever the last one had got to.
+static void captureFadeFrame() {
+  int count = min(outputCount, renderArenaLeds);
+  uint8_t mix = transitionActive ? transitionMix() : 255;
+  for (int i = 0; i < count; i++) {
+    const uint8_t* color = outputColor(i);
+    blendPixel(fadeFrame + i * 3, color[0], color[1], color[2], BLEND_ALPHA, mix);
+  }
+  memset(fadeFrame + count * 3, 0, (renderArenaLeds - count) * 3);
+}
+
+// Fade from the last frame shown to whatever is rendered next
+static void startTransition() {
+  if (scene.transitionMs <= 0 || renderArenaLeds == 0) {
+    transitionActive = false;
+    return;
+  }
+  captureFadeFrame();
+  transitionActive = true;
+  transitionStartMs = millis();
+  transitionDurationMs = scene.transitionMs;
+}
+
+// Threshold added to an 8.8 level before it is cut to 8 bits. It steps
+// through 8 values over 8 frames, offset by the pixel's position on the
+// system strip, so the fraction of a level shows up as the share of pixels
+// and frames that are one step brighter.
+static inline uint8_t ditherThreshold(uint8_t phase) {
+  static const uint8_t thresholds[8] = {16, 144, 80, 208, 48, 176, 112, 240};
+  return ENABLE_TEMPORAL_DITHERING ? thresholds[phase & 7] : 128;
+}
+
+// Output stage for RGB frames: gamma and brightness from one table, then
+// dithering, written in strip byte order (NEO_GRB). phase is the dither
+// phase of the first pixel and step its change per pixel. Returns non-zero
+// if a dim level was dithered, and adds the written channel values to sum
+// for the power estimate.
+static uint8_t convertColorFrame(const uint8_t* color, uint8_t* pixels, int count, uint8_t phase, int8_t step, uint32_t& sum) {
+  uint8_t dithered = 0;
+  uint32_t total = 0;
+  for (int i = 0; i < count; i++) {
+    uint16_t r = gammaLut[color[0]];
+    uint16_t g = gammaLut[color[1]];
+    uint16_t b = gammaLut[color[2]];
+    uint8_t threshold = ditherThreshold(phase);
+    pixels[0] = (g + threshold) >> 8;
+    pixels[1] = (r + threshold) >> 8;
+    pixels[2] = (b + threshold) >> 8;
+    dithered |= gammaDither[color[0]] | gammaDither[color[1]] | gammaDither[color[2]];
+    total += pixels[0] + pixels[1] + pixels[2];
+    phase += step;
+    color += 3;
+    pixels += 3;
+  }
+  sum += total;
+  return dithered;
+}
+
+// Output stage for indexed frames: the palette table already holds gamma
+// corrected levels in strip byte order, so each LED is one lookup
+static uint8_t convertIndexedFrame(const uint8_t* index, uint8_t* pixels, int count, uint8_t phase, int8_t step, uint32_t& sum) {
+  uint8_t dithered = 0;
+  uint32_t total = 0;
+  for (int i = 0; i < count; i++) {
+    const uint16_t* level = paletteLut[index[i]];
+    uint8_t threshold = ditherThreshold(phase);
+    pixels[0] = (level[0] + threshold) >> 8;
+    pixels[1] = (level[1] + threshold) >> 8;
+    pixels[2] = (level[2] + threshold) >> 8;
+    dithered |= paletteDither[index[i]];
+    total += pixels[0] + pixels[1] + pixels[2];
+    phase += step;
+    pixels += 3;
+  }
+  sum += total;
+  return dithered;
+}
+
+// Output stage during a transition: the new frame crossfaded over the frame
+// being faded out, then gamma, dithering and the power sum as in
+// convertColorFrame(). No palette table: both frames are mixed as colors.
+static uint8_t convertFadeFrame(uint8_t mix, uint8_t* pixels, int count, uint8_t phase, int8_t step, uint32_t& sum) {
+  uint8_t dithered = 0;
+  uint32_t total = 0;
+  for (int i = 0; i < count; i++) {
+    const uint8_t* from = fadeFrame + i * 3;
+    const uint8_t* to = outputColor(i);
+    uint8_t color[3] = {from[0], from[1], from[2]};
+    blendPixel(color, to[0], to[1], to[2], BLEND_ALPHA, mix);
+    
+    uint16_t r = gammaLut[color[0]];
+    uint16_t g = gammaLut[color[1]];
+    uint16_t b = gammaLut[color[2]];
+    uint8_t threshold = ditherThreshold(phase);
+    pixels[0] = (g + threshold) >> 8;
+    pixels[1] = (r + threshold) >> 8;
+    pixels[2] = (b + threshold) >> 8;
+    dithered |= gammaDither[color[0]] | gammaDither[color[1]] | gammaDither[color[2]];
+    total += pixels[0] + pixels[1] + pixels[2];
+    phase += step;
+    pixels += 3;
+  }
+  sum += total;
+  return dithered;
+}
+
+// Estimate the current of the frame just written and move the power limit
+// towards what the budget allows. Cuts take effect on the next output,
+// recovery is ramped so the brightness doesn't jump.
+static void updatePowerLimit(uint32_t channelSum) {
+  uint32_t idleMa = strip.numPixels() * LED_IDLE_MA;
+  uint32_t litMa = channelSum * LED_CHANNEL_MA / 255;
+  
+  // Strip levels scale with the limit, so this is the draw without it
+  uint32_t requestedMa = litMa * 256 / max(gammaLutLimit, (uint16_t)1);
+  
+  uint32_t target = 256;
+  if (powerBudgetMa > 0 && requestedMa > 0) {
+    uint32_t availableMa = (uint32_t)powerBudgetMa > idleMa ? powerBudgetMa - idleMa : 0;
+    if (requestedMa > availableMa) {
+      target = max(availableMa * 256 / requestedMa, (uint32_t)1);
+    }
+  }
+  
+  if (target < powerLimit) {
+    powerLimit = target;
+  } else {
+    powerLimit = min(target, (uint32_t)powerLimit + POWER_LIMIT_RAMP);
+  }
+  
+  telemetryReportPower(litMa + idleMa, requestedMa + idleMa, powerLimit);
+}
+
+// Convert the last frame into the strip's pixel buffer and show it
+static void writeOutput() {
+  {
+    PROFILE_ZONE(PROFILE_ZONE_OUTPUT);
+    updateGammaLut();
+    int count = min(outputCount, (int)strip.numPixels());
+    uint8_t dithered;
+    uint32_t sum = 0;
+    count = min(count, renderArenaLeds);
+    
+    // Dither by position on the system strip, so segments match one strip
+    uint8_t phase = outputPhase + (renderReversed ? renderOffset + renderCountLocal() - 1 : renderOffset);
+    int8_t step = renderReversed ? -1 : 1;
+    if (transitionActive) {
+      uint8_t mix = transitionMix();
+      dithered = convertFadeFrame(mix, strip.getPixels(), count, phase, step, sum);
+      transitionActive = mix < 255;
+    } else if (outputIndexed) {
+      updatePaletteLut();
+      dithered = convertIndexedFrame(indexFrame, strip.getPixels(), count, phase, step, sum);
+    } else {
+      dithered = convertColorFrame(colorFrame, strip.getPixels(), count, phase, step, sum);
+    }
+    outputPhase++;
+    outputDithered = dithered != 0;
+    updatePowerLimit(sum);
+  }
+  
+  unsigned long showStart = micros();
+  showStrip();
+  lastShowUs = micros() - showStart;
+  lastOutputMs = millis();
+}
+
+// Show the first count LEDs of the color frame. The dither phase follows
+// the shared frame counter, so every device dithers a frame the same way.
+static void showColorFrame(int count) {
+  if (!renderShowEnabled) return;
+  outputIndexed = false;
+  outputCount = count;
+  outputPhase = renderFrame;
+  writeOutput();
+}
+
+// Show the first count LEDs of the index frame
+static void showIndexedFrame(int count) {
+  if (!renderShowEnabled) return;
+  outputIndexed = true;
+  outputCount = count;
+  outputPhase = renderFrame;
+  writeOutput();
+}
+
+void refreshLEDOutput() {
+  loadSceneSettings();
+  
+  // Scenes that only redraw on motion are redrawn as soon as they change, so
+  // the last scene's pixels don't linger until someone walks by
+  if (renderedSceneKey != UINT64_MAX && sceneKey() != renderedSceneKey &&
+      !isSceneAnimated() && !isFollowingMasterScene()) {
+    updateLEDs(currentDistance);
+    return;
+  }
+  
+  // A frame that isn't at the current brightness and power limit yet is
+  // refreshed, and a transition keeps fading while the scene stands still.
+  // Dim dithered levels are only cycled when ENABLE_DITHER_REFRESH asks for it.
+  bool levelPending = outputCount > 0 && (scene.brightness & 0xFF) * powerLimit != gammaLutLevel;
+  bool ditherPending = ENABLE_DITHER_REFRESH && ENABLE_TEMPORAL_DITHERING && outputDithered;
+  if (!ditherPending && !levelPending && !transitionActive) return;
+  
+  // Fades run at the frame rate. Refreshes never take more than a tenth of
+  // the loop, however long the strip.
+  unsigned long interval = (levelPending || transitionActive) ? ANIMATION_INTERVAL_MS : LED_DITHER_REFRESH_MS;
+  interval = max(interval, lastShowUs * 10 / 1000);
+  if (millis() - lastOutputMs >= interval) {
+    writeOutput();
+  }
+}
+
+void setRenderWindow(int offset, int total, int length, bool reversed) {
+  renderOffset = max(0, offset);
+  renderTotal = constrain(total, 0, MAX_SUPPORTED_LEDS);
+  renderCount = constrain(length, 0, MAX_SUPPORTED_LEDS);
+  renderReversed = reversed;
+}
+
+uint32_t getRenderFrame() {
+  return renderFrame;
+}
+
+int getMotionDirection() {
+  return lastDirection;
+}
+
+void setMotionDirection(int direction) {
+  lastDirection = constrain(direction, -1, 1);
 }
 
 // Update LEDs based on distance reading and current mode
@@ -188,6 +788,7 @@ void updateLEDs(int distance) {
     Serial.printf("ERROR: Invalid LED count %d, skipping update\n", numLeds);
     return;
   }
+  loadSceneSettings();
   
   // Update direction based on distance change
   int direction = 0;
@@ -203,367 +804,456 @@ void updateLEDs(int distance) {
     lastDirection = direction;
   }
   
-  // Calculate the LED start position based on current distance
-  int startLed = map(distance, minDistance, maxDistance, 0, numLeds - movingLightSpan);
-  startLed = constrain(startLed, 0, numLeds - movingLightSpan);
+  // In distributed mode effects run over the whole system strip and this
+  // device only draws its own segment of it
+  if (ledSegmentMode == LED_SEGMENT_MODE_DISTRIBUTED) {
+    setRenderWindow(ledSegmentStart, totalSystemLeds, ledSegmentLength, ledSegmentReversed);
+  } else {
+    setRenderWindow(0, numLeds, numLeds, false);
+  }
+  
+  // Calculate the LED start position based on current distance (the stair
+  // frame position when several sensors are fused)
+  int rangeStart, rangeEnd;
+  getPositionRange(&rangeStart, &rangeEnd);
+  int length = renderLength();
+  int startLed = map(distance, rangeStart, rangeEnd, 0, length - scene.movingLightSpan);
+  startLed = constrain(startLed, 0, length - scene.movingLightSpan);
   
   // Apply center shift adjustment
   startLed += centerShift;
   
+  renderScene(startLed);
+  
+  // Slaves render the same frame for their own segments
+  sendSceneState(startLed);
+}
+
+void renderScene(int startLed) {
+  loadSceneSettings();
+  
+  // Every random draw in this frame comes from the shared timebase
+  seedRenderRandom(renderFrame);
+  
+  // A changed scene fades in over the last frame shown. Frames replayed
+  // without showing leave that to the next shown one.
+  uint64_t key = sceneKey();
+  if (key != renderedSceneKey && renderShowEnabled) {
+    if (renderedSceneKey != UINT64_MAX) startTransition();
+    renderedSceneKey = key;
+  }
+  
   // Handle different light modes
-  switch (lightMode) {
+  switch (scene.lightMode) {
     case LIGHT_MODE_STANDARD:
       updateStandardMode(startLed);
       break;
-    
+  
     case LIGHT_MODE_RAINBOW:
       updateRainbowMode();
       break;
-    
+  
     case LIGHT_MODE_COLOR_WAVE:
       updateColorWaveMode();
       break;
-    
+  
     case LIGHT_MODE_BREATHING:
       updateBreathingMode();
       break;
-    
+  
     case LIGHT_MODE_SOLID:
       updateSolidMode();
       break;
-      
+  
     case LIGHT_MODE_COMET:
       updateCometMode(startLed);
       break;
-      
+  
     case LIGHT_MODE_PULSE:
       updatePulseMode(startLed);
       break;
-      
+  
     case LIGHT_MODE_FIRE:
       updateFireMode();
       break;
-      
+  
     case LIGHT_MODE_THEATER_CHASE:
       updateTheaterChaseMode();
       break;
-      
+  
     case LIGHT_MODE_DUAL_SCAN:
       updateDualScanMode(startLed);
       break;
-      
+  
     case LIGHT_MODE_MOTION_PARTICLES:
       updateMotionParticlesMode(startLed);
       break;
-    
+  
     default:
       updateStandardMode(startLed);
       break;
   }
   
   // Update effect step for animations
-  effectStep = (effectStep + 1) % 256;
+  renderFrame++;
+  effectStep = renderFrame % 256;
 }
 
-// Forward declarations for functions used in ESP-NOW
-void processLEDSegmentData(led_segment_data_t segmentData);
-void updateLEDSegment(int globalStartPos, led_segment_data_t segmentData);
+void syncRenderTimebase(uint32_t frame, int startLed) {
+  loadSceneSettings();
+  int32_t behind = (int32_t)(frame - renderFrame);
+  
+  // Effects that carry state between frames (comet, fire, particles) have to
+  // replay the frames we missed; everything else is a pure function of the frame
+  bool stateful = (scene.lightMode == LIGHT_MODE_COMET ||
+                   scene.lightMode == LIGHT_MODE_FIRE ||
+                   scene.lightMode == LIGHT_MODE_MOTION_PARTICLES ||
+                   (scene.lightMode == LIGHT_MODE_STANDARD && scene.backgroundMode &&
+                    scene.backgroundLayer == BACKGROUND_LAYER_FIRE));
+  
+  if (stateful && behind > 0 && behind <= MAX_RENDER_CATCHUP_FRAMES) {
+    renderShowEnabled = false;
+    while (renderFrame != frame) {
+      renderScene(startLed);
+    }
+    renderShowEnabled = true;
+  }
+  
+  renderFrame = frame;
+  effectStep = renderFrame % 256;
+}
 
-// Update LEDs in standard mode (based on distance)
-void updateStandardMode(int startLed) {
-  strip.clear();
+// Fire effect state: one heat cell per LED of the whole system strip, so
+// every segment sees the same flames
+static uint8_t* fireHeat = nullptr;
+static int fireHeatSize = 0;
+
+// Advance the fire simulation by one frame
+static bool stepFire() {
+  // Map effectSpeed (1-100) to fire speed (1-20)
+  int fireSpeed = map(scene.effectSpeed, 1, 100, 1, 20);
   
-  // If background mode is enabled, set all LEDs to a dim background color
-  if (backgroundMode) {
-    float backgroundIntensity = 0.05; // Low background light
-    for (int i = 0; i < numLeds; i++) {
-      strip.setPixelColor(i, dimColor(redValue, greenValue, blueValue, backgroundIntensity));
+  // Map effectIntensity (1-100) to cooling rate (20-100)
+  int cooling = map(scene.effectIntensity, 1, 100, 20, 100);
+  
+  int length = renderLength();
+  
+  // Reallocate heat array if LED count changed
+  if (fireHeatSize != length) {
+    if (fireHeat != nullptr) {
+      free(fireHeat);
+      telemetryTrackFree(TELEMETRY_SUBSYSTEM_EFFECTS, fireHeatSize * sizeof(uint8_t));
+    }
+    fireHeat = (uint8_t*)malloc(length * sizeof(uint8_t));
+    if (fireHeat == nullptr) {
+      telemetryTrackAllocFailure(TELEMETRY_SUBSYSTEM_EFFECTS);
+      fireHeatSize = 0;
+      Serial.println("ERROR: Cannot allocate memory for fire effect");
+      return false;
+    }
+    // Initialize heat array
+    for (int i = 0; i < length; i++) {
+      fireHeat[i] = 0;
     }
+    fireHeatSize = length;
+    telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_EFFECTS, length * sizeof(uint8_t));
+    Serial.printf("Allocated fire effect buffer for %d LEDs\n", length);
   }
   
-  // Set moving light
-  for (int i = startLed; i < startLed + movingLightSpan; i++) {
-    if (i >= 0 && i < numLeds) {
-      strip.setPixelColor(i, strip.Color(redValue, greenValue, blueValue));
-    }
+  // Step 1: Cool down every cell a little
+  int coolingRange = ((cooling * 10) / length) + 2;
+  for (int i = 0; i < length; i++) {
+    fireHeat[i] = qsub8(fireHeat[i], min(255, (int)(renderRandom() % coolingRange)));
   }
   
-  // Add directional trailing effect if enabled
-  if (directionLightEnabled && trailLength > 0 && lastDirection != 0) {
-    int trailStartPos = (lastDirection > 0) ? startLed - trailLength : startLed + movingLightSpan;
-    int trailEndPos = (lastDirection > 0) ? startLed : startLed + movingLightSpan + trailLength;
-    
-    for (int i = trailStartPos; i < trailEndPos; i++) {
-      if (i >= 0 && i < numLeds) {
-        // Calculate fade based on position in trail
-        float fadePercent = (float)abs(i - (lastDirection > 0 ? startLed : startLed + movingLightSpan)) / trailLength;
-        fadePercent = constrain(fadePercent, 0.0, 1.0);
-        fadePercent = 1.0 - fadePercent; // Invert so it fades away from main light
-        
-        strip.setPixelColor(i, dimColor(redValue, greenValue, blueValue, fadePercent * 0.8));
-      }
+  // Step 2: Heat rises - transfer heat from each cell to the one above
+  for (int k = length - 1; k >= 2; k--) {
+    fireHeat[k] = (fireHeat[k - 1] + fireHeat[k - 2] + fireHeat[k - 2]) / 3;
+  }
+  
+  // Step 3: Randomly ignite new sparks near the bottom
+  if (random8() < fireSpeed) {
+    int y = random8(min(7, length / 4)); // Scale spark area with LED count
+    fireHeat[y] = qadd8(fireHeat[y], random8(160, 255));
+  }
+  
+  return true;
+}
+
+// Layer: the selected color
+static void drawColorLayer(const SceneLayer& layer, const LayerTarget& target, int begin, int end) {
+  for (int i = begin; i < end; i++) {
+    blendLayerPixel(layer, target, i, scene.redValue, scene.greenValue, scene.blueValue);
+  }
+}
+
+// Layer: the selected color, fading out with the distance from layer.origin
+// over the length of the span
+static void drawTrailLayer(const SceneLayer& layer, const LayerTarget& target, int begin, int end) {
+  int length = max(layer.end - layer.begin, 1);
+  for (int i = begin; i < end; i++) {
+    int distance = min(abs(i - layer.origin), length);
+    uint8_t fade = 255 * (length - distance) / length;
+    blendLayerPixel(layer, target, i, scaleChannel(scene.redValue, fade),
+                    scaleChannel(scene.greenValue, fade), scaleChannel(scene.blueValue, fade));
+  }
+}
+
+// Layer: the expanded palette (selectPalette() first), cycling like rainbow mode
+static void drawPaletteLayer(const SceneLayer& layer, const LayerTarget& target, int begin, int end) {
+  int animationSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
+  for (int i = begin; i < end; i++) {
+    const uint8_t* color = paletteColors[(i + effectStep * animationSpeed) % 256];
+    blendLayerPixel(layer, target, i, color[0], color[1], color[2]);
+  }
+}
+
+// Layer: the fire effect's heat through the heat palette (stepFire() and
+// selectPalette() first)
+static void drawFireLayer(const SceneLayer& layer, const LayerTarget& target, int begin, int end) {
+  end = min(end, fireHeatSize);
+  for (int i = begin; i < end; i++) {
+    const uint8_t* color = paletteColors[fireHeat[i]];
+    blendLayerPixel(layer, target, i, color[0], color[1], color[2]);
+  }
+}
+
+bool isSceneAnimated() {
+  loadSceneSettings();
+  if (scene.lightMode != LIGHT_MODE_STANDARD) return true;
+  return scene.backgroundMode && scene.backgroundLayer != BACKGROUND_LAYER_COLOR;
+}
+
+// Update LEDs in standard mode (based on distance): background, moving light
+// and directional trail, composed bottom-up
+void updateStandardMode(int startLed) {
+  if (!beginColorFrame()) return;
+  
+  SceneLayer layers[3];
+  int count = 0;
+  
+  // Dim color or an effect under everything else
+  if (scene.backgroundMode) {
+    LayerDraw draw = drawColorLayer;
+    if (scene.backgroundLayer == BACKGROUND_LAYER_PALETTE) {
+      selectPalette(scene.colorPalette);
+      draw = drawPaletteLayer;
+    } else if (scene.backgroundLayer == BACKGROUND_LAYER_FIRE && stepFire()) {
+      selectPalette(PALETTE_HEAT);
+      draw = drawFireLayer;
     }
+    layers[count++] = {draw, BLEND_ALPHA, BACKGROUND_LAYER_LEVEL, 0, renderLength(), 0};
   }
   
-  strip.show();
+  // Moving light covers the background
+  layers[count++] = {drawColorLayer, BLEND_ALPHA, 255, startLed, startLed + scene.movingLightSpan, startLed};
+  
+  // Directional trail fades away from the moving light, but never below the background
+  if (scene.directionLightEnabled && scene.trailLength > 0 && lastDirection != 0) {
+    int origin = (lastDirection > 0) ? startLed : startLed + scene.movingLightSpan;
+    int begin = (lastDirection > 0) ? startLed - scene.trailLength : origin;
+    layers[count++] = {drawTrailLayer, BLEND_MAX, 204, begin, begin + scene.trailLength, origin};
+  }
+  
+  composeLayers(renderTarget(), layers, count);
+  showColorFrame(numLeds);
 }
 
-// Update LEDs in rainbow mode
+// Update LEDs in rainbow mode: cycle through the selected palette
 void updateRainbowMode() {
-  int animationSpeed = map(effectSpeed, 1, 100, 1, 10);
-  for (int i = 0; i < numLeds; i++) {
+  if (!beginIndexedFrame(scene.colorPalette)) return;
+  
+  int animationSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
+  for (int i = windowBegin(); i < windowEnd(); i++) {
     int colorIndex = (i + (effectStep * animationSpeed)) % 256;
-    strip.setPixelColor(i, wheelColor(colorIndex));
+    setGlobalIndex(i, colorIndex);
   }
-  strip.show();
+  showIndexedFrame(renderCountLocal());
 }
 
 // Update LEDs in color wave mode
 void updateColorWaveMode() {
+  if (!beginColorFrame()) return;
+  
   // Map effectSpeed (1-100) to a reasonable animation speed value (1-10)
-  int animationSpeed = map(effectSpeed, 1, 100, 1, 10);
+  int animationSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
   
-  for (int i = 0; i < numLeds; i++) {
+  for (int i = windowBegin(); i < windowEnd(); i++) {
     // Create sine wave pattern for intensity
     float wave = sin((i + (effectStep * animationSpeed)) * 0.1) * 0.5 + 0.5;
-    
+  
     // Create color wave
     int colorIndex = (i * 3 + (effectStep * animationSpeed)) % 256;
     uint32_t baseColor = wheelColor(colorIndex);
-    
+  
     // Extract RGB components
     uint8_t r = (baseColor >> 16) & 0xFF;
     uint8_t g = (baseColor >> 8) & 0xFF;
     uint8_t b = baseColor & 0xFF;
-    
+  
     // Apply wave intensity modulated by effectIntensity
-    float intensity = wave * (effectIntensity / 100.0);
-    strip.setPixelColor(i, dimColor(r, g, b, intensity));
+    float intensity = wave * (scene.effectIntensity / 100.0);
+    setGlobalPixel(i, dimColor(r, g, b, intensity));
   }
-  strip.show();
+  showColorFrame(renderCountLocal());
 }
 
 // Update LEDs in breathing mode
 void updateBreathingMode() {
   // Map effectSpeed (1-100) to breathing speed (1-10)
-  int breathSpeed = map(effectSpeed, 1, 100, 1, 10);
+  int breathSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
   
   // Map effectIntensity (1-100) to intensity multiplier (0.1-1.0)
-  float intensityMultiplier = map(effectIntensity, 1, 100, 10, 100) / 100.0;
+  float intensityMultiplier = map(scene.effectIntensity, 1, 100, 10, 100) / 100.0;
   
   // Calculate breathing effect using sine wave
   float breath = sin(effectStep * 0.05 * breathSpeed) * 0.5 + 0.5;
   breath *= intensityMultiplier; // Apply intensity multiplier
   
-  for (int i = 0; i < numLeds; i++) {
-    strip.setPixelColor(i, dimColor(redValue, greenValue, blueValue, breath));
-  }
-  strip.show();
+  // The selected color palette runs from black to full color
+  if (!beginIndexedFrame(PALETTE_COLOR)) return;
+  memset(indexFrame, (uint8_t)(breath * 255), numLeds);
+  showIndexedFrame(numLeds);
 }
 
 // Update LEDs in solid color mode
 void updateSolidMode() {
-  for (int i = 0; i < numLeds; i++) {
-    strip.setPixelColor(i, strip.Color(redValue, greenValue, blueValue));
-  }
-  strip.show();
+  if (!beginIndexedFrame(PALETTE_COLOR)) return;
+  memset(indexFrame, 255, numLeds);
+  showIndexedFrame(numLeds);
 }
 
 // Comet effect: trailing gradient that follows motion
 void updateCometMode(int startLed) {
-  // Map effectSpeed (1-100) to a reasonable tail length (10-50)
-  int tailLength = map(effectSpeed, 1, 100, 10, 50);
+  // Map effectIntensity (1-100) to a fade factor (0.75-0.98); the fade sets
+  // how long the tail is
+  float fadeFactor = map(scene.effectIntensity, 1, 100, 75, 98) / 100.0;
   
-  // Map effectIntensity (1-100) to a fade factor (0.75-0.98)
-  float fadeFactor = map(effectIntensity, 1, 100, 75, 98) / 100.0;
+  // The tail is the previous frame, faded
+  if (!beginColorFrame(false)) return;
   
   // First, dim all LEDs slightly (creates the tail fade effect)
-  for (int i = 0; i < numLeds; i++) {
-    uint32_t color = strip.getPixelColor(i);
-    
-    // Extract RGB components
-    uint8_t r = (color >> 16) & 0xFF;
-    uint8_t g = (color >> 8) & 0xFF;
-    uint8_t b = color & 0xFF;
-    
-    // Apply fade factor
-    r = r * fadeFactor;
-    g = g * fadeFactor;
-    b = b * fadeFactor;
-    
-    strip.setPixelColor(i, strip.Color(r, g, b));
+  for (int i = 0; i < numLeds * 3; i++) {
+    colorFrame[i] = colorFrame[i] * fadeFactor;
   }
   
   // Add the new "head" of the comet
-  if (startLed >= 0 && startLed < numLeds) {
-    strip.setPixelColor(startLed, strip.Color(redValue, greenValue, blueValue));
+  if (startLed >= 0 && startLed < renderLength()) {
+    setGlobalPixel(startLed, strip.Color(scene.redValue, scene.greenValue, scene.blueValue));
   }
   
-  strip.show();
+  showColorFrame(numLeds);
 }
 
 // Pulse effect: pulses emanate from the motion point
 void updatePulseMode(int startLed) {
-  strip.clear();
+  if (!beginColorFrame()) return;
   
   // Map effectSpeed (1-100) to pulse speed (1-10)
-  int pulseSpeed = map(effectSpeed, 1, 100, 1, 10);
+  int pulseSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
   
   // Map effectIntensity (1-100) to maximum pulse radius (10-50)
-  int maxRadius = map(effectIntensity, 1, 100, 10, 50);
+  int maxRadius = map(scene.effectIntensity, 1, 100, 10, 50);
   
   // Create multiple pulses
   for (int pulse = 0; pulse < 3; pulse++) {
     // Calculate pulse radius based on effectStep
     int radius = (effectStep * pulseSpeed + (pulse * 85)) % (maxRadius * 2);
     if (radius > maxRadius) radius = (maxRadius * 2) - radius; // Reflect back
-    
+  
     // Draw the pulse
     for (int i = startLed - radius; i <= startLed + radius; i++) {
-      if (i >= 0 && i < numLeds) {
+      if (i >= 0 && i < renderLength()) {
         // Fade intensity based on distance from center
         float distFactor = 1.0 - abs(i - startLed) / (float)radius;
         distFactor = distFactor * distFactor; // Square for nicer falloff
-        
-        uint8_t r = redValue * distFactor;
-        uint8_t g = greenValue * distFactor;
-        uint8_t b = blueValue * distFactor;
-        
-        strip.setPixelColor(i, strip.Color(r, g, b));
+  
+        uint8_t r = scene.redValue * distFactor;
+        uint8_t g = scene.greenValue * distFactor;
+        uint8_t b = scene.blueValue * distFactor;
+  
+        setGlobalPixel(i, strip.Color(r, g, b));
       }
     }
   }
   
-  strip.show();
+  showColorFrame(numLeds);
 }
 
 // Fire effect: simulates flickering flames
 void updateFireMode() {
-  // Map effectSpeed (1-100) to fire speed (1-20)
-  int fireSpeed = map(effectSpeed, 1, 100, 1, 20);
-  
-  // Map effectIntensity (1-100) to cooling rate (20-100)
-  int cooling = map(effectIntensity, 1, 100, 20, 100);
-  
-  // Dynamic array allocation for heat values
-  static uint8_t* heat = nullptr;
-  static int allocatedLeds = 0;
-  
-  // Reallocate heat array if LED count changed
-  if (allocatedLeds != numLeds) {
-    if (heat != nullptr) {
-      free(heat);
-    }
-    heat = (uint8_t*)malloc(numLeds * sizeof(uint8_t));
-    if (heat == nullptr) {
-      Serial.println("ERROR: Cannot allocate memory for fire effect");
-      return;
-    }
-    // Initialize heat array
-    for (int i = 0; i < numLeds; i++) {
-      heat[i] = 0;
-    }
-    allocatedLeds = numLeds;
-    Serial.printf("Allocated fire effect buffer for %d LEDs\n", numLeds);
-  }
-  
-  // Step 1: Cool down every cell a little
-  for (int i = 0; i < numLeds; i++) {
-    heat[i] = qsub8(heat[i], random(0, ((cooling * 10) / numLeds) + 2));
-  }
-  
-  // Step 2: Heat rises - transfer heat from each cell to the one above
-  for (int k = numLeds - 1; k >= 2; k--) {
-    heat[k] = (heat[k - 1] + heat[k - 2] + heat[k - 2]) / 3;
-  }
-  
-  // Step 3: Randomly ignite new sparks near the bottom
-  if (random8() < fireSpeed) {
-    int y = random8(min(7, numLeds / 4)); // Scale spark area with LED count
-    heat[y] = qadd8(heat[y], random8(160, 255));
-  }
+  if (!stepFire()) return;
   
-  // Step 4: Convert heat to LED colors
-  for (int j = 0; j < numLeds; j++) {
-    // Map heat level to color palette
-    uint8_t t = heat[j];
-    uint32_t color;
-    
-    if (t > 240) { // White (hottest)
-      color = strip.Color(255, 255, 255);
-    } else if (t > 210) { // Yellow
-      color = strip.Color(255, 255, t - 210);
-    } else if (t > 140) { // Orange
-      color = strip.Color(255, map(t, 140, 210, 0, 255), 0);
-    } else { // Red (coolest fire)
-      color = strip.Color(map(t, 0, 140, 0, 255), 0, 0);
-    }
-    
-    strip.setPixelColor(j, color);
+  // Heat levels index the heat palette (red, orange, yellow, white)
+  if (!beginIndexedFrame(PALETTE_HEAT)) return;
+  for (int j = windowBegin(); j < windowEnd(); j++) {
+    setGlobalIndex(j, fireHeat[j]);
   }
   
-  strip.show();
+  showIndexedFrame(renderCountLocal());
 }
 
 // Theater chase effect: alternating on/off lights that move
 void updateTheaterChaseMode() {
   // Map effectSpeed (1-100) to chase speed (1-10)
-  int chaseSpeed = map(effectSpeed, 1, 100, 1, 10);
+  int chaseSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
   
   // Map effectIntensity (1-100) to gap size (1-5)
-  int gapSize = map(effectIntensity, 1, 100, 1, 5);
+  int gapSize = map(scene.effectIntensity, 1, 100, 1, 5);
   
-  strip.clear();
+  // Starts out all black (index 0 of the color palette)
+  if (!beginIndexedFrame(PALETTE_COLOR)) return;
   
   // Calculate chase position based on effectStep
   int pos = (effectStep * chaseSpeed) % (gapSize * 2);
   
   // Set every nth LED based on the current chase position
-  for (int i = 0; i < numLeds; i++) {
+  for (int i = windowBegin(); i < windowEnd(); i++) {
     if ((i + pos) % (gapSize * 2) < gapSize) {
-      strip.setPixelColor(i, strip.Color(redValue, greenValue, blueValue));
+      setGlobalIndex(i, 255);
     }
   }
   
-  strip.show();
+  showIndexedFrame(numLeds);
 }
 
 // Dual scan effect: two scanning lights that move in opposite directions
 void updateDualScanMode(int startLed) {
   // Map effectSpeed (1-100) to scan speed (1-10)
-  int scanSpeed = map(effectSpeed, 1, 100, 1, 10);
+  int scanSpeed = map(scene.effectSpeed, 1, 100, 1, 10);
   
   // Map effectIntensity (1-100) to scan width (1-20)
-  int scanWidth = map(effectIntensity, 1, 100, 1, 20);
+  int scanWidth = map(scene.effectIntensity, 1, 100, 1, 20);
   
-  strip.clear();
+  if (!beginColorFrame()) return;
   
   // Calculate scan position based on effectStep
-  int pos1 = (effectStep * scanSpeed) % numLeds;
-  int pos2 = numLeds - 1 - pos1; // Opposite direction
+  int length = renderLength();
+  int pos1 = (effectStep * scanSpeed) % length;
+  int pos2 = length - 1 - pos1; // Opposite direction
   
   // Create two moving scan beams
   for (int i = 0; i < scanWidth; i++) {
     int p1 = pos1 + i;
     int p2 = pos2 - i;
-    
-    if (p1 >= 0 && p1 < numLeds) {
+  
+    if (p1 >= 0 && p1 < length) {
       float fade = 1.0 - (float)i / scanWidth;
-      strip.setPixelColor(p1, dimColor(redValue, greenValue, blueValue, fade));
+      setGlobalPixel(p1, dimColor(scene.redValue, scene.greenValue, scene.blueValue, fade));
     }
-    
-    if (p2 >= 0 && p2 < numLeds) {
+  
+    if (p2 >= 0 && p2 < length) {
       float fade = 1.0 - (float)i / scanWidth;
-      strip.setPixelColor(p2, dimColor(redValue, greenValue, blueValue, fade));
+      setGlobalPixel(p2, dimColor(scene.redValue, scene.greenValue, scene.blueValue, fade));
     }
   }
   
   // Add brighter point at the tracked motion position
-  if (startLed >= 0 && startLed < numLeds) {
-    strip.setPixelColor(startLed, strip.Color(redValue, greenValue, blueValue));
+  if (startLed >= 0 && startLed < length) {
+    setGlobalPixel(startLed, strip.Color(scene.redValue, scene.greenValue, scene.blueValue));
   }
   
-  strip.show();
+  showColorFrame(numLeds);
 }
 
 // Motion particles effect: particles that spawn from the motion point
@@ -580,40 +1270,47 @@ void updateMotionParticlesMode(int startLed) {
   static Particle* particles = nullptr;
   static int maxParticles = 0;
   
+  // Particles live on the whole system strip so they can cross segment borders
+  int length = renderLength();
+  
   // Reallocate particle array if needed
-  int neededParticles = min(50, numLeds / 10); // Scale particles with LED count
+  int neededParticles = min(50, length / 10); // Scale particles with LED count
   if (maxParticles != neededParticles) {
     if (particles != nullptr) {
       free(particles);
+      telemetryTrackFree(TELEMETRY_SUBSYSTEM_EFFECTS, maxParticles * sizeof(Particle));
     }
     particles = (Particle*)malloc(neededParticles * sizeof(Particle));
     if (particles == nullptr) {
+      telemetryTrackAllocFailure(TELEMETRY_SUBSYSTEM_EFFECTS);
+      maxParticles = 0;
       Serial.println("ERROR: Cannot allocate memory for particles");
       return;
     }
-    
+  
     // Initialize particles
     for (int i = 0; i < neededParticles; i++) {
       particles[i].active = false;
     }
     maxParticles = neededParticles;
+    telemetryTrackAlloc(TELEMETRY_SUBSYSTEM_EFFECTS, maxParticles * sizeof(Particle));
     Serial.printf("Allocated particle buffer for %d particles\n", maxParticles);
   }
   
   // Map effectSpeed (1-100) to particle speed (0.5-3.0)
-  float particleMaxSpeed = map(effectSpeed, 1, 100, 50, 300) / 100.0;
+  float particleMaxSpeed = map(scene.effectSpeed, 1, 100, 50, 300) / 100.0;
   
   // Map effectIntensity (1-100) to spawn rate (1-10)
-  int spawnRate = map(effectIntensity, 1, 100, 1, 10);
+  int spawnRate = map(scene.effectIntensity, 1, 100, 1, 10);
   
   // Spawn new particles from the motion point
   for (int i = 0; i < spawnRate; i++) {
-    if (random(100) < 30) { // 30% chance to spawn a new particle
+    if (random8(100) < 30) { // 30% chance to spawn a new particle
       // Find an inactive particle slot
       for (int j = 0; j < maxParticles; j++) {
         if (!particles[j].active) {
           particles[j].position = startLed;
-          particles[j].velocity = (random(100) / 100.0 * 2.0 - 1.0) * particleMaxSpeed; // Random direction
+          particles[j].velocity = (random8(100) / 100.0 * 2.0 - 1.0) * particleMaxSpeed; // Random direction
           particles[j].brightness = 1.0;
           particles[j].active = true;
           break;
@@ -622,8 +1319,8 @@ void updateMotionParticlesMode(int startLed) {
     }
   }
   
-  // Clear the strip
-  strip.clear();
+  // Clear the frame
+  if (!beginColorFrame()) return;
   
   // Update and draw particles
   for (int i = 0; i < maxParticles; i++) {
@@ -631,22 +1328,99 @@ void updateMotionParticlesMode(int startLed) {
       // Update position
       particles[i].position += particles[i].velocity;
       particles[i].brightness -= 0.02; // Fade out
-      
+  
       // Deactivate if off strip or too dim
-      if (particles[i].position < 0 || particles[i].position >= numLeds || particles[i].brightness <= 0) {
+      if (particles[i].position < 0 || particles[i].position >= length || particles[i].brightness <= 0) {
         particles[i].active = false;
         continue;
       }
-      
+  
       // Draw particle
       int pos = (int)particles[i].position;
-      if (pos >= 0 && pos < numLeds) {
-        strip.setPixelColor(pos, dimColor(redValue, greenValue, blueValue, particles[i].brightness));
+      if (pos >= 0 && pos < length) {
+        setGlobalPixel(pos, dimColor(scene.redValue, scene.greenValue, scene.blueValue, particles[i].brightness));
       }
     }
   }
   
-  strip.show();
+  showColorFrame(numLeds);
+}
+
+static volatile uint32_t benchmarkSink;
+
+bool runRenderBenchmark(RenderBenchmark* result) {
+  const int leds = RENDER_BENCHMARK_LEDS;
+  const int iterations = RENDER_BENCHMARK_ITERATIONS;
+  
+  // Scratch buffers, so the benchmark size doesn't depend on the strip.
+  // The scratch strip is never begun, so it doesn't drive a pin.
+  uint8_t* color = (uint8_t*)malloc(leds * 3);
+  uint8_t* index = (uint8_t*)malloc(leds);
+  uint8_t* pixels = (uint8_t*)malloc(leds * 3);
+  Adafruit_NeoPixel scratch(leds, -1, NEO_GRB + NEO_KHZ800);
+  
+  bool allocated = color && index && pixels && scratch.getPixels();
+  if (allocated) {
+    // A gradient, so no pass sees only zeros
+    for (int i = 0; i < leds; i++) {
+      color[i * 3] = i;
+      color[i * 3 + 1] = i * 3;
+      color[i * 3 + 2] = 255 - i;
+      index[i] = i;
+    }
+    loadSceneSettings();
+    updateGammaLut();
+    if (paletteColorsKey == UINT64_MAX) selectPalette(scene.colorPalette);
+    updatePaletteLut();
+    scratch.setBrightness(scene.brightness);  // the library's scaling, as the old path used
+    
+    uint32_t mhz = getCpuFrequencyMhz();
+    uint8_t levels = 0;
+    uint32_t sum = 0;
+    
+    uint32_t start = ESP.getCycleCount();
+    for (int n = 0; n < iterations; n++) {
+      for (int i = 0; i < leds; i++) {
+        scratch.setPixelColor(i, strip.Color(color[i * 3], color[i * 3 + 1], color[i * 3 + 2]));
+      }
+    }
+    result->setPixelColorUs = (float)(ESP.getCycleCount() - start) / mhz / iterations;
+    
+    start = ESP.getCycleCount();
+    for (int n = 0; n < iterations; n++) {
+      levels |= convertColorFrame(color, pixels, leds, n, 1, sum);
+    }
+    result->colorOutputUs = (float)(ESP.getCycleCount() - start) / mhz / iterations;
+    
+    start = ESP.getCycleCount();
+    for (int n = 0; n < iterations; n++) {
+      levels |= convertIndexedFrame(index, pixels, leds, n, 1, sum);
+    }
+    result->indexedOutputUs = (float)(ESP.getCycleCount() - start) / mhz / iterations;
+    
+    // Every layer spans the whole strip, the most a scene can cost
+    LayerTarget target = {pixels, 0, leds, leds, false};
+    const SceneLayer layers[3] = {
+      {drawColorLayer, BLEND_ALPHA, BACKGROUND_LAYER_LEVEL, 0, leds, 0},
+      {drawPaletteLayer, BLEND_ADD, 128, 0, leds, 0},
+      {drawTrailLayer, BLEND_MAX, 204, 0, leds, leds / 2},
+    };
+    start = ESP.getCycleCount();
+    for (int n = 0; n < iterations; n++) {
+      composeLayers(target, layers, 3);
+    }
+    result->compositeUs = (float)(ESP.getCycleCount() - start) / mhz / iterations;
+    
+    result->leds = leds;
+    
+    // Keeps the passes from being optimized away
+    benchmarkSink = levels + sum + pixels[leds * 3 - 1] + scratch.getPixels()[0];
+  }
+  
+  free(color);
+  free(index);
+  free(pixels);
+  return allocated;
 }
 
 // Get current configured LED count
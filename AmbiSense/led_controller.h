@@ -4,9 +4,6 @@
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
 
-// Forward declaration for ESP-NOW LED segment data structure
-struct led_segment_data_t;
-
 // Maximum supported LEDs (can be increased based on available memory)
 #define MAX_SUPPORTED_LEDS 2000
 
@@ -51,10 +48,108 @@ void testAllLEDs();
 
 /**
  * Update LEDs based on distance reading
- * @param distance The current distance reading from the radar sensor
+ * @param distance The current distance reading from the radar sensor, or the
+ *                 fused stair position (see getPositionRange())
  */
 void updateLEDs(int distance);
 
+/**
+ * Render one frame of the current light mode and advance the timebase
+ * Effects are computed over the whole system strip; only the pixels inside
+ * this device's render window are drawn
+ * @param startLed Global LED index of the motion window
+ */
+void renderScene(int startLed);
+
+/**
+ * Select the part of the system strip drawn by this device
+ * @param offset Global index of this device's first LED
+ * @param total Length of the whole system strip (including gaps between segments)
+ * @param length Number of LEDs in this device's segment (0 = whole local strip)
+ * @param reversed True if the segment is wired against the stair direction
+ */
+void setRenderWindow(int offset, int total, int length, bool reversed);
+
+/**
+ * Jump the render timebase to a frame received from the master
+ * Stateful effects replay missed frames (without showing) so they stay in sync
+ * @param frame Master frame counter
+ * @param startLed Global LED index of the motion window
+ */
+void syncRenderTimebase(uint32_t frame, int startLed);
+
+// Settings a frame is rendered with (mirrors the persisted settings)
+struct SceneSettings {
+  int lightMode;
+  int brightness;
+  int redValue;
+  int greenValue;
+  int blueValue;
+  bool backgroundMode;
+  bool directionLightEnabled;
+  int movingLightSpan;
+  int trailLength;
+  int effectSpeed;
+  int effectIntensity;
+  int colorPalette;
+  int backgroundLayer;
+  int transitionMs;
+};
+
+/**
+ * Render with the master's settings while isFollowingMasterScene(), instead
+ * of this device's own. The persisted settings are left alone, so the slave
+ * is back to its own configuration when it stops following.
+ * @param settings Settings from the master's latest scene
+ */
+void setFollowedScene(const SceneSettings& settings);
+
+/**
+ * Show the last frame again when the refresh is due: for the next dither
+ * step, a new brightness or power limit, or the next step of a transition.
+ * A scene that only redraws on motion is redrawn right away once its
+ * settings changed. Call once per loop iteration.
+ */
+void refreshLEDOutput();
+
+// Cost of one pass over RENDER_BENCHMARK_LEDS LEDs, in microseconds
+struct RenderBenchmark {
+  int leds;
+  float setPixelColorUs;   // strip.setPixelColor() with brightness scaling, per LED
+  float colorOutputUs;     // Output stage over an RGB frame
+  float indexedOutputUs;   // Output stage over an indexed frame
+  float compositeUs;       // Three layers (add, max, alpha) blended over every LED
+};
+
+/**
+ * Time the output stage against per-pixel setPixelColor(), and the scene
+ * compositor at its worst case, on scratch buffers.
+ * Call from the loop task; takes a few milliseconds.
+ * @param result Timings, averaged over RENDER_BENCHMARK_ITERATIONS runs
+ * @return false if the scratch buffers could not be allocated
+ */
+bool runRenderBenchmark(RenderBenchmark* result);
+
+/**
+ * Check whether the current scene changes without motion. Animated scenes
+ * are rendered every animation interval; the others (standard mode) only when
+ * a new distance reading arrives.
+ * @return true for effect modes, and for standard mode with an effect background
+ */
+bool isSceneAnimated();
+
+/**
+ * Get the current render frame counter
+ * @return Number of frames rendered since boot (or since last sync)
+ */
+uint32_t getRenderFrame();
+
+/**
+ * Get/set the last detected motion direction (-1, 0, 1)
+ */
+int getMotionDirection();
+void setMotionDirection(int direction);
+
 /**
  * Update LEDs in standard mode (based on distance)
  * @param startLed The starting LED position based on distance
@@ -115,19 +210,6 @@ void updateDualScanMode(int startLed);
  */
 void updateMotionParticlesMode(int startLed);
 
-/**
- * Process LED segment data (ESP-NOW distributed mode)
- * @param segmentData LED segment data structure
- */
-void processLEDSegmentData(led_segment_data_t segmentData);
-
-/**
- * Update LED segment for distributed mode
- * @param globalStartPos Global LED start position  
- * @param segmentData LED segment data
- */
-void updateLEDSegment(int globalStartPos, led_segment_data_t segmentData);
-
 /**
  * Helper function to create a color with a specific intensity
  * @param r Red component (0-255)
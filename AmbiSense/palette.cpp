@@ -0,0 +1,131 @@
+#include <Arduino.h>
+#include "config.h"
+#include "palette.h"
+
+// Built-in palettes, in PALETTE_* order. PALETTE_COLOR and PALETTE_CUSTOM are
+// filled in at expansion time.
+struct BuiltinPalette {
+  const char* name;
+  uint8_t count;
+  PaletteStop stops[PALETTE_MAX_STOPS];
+};
+
+static const BuiltinPalette builtinPalettes[PALETTE_COUNT] = {
+  // Same colors as the old color wheel: red, green, blue and back to red
+  {"Rainbow", 4, {{0, 255, 0, 0}, {85, 0, 255, 0}, {170, 0, 0, 255}, {255, 255, 0, 0}}},
+  // Fire effect heat: dark red through orange and yellow, white at the top
+  {"Heat",    6, {{0, 0, 0, 0}, {140, 255, 0, 0}, {210, 255, 255, 0}, {240, 255, 255, 30},
+                  {241, 255, 255, 255}, {255, 255, 255, 255}}},
+  {"Ocean",   5, {{0, 0, 16, 64}, {80, 0, 96, 192}, {160, 0, 192, 200}, {208, 128, 240, 255},
+                  {255, 0, 16, 64}}},
+  {"Forest",  4, {{0, 0, 48, 0}, {96, 32, 160, 16}, {176, 128, 200, 32}, {255, 0, 48, 0}}},
+  {"Sunset",  5, {{0, 120, 0, 60}, {80, 255, 40, 0}, {150, 255, 140, 0}, {210, 160, 0, 120},
+                  {255, 120, 0, 60}}},
+  {"Color",   0, {}},
+  // Starting point for the user palette
+  {"Custom",  3, {{0, 255, 0, 128}, {128, 0, 128, 255}, {255, 255, 0, 128}}},
+};
+
+static CustomPalette customPalette;
+static uint16_t customPaletteRevision = 0;
+
+// Fill entries by interpolating between stops; before the first and after
+// the last stop the end colors are held
+static void expandStops(const PaletteStop* stops, int count, uint8_t entries[PALETTE_SIZE][3]) {
+  int next = 0;
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    while (next < count && stops[next].position <= i) next++;
+
+    const PaletteStop& lower = stops[max(next - 1, 0)];
+    const PaletteStop& upper = stops[min(next, count - 1)];
+    int span = upper.position - lower.position;
+    if (next == 0 || next == count || span <= 0) {
+      const PaletteStop& held = (next == 0) ? upper : lower;
+      entries[i][0] = held.r;
+      entries[i][1] = held.g;
+      entries[i][2] = held.b;
+      continue;
+    }
+
+    int offset = i - lower.position;
+    entries[i][0] = lower.r + (upper.r - lower.r) * offset / span;
+    entries[i][1] = lower.g + (upper.g - lower.g) * offset / span;
+    entries[i][2] = lower.b + (upper.b - lower.b) * offset / span;
+  }
+}
+
+void expandPalette(uint8_t palette, uint8_t r, uint8_t g, uint8_t b, uint8_t entries[PALETTE_SIZE][3]) {
+  if (palette == PALETTE_COLOR) {
+    const PaletteStop ramp[2] = {{0, 0, 0, 0}, {255, r, g, b}};
+    expandStops(ramp, 2, entries);
+  } else if (palette == PALETTE_CUSTOM) {
+    if (customPalette.count == 0) resetCustomPalette();
+    expandStops(customPalette.stops, customPalette.count, entries);
+  } else {
+    const BuiltinPalette& builtin = builtinPalettes[palette < PALETTE_COUNT ? palette : PALETTE_RAINBOW];
+    expandStops(builtin.stops, builtin.count, entries);
+  }
+}
+
+bool setCustomPalette(const PaletteStop* stops, int count) {
+  if (count < 2 || count > PALETTE_MAX_STOPS) return false;
+  for (int i = 1; i < count; i++) {
+    if (stops[i].position < stops[i - 1].position) return false;
+  }
+
+  customPalette.count = count;
+  memcpy(customPalette.stops, stops, count * sizeof(PaletteStop));
+  // Unused stops are zeroed so the stored record only changes with the palette
+  memset(customPalette.stops + count, 0, (PALETTE_MAX_STOPS - count) * sizeof(PaletteStop));
+  customPaletteRevision++;
+  return true;
+}
+
+const CustomPalette& getCustomPalette() {
+  return customPalette;
+}
+
+void resetCustomPalette() {
+  const BuiltinPalette& builtin = builtinPalettes[PALETTE_CUSTOM];
+  setCustomPalette(builtin.stops, builtin.count);
+}
+
+uint16_t getCustomPaletteRevision() {
+  return customPaletteRevision;
+}
+
+int parsePaletteStops(const char* text, PaletteStop* stops) {
+  int count = 0;
+  const char* p = text;
+
+  while (*p) {
+    if (count == PALETTE_MAX_STOPS) return 0;
+
+    char* end;
+    long position = strtol(p, &end, 10);
+    if (end == p || *end != ':' || position < 0 || position > 255) return 0;
+    p = end + 1;
+
+    long color = strtol(p, &end, 16);
+    if (end - p != 6 || color < 0) return 0;
+    p = end;
+
+    stops[count].position = position;
+    stops[count].r = (color >> 16) & 0xFF;
+    stops[count].g = (color >> 8) & 0xFF;
+    stops[count].b = color & 0xFF;
+    count++;
+
+    if (*p == ',') {
+      p++;
+    } else if (*p != '\0') {
+      return 0;
+    }
+  }
+
+  return count;
+}
+
+const char* getPaletteName(uint8_t palette) {
+  return palette < PALETTE_COUNT ? builtinPalettes[palette].name : "Unknown";
+}
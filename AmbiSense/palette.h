@@ -0,0 +1,81 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/*
+ * Gradient palettes for the indexed render path. Palette effects draw one
+ * byte per LED - an index into a 256-entry palette - and the LED controller
+ * expands the whole frame to strip colors in a single table lookup pass.
+ *
+ * Each palette is a short list of gradient stops (PALETTE_*, see config.h).
+ * The custom palette holds up to PALETTE_MAX_STOPS stops set by the user and
+ * is stored with the render settings.
+ */
+
+#define PALETTE_SIZE 256
+#define PALETTE_MAX_STOPS 8
+
+// One gradient stop: the color at a palette index
+struct PaletteStop {
+  uint8_t position;
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+};
+
+// User palette as stored in the settings
+struct CustomPalette {
+  uint8_t count;
+  PaletteStop stops[PALETTE_MAX_STOPS];
+};
+
+/**
+ * Expand a palette into one color per index
+ * @param palette PALETTE_* id
+ * @param r Selected color, used by PALETTE_COLOR
+ * @param g Selected color, used by PALETTE_COLOR
+ * @param b Selected color, used by PALETTE_COLOR
+ * @param entries Destination, RGB per index
+ */
+void expandPalette(uint8_t palette, uint8_t r, uint8_t g, uint8_t b, uint8_t entries[PALETTE_SIZE][3]);
+
+/**
+ * Replace the custom palette
+ * @param stops Gradient stops, positions in ascending order
+ * @param count Number of stops (2 to PALETTE_MAX_STOPS)
+ * @return false if the stops are not a valid palette
+ */
+bool setCustomPalette(const PaletteStop* stops, int count);
+
+/**
+ * Get the custom palette
+ */
+const CustomPalette& getCustomPalette();
+
+/**
+ * Put back the built-in custom palette
+ */
+void resetCustomPalette();
+
+/**
+ * Get a counter that changes whenever the custom palette does, so cached
+ * expansions know when to rebuild
+ */
+uint16_t getCustomPaletteRevision();
+
+/**
+ * Parse stops in the form "position:RRGGBB,position:RRGGBB,..."
+ * @param text Stops as sent by the client
+ * @param stops Destination, PALETTE_MAX_STOPS entries
+ * @return Number of stops, or 0 if the text is malformed
+ */
+int parsePaletteStops(const char* text, PaletteStop* stops);
+
+/**
+ * Get a palette's name for the web interface
+ */
+const char* getPaletteName(uint8_t palette);
+
+#endif // PALETTE_H
@@ -0,0 +1,96 @@
+#include <Arduino.h>
+#include "config.h"
+#include "profiler.h"
+
+struct ZoneRecord {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS];
+};
+
+static ZoneRecord zoneRecords[PROFILE_ZONE_COUNT];
+static portMUX_TYPE profilerMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const zoneNames[PROFILE_ZONE_COUNT] = {
+  "loop",
+  "webHandler",
+  "settingsSave",
+  "wifi",
+  "radar",
+  "fusion",
+  "scene",
+  "espnow",
+  "animation",
+  "output",
+  "show",
+  "http",
+  "events"
+};
+
+// Values below 4 us get a bucket each; above that, 4 buckets per power of two
+static inline int bucketFor(uint32_t us) {
+  if (us < 4) return us;
+  int octave = 31 - __builtin_clz(us);
+  int sub = (us >> (octave - 2)) & 3;
+  return min((octave - 1) * 4 + sub, PROFILE_HISTOGRAM_BUCKETS - 1);
+}
+
+// Largest value that falls in a bucket
+static uint32_t bucketUpperUs(int bucket) {
+  if (bucket < 4) return bucket;
+  int octave = bucket / 4 + 1;
+  int sub = bucket % 4;
+  return ((uint32_t)(4 + sub + 1) << (octave - 2)) - 1;
+}
+
+void profilerRecord(ProfileZone zone, uint32_t cycles) {
+  uint32_t us = cycles / getCpuFrequencyMhz();
+  int bucket = bucketFor(us);
+
+  portENTER_CRITICAL(&profilerMux);
+  ZoneRecord& record = zoneRecords[zone];
+  if (record.count == 0 || cycles < record.minCycles) record.minCycles = cycles;
+  if (cycles > record.maxCycles) record.maxCycles = cycles;
+  record.count++;
+  record.totalCycles += cycles;
+  record.histogram[bucket]++;
+  portEXIT_CRITICAL(&profilerMux);
+}
+
+void getProfileZoneStats(ProfileZone zone, ProfileZoneStats* stats) {
+  ZoneRecord record;
+  portENTER_CRITICAL(&profilerMux);
+  record = zoneRecords[zone];
+  portEXIT_CRITICAL(&profilerMux);
+
+  uint32_t mhz = getCpuFrequencyMhz();
+  stats->count = record.count;
+  stats->minUs = record.minCycles / mhz;
+  stats->maxUs = record.maxCycles / mhz;
+  stats->avgUs = record.count ? (float)record.totalCycles / record.count / mhz : 0;
+
+  // First bucket at which 99% of the measurements are covered
+  stats->p99Us = 0;
+  uint32_t target = record.count - record.count / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < PROFILE_HISTOGRAM_BUCKETS && record.count > 0; i++) {
+    seen += record.histogram[i];
+    if (seen >= target) {
+      // Never above the slowest measurement; the top bucket is open-ended
+      stats->p99Us = (i == PROFILE_HISTOGRAM_BUCKETS - 1) ? stats->maxUs : min(bucketUpperUs(i), stats->maxUs);
+      break;
+    }
+  }
+}
+
+const char* getProfileZoneName(ProfileZone zone) {
+  return zone < PROFILE_ZONE_COUNT ? zoneNames[zone] : "unknown";
+}
+
+void resetProfiler() {
+  portENTER_CRITICAL(&profilerMux);
+  memset(zoneRecords, 0, sizeof(zoneRecords));
+  portEXIT_CRITICAL(&profilerMux);
+}
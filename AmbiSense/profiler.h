@@ -0,0 +1,88 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/*
+ * Per-stage timing of the loop and web tasks. A PROFILE_ZONE() at the top of
+ * a block times the rest of the block with the CPU cycle counter and adds it
+ * to that zone's statistics: count, min, average, max and a log-scale
+ * histogram for percentiles. Zones may nest; each one counts its own full
+ * time.
+ *
+ * With ENABLE_PROFILER false the zones compile to nothing.
+ */
+
+// Timed stages. Each zone is recorded by one task only.
+enum ProfileZone : uint8_t {
+  PROFILE_ZONE_LOOP,          // Whole loop() iteration
+  PROFILE_ZONE_WEB_HANDLER,   // Settings request run on the loop
+  PROFILE_ZONE_SETTINGS_SAVE,
+  PROFILE_ZONE_WIFI,          // wifiManager.process()
+  PROFILE_ZONE_RADAR,         // processRadarReading(), including LED updates it triggers
+  PROFILE_ZONE_FUSION,        // Combining sensor readings (master)
+  PROFILE_ZONE_SCENE,         // Rendering the master's scene (slave)
+  PROFILE_ZONE_ESPNOW,        // ESP-NOW discovery and maintenance
+  PROFILE_ZONE_ANIMATION,     // Effect frame drawn from loop()
+  PROFILE_ZONE_OUTPUT,        // Output stage: gamma, brightness and dithering into the strip buffer
+  PROFILE_ZONE_SHOW,          // strip.show()
+  PROFILE_ZONE_HTTP,          // server.handleClient() in the web task
+  PROFILE_ZONE_EVENTS,        // Event stream in the web task
+  PROFILE_ZONE_COUNT
+};
+
+// Log-scale histogram: 4 buckets per power of two of microseconds
+#define PROFILE_HISTOGRAM_BUCKETS 64
+
+// Statistics of one zone, in microseconds
+struct ProfileZoneStats {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  float avgUs;
+  uint32_t p99Us;  // Upper edge of the histogram bucket holding the 99th percentile
+};
+
+/**
+ * Add one measurement to a zone
+ * @param zone Zone that was timed
+ * @param cycles Elapsed CPU cycles
+ */
+void profilerRecord(ProfileZone zone, uint32_t cycles);
+
+/**
+ * Get a zone's statistics
+ * @param zone Zone to read
+ * @param stats Structure to fill
+ */
+void getProfileZoneStats(ProfileZone zone, ProfileZoneStats* stats);
+
+/**
+ * Get a zone's name for reports
+ */
+const char* getProfileZoneName(ProfileZone zone);
+
+/**
+ * Clear the statistics of all zones
+ */
+void resetProfiler();
+
+// Times the enclosing block
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfileZone zone) : _zone(zone), _start(ESP.getCycleCount()) {}
+  ~ProfileScope() { profilerRecord(_zone, ESP.getCycleCount() - _start); }
+
+private:
+  ProfileZone _zone;
+  uint32_t _start;
+};
+
+#if ENABLE_PROFILER
+#define PROFILE_ZONE(zone) ProfileScope profileScope(zone)
+#else
+#define PROFILE_ZONE(zone) do {} while (0)
+#endif
+
+#endif // PROFILER_H
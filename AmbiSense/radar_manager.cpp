@@ -40,9 +40,13 @@ bool processRadarReading() {
 
     if (radar.isConnected()) {
         int rawDistance = radar.movingTargetDistance();
+        uint8_t energy = radar.movingTargetEnergy();
         
         // If no moving target, check for stationary target
-        if (rawDistance == 0) rawDistance = radar.stationaryTargetDistance();
+        if (rawDistance == 0) {
+            rawDistance = radar.stationaryTargetDistance();
+            energy = radar.stationaryTargetEnergy();
+        }
         
         // Ensure rawDistance is in valid range
         if (rawDistance < minDistance) rawDistance = minDistance;
@@ -154,7 +158,7 @@ bool processRadarReading() {
             }
             
             if (validMaster) {
-                sendSensorData(currentDistance, direction);
+                sendSensorData(currentDistance, direction, energy);
                 // REMOVED: LED updates for slaves in master-slave mode
                 // Slaves should not control LEDs when connected to a master
             } else {
@@ -166,7 +170,7 @@ bool processRadarReading() {
                 }
                 
                 // If no master configured, slave can control its own LEDs for testing
-                if (lightMode == LIGHT_MODE_STANDARD) {
+                if (!isSceneAnimated()) {
                     updateLEDs(currentDistance);
                 }
             }
@@ -177,17 +181,18 @@ bool processRadarReading() {
         if (deviceRole == DEVICE_ROLE_MASTER) {
             if (numSlaveDevices == 0) {
                 // No slaves configured, update LEDs directly for standard mode
-                if (lightMode == LIGHT_MODE_STANDARD) {
+                if (!isSceneAnimated()) {
                     updateLEDs(currentDistance);
                 }
+            } else {
+                // With slaves our reading is combined with theirs in processPendingSensorData()
+                updateLocalSensorReading(currentDistance, direction, energy);
             }
-            // If slaves are configured, updateLEDsWithMultiSensorData() will handle LED updates
-            // This is called automatically from ESP-NOW when data is received
         }
         
         // STANDALONE MODE: If no role is set or unknown role, act as standalone
         if (deviceRole != DEVICE_ROLE_MASTER && deviceRole != DEVICE_ROLE_SLAVE) {
-            if (lightMode == LIGHT_MODE_STANDARD) {
+            if (!isSceneAnimated()) {
                 updateLEDs(currentDistance);
             }
         }
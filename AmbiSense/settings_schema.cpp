@@ -0,0 +1,162 @@
+#include <Arduino.h>
+#include "config.h"
+#include "settings_schema.h"
+#include "eeprom_manager.h"
+
+const SettingDescriptor settingsSchema[] = {
+  // key                       type           target                    min   max                          default                             section                     apply
+  {"numLeds",                 SETTING_INT,   &numLeds,                 1,    MAX_SUPPORTED_LEDS,          DEFAULT_NUM_LEDS,                   SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_COUNT},
+  {"minDist",                 SETTING_INT,   &minDistance,             0,    500,                         DEFAULT_MIN_DISTANCE,               SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"maxDist",                 SETTING_INT,   &maxDistance,             1,    1000,                        DEFAULT_MAX_DISTANCE,               SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"brightness",              SETTING_INT,   &brightness,              0,    255,                         DEFAULT_BRIGHTNESS,                 SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"lightSpan",               SETTING_INT,   &movingLightSpan,         1,    100,                         DEFAULT_MOVING_LIGHT_SPAN,          SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"redValue",                SETTING_INT,   &redValue,                0,    255,                         DEFAULT_RED,                        SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"greenValue",              SETTING_INT,   &greenValue,              0,    255,                         DEFAULT_GREEN,                      SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"blueValue",               SETTING_INT,   &blueValue,               0,    255,                         DEFAULT_BLUE,                       SETTINGS_SECTION_SYSTEM,    SETTING_APPLY_LED_CONFIG},
+  {"lightMode",               SETTING_INT,   &lightMode,               0,    LIGHT_MODE_MOTION_PARTICLES, DEFAULT_LIGHT_MODE,                 SETTINGS_SECTION_ADVANCED,  SETTING_APPLY_LED_CONFIG},
+  {"effectSpeed",             SETTING_INT,   &effectSpeed,             1,    100,                         DEFAULT_EFFECT_SPEED,               SETTINGS_SECTION_ADVANCED,  0},
+  {"effectIntensity",         SETTING_INT,   &effectIntensity,         1,    100,                         DEFAULT_EFFECT_INTENSITY,           SETTINGS_SECTION_ADVANCED,  0},
+  {"centerShift",             SETTING_INT,   &centerShift,             -100, 100,                         DEFAULT_CENTER_SHIFT,               SETTINGS_SECTION_ADVANCED,  0},
+  {"trailLength",             SETTING_INT,   &trailLength,             0,    100,                         DEFAULT_TRAIL_LENGTH,               SETTINGS_SECTION_ADVANCED,  0},
+  {"directionalLight",        SETTING_BOOL,  &directionLightEnabled,   0,    1,                           DEFAULT_DIRECTION_LIGHT,            SETTINGS_SECTION_ADVANCED,  0},
+  {"backgroundMode",          SETTING_BOOL,  &backgroundMode,          0,    1,                           DEFAULT_BACKGROUND_MODE,            SETTINGS_SECTION_ADVANCED,  0},
+  {"palette",                 SETTING_INT,   &colorPalette,            0,    PALETTE_COUNT - 1,           DEFAULT_PALETTE,                    SETTINGS_SECTION_RENDER,    0},
+  {"backgroundLayer",         SETTING_INT,   &backgroundLayer,         0,    BACKGROUND_LAYER_COUNT - 1,  DEFAULT_BACKGROUND_LAYER,           SETTINGS_SECTION_RENDER,    0},
+  {"transitionMs",            SETTING_INT,   &transitionMs,            0,    MAX_TRANSITION_MS,           DEFAULT_TRANSITION_MS,              SETTINGS_SECTION_RENDER,    0},
+  {"powerBudget",             SETTING_INT,   &powerBudgetMa,           0,    MAX_POWER_BUDGET_MA,         DEFAULT_POWER_BUDGET_MA,            SETTINGS_SECTION_RENDER,    0},
+  {"motionSmoothing",         SETTING_BOOL,  &motionSmoothingEnabled,  0,    1,                           DEFAULT_MOTION_SMOOTHING_ENABLED,   SETTINGS_SECTION_MOTION,    0},
+  {"positionSmoothingFactor", SETTING_FLOAT, &positionSmoothingFactor, 0,    1,                           DEFAULT_POSITION_SMOOTHING_FACTOR,  SETTINGS_SECTION_MOTION,    0},
+  {"velocitySmoothingFactor", SETTING_FLOAT, &velocitySmoothingFactor, 0,    1,                           DEFAULT_VELOCITY_SMOOTHING_FACTOR,  SETTINGS_SECTION_MOTION,    0},
+  {"predictionFactor",        SETTING_FLOAT, &predictionFactor,        0,    1,                           DEFAULT_PREDICTION_FACTOR,          SETTINGS_SECTION_MOTION,    0},
+  {"positionPGain",           SETTING_FLOAT, &positionPGain,           0,    1,                           DEFAULT_POSITION_P_GAIN,            SETTINGS_SECTION_MOTION,    0},
+  {"positionIGain",           SETTING_FLOAT, &positionIGain,           0,    0.1f,                        DEFAULT_POSITION_I_GAIN,            SETTINGS_SECTION_MOTION,    0},
+  {"sensorPriorityMode",      SETTING_UINT8, &sensorPriorityMode,      0,    SENSOR_PRIORITY_FUSION,      DEFAULT_SENSOR_PRIORITY_MODE,       SETTINGS_SECTION_ESPNOW,    SETTING_APPLY_PRIORITY},
+};
+
+static_assert(sizeof(settingsSchema) / sizeof(settingsSchema[0]) == SETTINGS_SCHEMA_SIZE,
+              "SETTINGS_SCHEMA_SIZE does not match the schema table");
+
+static SettingsSnapshot publishedSettings;
+static portMUX_TYPE snapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+int findSetting(const char* key) {
+  for (int i = 0; i < SETTINGS_SCHEMA_SIZE; i++) {
+    if (strcmp(settingsSchema[i].key, key) == 0) return i;
+  }
+  return -1;
+}
+
+bool parseSettingValue(const SettingDescriptor& setting, const char* text, float& value) {
+  if (setting.type == SETTING_BOOL) {
+    if (strcmp(text, "true") == 0 || strcmp(text, "1") == 0) {
+      value = 1;
+    } else if (strcmp(text, "false") == 0 || strcmp(text, "0") == 0) {
+      value = 0;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  char* end;
+  if (setting.type == SETTING_INT || setting.type == SETTING_UINT8) {
+    value = strtol(text, &end, 10);
+  } else {
+    value = strtof(text, &end);
+  }
+  if (end == text || *end != '\0') return false;
+
+  // NaN fails both comparisons
+  return value >= setting.minValue && value <= setting.maxValue;
+}
+
+float readSetting(const SettingDescriptor& setting) {
+  switch (setting.type) {
+    case SETTING_INT:   return *(int*)setting.target;
+    case SETTING_BOOL:  return *(bool*)setting.target ? 1 : 0;
+    case SETTING_UINT8: return *(uint8_t*)setting.target;
+    default:            return *(float*)setting.target;
+  }
+}
+
+void writeSetting(const SettingDescriptor& setting, float value) {
+  switch (setting.type) {
+    case SETTING_INT:   *(int*)setting.target = (int)value; break;
+    case SETTING_BOOL:  *(bool*)setting.target = value != 0; break;
+    case SETTING_UINT8: *(uint8_t*)setting.target = (uint8_t)value; break;
+    default:            *(float*)setting.target = value; break;
+  }
+}
+
+void validateAllSettings() {
+  for (int i = 0; i < SETTINGS_SCHEMA_SIZE; i++) {
+    const SettingDescriptor& setting = settingsSchema[i];
+    float value = readSetting(setting);
+
+    // NaN fails both comparisons too
+    if (!(value >= setting.minValue && value <= setting.maxValue)) {
+      Serial.printf("WARNING: %s out of range, restoring default\n", setting.key);
+      writeSetting(setting, setting.defaultValue);
+    }
+  }
+
+  // Ensure min is always less than max
+  if (minDistance >= maxDistance) {
+    minDistance = DEFAULT_MIN_DISTANCE;
+    maxDistance = DEFAULT_MAX_DISTANCE;
+  }
+
+  // Validate LED distribution settings (their limits follow numLeds)
+  validateLEDDistributionSettings();
+
+  // Log important values after validation
+  Serial.printf("Validated Min/Max: %d/%d\n", minDistance, maxDistance);
+}
+
+void publishSettingsSnapshot() {
+  SettingsSnapshot snapshot;
+  snapshot.minDistance = minDistance;
+  snapshot.maxDistance = maxDistance;
+  snapshot.brightness = brightness;
+  snapshot.movingLightSpan = movingLightSpan;
+  snapshot.redValue = redValue;
+  snapshot.greenValue = greenValue;
+  snapshot.blueValue = blueValue;
+  snapshot.numLeds = numLeds;
+  snapshot.centerShift = centerShift;
+  snapshot.trailLength = trailLength;
+  snapshot.directionLightEnabled = directionLightEnabled;
+  snapshot.backgroundMode = backgroundMode;
+  snapshot.lightMode = lightMode;
+  snapshot.effectSpeed = effectSpeed;
+  snapshot.effectIntensity = effectIntensity;
+  snapshot.colorPalette = colorPalette;
+  snapshot.powerBudgetMa = powerBudgetMa;
+  snapshot.backgroundLayer = backgroundLayer;
+  snapshot.transitionMs = transitionMs;
+  snapshot.motionSmoothingEnabled = motionSmoothingEnabled;
+  snapshot.positionSmoothingFactor = positionSmoothingFactor;
+  snapshot.velocitySmoothingFactor = velocitySmoothingFactor;
+  snapshot.predictionFactor = predictionFactor;
+  snapshot.positionPGain = positionPGain;
+  snapshot.positionIGain = positionIGain;
+  snapshot.deviceRole = deviceRole;
+  snapshot.sensorPriorityMode = sensorPriorityMode;
+  snapshot.ledSegmentMode = ledSegmentMode;
+  snapshot.ledSegmentStart = ledSegmentStart;
+  snapshot.ledSegmentLength = ledSegmentLength;
+  snapshot.totalSystemLeds = totalSystemLeds;
+
+  // Built outside the lock; the lock only covers the copy
+  portENTER_CRITICAL(&snapshotMux);
+  publishedSettings = snapshot;
+  portEXIT_CRITICAL(&snapshotMux);
+}
+
+SettingsSnapshot getSettingsSnapshot() {
+  SettingsSnapshot snapshot;
+  portENTER_CRITICAL(&snapshotMux);
+  snapshot = publishedSettings;
+  portEXIT_CRITICAL(&snapshotMux);
+  return snapshot;
+}
@@ -0,0 +1,124 @@
+#ifndef SETTINGS_SCHEMA_H
+#define SETTINGS_SCHEMA_H
+
+#include <Arduino.h>
+
+/*
+ * One table describing every user setting: its key, type, range, default,
+ * the settings section it is stored in and what has to happen when it
+ * changes. Boot-time validation and /setBatch both work from it.
+ *
+ * Settings are only changed on the loop task. Other tasks (the web server,
+ * ESP-NOW callbacks) read them through getSettingsSnapshot(), a copy that
+ * loop() republishes after each change, so they never see a half-applied
+ * update. The segment map, sensor geometry and paired addresses are tables,
+ * not settings, and are not in the snapshot: handlers that read them run on
+ * the loop task (onLoop() in web_interface.cpp).
+ */
+
+enum SettingType : uint8_t {
+  SETTING_INT,
+  SETTING_BOOL,
+  SETTING_FLOAT,
+  SETTING_UINT8
+};
+
+#define SETTING_APPLY_LED_CONFIG 0x01  // Needs updateLEDConfig() afterwards
+#define SETTING_APPLY_LED_COUNT  0x02  // Needs the strip rebuilt
+#define SETTING_APPLY_PRIORITY   0x04  // Set through setSensorPriorityMode()
+
+struct SettingDescriptor {
+  const char* key;
+  SettingType type;
+  void* target;
+  float minValue;
+  float maxValue;
+  float defaultValue;
+  uint16_t section; // SETTINGS_SECTION_* the value is stored in
+  uint8_t apply;    // SETTING_APPLY_* flags
+};
+
+#define SETTINGS_SCHEMA_SIZE 26
+
+extern const SettingDescriptor settingsSchema[SETTINGS_SCHEMA_SIZE];
+
+// Settings as other tasks see them
+struct SettingsSnapshot {
+  int minDistance;
+  int maxDistance;
+  int brightness;
+  int movingLightSpan;
+  int redValue;
+  int greenValue;
+  int blueValue;
+  int numLeds;
+  int centerShift;
+  int trailLength;
+  bool directionLightEnabled;
+  bool backgroundMode;
+  int lightMode;
+  int effectSpeed;
+  int effectIntensity;
+  int colorPalette;
+  int powerBudgetMa;
+  int backgroundLayer;
+  int transitionMs;
+  bool motionSmoothingEnabled;
+  float positionSmoothingFactor;
+  float velocitySmoothingFactor;
+  float predictionFactor;
+  float positionPGain;
+  float positionIGain;
+  uint8_t deviceRole;
+  uint8_t sensorPriorityMode;
+  int ledSegmentMode;
+  int ledSegmentStart;
+  int ledSegmentLength;
+  int totalSystemLeds;
+};
+
+/**
+ * Look up a setting by key
+ * @param key Setting name as used by /setBatch
+ * @return Index into settingsSchema, or -1 if there is no such setting
+ */
+int findSetting(const char* key);
+
+/**
+ * Parse and range-check a value for a setting
+ * @param setting Schema entry
+ * @param text Value as sent by the client ("true"/"false" or 1/0 for flags)
+ * @param value Parsed value
+ * @return false if the text isn't a valid value for this setting
+ */
+bool parseSettingValue(const SettingDescriptor& setting, const char* text, float& value);
+
+/**
+ * Get a setting's current value
+ */
+float readSetting(const SettingDescriptor& setting);
+
+/**
+ * Set a setting's value. No range check and no side effects.
+ */
+void writeSetting(const SettingDescriptor& setting, float value);
+
+/**
+ * Validate all settings in one pass over the schema. Values out of range go
+ * back to their default; checks that involve more than one value follow.
+ */
+void validateAllSettings();
+
+/**
+ * Publish the current settings to other tasks. Call from the loop task
+ * after settings changed.
+ */
+void publishSettingsSnapshot();
+
+/**
+ * Get a consistent copy of the last published settings. Safe from any task.
+ * @return Settings as of the last publishSettingsSnapshot()
+ */
+SettingsSnapshot getSettingsSnapshot();
+
+#endif // SETTINGS_SCHEMA_H
@@ -0,0 +1,147 @@
+#include <Preferences.h>
+#include "config.h"
+#include "settings_store.h"
+
+// Stored in front of every payload
+struct RecordHeader {
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t size;
+  uint32_t crc;      // CRC32 of the payload
+};
+
+// What the store is known to hold, so unchanged saves can be skipped
+struct RecordIndexEntry {
+  char key[16];
+  uint8_t version;
+  uint16_t size;
+  uint32_t crc;
+};
+
+static Preferences store;
+static bool storeOpen = false;
+
+static RecordIndexEntry recordIndex[SETTINGS_STORE_MAX_RECORDS];
+static int recordIndexCount = 0;
+
+// Reads and writes only happen on the loop task, so one buffer serves both
+static uint8_t recordBuffer[sizeof(RecordHeader) + SETTINGS_STORE_MAX_RECORD_SIZE];
+
+// CRC-32 (IEEE 802.3), bitwise - records are small and rarely written
+static uint32_t crc32(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+static RecordIndexEntry* findRecord(const char* key) {
+  for (int i = 0; i < recordIndexCount; i++) {
+    if (strcmp(recordIndex[i].key, key) == 0) return &recordIndex[i];
+  }
+  return nullptr;
+}
+
+static void rememberRecord(const char* key, uint8_t version, uint16_t size, uint32_t crc) {
+  RecordIndexEntry* entry = findRecord(key);
+  if (!entry) {
+    // A full index only costs the unchanged-save shortcut
+    if (recordIndexCount >= SETTINGS_STORE_MAX_RECORDS) return;
+    entry = &recordIndex[recordIndexCount++];
+    strncpy(entry->key, key, sizeof(entry->key) - 1);
+    entry->key[sizeof(entry->key) - 1] = '\0';
+  }
+  entry->version = version;
+  entry->size = size;
+  entry->crc = crc;
+}
+
+// The stored copy no longer matches what the index says, so the next write must land
+static void forgetRecord(const char* key) {
+  RecordIndexEntry* entry = findRecord(key);
+  if (entry) {
+    *entry = recordIndex[--recordIndexCount];
+  }
+}
+
+bool settingsStoreBegin() {
+  if (!storeOpen) {
+    storeOpen = store.begin(SETTINGS_STORE_NAMESPACE, false);
+    if (!storeOpen) {
+      Serial.println("ERROR: Failed to open the settings store!");
+    }
+  }
+  return storeOpen;
+}
+
+bool settingsStoreContains(const char* key) {
+  return settingsStoreBegin() && store.isKey(key);
+}
+
+bool settingsStoreRead(const char* key, uint8_t version, void* data, size_t size) {
+  if (size > SETTINGS_STORE_MAX_RECORD_SIZE || !settingsStoreContains(key)) return false;
+
+  size_t length = sizeof(RecordHeader) + size;
+  if (store.getBytesLength(key) != length || store.getBytes(key, recordBuffer, length) != length) {
+    forgetRecord(key);
+    return false;
+  }
+
+  RecordHeader header;
+  memcpy(&header, recordBuffer, sizeof(header));
+  const uint8_t* payload = recordBuffer + sizeof(header);
+
+  if (header.version != version || header.size != size || header.crc != crc32(payload, size)) {
+    forgetRecord(key);
+    return false;
+  }
+
+  memcpy(data, payload, size);
+  rememberRecord(key, version, size, header.crc);
+  return true;
+}
+
+SettingsStoreResult settingsStoreWrite(const char* key, uint8_t version, const void* data, size_t size) {
+  if (size > SETTINGS_STORE_MAX_RECORD_SIZE || !settingsStoreBegin()) return SETTINGS_STORE_FAILED;
+
+  uint32_t crc = crc32((const uint8_t*)data, size);
+
+  RecordIndexEntry* entry = findRecord(key);
+  if (entry && entry->version == version && entry->size == size && entry->crc == crc) {
+    return SETTINGS_STORE_UNCHANGED;
+  }
+
+  RecordHeader header;
+  header.version = version;
+  header.reserved = 0;
+  header.size = size;
+  header.crc = crc;
+  memcpy(recordBuffer, &header, sizeof(header));
+  memcpy(recordBuffer + sizeof(header), data, size);
+
+  // NVS keeps the previous record until the new one is complete, so a retry is safe
+  size_t length = sizeof(header) + size;
+  if (store.putBytes(key, recordBuffer, length) != length &&
+      store.putBytes(key, recordBuffer, length) != length) {
+    return SETTINGS_STORE_FAILED;
+  }
+
+  rememberRecord(key, version, size, crc);
+  return SETTINGS_STORE_WRITTEN;
+}
+
+size_t settingsStoreFreeEntries() {
+  return settingsStoreBegin() ? store.freeEntries() : 0;
+}
+
+void settingsStoreEnd() {
+  if (storeOpen) {
+    store.end();
+    storeOpen = false;
+  }
+  recordIndexCount = 0;
+}
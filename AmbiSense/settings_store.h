@@ -0,0 +1,71 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+
+/*
+ * Keyed, versioned settings records in the ESP32's NVS partition.
+ *
+ * NVS is log-structured: a write appends a new entry and only then retires
+ * the old one, pages are rotated for wear leveling, and a write cut short by
+ * a power loss leaves the previous value in place. Each record adds a layout
+ * version and a CRC32 of its contents, so a record written by a different
+ * layout or damaged in flash reads as missing instead of being loaded.
+ *
+ * A small in-RAM index remembers the CRC of every record read or written,
+ * so saving unchanged contents costs no flash write at all.
+ */
+
+// Result of settingsStoreWrite()
+enum SettingsStoreResult : uint8_t {
+  SETTINGS_STORE_WRITTEN,
+  SETTINGS_STORE_UNCHANGED,  // Same contents as stored - flash left alone
+  SETTINGS_STORE_FAILED
+};
+
+/**
+ * Opens the store. Safe to call more than once; reads and writes open it on demand.
+ * @return false if NVS is unavailable
+ */
+bool settingsStoreBegin();
+
+/**
+ * Check whether a record exists, whatever its version or contents
+ * @param key Record name (at most 15 characters)
+ * @return true if the key is present
+ */
+bool settingsStoreContains(const char* key);
+
+/**
+ * Reads a record
+ * @param key Record name
+ * @param version Expected layout version
+ * @param data Destination, left untouched unless the read succeeds
+ * @param size Expected payload size
+ * @return true if the record exists with this version and size and its CRC32 matches
+ */
+bool settingsStoreRead(const char* key, uint8_t version, void* data, size_t size);
+
+/**
+ * Writes a record, unless the stored copy already has the same contents
+ * @param key Record name
+ * @param version Layout version to store with it
+ * @param data Payload
+ * @param size Payload size (at most SETTINGS_STORE_MAX_RECORD_SIZE)
+ * @return What happened
+ */
+SettingsStoreResult settingsStoreWrite(const char* key, uint8_t version, const void* data, size_t size);
+
+/**
+ * Get the free space left in the store
+ * @return Free NVS entries (32 bytes each)
+ */
+size_t settingsStoreFreeEntries();
+
+/**
+ * Closes the store and forgets the in-RAM index. The next read or write
+ * reopens it, as after a restart.
+ */
+void settingsStoreEnd();
+
+#endif // SETTINGS_STORE_H
@@ -0,0 +1,173 @@
+#include <esp_heap_caps.h>
+#include "config.h"
+#include "telemetry.h"
+
+struct WatchedTask {
+  const char* name;
+  TaskHandle_t handle;  // nullptr once the task has ended
+  uint32_t stackFree;
+};
+
+static WatchedTask watchedTasks[TELEMETRY_MAX_TASKS];
+static int watchedTaskCount = 0;
+
+static TelemetryAllocStats allocStats[TELEMETRY_SUBSYSTEM_COUNT];
+static TelemetryPower power = {0, 0, 256, 0};
+static portMUX_TYPE telemetryMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Set from whichever task failed to allocate
+static volatile uint32_t heapAllocFailures = 0;
+
+// History ring, written and read by the web task only
+static TelemetrySample history[TELEMETRY_HISTORY_SIZE];
+static int historyHead = 0;   // Next slot to write
+static int historyCount = 0;
+static unsigned long lastSampleTime = 0;
+
+static const char* const subsystemNames[TELEMETRY_SUBSYSTEM_COUNT] = {
+  "strip",
+  "effects",
+  "framebuffer"
+};
+
+static void onAllocFailed(size_t size, uint32_t caps, const char* functionName) {
+  heapAllocFailures++;
+}
+
+void telemetryBegin() {
+  heap_caps_register_failed_alloc_callback(onAllocFailed);
+  telemetryRegisterTask("loop", xTaskGetCurrentTaskHandle());
+}
+
+void telemetryRegisterTask(const char* name, TaskHandle_t task) {
+  uint32_t stackFree = uxTaskGetStackHighWaterMark(task);
+
+  portENTER_CRITICAL(&telemetryMux);
+  if (watchedTaskCount < TELEMETRY_MAX_TASKS) {
+    WatchedTask& watched = watchedTasks[watchedTaskCount++];
+    watched.name = name;
+    watched.handle = task;
+    watched.stackFree = stackFree;
+  }
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void telemetryUnregisterTask(TaskHandle_t task) {
+  uint32_t stackFree = uxTaskGetStackHighWaterMark(task);
+
+  portENTER_CRITICAL(&telemetryMux);
+  for (int i = 0; i < watchedTaskCount; i++) {
+    if (watchedTasks[i].handle == task) {
+      watchedTasks[i].stackFree = stackFree;
+      watchedTasks[i].handle = nullptr;
+    }
+  }
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void telemetryTrackAlloc(TelemetrySubsystem subsystem, size_t bytes) {
+  portENTER_CRITICAL(&telemetryMux);
+  TelemetryAllocStats& stats = allocStats[subsystem];
+  stats.allocs++;
+  stats.liveBytes += bytes;
+  if (stats.liveBytes > stats.peakBytes) {
+    stats.peakBytes = stats.liveBytes;
+  }
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void telemetryTrackFree(TelemetrySubsystem subsystem, size_t bytes) {
+  portENTER_CRITICAL(&telemetryMux);
+  TelemetryAllocStats& stats = allocStats[subsystem];
+  stats.frees++;
+  stats.liveBytes -= min((uint32_t)bytes, stats.liveBytes);
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void telemetryTrackAllocFailure(TelemetrySubsystem subsystem) {
+  portENTER_CRITICAL(&telemetryMux);
+  allocStats[subsystem].failures++;
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void telemetryReportPower(uint32_t estimatedMa, uint32_t requestedMa, uint16_t limit) {
+  portENTER_CRITICAL(&telemetryMux);
+  power.estimatedMa = estimatedMa;
+  power.requestedMa = requestedMa;
+  power.limit = limit;
+  if (limit < 256) power.limitedFrames++;
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void getTelemetryPower(TelemetryPower* result) {
+  portENTER_CRITICAL(&telemetryMux);
+  *result = power;
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+void processTelemetry() {
+  unsigned long now = millis();
+  if (historyCount > 0 && now - lastSampleTime < TELEMETRY_SAMPLE_INTERVAL_MS) return;
+  lastSampleTime = now;
+
+  TelemetrySample& sample = history[historyHead];
+  sample.timeMs = now;
+  sample.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  sample.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  sample.fragmentation = sample.freeHeap > 0 ?
+    (uint16_t)(1000 - (uint64_t)sample.largestFreeBlock * 1000 / sample.freeHeap) : 0;
+
+  // Under the lock, so a task can't end between the handle check and the reading
+  portENTER_CRITICAL(&telemetryMux);
+  for (int i = 0; i < TELEMETRY_MAX_TASKS; i++) {
+    uint32_t stackFree = 0;
+    if (i < watchedTaskCount) {
+      WatchedTask& watched = watchedTasks[i];
+      if (watched.handle) {
+        watched.stackFree = uxTaskGetStackHighWaterMark(watched.handle);
+      }
+      stackFree = watched.stackFree;
+    }
+    sample.stackFree[i] = (uint16_t)min(stackFree, (uint32_t)UINT16_MAX);
+  }
+  sample.powerMa = (uint16_t)min(power.estimatedMa, (uint32_t)UINT16_MAX);
+  portEXIT_CRITICAL(&telemetryMux);
+
+  historyHead = (historyHead + 1) % TELEMETRY_HISTORY_SIZE;
+  if (historyCount < TELEMETRY_HISTORY_SIZE) historyCount++;
+}
+
+int getTelemetrySampleCount() {
+  return historyCount;
+}
+
+const TelemetrySample& getTelemetrySample(int index) {
+  int oldest = (historyHead - historyCount + TELEMETRY_HISTORY_SIZE) % TELEMETRY_HISTORY_SIZE;
+  return history[(oldest + index) % TELEMETRY_HISTORY_SIZE];
+}
+
+int getTelemetryTasks(TelemetryTask* tasks, int maxTasks) {
+  portENTER_CRITICAL(&telemetryMux);
+  int count = min(watchedTaskCount, maxTasks);
+  for (int i = 0; i < count; i++) {
+    tasks[i].name = watchedTasks[i].name;
+    tasks[i].stackFree = watchedTasks[i].stackFree;
+    tasks[i].running = watchedTasks[i].handle != nullptr;
+  }
+  portEXIT_CRITICAL(&telemetryMux);
+  return count;
+}
+
+void getTelemetryAllocStats(TelemetrySubsystem subsystem, TelemetryAllocStats* stats) {
+  portENTER_CRITICAL(&telemetryMux);
+  *stats = allocStats[subsystem];
+  portEXIT_CRITICAL(&telemetryMux);
+}
+
+const char* getTelemetrySubsystemName(TelemetrySubsystem subsystem) {
+  return subsystem < TELEMETRY_SUBSYSTEM_COUNT ? subsystemNames[subsystem] : "unknown";
+}
+
+uint32_t getHeapAllocFailures() {
+  return heapAllocFailures;
+}
@@ -0,0 +1,167 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/*
+ * Memory telemetry. Every TELEMETRY_SAMPLE_INTERVAL_MS the web task records
+ * free heap, the largest free block, fragmentation, the unused stack of each
+ * registered task and the estimated LED current into a ring of
+ * TELEMETRY_HISTORY_SIZE samples.
+ *
+ * Subsystems that allocate at runtime report their allocations and frees,
+ * so a buffer that grows or leaks shows up as live bytes that keep rising.
+ * Failed allocations anywhere on the heap are counted as well.
+ */
+
+// Subsystems with their own allocation counters
+enum TelemetrySubsystem : uint8_t {
+  TELEMETRY_SUBSYSTEM_STRIP,        // NeoPixel pixel buffer
+  TELEMETRY_SUBSYSTEM_EFFECTS,      // Effect state (fire heat map, particles)
+  TELEMETRY_SUBSYSTEM_FRAMEBUFFER,  // Render arena (color, indexed and fade frames)
+  TELEMETRY_SUBSYSTEM_COUNT
+};
+
+// One point of the history ring
+struct TelemetrySample {
+  uint32_t timeMs;
+  uint32_t freeHeap;
+  uint32_t largestFreeBlock;
+  uint16_t fragmentation;                  // Permille of free heap outside the largest block
+  uint16_t stackFree[TELEMETRY_MAX_TASKS]; // Bytes of stack never used, per registered task
+  uint16_t powerMa;                        // Estimated LED current of the last frame
+};
+
+// Head of the binary history dump, followed by the samples, oldest first
+struct __attribute__((packed)) TelemetryDumpHeader {
+  uint8_t version;      // TELEMETRY_DUMP_VERSION
+  uint8_t taskCount;    // Registered tasks (stackFree entries that are in use)
+  uint16_t sampleCount;
+  uint16_t sampleSize;  // sizeof(TelemetrySample)
+  uint16_t reserved;
+  uint32_t intervalMs;
+};
+
+#define TELEMETRY_DUMP_VERSION 2
+
+// Allocation counters of one subsystem
+struct TelemetryAllocStats {
+  uint32_t allocs;
+  uint32_t frees;
+  uint32_t failures;
+  uint32_t liveBytes;
+  uint32_t peakBytes;
+};
+
+// LED current as estimated by the output stage's power limiter
+struct TelemetryPower {
+  uint32_t estimatedMa;  // Last frame as shown
+  uint32_t requestedMa;  // The same frame without the limit
+  uint16_t limit;        // Share of the brightness allowed, in 1/256
+  uint32_t limitedFrames;
+};
+
+// A task whose stack is watched
+struct TelemetryTask {
+  const char* name;
+  uint32_t stackFree;   // Latest high-water mark (bytes never used)
+  bool running;         // False once the task has ended; stackFree is its last reading
+};
+
+/**
+ * Start counting failed heap allocations and watch the calling (loop) task
+ */
+void telemetryBegin();
+
+/**
+ * Watch a task's stack high-water mark
+ * @param name Task name, must outlive the telemetry module (a literal)
+ * @param task Task handle
+ */
+void telemetryRegisterTask(const char* name, TaskHandle_t task);
+
+/**
+ * Take a final stack reading of a task that is about to end
+ * @param task Task handle
+ */
+void telemetryUnregisterTask(TaskHandle_t task);
+
+/**
+ * Record a successful allocation
+ * @param subsystem Owner of the memory
+ * @param bytes Bytes allocated
+ */
+void telemetryTrackAlloc(TelemetrySubsystem subsystem, size_t bytes);
+
+/**
+ * Record a free
+ * @param subsystem Owner of the memory
+ * @param bytes Bytes released
+ */
+void telemetryTrackFree(TelemetrySubsystem subsystem, size_t bytes);
+
+/**
+ * Record an allocation that failed
+ * @param subsystem Subsystem that asked for the memory
+ */
+void telemetryTrackAllocFailure(TelemetrySubsystem subsystem);
+
+/**
+ * Record the estimated current of a frame (loop task)
+ * @param estimatedMa Draw of the frame as shown
+ * @param requestedMa Draw the frame would have without the power limit
+ * @param limit Power limit for the next frames, in 1/256 of full brightness
+ */
+void telemetryReportPower(uint32_t estimatedMa, uint32_t requestedMa, uint16_t limit);
+
+/**
+ * Get the latest power estimate
+ * @param power Structure to fill
+ */
+void getTelemetryPower(TelemetryPower* power);
+
+/**
+ * Take a sample when one is due. Call from the web task loop; the history
+ * is only read there too.
+ */
+void processTelemetry();
+
+/**
+ * Get the number of samples in the history
+ */
+int getTelemetrySampleCount();
+
+/**
+ * Get a sample from the history (web task only)
+ * @param index 0 = oldest
+ * @return The sample
+ */
+const TelemetrySample& getTelemetrySample(int index);
+
+/**
+ * Copy the watched tasks
+ * @param tasks Destination array
+ * @param maxTasks Size of the destination array
+ * @return Number of tasks copied; their order matches TelemetrySample::stackFree
+ */
+int getTelemetryTasks(TelemetryTask* tasks, int maxTasks);
+
+/**
+ * Get a subsystem's allocation counters
+ * @param subsystem Subsystem to read
+ * @param stats Structure to fill
+ */
+void getTelemetryAllocStats(TelemetrySubsystem subsystem, TelemetryAllocStats* stats);
+
+/**
+ * Get a subsystem's name for reports
+ */
+const char* getTelemetrySubsystemName(TelemetrySubsystem subsystem);
+
+/**
+ * Get the number of failed heap allocations since boot, from any code
+ */
+uint32_t getHeapAllocFailures();
+
+#endif // TELEMETRY_H
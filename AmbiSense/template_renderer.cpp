@@ -0,0 +1,99 @@
+#include <stdarg.h>
+#include "template_renderer.h"
+
+TemplateStream::TemplateStream(WebServer& server) : webServer(server), used(0) {
+}
+
+void TemplateStream::write(const char* data, size_t length) {
+  while (length > 0) {
+    size_t n = min(length, (size_t)TEMPLATE_CHUNK_SIZE - used);
+    memcpy(buffer + used, data, n);
+    used += n;
+    data += n;
+    length -= n;
+    if (used == TEMPLATE_CHUNK_SIZE) flush();
+  }
+}
+
+void TemplateStream::write_P(PGM_P data, size_t length) {
+  while (length > 0) {
+    size_t n = min(length, (size_t)TEMPLATE_CHUNK_SIZE - used);
+    memcpy_P(buffer + used, data, n);
+    used += n;
+    data += n;
+    length -= n;
+    if (used == TEMPLATE_CHUNK_SIZE) flush();
+  }
+}
+
+void TemplateStream::print(const char* text) {
+  write(text, strlen(text));
+}
+
+void TemplateStream::printf(const char* format, ...) {
+  char value[64];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(value, sizeof(value), format, args);
+  va_end(args);
+
+  if (n > 0) {
+    write(value, min((size_t)n, sizeof(value) - 1));
+  }
+}
+
+void TemplateStream::flush() {
+  // A zero-length chunk would end the response, so never send one here
+  if (used == 0) return;
+  webServer.sendContent(buffer, used);
+  used = 0;
+}
+
+static bool isTokenChar(char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+void streamTemplate(WebServer& server, int code, const char* contentType, PGM_P tmpl, TemplateResolver resolve) {
+  TemplateStream out(server);
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, contentType, "");
+
+  PGM_P literal = tmpl;
+  PGM_P p = tmpl;
+  char c;
+
+  while ((c = pgm_read_byte(p)) != '\0') {
+    if (c != '%') {
+      p++;
+      continue;
+    }
+
+    // Read a candidate %TOKEN%
+    char token[TEMPLATE_MAX_TOKEN + 1];
+    size_t length = 0;
+    PGM_P q = p + 1;
+    while (length < TEMPLATE_MAX_TOKEN && isTokenChar(pgm_read_byte(q))) {
+      token[length++] = pgm_read_byte(q);
+      q++;
+    }
+
+    if (length == 0 || pgm_read_byte(q) != '%') {
+      // Plain '%' - leave it in the literal run
+      p++;
+      continue;
+    }
+    token[length] = '\0';
+
+    out.write_P(literal, p - literal);
+    resolve(token, out);
+    p = q + 1;
+    literal = p;
+  }
+
+  out.write_P(literal, p - literal);
+  out.flush();
+
+  // Terminating chunk
+  server.sendContent("", 0);
+}
@@ -0,0 +1,54 @@
+#ifndef TEMPLATE_RENDERER_H
+#define TEMPLATE_RENDERER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// Size of the single output buffer used per request; one chunk per flush
+#define TEMPLATE_CHUNK_SIZE 512
+
+// Longest %PLACEHOLDER% name recognised; longer runs are sent literally
+#define TEMPLATE_MAX_TOKEN 32
+
+// Buffered writer that sends its contents as HTTP chunks when full
+class TemplateStream {
+public:
+  TemplateStream(WebServer& server);
+
+  // Append RAM data
+  void write(const char* data, size_t length);
+
+  // Append flash (PROGMEM) data
+  void write_P(PGM_P data, size_t length);
+
+  // Append a C string
+  void print(const char* text);
+
+  // Append formatted text (values longer than 64 chars are truncated)
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  // Send any buffered bytes as one chunk
+  void flush();
+
+private:
+  WebServer& webServer;
+  char buffer[TEMPLATE_CHUNK_SIZE];
+  size_t used;
+};
+
+// Called for each %TOKEN% found in a template; writes the value to out
+typedef void (*TemplateResolver)(const char* token, TemplateStream& out);
+
+/**
+ * Streams a flash-resident template using chunked transfer encoding,
+ * resolving %TOKEN% placeholders (A-Z, 0-9, _) through the resolver.
+ * A '%' that does not start a placeholder is sent as-is, so CSS like
+ * "100%" needs no escaping. Heap use is independent of the page size.
+ * @param code HTTP status code
+ * @param contentType Response content type
+ * @param tmpl Null-terminated PROGMEM template
+ * @param resolve Placeholder resolver
+ */
+void streamTemplate(WebServer& server, int code, const char* contentType, PGM_P tmpl, TemplateResolver resolve);
+
+#endif // TEMPLATE_RENDERER_H
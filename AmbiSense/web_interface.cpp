@@ -2,42 +2,156 @@
 #include <SPIFFS.h>
 #include <ESPmDNS.h>
 #include <EEPROM.h>
+#include <esp_heap_caps.h>
 
 #include "config.h"
 #include "web_interface.h"
 #include "eeprom_manager.h"
+#include "settings_store.h"
+#include "settings_schema.h"
 #include "led_controller.h"
 #include "wifi_manager.h"
 #include "espnow_manager.h"
+#include "template_renderer.h"
+#include "json_writer.h"
+#include "event_stream.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "palette.h"
 
 // Create WebServer object on port 80
 WebServer server(WEB_SERVER_PORT);
 
-// Full-featured compressed HTML templates stored in PROGMEM to save RAM
-#include "compressed_html_full.h"
+// Fully composed, gzip-compressed pages generated from compressed_html_full.h
+// by tools/gen_web_pages.py. Served directly from flash, no heap copies.
+#include "web_pages_gz.h"
 
-// Function to generate main page HTML
-String getMainHTML() {
-  return buildFullPage(basic_tab_full, "basic", FPSTR(basic_tab_js));
+// Send a precompressed page straight from flash
+static void sendCompressedPage(const uint8_t* page, size_t length) {
+  server.sendHeader("Cache-Control", "max-age=300"); // Cache for 5 minutes
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html; charset=utf-8", (PGM_P)page, length);
 }
 
-// Function to generate advanced settings HTML
-String getAdvancedHTML() {
-  return buildFullPage(advanced_tab_full, "advanced", nullptr);
+// Send a JSON document built on the stack without copying it into a String
+static void sendJson(int code, const JsonWriter& json) {
+  if (json.overflowed()) {
+    server.send_P(500, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Response too large\"}");
+    return;
+  }
+  server.send_P(code, "application/json; charset=utf-8", json.c_str(), json.length());
 }
 
-// Function to generate effects settings HTML
-String getEffectsHTML() {
-  return buildFullPage(effects_tab_full, "effects", nullptr);
+// Send the usual {"status":...,"message":...} reply
+static void sendJsonStatus(int code, const char* status, const char* message) {
+  char buffer[192];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("status", status);
+  json.field("message", message);
+  json.endObject();
+  sendJson(code, json);
 }
 
-// Function to generate mesh settings HTML
-String getMeshHTML() {
-  return buildFullPage(mesh_tab_full, "mesh", FPSTR(mesh_tab_js));
+// Parse one request argument as the given setting, range-checked through the
+// schema as /setBatch does. Replies 400 and returns false if it isn't valid.
+static bool parseSettingArg(const char* key, const char* arg, float& value) {
+  int index = findSetting(key);
+  if (index < 0 || !parseSettingValue(settingsSchema[index], server.arg(arg).c_str(), value)) {
+    char errorMessage[64];
+    snprintf(errorMessage, sizeof(errorMessage), "Invalid value for %s", key);
+    sendJsonStatus(400, "error", errorMessage);
+    return false;
+  }
+  return true;
 }
-void handleDiagnostics() {
-  // Real-time diagnostics page with live updates
-  String html = R"(<!DOCTYPE html>
+
+// Web server task and the hand-over of state-changing handlers to loop()
+static TaskHandle_t webTask = nullptr;
+static SemaphoreHandle_t handlerDone = nullptr;
+static void (* volatile pendingHandler)() = nullptr;
+static uint32_t handlerMaxUs = 0;
+static uint32_t handlersOverBudget = 0;
+
+static void webServerTask(void* parameter) {
+  for (;;) {
+    // Accepting, reading and answering slow clients happens here, off the render path
+    {
+      PROFILE_ZONE(PROFILE_ZONE_HTTP);
+      server.handleClient();
+    }
+    {
+      PROFILE_ZONE(PROFILE_ZONE_EVENTS);
+      processEventStream();
+    }
+    wifiManager.processScan();
+    processTelemetry();
+    
+    // Let the idle task run and feed its watchdog
+    vTaskDelay(1);
+  }
+}
+
+// Run a handler in loop() and wait for it; called from the web server task
+static void runOnLoop(void (*handler)()) {
+  if (server.args() > WEB_MAX_REQUEST_ARGS) {
+    sendJsonStatus(413, "error", "Too many parameters");
+    return;
+  }
+  size_t requestBytes = 0;
+  for (int i = 0; i < server.args(); i++) {
+    requestBytes += server.argName(i).length() + server.arg(i).length();
+  }
+  if (requestBytes > WEB_MAX_REQUEST_BYTES) {
+    sendJsonStatus(413, "error", "Request too large");
+    return;
+  }
+  
+  if (!webTask) {
+    handler();
+    publishSettingsSnapshot();
+    return;
+  }
+  
+  pendingHandler = handler;
+  xSemaphoreTake(handlerDone, portMAX_DELAY);
+}
+
+// Register a handler that changes render state
+static void onLoop(const char* uri, HTTPMethod method, void (*handler)()) {
+  server.on(uri, method, [handler]() { runOnLoop(handler); });
+}
+
+void serviceWebRequests() {
+  void (*handler)() = pendingHandler;
+  if (!handler) return;
+  
+  unsigned long start = micros();
+  {
+    PROFILE_ZONE(PROFILE_ZONE_WEB_HANDLER);
+    handler();
+  }
+  uint32_t elapsed = micros() - start;
+  
+  // Settings changes become visible to the web task in one step
+  publishSettingsSnapshot();
+  
+  // The request still belongs to us until handlerDone is given: after that
+  // the web task may already be parsing the next one into server.uri()
+  if (elapsed > handlerMaxUs) handlerMaxUs = elapsed;
+  if (elapsed > WEB_HANDLER_BUDGET_US) {
+    handlersOverBudget++;
+    if (ENABLE_DEBUG_LOGGING) {
+      Serial.printf("[Web] %s took %u us on the render loop\n", server.uri().c_str(), (unsigned)elapsed);
+    }
+  }
+  
+  pendingHandler = nullptr;
+  xSemaphoreGive(handlerDone);
+}
+
+// Diagnostics page, streamed by streamTemplate() with live values filled in
+static const char diagnostics_template[] PROGMEM = R"(<!DOCTYPE html>
 <html><head>
 <meta charset="UTF-8">
 <meta http-equiv="Content-Type" content="text/html; charset=utf-8">
@@ -86,19 +200,31 @@ body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;background:var(--bg
 <h3>📊 System Status</h3>
 <div class='metric'>
 <span class='metric-label'>Device Role</span>
-<span class='metric-value' id='deviceRole'>)" + String(deviceRole == DEVICE_ROLE_MASTER ? "Master" : "Slave") + R"(</span>
+<span class='metric-value' id='deviceRole'>%DEVICE_ROLE%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Current Distance</span>
-<span class='metric-value' id='currentDistance'>)" + String(currentDistance) + R"( cm</span>
+<span class='metric-value' id='currentDistance'>%CURRENT_DISTANCE% cm</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>LED Count</span>
-<span class='metric-value' id='ledCount'>)" + String(numLeds) + R"(</span>
+<span class='metric-value' id='ledCount'>%NUM_LEDS%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Light Mode</span>
-<span class='metric-value' id='lightMode'>)" + String(lightMode) + R"(</span>
+<span class='metric-value' id='lightMode'>%LIGHT_MODE%</span>
+</div>
+<div class='metric'>
+<span class='metric-label'>Velocity</span>
+<span class='metric-value' id='velocity'>-- cm/s</span>
+</div>
+<div class='metric'>
+<span class='metric-label'>Active Sensor</span>
+<span class='metric-value' id='activeSensor'>--</span>
+</div>
+<div class='metric'>
+<span class='metric-label'>Render FPS</span>
+<span class='metric-value' id='renderFps'>--</span>
 </div>
 </div>
 
@@ -106,19 +232,19 @@ body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;background:var(--bg
 <h3>💾 Memory & Performance</h3>
 <div class='metric'>
 <span class='metric-label'>Free Heap</span>
-<span class='metric-value' id='freeHeap'>)" + String(ESP.getFreeHeap()) + R"( bytes</span>
+<span class='metric-value' id='freeHeap'>%FREE_HEAP% bytes</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Total Heap</span>
-<span class='metric-value'>)" + String(ESP.getHeapSize()) + R"( bytes</span>
+<span class='metric-value'>%TOTAL_HEAP% bytes</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Uptime</span>
-<span class='metric-value' id='uptime'>)" + String(millis() / 1000) + R"( sec</span>
+<span class='metric-value' id='uptime'>%UPTIME% sec</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>WiFi RSSI</span>
-<span class='metric-value' id='wifiRssi'>)" + String(WiFi.RSSI()) + R"( dBm</span>
+<span class='metric-value' id='wifiRssi'>%WIFI_RSSI% dBm</span>
 </div>
 </div>
 
@@ -126,19 +252,19 @@ body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;background:var(--bg
 <h3>🎯 Motion Settings</h3>
 <div class='metric'>
 <span class='metric-label'>Min Distance</span>
-<span class='metric-value' id='minDistance'>)" + String(minDistance) + R"( cm</span>
+<span class='metric-value' id='minDistance'>%MIN_DISTANCE% cm</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Max Distance</span>
-<span class='metric-value' id='maxDistance'>)" + String(maxDistance) + R"( cm</span>
+<span class='metric-value' id='maxDistance'>%MAX_DISTANCE% cm</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Brightness</span>
-<span class='metric-value' id='brightness'>)" + String(brightness) + R"(</span>
+<span class='metric-value' id='brightness'>%BRIGHTNESS%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Motion Smoothing</span>
-<span class='metric-value' id='motionSmoothing'>)" + String(motionSmoothingEnabled ? "Enabled" : "Disabled") + R"(</span>
+<span class='metric-value' id='motionSmoothing'>%MOTION_SMOOTHING%</span>
 </div>
 </div>
 
@@ -146,15 +272,15 @@ body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;background:var(--bg
 <h3>📡 Network Info</h3>
 <div class='metric'>
 <span class='metric-label'>IP Address</span>
-<span class='metric-value' id='ipAddress'>)" + WiFi.localIP().toString() + R"(</span>
+<span class='metric-value' id='ipAddress'>%IP_ADDRESS%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>MAC Address</span>
-<span class='metric-value'>)" + WiFi.macAddress() + R"(</span>
+<span class='metric-value'>%MAC_ADDRESS%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>Connected Slaves</span>
-<span class='metric-value' id='slaveCount'>)" + String(numSlaveDevices) + R"(</span>
+<span class='metric-value' id='slaveCount'>%SLAVE_COUNT%</span>
 </div>
 <div class='metric'>
 <span class='metric-label'>ESP-NOW Status</span>
@@ -173,14 +299,40 @@ body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;background:var(--bg
 </div>
 
 <script>
+// Fast-changing values arrive over /events; polling only covers the rest
+let streamLive = false;
+
+function showDistance(distance) {
+  document.getElementById('currentDistance').textContent = distance + ' cm';
+  document.getElementById('chartDistance').textContent = distance;
+  updateDistanceChart(distance);
+}
+
+function startEventStream() {
+  if (!window.EventSource) return;
+  const es = new EventSource('/events?hz=10');
+  es.onopen = () => { streamLive = true; };
+  es.onmessage = e => {
+    const [distance, velocity, sensor, fps] = e.data.split(',').map(Number);
+    showDistance(distance);
+    document.getElementById('velocity').textContent = velocity + ' cm/s';
+    document.getElementById('activeSensor').textContent = sensor < 0 ? 'Holding' : sensor == 0 ? 'Master' : 'Slave ' + sensor;
+    document.getElementById('renderFps').textContent = fps;
+  };
+  es.onerror = () => {
+    // Server full or gone - go back to polling
+    es.close();
+    streamLive = false;
+  };
+}
+
 function updateDiagnostics() {
   // Fetch all diagnostic data in one call for better performance
   fetch('/diagnosticdata')
     .then(r => r.json())
     .then(data => {
-      // Update real-time values
-      document.getElementById('currentDistance').textContent = data.currentDistance + ' cm';
-      document.getElementById('chartDistance').textContent = data.currentDistance;
+      // Distance comes from the stream when it is up
+      if (!streamLive) showDistance(parseInt(data.currentDistance));
       document.getElementById('freeHeap').textContent = data.freeHeap.toLocaleString() + ' bytes';
       document.getElementById('uptime').textContent = data.uptime + ' sec';
       document.getElementById('wifiRssi').textContent = data.wifiRssi + ' dBm';
@@ -197,21 +349,15 @@ function updateDiagnostics() {
       const roleText = data.deviceRole == 1 ? 'Master' : data.deviceRole == 2 ? 'Slave' : 'Standalone';
       document.getElementById('deviceRole').textContent = roleText;
       document.getElementById('slaveCount').textContent = data.numSlaves;
-      
-      // Update distance chart
-      updateDistanceChart(parseInt(data.currentDistance));
     })
     .catch(e => {
       console.error('Error fetching diagnostic data:', e);
       // Fallback to individual endpoints if batch fails
-      fetch('/distance').then(r => r.text()).then(d => {
-        document.getElementById('currentDistance').textContent = d + ' cm';
-        updateDistanceChart(parseInt(d));
-      });
+      if (!streamLive) fetch('/distance').then(r => r.text()).then(d => showDistance(parseInt(d)));
     });
   
-  // Schedule next update
-  setTimeout(updateDiagnostics, 1000);
+  // Schedule next update - slow while the stream carries the live values
+  setTimeout(updateDiagnostics, streamLive ? 5000 : 1000);
 }
 
 function getLightModeName(mode) {
@@ -242,44 +388,284 @@ function updateDistanceChart(distance) {
 }
 
 // Start updates when page loads
-document.addEventListener('DOMContentLoaded', updateDiagnostics);
+document.addEventListener('DOMContentLoaded', () => {
+  startEventStream();
+  updateDiagnostics();
+});
 </script>
 </body></html>)";
-  
-  server.send(200, "text/html; charset=utf-8", html);
+
+// Resolves the diagnostics page placeholders
+static void resolveDiagnosticsToken(const char* token, TemplateStream& out) {
+  if (strcmp(token, "DEVICE_ROLE") == 0) {
+    out.print(deviceRole == DEVICE_ROLE_MASTER ? "Master" : "Slave");
+  } else if (strcmp(token, "CURRENT_DISTANCE") == 0) {
+    out.printf("%d", currentDistance);
+  } else if (strcmp(token, "NUM_LEDS") == 0) {
+    out.printf("%d", numLeds);
+  } else if (strcmp(token, "LIGHT_MODE") == 0) {
+    out.printf("%d", lightMode);
+  } else if (strcmp(token, "FREE_HEAP") == 0) {
+    out.printf("%u", (unsigned)ESP.getFreeHeap());
+  } else if (strcmp(token, "TOTAL_HEAP") == 0) {
+    out.printf("%u", (unsigned)ESP.getHeapSize());
+  } else if (strcmp(token, "UPTIME") == 0) {
+    out.printf("%lu", millis() / 1000);
+  } else if (strcmp(token, "WIFI_RSSI") == 0) {
+    out.printf("%d", (int)WiFi.RSSI());
+  } else if (strcmp(token, "MIN_DISTANCE") == 0) {
+    out.printf("%d", minDistance);
+  } else if (strcmp(token, "MAX_DISTANCE") == 0) {
+    out.printf("%d", maxDistance);
+  } else if (strcmp(token, "BRIGHTNESS") == 0) {
+    out.printf("%d", brightness);
+  } else if (strcmp(token, "MOTION_SMOOTHING") == 0) {
+    out.print(motionSmoothingEnabled ? "Enabled" : "Disabled");
+  } else if (strcmp(token, "IP_ADDRESS") == 0) {
+    IPAddress ip = WiFi.localIP();
+    out.printf("%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  } else if (strcmp(token, "MAC_ADDRESS") == 0) {
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    out.printf("%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  } else if (strcmp(token, "SLAVE_COUNT") == 0) {
+    out.printf("%d", numSlaveDevices);
+  }
+}
+
+void handleDiagnostics() {
+  // Real-time diagnostics page with live updates, streamed in small chunks
+  streamTemplate(server, 200, "text/html; charset=utf-8", diagnostics_template, resolveDiagnosticsToken);
 }
 
 void handleDiagnosticData() {
   // Real-time diagnostic data endpoint
-  String json = "{";
-  json += "\"freeHeap\":" + String(ESP.getFreeHeap()) + ",";
-  json += "\"totalHeap\":" + String(ESP.getHeapSize()) + ",";
-  json += "\"uptime\":" + String(millis() / 1000) + ",";
-  json += "\"wifiRssi\":" + String(WiFi.RSSI()) + ",";
-  json += "\"currentDistance\":" + String(currentDistance) + ",";
-  json += "\"deviceRole\":" + String(deviceRole) + ",";
-  json += "\"numSlaves\":" + String(numSlaveDevices) + ",";
-  json += "\"lightMode\":" + String(lightMode) + ",";
-  json += "\"brightness\":" + String(brightness) + ",";
-  json += "\"numLeds\":" + String(numLeds) + ",";
-  json += "\"motionSmoothing\":" + String(motionSmoothingEnabled ? "true" : "false") + ",";
-  json += "\"minDistance\":" + String(minDistance) + ",";
-  json += "\"maxDistance\":" + String(maxDistance);
-  json += "}";
-  
-  server.send(200, "application/json; charset=utf-8", json);
-}
-
-// Function to generate network HTML page
-String getNetworkHTML() {
-  return buildFullPage(network_tab_full, "network", FPSTR(network_tab_js));
+  SettingsSnapshot settings = getSettingsSnapshot();
+  char buffer[768];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("freeHeap", (unsigned long)ESP.getFreeHeap());
+  json.field("totalHeap", (unsigned long)ESP.getHeapSize());
+  json.field("uptime", millis() / 1000);
+  json.field("wifiRssi", (int)WiFi.RSSI());
+  json.field("currentDistance", currentDistance);
+  json.field("deviceRole", settings.deviceRole);
+  json.field("numSlaves", numSlaveDevices);
+  json.field("lightMode", settings.lightMode);
+  json.field("brightness", settings.brightness);
+  json.field("numLeds", settings.numLeds);
+  json.field("motionSmoothing", settings.motionSmoothingEnabled);
+  json.field("minDistance", settings.minDistance);
+  json.field("maxDistance", settings.maxDistance);
+  json.field("streamClients", getEventStreamClientCount());
+  json.field("handlerMaxUs", (unsigned long)handlerMaxUs);
+  json.field("handlersOverBudget", (unsigned long)handlersOverBudget);
+  
+  // Settings flash wear
+  const SettingsSaveStats& saveStats = getSettingsSaveStats();
+  json.beginObject("settingsStore");
+  json.field("writes", (unsigned long)saveStats.writes);
+  json.field("skippedWrites", (unsigned long)saveStats.skippedWrites);
+  json.field("coalescedChanges", (unsigned long)saveStats.coalescedChanges);
+  json.field("lifetimeWrites", (unsigned long)saveStats.lifetimeWrites);
+  json.field("pendingSections", (unsigned int)getPendingSettingsSections());
+  json.field("freeEntries", (unsigned long)settingsStoreFreeEntries());
+  json.endObject();
+  
+  // Station reconnects and the cost of servicing them on the loop
+  WifiLinkStats link = wifiManager.getLinkStats();
+  json.beginObject("wifi");
+  json.field("state", (int)link.state);
+  json.field("failedAttempts", (unsigned long)link.failedAttempts);
+  json.field("disconnects", (unsigned long)link.disconnects);
+  json.field("reconnects", (unsigned long)link.reconnects);
+  json.field("processMaxUs", (unsigned long)link.processMaxUs);
+  json.field("processAvgUs", (unsigned long)link.processAvgUs);
+  json.endObject();
+  
+  // Startup timing, ms since power-up
+  json.beginObject("boot");
+  json.field("ledsReadyMs", bootLedsReadyMs);
+  json.field("firstLightMs", bootFirstLightMs);
+  json.field("networkReadyMs", bootNetworkReadyMs);
+  json.endObject();
+  json.endObject();
+  
+  sendJson(200, json);
+}
+
+// Per-stage timing; ?reset=1 clears it after the reply is built
+void handleProfile() {
+  char buffer[1536];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("enabled", (bool)ENABLE_PROFILER);
+  json.field("cpuMhz", (unsigned long)getCpuFrequencyMhz());
+  
+  json.beginArray("zones");
+  for (int i = 0; i < PROFILE_ZONE_COUNT; i++) {
+    ProfileZoneStats stats;
+    getProfileZoneStats((ProfileZone)i, &stats);
+    json.beginObject();
+    json.field("name", getProfileZoneName((ProfileZone)i));
+    json.field("count", (unsigned long)stats.count);
+    json.field("minUs", (unsigned long)stats.minUs);
+    json.field("avgUs", stats.avgUs, 1);
+    json.field("maxUs", (unsigned long)stats.maxUs);
+    json.field("p99Us", (unsigned long)stats.p99Us);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  
+  if (server.hasArg("reset") && server.arg("reset") == "1") {
+    resetProfiler();
+  }
+  
+  sendJson(200, json);
+}
+
+void handleBenchmark() {
+  RenderBenchmark result;
+  if (!runRenderBenchmark(&result)) {
+    sendJsonStatus(500, "error", "Not enough memory for the benchmark");
+    return;
+  }
+  
+  char buffer[256];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("leds", result.leds);
+  json.field("iterations", RENDER_BENCHMARK_ITERATIONS);
+  json.field("setPixelColorUs", result.setPixelColorUs, 1);
+  json.field("colorOutputUs", result.colorOutputUs, 1);
+  json.field("indexedOutputUs", result.indexedOutputUs, 1);
+  json.field("compositeUs", result.compositeUs, 1);
+  json.field("frameBudgetUs", ANIMATION_INTERVAL_MS * 1000);
+  json.endObject();
+  
+  sendJson(200, json);
+}
+
+// Raw history dump: TelemetryDumpHeader, then the samples oldest first
+static void sendTelemetryDump() {
+  uint8_t buffer[sizeof(TelemetryDumpHeader) + TELEMETRY_HISTORY_SIZE * sizeof(TelemetrySample)];
+  TelemetryTask tasks[TELEMETRY_MAX_TASKS];
+  
+  TelemetryDumpHeader header = {};
+  header.version = TELEMETRY_DUMP_VERSION;
+  header.taskCount = getTelemetryTasks(tasks, TELEMETRY_MAX_TASKS);
+  header.sampleCount = getTelemetrySampleCount();
+  header.sampleSize = sizeof(TelemetrySample);
+  header.intervalMs = TELEMETRY_SAMPLE_INTERVAL_MS;
+  memcpy(buffer, &header, sizeof(header));
+  
+  size_t length = sizeof(header);
+  for (int i = 0; i < header.sampleCount; i++) {
+    memcpy(buffer + length, &getTelemetrySample(i), sizeof(TelemetrySample));
+    length += sizeof(TelemetrySample);
+  }
+  
+  server.send_P(200, "application/octet-stream", (const char*)buffer, length);
+}
+
+void handleTelemetry() {
+  if (server.hasArg("format") && server.arg("format") == "bin") {
+    sendTelemetryDump();
+    return;
+  }
+  
+  TelemetryTask tasks[TELEMETRY_MAX_TASKS];
+  int taskCount = getTelemetryTasks(tasks, TELEMETRY_MAX_TASKS);
+  int sampleCount = getTelemetrySampleCount();
+  
+  char buffer[4096];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("intervalMs", (unsigned long)TELEMETRY_SAMPLE_INTERVAL_MS);
+  
+  uint32_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  uint32_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  json.beginObject("heap");
+  json.field("size", (unsigned long)ESP.getHeapSize());
+  json.field("free", (unsigned long)freeHeap);
+  json.field("minFree", (unsigned long)ESP.getMinFreeHeap());
+  json.field("largestBlock", (unsigned long)largestBlock);
+  json.field("fragmentation", freeHeap > 0 ? 1000 - (int)((uint64_t)largestBlock * 1000 / freeHeap) : 0);
+  json.field("allocFailures", (unsigned long)getHeapAllocFailures());
+  json.endObject();
+  
+  json.beginArray("tasks");
+  for (int i = 0; i < taskCount; i++) {
+    json.beginObject();
+    json.field("name", tasks[i].name);
+    json.field("stackFree", (unsigned long)tasks[i].stackFree);
+    json.field("running", tasks[i].running);
+    json.endObject();
+  }
+  json.endArray();
+  
+  json.beginArray("subsystems");
+  for (int i = 0; i < TELEMETRY_SUBSYSTEM_COUNT; i++) {
+    TelemetryAllocStats stats;
+    getTelemetryAllocStats((TelemetrySubsystem)i, &stats);
+    json.beginObject();
+    json.field("name", getTelemetrySubsystemName((TelemetrySubsystem)i));
+    json.field("allocs", (unsigned long)stats.allocs);
+    json.field("frees", (unsigned long)stats.frees);
+    json.field("failures", (unsigned long)stats.failures);
+    json.field("liveBytes", (unsigned long)stats.liveBytes);
+    json.field("peakBytes", (unsigned long)stats.peakBytes);
+    json.endObject();
+  }
+  json.endArray();
+  
+  TelemetryPower power;
+  getTelemetryPower(&power);
+  json.beginObject("power");
+  json.field("budgetMa", getSettingsSnapshot().powerBudgetMa);
+  json.field("estimatedMa", (unsigned long)power.estimatedMa);
+  json.field("requestedMa", (unsigned long)power.requestedMa);
+  json.field("limitPercent", power.limit * 100 / 256);
+  json.field("limitedFrames", (unsigned long)power.limitedFrames);
+  json.endObject();
+  
+  // History as columns, oldest first; stackFree has one column per task
+  json.beginObject("history");
+  json.beginArray("timeMs");
+  for (int i = 0; i < sampleCount; i++) json.value((unsigned long)getTelemetrySample(i).timeMs);
+  json.endArray();
+  json.beginArray("freeHeap");
+  for (int i = 0; i < sampleCount; i++) json.value((unsigned long)getTelemetrySample(i).freeHeap);
+  json.endArray();
+  json.beginArray("largestBlock");
+  for (int i = 0; i < sampleCount; i++) json.value((unsigned long)getTelemetrySample(i).largestFreeBlock);
+  json.endArray();
+  json.beginArray("fragmentation");
+  for (int i = 0; i < sampleCount; i++) json.value((int)getTelemetrySample(i).fragmentation);
+  json.endArray();
+  json.beginArray("powerMa");
+  for (int i = 0; i < sampleCount; i++) json.value((int)getTelemetrySample(i).powerMa);
+  json.endArray();
+  json.beginArray("stackFree");
+  for (int t = 0; t < taskCount; t++) {
+    json.beginArray();
+    for (int i = 0; i < sampleCount; i++) json.value((int)getTelemetrySample(i).stackFree[t]);
+    json.endArray();
+  }
+  json.endArray();
+  json.endObject();
+  json.endObject();
+  
+  sendJson(200, json);
 }
 
 void setupWebServer() {
   // Wait a moment to ensure WiFi is fully initialized
   delay(100);
   
-  // Define handlers for each endpoint
+  // Define handlers for each endpoint. server.on() handlers run in the web task;
+  // onLoop() ones change render state and run in loop() between frames
   server.on("/", HTTP_GET, handleRoot);
   server.on("/advanced", HTTP_GET, handleAdvanced);
   server.on("/effects", HTTP_GET, handleEffects);
@@ -287,43 +673,56 @@ void setupWebServer() {
   
   // Use simplified network handlers
   server.on("/network", HTTP_GET, handleNetwork);
-  server.on("/network", HTTP_POST, handleNetworkPost);
+  onLoop("/network", HTTP_POST, handleNetworkPost);
   
-  server.on("/set", HTTP_GET, handleSet);
-  server.on("/distance", HTTP_GET, handleDistance);
+  onLoop("/set", HTTP_GET, handleSet);
+  onLoop("/setBatch", HTTP_ANY, handleSetBatch);
+  onLoop("/distance", HTTP_GET, handleDistance);
   server.on("/settings", HTTP_GET, handleSettings);
   
-  server.on("/setLightMode", HTTP_GET, handleSetLightMode);
-  server.on("/setDirectionalLight", HTTP_GET, handleSetDirectionalLight);
-  server.on("/setCenterShift", HTTP_GET, handleSetCenterShift);
-  server.on("/setTrailLength", HTTP_GET, handleSetTrailLength);
-  server.on("/setBackgroundMode", HTTP_GET, handleSetBackgroundMode);
-  server.on("/setMotionSmoothing", HTTP_GET, handleSetMotionSmoothing);
-  server.on("/setMotionSmoothingParam", HTTP_GET, handleSetMotionSmoothingParam);
-  server.on("/setEffectSpeed", HTTP_GET, handleSetEffectSpeed);
-  server.on("/setEffectIntensity", HTTP_GET, handleSetEffectIntensity);
-  server.on("/setSensorPriorityMode", HTTP_GET, handleSetSensorPriorityMode);
+  onLoop("/setLightMode", HTTP_GET, handleSetLightMode);
+  onLoop("/setDirectionalLight", HTTP_GET, handleSetDirectionalLight);
+  onLoop("/setCenterShift", HTTP_GET, handleSetCenterShift);
+  onLoop("/setTrailLength", HTTP_GET, handleSetTrailLength);
+  onLoop("/setBackgroundMode", HTTP_GET, handleSetBackgroundMode);
+  onLoop("/setMotionSmoothing", HTTP_GET, handleSetMotionSmoothing);
+  onLoop("/setMotionSmoothingParam", HTTP_GET, handleSetMotionSmoothingParam);
+  onLoop("/setEffectSpeed", HTTP_GET, handleSetEffectSpeed);
+  onLoop("/setEffectIntensity", HTTP_GET, handleSetEffectIntensity);
+  onLoop("/getPalette", HTTP_GET, handleGetPalette);
+  onLoop("/setPalette", HTTP_GET, handleSetPalette);
+  onLoop("/setSensorPriorityMode", HTTP_GET, handleSetSensorPriorityMode);
+  onLoop("/getSensorGeometry", HTTP_GET, handleGetSensorGeometry);
+  onLoop("/setSensorGeometry", HTTP_GET, handleSetSensorGeometry);
   
   // LED-specific endpoints
-  server.on("/testLEDs", HTTP_GET, handleTestLEDs);
-  server.on("/reinitLEDs", HTTP_GET, handleReinitLEDs);
+  onLoop("/testLEDs", HTTP_GET, handleTestLEDs);
+  onLoop("/reinitLEDs", HTTP_GET, handleReinitLEDs);
   
   // LED Distribution endpoints
-  server.on("/setLEDSegmentMode", HTTP_GET, handleSetLEDSegmentMode);
+  onLoop("/setLEDSegmentMode", HTTP_GET, handleSetLEDSegmentMode);
   server.on("/getLEDSegmentInfo", HTTP_GET, handleGetLEDSegmentInfo);
-  server.on("/setLEDSegmentInfo", HTTP_GET, handleSetLEDSegmentInfo);
+  onLoop("/setLEDSegmentInfo", HTTP_GET, handleSetLEDSegmentInfo);
+  onLoop("/getSegmentMap", HTTP_GET, handleGetSegmentMap);
+  onLoop("/setSegmentMap", HTTP_GET, handleSetSegmentMap);
   
   // ESP-NOW mesh configuration endpoints
-  server.on("/getDeviceInfo", HTTP_GET, handleGetDeviceInfo);
-  server.on("/setDeviceRole", HTTP_GET, handleSetDeviceRole);
+  onLoop("/getDeviceInfo", HTTP_GET, handleGetDeviceInfo);
+  onLoop("/setDeviceRole", HTTP_GET, handleSetDeviceRole);
   server.on("/scanForSlaves", HTTP_GET, handleScanForSlaves);
-  server.on("/addSlave", HTTP_GET, handleAddSlave);
-  server.on("/removeSlave", HTTP_GET, handleRemoveSlave);
-  server.on("/setMasterMac", HTTP_GET, handleSetMasterMac);
-  server.on("/sensordata", HTTP_GET, handleGetSensorData);
+  onLoop("/addSlave", HTTP_GET, handleAddSlave);
+  onLoop("/removeSlave", HTTP_GET, handleRemoveSlave);
+  onLoop("/setMasterMac", HTTP_GET, handleSetMasterMac);
+  onLoop("/sensordata", HTTP_GET, handleGetSensorData);
+  server.on("/espnowstats", HTTP_GET, handleGetESPNOWStats);
+  onLoop("/setFaultInjection", HTTP_GET, handleSetFaultInjection);
   server.on("/diagnostics", HTTP_GET, handleDiagnostics);
   server.on("/diagnosticdata", HTTP_GET, handleDiagnosticData);
-  server.on("/resetdistance", HTTP_GET, handleResetDistanceValues);
+  server.on("/telemetry", HTTP_GET, handleTelemetry);
+  server.on("/profile", HTTP_GET, handleProfile);
+  onLoop("/benchmark", HTTP_GET, handleBenchmark);
+  server.on("/events", HTTP_GET, handleEventStream);
+  onLoop("/resetdistance", HTTP_GET, handleResetDistanceValues);
 
   // WiFi management
   server.on("/resetwifi", HTTP_GET, handleResetWifi);
@@ -340,19 +739,66 @@ void setupWebServer() {
   // Start server
   server.begin();
   Serial.println("HTTP server started on port " + String(WEB_SERVER_PORT));
+  
+  // Serve from a dedicated task so slow clients never hold up the render loop
+  handlerDone = xSemaphoreCreateBinary();
+  if (xTaskCreatePinnedToCore(webServerTask, "web", WEB_TASK_STACK_SIZE, nullptr,
+                              WEB_TASK_PRIORITY, &webTask, WEB_TASK_CORE) != pdPASS) {
+    webTask = nullptr;
+    Serial.println("ERROR: Failed to start web server task");
+  } else {
+    telemetryRegisterTask("web", webTask);
+  }
+}
+void handleGetSensorGeometry() {
+  char buffer[1024];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.beginArray("sensors");
+  
+  for (int i = 0; i <= numSlaveDevices; i++) {
+    json.beginObject();
+    json.field("id", i);
+    json.field("offset", sensorGeometry[i].offset);
+    json.field("orientation", sensorGeometry[i].orientation);
+    json.endObject();
+  }
+  
+  json.endArray();
+  json.endObject();
+  
+  sendJson(200, json);
+}
+
+void handleSetSensorGeometry() {
+  if (server.hasArg("id") && server.hasArg("offset") && server.hasArg("orientation")) {
+    int id = server.arg("id").toInt();
+    int offset = server.arg("offset").toInt();
+    int orientation = server.arg("orientation").toInt();
+    
+    if (id >= 0 && id <= numSlaveDevices && offset >= -5000 && offset <= 5000 &&
+        setSensorGeometry(id, offset, orientation)) {
+      sendJsonStatus(200, "success", "Sensor geometry updated");
+    } else {
+      sendJsonStatus(400, "error", "Invalid sensor geometry");
+    }
+  } else {
+    sendJsonStatus(400, "error", "Missing required parameters");
+  }
 }
+
 void handleSetSensorPriorityMode() {
   if (server.hasArg("mode")) {
     uint8_t mode = server.arg("mode").toInt();
-    if (mode <= SENSOR_PRIORITY_ZONE_BASED) {
+    if (mode <= SENSOR_PRIORITY_FUSION) {
       setSensorPriorityMode(mode);
       
-      server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Sensor priority mode updated\"}");
+      sendJsonStatus(200, "success", "Sensor priority mode updated");
     } else {
-      server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Invalid mode parameter\"}");
+      sendJsonStatus(400, "error", "Invalid mode parameter");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing mode parameter\"}");
+    sendJsonStatus(400, "error", "Missing mode parameter");
   }
 }
 
@@ -362,27 +808,28 @@ void handleSetLEDSegmentMode() {
     int mode = server.arg("mode").toInt();
     if (mode == LED_SEGMENT_MODE_CONTINUOUS || mode == LED_SEGMENT_MODE_DISTRIBUTED) {
       setLEDSegmentMode(mode);
-      server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"LED segment mode updated\"}");
+      sendJsonStatus(200, "success", "LED segment mode updated");
     } else {
-      server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Invalid mode parameter\"}");
+      sendJsonStatus(400, "error", "Invalid mode parameter");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing mode parameter\"}");
+    sendJsonStatus(400, "error", "Missing mode parameter");
   }
 }
 
 void handleGetLEDSegmentInfo() {
-  int start, length, total;
-  getLEDSegmentInfo(&start, &length, &total);
+  SettingsSnapshot settings = getSettingsSnapshot();
   
-  String json = "{";
-  json += "\"mode\":" + String(getLEDSegmentMode()) + ",";
-  json += "\"start\":" + String(start) + ",";
-  json += "\"length\":" + String(length) + ",";
-  json += "\"total\":" + String(total);
-  json += "}";
+  char buffer[128];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("mode", settings.ledSegmentMode);
+  json.field("start", settings.ledSegmentStart);
+  json.field("length", settings.ledSegmentLength);
+  json.field("total", settings.totalSystemLeds);
+  json.endObject();
   
-  server.send(200, "application/json; charset=utf-8", json);
+  sendJson(200, json);
 }
 
 void handleSetLEDSegmentInfo() {
@@ -394,33 +841,104 @@ void handleSetLEDSegmentInfo() {
     // Validate parameters
     if (start >= 0 && length > 0 && total > 0 && start + length <= total) {
       setLEDSegmentInfo(start, length, total);
-      saveLEDDistributionSettings();
       
-      server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"LED segment info updated\"}");
+      sendJsonStatus(200, "success", "LED segment info updated");
     } else {
-      server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Invalid segment parameters\"}");
+      sendJsonStatus(400, "error", "Invalid segment parameters");
+    }
+  } else {
+    sendJsonStatus(400, "error", "Missing required parameters");
+  }
+}
+
+void handleGetSegmentMap() {
+  char buffer[2048];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("total", ledSegmentMap.totalLeds);
+  json.beginArray("segments");
+  
+  for (int i = 0; i < ledSegmentMap.count; i++) {
+    const led_segment_entry_t& entry = ledSegmentMap.entries[i];
+    json.beginObject();
+    json.fieldMac("mac", entry.mac);
+    json.field("start", entry.start);
+    json.field("length", entry.length);
+    json.field("reversed", (entry.flags & SEGMENT_FLAG_REVERSED) != 0);
+    json.endObject();
+  }
+  
+  json.endArray();
+  json.endObject();
+  
+  sendJson(200, json);
+}
+
+// Segments are passed as "MAC,start,length,reversed" separated by ';' - an empty list clears the map
+void handleSetSegmentMap() {
+  if (deviceRole != DEVICE_ROLE_MASTER) {
+    sendJsonStatus(403, "error", "Only the master holds the segment map");
+    return;
+  }
+  
+  if (!server.hasArg("total") || !server.hasArg("segments")) {
+    sendJsonStatus(400, "error", "Missing required parameters");
+    return;
+  }
+  
+  segment_map_t map;
+  memset(&map, 0, sizeof(map));
+  map.totalLeds = constrain(server.arg("total").toInt(), 0, MAX_SUPPORTED_LEDS);
+  
+  String segments = server.arg("segments");
+  int pos = 0;
+  while (pos < (int)segments.length()) {
+    int end = segments.indexOf(';', pos);
+    if (end < 0) end = segments.length();
+    String item = segments.substring(pos, end);
+    pos = end + 1;
+    
+    if (item.length() == 0) continue;
+    
+    if (map.count >= MAX_SEGMENT_MAP_ENTRIES) {
+      sendJsonStatus(400, "error", "Too many segments");
+      return;
+    }
+    
+    int values[6];
+    int start, length, reversed;
+    if (sscanf(item.c_str(), "%x:%x:%x:%x:%x:%x,%d,%d,%d", 
+               &values[0], &values[1], &values[2], 
+               &values[3], &values[4], &values[5],
+               &start, &length, &reversed) != 9 ||
+        start < 0 || length < 1) {
+      sendJsonStatus(400, "error", "Invalid segment format");
+      return;
+    }
+    
+    led_segment_entry_t& entry = map.entries[map.count++];
+    for (int i = 0; i < 6; i++) {
+      entry.mac[i] = static_cast<uint8_t>(values[i]);
     }
+    entry.start = start;
+    entry.length = length;
+    entry.flags = reversed ? SEGMENT_FLAG_REVERSED : 0;
+  }
+  
+  if (setSegmentMap(map)) {
+    sendJsonStatus(200, "success", "Segment map updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing required parameters\"}");
+    sendJsonStatus(400, "error", "Segments must lie within the total and use each device once");
   }
 }
+
 // Add this to web_interface.cpp
 void handleResetDistanceValues() {
   // Reset just min/max distance settings to defaults
   minDistance = DEFAULT_MIN_DISTANCE;
   maxDistance = DEFAULT_MAX_DISTANCE;
   
-  // Save to EEPROM
-  EEPROM.write(EEPROM_ADDR_MIN_DIST_L, minDistance & 0xFF);
-  EEPROM.write(EEPROM_ADDR_MIN_DIST_H, (minDistance >> 8) & 0xFF);
-  EEPROM.write(EEPROM_ADDR_MAX_DIST_L, maxDistance & 0xFF);
-  EEPROM.write(EEPROM_ADDR_MAX_DIST_H, (maxDistance >> 8) & 0xFF);
-  
-  // Calculate and save new CRC
-  uint8_t newCRC = calculateSystemCRC(); // Use function from eeprom_manager
-  EEPROM.write(EEPROM_ADDR_CRC, newCRC);
-  
-  EEPROM.commit();
+  scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
   
   // Inform user
   String html = "<html><body style='font-family:Arial;text-align:center;'>"
@@ -436,87 +954,88 @@ void handleResetDistanceValues() {
 
 // Individual route handlers
 void handleRoot() {
-  String html = getMainHTML();
-  server.sendHeader("Cache-Control", "max-age=300"); // Cache for 5 minutes
-  server.sendHeader("Content-Length", String(html.length()));
-  server.send(200, "text/html; charset=utf-8", html);
+  sendCompressedPage(page_basic_gz, page_basic_gz_len);
 }
 
 void handleAdvanced() {
-  String html = getAdvancedHTML();
-  server.sendHeader("Cache-Control", "max-age=300");
-  server.sendHeader("Content-Length", String(html.length()));
-  server.send(200, "text/html; charset=utf-8", html);
+  sendCompressedPage(page_advanced_gz, page_advanced_gz_len);
 }
 
 void handleEffects() {
-  String html = getEffectsHTML();
-  server.sendHeader("Cache-Control", "max-age=300");
-  server.sendHeader("Content-Length", String(html.length()));
-  server.send(200, "text/html; charset=utf-8", html);
+  sendCompressedPage(page_effects_gz, page_effects_gz_len);
 }
 
 void handleMesh() {
-  String html = getMeshHTML();
-  server.sendHeader("Cache-Control", "max-age=300");
-  server.sendHeader("Content-Length", String(html.length()));
-  server.send(200, "text/html; charset=utf-8", html);
+  sendCompressedPage(page_mesh_gz, page_mesh_gz_len);
 }
 
 void handleNetwork() {
-  String html = getNetworkHTML();
-  server.sendHeader("Cache-Control", "max-age=300");
-  server.sendHeader("Content-Length", String(html.length()));
-  server.send(200, "text/html; charset=utf-8", html);
+  sendCompressedPage(page_network_gz, page_network_gz_len);
 }
 
 
 void handleDistance() {
-  server.send(200, "text/plain", String(currentDistance));
+  char text[12];
+  int length = snprintf(text, sizeof(text), "%d", currentDistance);
+  server.send_P(200, "text/plain", text, length);
 }
 
 void handleSettings() {
+  // One consistent copy, even if loop() is applying a change right now
+  SettingsSnapshot settings = getSettingsSnapshot();
+  
   // Create JSON with current settings
-  String json = "{";
-  json += "\"minDistance\":" + String(minDistance) + ",";
-  json += "\"maxDistance\":" + String(maxDistance) + ",";
-  json += "\"brightness\":" + String(brightness) + ",";
-  json += "\"movingLightSpan\":" + String(movingLightSpan) + ",";
-  json += "\"redValue\":" + String(redValue) + ",";
-  json += "\"greenValue\":" + String(greenValue) + ",";
-  json += "\"blueValue\":" + String(blueValue) + ",";
-  json += "\"numLeds\":" + String(numLeds) + ",";
-  json += "\"centerShift\":" + String(centerShift) + ",";
-  json += "\"trailLength\":" + String(trailLength) + ",";
-  json += "\"directionLightEnabled\":" + String(directionLightEnabled ? "true" : "false") + ",";
-  json += "\"backgroundMode\":" + String(backgroundMode ? "true" : "false") + ",";
-  json += "\"lightMode\":" + String(lightMode) + ",";
-  json += "\"motionSmoothingEnabled\":" + String(motionSmoothingEnabled ? "true" : "false") + ",";
-  json += "\"effectSpeed\":" + String(effectSpeed) + ",";
-  json += "\"effectIntensity\":" + String(effectIntensity) + ",";
-  json += "\"positionSmoothingFactor\":" + String(positionSmoothingFactor, 3) + ",";
-  json += "\"velocitySmoothingFactor\":" + String(velocitySmoothingFactor, 3) + ",";
-  json += "\"predictionFactor\":" + String(predictionFactor, 3) + ",";
-  json += "\"positionPGain\":" + String(positionPGain, 3) + ",";
-  json += "\"positionIGain\":" + String(positionIGain, 3) + ",";
-  json += "\"sensorPriorityMode\":" + String(sensorPriorityMode);
-  json += "}";
-  
-  server.send(200, "application/json; charset=utf-8", json);
+  char buffer[1024];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("minDistance", settings.minDistance);
+  json.field("maxDistance", settings.maxDistance);
+  json.field("brightness", settings.brightness);
+  json.field("movingLightSpan", settings.movingLightSpan);
+  json.field("redValue", settings.redValue);
+  json.field("greenValue", settings.greenValue);
+  json.field("blueValue", settings.blueValue);
+  json.field("numLeds", settings.numLeds);
+  json.field("centerShift", settings.centerShift);
+  json.field("trailLength", settings.trailLength);
+  json.field("directionLightEnabled", settings.directionLightEnabled);
+  json.field("backgroundMode", settings.backgroundMode);
+  json.field("lightMode", settings.lightMode);
+  json.field("motionSmoothingEnabled", settings.motionSmoothingEnabled);
+  json.field("effectSpeed", settings.effectSpeed);
+  json.field("effectIntensity", settings.effectIntensity);
+  json.field("palette", settings.colorPalette);
+  json.field("powerBudget", settings.powerBudgetMa);
+  json.field("backgroundLayer", settings.backgroundLayer);
+  json.field("transitionMs", settings.transitionMs);
+  json.field("positionSmoothingFactor", settings.positionSmoothingFactor, 3);
+  json.field("velocitySmoothingFactor", settings.velocitySmoothingFactor, 3);
+  json.field("predictionFactor", settings.predictionFactor, 3);
+  json.field("positionPGain", settings.positionPGain, 3);
+  json.field("positionIGain", settings.positionIGain, 3);
+  json.field("sensorPriorityMode", settings.sensorPriorityMode);
+  json.endObject();
+  
+  sendJson(200, json);
 }
 
 void handleSet() {
   bool settingsChanged = false;
-  String response = "{\"status\":\"success\", \"changes\":[";
-  bool firstChange = true;
-  String errorMessage = "";
+  const char* errorMessage = nullptr;
+  char ledCountError[48];
+  char buffer[256];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("status", "success");
+  json.beginArray("changes");
 
   if (server.hasArg("numLeds")) {
     int newNumLeds = server.arg("numLeds").toInt();
     
     // Enhanced validation for LED count
     if (!validateLEDCount(newNumLeds)) {
-      errorMessage = "Invalid LED count: " + String(newNumLeds) + " (max: " + String(MAX_SUPPORTED_LEDS) + ")";
+      snprintf(ledCountError, sizeof(ledCountError), "Invalid LED count: %d (max: %d)", newNumLeds, MAX_SUPPORTED_LEDS);
+      errorMessage = ledCountError;
     } else if (numLeds != newNumLeds) {
       Serial.printf("Web UI: Changing LED count from %d to %d\n", numLeds, newNumLeds);
       
@@ -524,9 +1043,7 @@ void handleSet() {
       reinitializeLEDStrip(newNumLeds);
       
       settingsChanged = true;
-      if (!firstChange) response += ",";
-      response += "\"numLeds\"";
-      firstChange = false;
+      json.value("numLeds");
       
       Serial.printf("Web UI: LED count successfully changed to %d\n", numLeds);
     }
@@ -539,9 +1056,7 @@ void handleSet() {
       if (minDistance != newMinDist) {
         minDistance = newMinDist;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"minDistance\"";
-        firstChange = false;
+        json.value("minDistance");
         
         // Debug logging
         Serial.printf("Web UI set minDistance to %d\n", minDistance);
@@ -560,9 +1075,7 @@ void handleSet() {
       if (maxDistance != newMaxDist) {
         maxDistance = newMaxDist;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"maxDistance\"";
-        firstChange = false;
+        json.value("maxDistance");
         
         // Debug logging
         Serial.printf("Web UI set maxDistance to %d\n", maxDistance);
@@ -580,9 +1093,7 @@ void handleSet() {
       if (brightness != newBrightness) {
         brightness = newBrightness;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"brightness\"";
-        firstChange = false;
+        json.value("brightness");
       }
     } else {
       errorMessage = "Invalid brightness (must be between 0 and 255)";
@@ -595,14 +1106,7 @@ void handleSet() {
       if (movingLightSpan != newLightSpan) {
         movingLightSpan = newLightSpan;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"movingLightSpan\"";
-        firstChange = false;
-        
-        // Save settings immediately
-        saveSettings();
-        EEPROM.commit();
-        updateLEDConfig();
+        json.value("movingLightSpan");
       }
     } else {
       errorMessage = "Invalid light span (must be between 1 and 100)";
@@ -616,9 +1120,7 @@ void handleSet() {
       if (redValue != newRedValue) {
         redValue = newRedValue;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"redValue\"";
-        firstChange = false;
+        json.value("redValue");
       }
     } else {
       errorMessage = "Invalid red value (must be between 0 and 255)";
@@ -631,9 +1133,7 @@ void handleSet() {
       if (greenValue != newGreenValue) {
         greenValue = newGreenValue;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"greenValue\"";
-        firstChange = false;
+        json.value("greenValue");
       }
     } else {
       errorMessage = "Invalid green value (must be between 0 and 255)";
@@ -646,43 +1146,119 @@ void handleSet() {
       if (blueValue != newBlueValue) {
         blueValue = newBlueValue;
         settingsChanged = true;
-        if (!firstChange) response += ",";
-        response += "\"blueValue\"";
-        firstChange = false;
+        json.value("blueValue");
       }
     } else {
       errorMessage = "Invalid blue value (must be between 0 and 255)";
     }
   }
 
-  response += "]}";
+  json.endArray();
+  json.endObject();
 
   if (settingsChanged) {
-    // Save settings and ensure they are committed
-    saveSettings();  // Save all settings to EEPROM
-    
-    // Add a small delay to ensure EEPROM write completes
-    delay(10);
+    // Persisted by the deferred save once changes settle
+    scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
     
     // Update LED configuration (this will handle LED count changes properly)
     updateLEDConfig();
     
     // Send the response that was built
-    server.send(200, "application/json; charset=utf-8", response);
-  } else if (errorMessage != "") {
+    sendJson(200, json);
+  } else if (errorMessage) {
     // Return error message if validation failed
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"" + errorMessage + "\"}");
+    sendJsonStatus(400, "error", errorMessage);
   } else {
     // If nothing changed but there were no errors
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"No changes needed\"}");
+    sendJsonStatus(200, "success", "No changes needed");
+  }
+}
+
+// Apply several settings in one request (query string or form-encoded POST
+// body, e.g. "brightness=200&lightMode=3"). Either every key is applied or,
+// if any key or value is invalid, none is. One deferred save covers them all.
+void handleSetBatch() {
+  float staged[SETTINGS_SCHEMA_SIZE];
+  bool present[SETTINGS_SCHEMA_SIZE] = {false};
+  char errorMessage[64];
+  
+  for (int i = 0; i < server.args(); i++) {
+    String name = server.argName(i);
+    int index = findSetting(name.c_str());
+    if (index < 0) {
+      snprintf(errorMessage, sizeof(errorMessage), "Unknown setting: %s", name.c_str());
+      sendJsonStatus(400, "error", errorMessage);
+      return;
+    }
+    
+    String text = server.arg(i);
+    if (!parseSettingValue(settingsSchema[index], text.c_str(), staged[index])) {
+      snprintf(errorMessage, sizeof(errorMessage), "Invalid value for %s", name.c_str());
+      sendJsonStatus(400, "error", errorMessage);
+      return;
+    }
+    present[index] = true;
+  }
+  
+  // Checks that involve more than one value, against the values the batch would leave
+  int minIndex = findSetting("minDist");
+  int maxIndex = findSetting("maxDist");
+  float newMin = present[minIndex] ? staged[minIndex] : minDistance;
+  float newMax = present[maxIndex] ? staged[maxIndex] : maxDistance;
+  if (newMin >= newMax) {
+    sendJsonStatus(400, "error", "Minimum distance must be less than maximum distance");
+    return;
+  }
+  
+  int countIndex = findSetting("numLeds");
+  if (present[countIndex] && (int)staged[countIndex] != numLeds && !validateLEDCount((int)staged[countIndex])) {
+    sendJsonStatus(400, "error", "Invalid LED count");
+    return;
+  }
+  
+  // Everything is valid - apply it in one step
+  char buffer[640];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("status", "success");
+  json.beginArray("changes");
+  
+  int changes = 0;
+  uint8_t apply = 0;
+  uint16_t sections = 0;
+  for (int i = 0; i < SETTINGS_SCHEMA_SIZE; i++) {
+    const SettingDescriptor& setting = settingsSchema[i];
+    if (!present[i] || staged[i] == readSetting(setting)) continue;
+    
+    if (setting.apply & SETTING_APPLY_LED_COUNT) {
+      reinitializeLEDStrip((int)staged[i]);
+    } else if (setting.apply & SETTING_APPLY_PRIORITY) {
+      setSensorPriorityMode((uint8_t)staged[i]);
+    } else {
+      writeSetting(setting, staged[i]);
+    }
+    apply |= setting.apply;
+    sections |= setting.section;
+    changes++;
+    json.value(setting.key);
   }
+  
+  json.endArray();
+  json.endObject();
+  
+  if (changes > 0) {
+    if (apply) updateLEDConfig();
+    scheduleSettingsSave(sections);
+  }
+  
+  sendJson(200, json);
 }
 
 // Add new endpoint for LED testing
 void handleTestLEDs() {
   Serial.println("Web UI: Testing LEDs requested");
   testAllLEDs();
-  server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"LED test completed\"}");
+  sendJsonStatus(200, "success", "LED test completed");
 }
 
 // Added new endpoint for force LED reinitialization
@@ -693,27 +1269,33 @@ void handleReinitLEDs() {
     if (validateLEDCount(newCount)) {
       Serial.printf("Web UI: Force reinitializing LEDs to %d\n", newCount);
       reinitializeLEDStrip(newCount);
-      server.send(200, "application/json; charset=utf-8", 
-                 "{\"status\":\"success\",\"message\":\"LEDs reinitialized\",\"count\":" + String(numLeds) + "}");
+      char buffer[128];
+      JsonWriter json(buffer, sizeof(buffer));
+      json.beginObject();
+      json.field("status", "success");
+      json.field("message", "LEDs reinitialized");
+      json.field("count", numLeds);
+      json.endObject();
+      sendJson(200, json);
     } else {
-      server.send(400, "application/json; charset=utf-8", 
-                 "{\"status\":\"error\",\"message\":\"Invalid LED count\"}");
+      sendJsonStatus(400, "error", "Invalid LED count");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-               "{\"status\":\"error\",\"message\":\"Missing count parameter\"}");
+    sendJsonStatus(400, "error", "Missing count parameter");
   }
 }
 
 void handleSetLightMode() {
   if (server.hasArg("mode")) {
-    lightMode = server.arg("mode").toInt();
-    saveSettings();
+    float mode;
+    if (!parseSettingArg("lightMode", "mode", mode)) return;
+    lightMode = (int)mode;
+    scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     updateLEDConfig();
     
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Light mode updated\"}");
+    sendJsonStatus(200, "success", "Light mode updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing mode parameter\"}");
+    sendJsonStatus(400, "error", "Missing mode parameter");
   }
 }
 
@@ -724,16 +1306,12 @@ void handleSetDirectionalLight() {
     
     if (directionLightEnabled != newValue) {
       directionLightEnabled = newValue;
-      saveAdvancedSettings(); // Save to specific section
-      EEPROM.commit(); // Force commit to EEPROM
+      scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     }
     
-    server.send(200, "application/json; charset=utf-8", 
-               "{\"status\":\"success\",\"message\":\"Directional light set to " + 
-               String(directionLightEnabled ? "enabled" : "disabled") + "\"}");
+    sendJsonStatus(200, "success", directionLightEnabled ? "Directional light set to enabled" : "Directional light set to disabled");
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-               "{\"status\":\"error\",\"message\":\"Missing enabled parameter\"}");
+    sendJsonStatus(400, "error", "Missing enabled parameter");
   }
 }
 
@@ -745,41 +1323,38 @@ void handleSetBackgroundMode() {
     
     if (backgroundMode != newValue) {
       backgroundMode = newValue;
-      saveAdvancedSettings(); // Save to specific section
-      EEPROM.commit(); // Force commit to EEPROM
+      scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     }
     
-    server.send(200, "application/json; charset=utf-8", 
-               "{\"status\":\"success\",\"message\":\"Background mode set to " + 
-               String(backgroundMode ? "enabled" : "disabled") + "\"}");
+    sendJsonStatus(200, "success", backgroundMode ? "Background mode set to enabled" : "Background mode set to disabled");
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-               "{\"status\":\"error\",\"message\":\"Missing enabled parameter\"}");
+    sendJsonStatus(400, "error", "Missing enabled parameter");
   }
 }
 
 void handleSetCenterShift() {
   if (server.hasArg("value")) {
-    centerShift = server.arg("value").toInt();
-    saveAdvancedSettings(); // Save to specific section
-    EEPROM.commit(); // Force commit to EEPROM
+    float value;
+    if (!parseSettingArg("centerShift", "value", value)) return;
+    centerShift = (int)value;
+    scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Center shift updated\"}");
+    sendJsonStatus(200, "success", "Center shift updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing value parameter\"}");
+    sendJsonStatus(400, "error", "Missing value parameter");
   }
 }
 
 void handleSetTrailLength() {
   if (server.hasArg("value")) {
-    trailLength = server.arg("value").toInt();
-    // Save to EEPROM
-    saveAdvancedSettings();
-    EEPROM.commit(); // Make sure we explicitly commit
+    float value;
+    if (!parseSettingArg("trailLength", "value", value)) return;
+    trailLength = (int)value;
+    scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Trail length updated\"}");
+    sendJsonStatus(200, "success", "Trail length updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing value parameter\"}");
+    sendJsonStatus(400, "error", "Missing value parameter");
   }
 }
 
@@ -790,16 +1365,12 @@ void handleSetMotionSmoothing() {
     
     if (motionSmoothingEnabled != newValue) {
       motionSmoothingEnabled = newValue;
-      saveMotionSettings(); // Save to specific section
-      EEPROM.commit(); // Force commit to EEPROM
+      scheduleSettingsSave(SETTINGS_SECTION_MOTION);
     }
     
-    server.send(200, "application/json; charset=utf-8", 
-               "{\"status\":\"success\",\"message\":\"Motion smoothing set to " + 
-               String(motionSmoothingEnabled ? "enabled" : "disabled") + "\"}");
+    sendJsonStatus(200, "success", motionSmoothingEnabled ? "Motion smoothing set to enabled" : "Motion smoothing set to disabled");
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-               "{\"status\":\"error\",\"message\":\"Missing enabled parameter\"}");
+    sendJsonStatus(400, "error", "Missing enabled parameter");
   }
 } 
 void handleSetMotionSmoothingParam() {
@@ -832,52 +1403,112 @@ void handleSetMotionSmoothingParam() {
     } 
     else {
       validParam = false;
-      server.send(400, "application/json; charset=utf-8", 
-        "{\"error\":\"Invalid parameter\",\"param\":\"" + param + "\"}");
+      char buffer[128];
+      JsonWriter json(buffer, sizeof(buffer));
+      json.beginObject();
+      json.field("error", "Invalid parameter");
+      json.field("param", param.c_str());
+      json.endObject();
+      sendJson(400, json);
       return;
     }
 
     if (validParam) {
-      // Immediately save to ensure persistence
-      saveMotionSettings();
-      EEPROM.commit();  // Make sure we explicitly commit
+      // Slider drags arrive as a stream of these; the deferred save coalesces them
+      scheduleSettingsSave(SETTINGS_SECTION_MOTION);
       
       // Prepare a JSON response with the actual constrained value
-      String jsonResponse = "{\"param\":\"" + param + "\",\"value\":" + 
-        String(constrainedValue, 3) + ",\"status\":\"success\"}";
+      char buffer[128];
+      JsonWriter json(buffer, sizeof(buffer));
+      json.beginObject();
+      json.field("param", param.c_str());
+      json.field("value", constrainedValue, 3);
+      json.field("status", "success");
+      json.endObject();
       
-      server.send(200, "application/json; charset=utf-8", jsonResponse);
+      sendJson(200, json);
       
       if (ENABLE_DEBUG_LOGGING) {
         Serial.printf("Updated motion parameter %s to %.3f\n", param.c_str(), constrainedValue);
       }
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-      "{\"error\":\"Missing parameter or value\"}");
+    server.send_P(400, "application/json; charset=utf-8", "{\"error\":\"Missing parameter or value\"}");
   }
 }
 
 void handleSetEffectSpeed() {
   if (server.hasArg("value")) {
-    effectSpeed = server.arg("value").toInt();
-    saveSettings();
+    float value;
+    if (!parseSettingArg("effectSpeed", "value", value)) return;
+    effectSpeed = (int)value;
+    scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Effect speed updated\"}");
+    sendJsonStatus(200, "success", "Effect speed updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing value parameter\"}");
+    sendJsonStatus(400, "error", "Missing value parameter");
   }
 }
 
 void handleSetEffectIntensity() {
   if (server.hasArg("value")) {
-    effectIntensity = server.arg("value").toInt();
-    saveSettings();
+    float value;
+    if (!parseSettingArg("effectIntensity", "value", value)) return;
+    effectIntensity = (int)value;
+    scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
     
-    server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Effect intensity updated\"}");
+    sendJsonStatus(200, "success", "Effect intensity updated");
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing value parameter\"}");
+    sendJsonStatus(400, "error", "Missing value parameter");
+  }
+}
+
+void handleGetPalette() {
+  const CustomPalette& custom = getCustomPalette();
+  
+  char buffer[768];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("palette", colorPalette);
+  json.beginArray("palettes");
+  for (int i = 0; i < PALETTE_COUNT; i++) {
+    json.value(getPaletteName(i));
+  }
+  json.endArray();
+  json.beginArray("custom");
+  for (int i = 0; i < custom.count; i++) {
+    const PaletteStop& stop = custom.stops[i];
+    char color[8];
+    snprintf(color, sizeof(color), "%02X%02X%02X", stop.r, stop.g, stop.b);
+    json.beginObject();
+    json.field("position", (int)stop.position);
+    json.field("color", color);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  
+  sendJson(200, json);
+}
+
+void handleSetPalette() {
+  if (!server.hasArg("stops")) {
+    sendJsonStatus(400, "error", "Missing stops parameter");
+    return;
+  }
+  
+  PaletteStop stops[PALETTE_MAX_STOPS];
+  int count = parsePaletteStops(server.arg("stops").c_str(), stops);
+  if (!setCustomPalette(stops, count)) {
+    sendJsonStatus(400, "error", "Invalid palette stops");
+    return;
   }
+  
+  // Show what was just set
+  colorPalette = PALETTE_CUSTOM;
+  scheduleSettingsSave(SETTINGS_SECTION_RENDER);
+  
+  sendJsonStatus(200, "success", "Custom palette updated");
 }
 
 void handleNetworkPost() {
@@ -942,80 +1573,83 @@ void handleResetWifi() {
   resetRequestTime = millis();
 }
 
+// Scan endpoints answer from the cache right away. A stale cache (or ?refresh=1)
+// starts a background scan; clients poll until X-Scan-In-Progress drops to 0.
+static const WiFiNetwork* getCachedScan(int& count) {
+  wifiManager.requestScan(server.hasArg("refresh") && server.arg("refresh") == "1");
+  
+  char age[12];
+  snprintf(age, sizeof(age), "%ld", wifiManager.getScanAgeMs());
+  server.sendHeader("X-Scan-In-Progress", wifiManager.isScanning() ? "1" : "0");
+  server.sendHeader("X-Scan-Age-Ms", age);
+  
+  return wifiManager.getScanResults(count);
+}
+
 void handleScanNetworks() {
-  std::vector<WiFiNetwork> networks = wifiManager.scanNetworks();
+  int numNetworks;
+  const WiFiNetwork* networks = getCachedScan(numNetworks);
   
   // If no networks found, return an empty array rather than error
-  String json = "[";
+  char buffer[512];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginArray();
   
-  if (!networks.empty()) {
-    // Limit to top 5 networks with strongest signal
-    int count = min(5, (int)networks.size());
-    
-    for (int i = 0; i < count; i++) {
-      if (i > 0) json += ",";
-      
-      // Encode the SSID for JSON (escaping quotes and backslashes)
-      String escapedSSID = networks[i].ssid;
-      escapedSSID.replace("\\", "\\\\");  // Escape backslashes first
-      escapedSSID.replace("\"", "\\\"");  // Then escape quotes
-      
-      json += "{\"ssid\":\"" + escapedSSID + "\",";
-      json += "\"rssi\":" + String(networks[i].rssi) + ",";
-      json += "\"secure\":" + String(networks[i].encType != WIFI_AUTH_OPEN ? "true" : "false") + "}";
-    }
+  // Limit to top 5 networks with strongest signal
+  int count = min(5, numNetworks);
+  
+  for (int i = 0; i < count; i++) {
+    // The writer escapes quotes, backslashes and control characters in the SSID
+    json.beginObject();
+    json.field("ssid", networks[i].ssid);
+    json.field("rssi", (long)networks[i].rssi);
+    json.field("secure", networks[i].encType != WIFI_AUTH_OPEN);
+    json.endObject();
   }
   
-  json += "]";
+  json.endArray();
   
-  server.send(200, "application/json; charset=utf-8", json);
+  sendJson(200, json);
 }
 
 // ESP-NOW handlers
 void handleGetDeviceInfo() {
   // Create a JSON response with device role, MAC address, paired devices, and sensor priority mode
-  String json = "{";
-  json += "\"role\":" + String(deviceRole) + ",";
+  SettingsSnapshot settings = getSettingsSnapshot();
+  char buffer[768];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("role", settings.deviceRole);
   
   // Add MAC address
   uint8_t mac[6];
   WiFi.macAddress(mac);
-  char macStr[18];
-  sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
-          mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-  json += "\"mac\":\"" + String(macStr) + "\"";
+  json.fieldMac("mac", mac);
   
   // Add master MAC if this is a slave
   if (deviceRole == DEVICE_ROLE_SLAVE) {
-    char masterMacStr[18];
-    sprintf(masterMacStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
-            masterAddress[0], masterAddress[1], masterAddress[2], 
-            masterAddress[3], masterAddress[4], masterAddress[5]);
-    json += ",\"masterMac\":\"" + String(masterMacStr) + "\"";
+    json.fieldMac("masterMac", masterAddress);
   }
   
   // Add slave MACs if this is a master
-  if (deviceRole == DEVICE_ROLE_MASTER && numSlaveDevices > 0) {
-    json += ",\"slaves\":[";
+  json.beginArray("slaves");
+  if (deviceRole == DEVICE_ROLE_MASTER) {
     for (int i = 0; i < numSlaveDevices; i++) {
-      if (i > 0) json += ",";
       char slaveMacStr[18];
       sprintf(slaveMacStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
               slaveAddresses[i][0], slaveAddresses[i][1], slaveAddresses[i][2], 
               slaveAddresses[i][3], slaveAddresses[i][4], slaveAddresses[i][5]);
-      json += "\"" + String(slaveMacStr) + "\"";
+      json.value(slaveMacStr);
     }
-    json += "]";
-  } else {
-    json += ",\"slaves\":[]";
   }
+  json.endArray();
   
   // Add sensor priority mode
-  json += ",\"sensorPriorityMode\":" + String(sensorPriorityMode);
+  json.field("sensorPriorityMode", settings.sensorPriorityMode);
   
-  json += "}";
+  json.endObject();
   
-  server.send(200, "application/json; charset=utf-8", json);
+  sendJson(200, json);
 }
 
 void handleSetDeviceRole() {
@@ -1024,78 +1658,54 @@ void handleSetDeviceRole() {
     if (newRole == DEVICE_ROLE_MASTER || newRole == DEVICE_ROLE_SLAVE) {
       deviceRole = newRole;
       
-      // Save to EEPROM
-      EEPROM.write(EEPROM_ADDR_DEVICE_ROLE, deviceRole);
-      EEPROM.commit();
+      saveEspnowSettings();
       
       // Re-initialize ESP-NOW with new role
       esp_now_deinit();
       setupESPNOW();
       
-      server.send(200, "application/json; charset=utf-8", "{\"status\":\"success\",\"message\":\"Device role updated\"}");
+      sendJsonStatus(200, "success", "Device role updated");
     } else {
-      server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Invalid role value\"}");
+      sendJsonStatus(400, "error", "Invalid role value");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", "{\"status\":\"error\",\"message\":\"Missing role parameter\"}");
+    sendJsonStatus(400, "error", "Missing role parameter");
   }
 }
 
-// Add this updated function to web_interface.cpp, replacing the existing handleScanForSlaves
-
+// Devices in range answer an ESP-NOW probe on the mesh channel, so the table
+// fills within a few hundred ms. ?refresh=1 sends new probes; the page polls
+// while X-Scan-In-Progress is 1 and renders what has arrived so far.
 void handleScanForSlaves() {
-  Serial.println("Scanning for AmbiSense slave devices...");
+  if (server.hasArg("refresh") && server.arg("refresh") == "1") {
+    startSlaveDiscovery(ESPNOW_DISCOVERY_DURATION_MS);
+  }
+  server.sendHeader("X-Scan-In-Progress", isSlaveDiscoveryActive() ? "1" : "0");
   
-  // Scan with longer timeout for better detection
-  int numDevices = WiFi.scanNetworks(false, true, false, 300);
+  discovered_peer_t peers[ESPNOW_DISCOVERY_MAX_PEERS];
+  int numPeers = getDiscoveredPeers(peers, ESPNOW_DISCOVERY_MAX_PEERS);
   
-  String jsonResponse = "[";
-  int devicesFound = 0;
+  // Up to ~140 bytes per device
+  char buffer[2816];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginArray();
   
-  for (int i = 0; i < numDevices && devicesFound < 10; i++) {
-    String ssid = WiFi.SSID(i);
-    
-    // Only include AmbiSense devices or devices that could be AmbiSense
-    bool isAmbiSense = ssid.startsWith(AMBISENSE_DEVICE_PREFIX) || 
-                       ssid.startsWith("AmbiSense") ||
-                       ssid.indexOf("AmbiSense") >= 0;
-    
-    if (isAmbiSense || ssid.length() == 0) { // Include hidden networks too
-      if (devicesFound > 0) jsonResponse += ",";
-      
-      uint8_t* bssid = WiFi.BSSID(i);
-      char macStr[18];
-      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
-              bssid[0], bssid[1], bssid[2], 
-              bssid[3], bssid[4], bssid[5]);
-      
-      // Determine signal strength label
-      String signalStrength = "Unknown";
-      int rssi = WiFi.RSSI(i);
-      if (rssi >= -50) signalStrength = "Excellent";
-      else if (rssi >= -60) signalStrength = "Good";
-      else if (rssi >= -70) signalStrength = "Fair";
-      else signalStrength = "Weak";
-      
-      String deviceName = ssid.length() > 0 ? ssid : "Hidden AmbiSense Device";
-      
-      jsonResponse += "{\"name\":\"" + deviceName + "\",";
-      jsonResponse += "\"mac\":\"" + String(macStr) + "\",";
-      jsonResponse += "\"rssi\":" + String(rssi) + ",";
-      jsonResponse += "\"signal\":\"" + signalStrength + "\",";
-      jsonResponse += "\"isAmbiSense\":" + String(isAmbiSense ? "true" : "false") + "}";
-      
-      devicesFound++;
-    }
+  for (int i = 0; i < numPeers; i++) {
+    json.beginObject();
+    json.field("name", peers[i].name);
+    json.fieldMac("mac", peers[i].mac);
+    json.field("rssi", (int)peers[i].rssi);
+    json.field("role", peers[i].role);
+    json.field("leds", peers[i].numLeds);
+    json.field("firmware", peers[i].firmware);
+    json.field("paired", (peers[i].flags & ANNOUNCE_FLAG_PAIRED) != 0);
+    json.endObject();
   }
   
-  jsonResponse += "]";
-  
-  // Free memory used by the scan
-  WiFi.scanDelete();
+  json.endArray();
   
   // Send the response
-  server.send(200, "application/json; charset=utf-8", jsonResponse);
+  sendJson(200, json);
 }
 
 void handleAddSlave() {
@@ -1130,18 +1740,6 @@ void handleAddSlave() {
       }
       
       if (!alreadyExists && numSlaveDevices < MAX_SLAVE_DEVICES) {
-        // Add the new slave
-        for (int i = 0; i < 6; i++) {
-          slaveAddresses[numSlaveDevices][i] = mac[i];
-        }
-        
-        // Save to EEPROM
-        EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES, numSlaveDevices + 1);
-        for (int i = 0; i < 6; i++) {
-          EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES + 1 + (numSlaveDevices * 6) + i, mac[i]);
-        }
-        EEPROM.commit();
-        
         // Add as ESP-NOW peer with correct channel
         esp_now_peer_info_t peerInfo = {};
         memcpy(peerInfo.peer_addr, mac, 6);
@@ -1149,27 +1747,24 @@ void handleAddSlave() {
         peerInfo.encrypt = false; // No encryption for simplicity
         
         if (esp_now_add_peer(&peerInfo) == ESP_OK) {
-          numSlaveDevices++;
-          server.send(200, "application/json; charset=utf-8", 
-            "{\"status\":\"success\",\"message\":\"Slave device added\"}");
+          // Add the new slave and save the peer table
+          addSlaveSlot(mac);
+          scheduleSettingsSave(SETTINGS_SECTION_PEER_TABLE);
+          
+          sendJsonStatus(200, "success", "Slave device added");
         } else {
-          server.send(500, "application/json; charset=utf-8", 
-            "{\"status\":\"error\",\"message\":\"Failed to add ESP-NOW peer\"}");
+          sendJsonStatus(500, "error", "Failed to add ESP-NOW peer");
         }
       } else if (alreadyExists) {
-        server.send(400, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Slave device already paired\"}");
+        sendJsonStatus(400, "error", "Slave device already paired");
       } else {
-        server.send(400, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Maximum number of slave devices reached\"}");
+        sendJsonStatus(400, "error", "Maximum number of slave devices reached");
       }
     } else {
-      server.send(400, "application/json; charset=utf-8", 
-        "{\"status\":\"error\",\"message\":\"Invalid MAC address format\"}");
+      sendJsonStatus(400, "error", "Invalid MAC address format");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-      "{\"status\":\"error\",\"message\":\"Missing MAC address or not in master mode\"}");
+    sendJsonStatus(400, "error", "Missing MAC address or not in master mode");
   }
 }
 
@@ -1208,63 +1803,100 @@ void handleRemoveSlave() {
         // Remove this peer from ESP-NOW
         esp_now_del_peer(mac);
         
-        // Shift remaining slaves down
-        for (int i = slaveIndex; i < numSlaveDevices - 1; i++) {
-          for (int j = 0; j < 6; j++) {
-            slaveAddresses[i][j] = slaveAddresses[i + 1][j];
-          }
-        }
+        // Shift remaining slaves down (their geometry, health and readings move with them)
+        removeSlaveSlot(slaveIndex);
         
-        numSlaveDevices--;
-        
-        // Update EEPROM
-        EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES, numSlaveDevices);
-        for (int i = 0; i < numSlaveDevices; i++) {
-          for (int j = 0; j < 6; j++) {
-            EEPROM.write(EEPROM_ADDR_PAIRED_SLAVES + 1 + (i * 6) + j, slaveAddresses[i][j]);
-          }
-        }
-        EEPROM.commit();
+        // Update the stored peer table
+        scheduleSettingsSave(SETTINGS_SECTION_PEER_TABLE | SETTINGS_SECTION_SENSOR_GEOMETRY);
         
-        server.send(200, "application/json; charset=utf-8", 
-          "{\"status\":\"success\",\"message\":\"Slave device removed\"}");
+        sendJsonStatus(200, "success", "Slave device removed");
       } else {
-        server.send(404, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Slave device not found\"}");
+        sendJsonStatus(404, "error", "Slave device not found");
       }
     } else {
-      server.send(400, "application/json; charset=utf-8", 
-        "{\"status\":\"error\",\"message\":\"Invalid MAC address format\"}");
+      sendJsonStatus(400, "error", "Invalid MAC address format");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-      "{\"status\":\"error\",\"message\":\"Missing MAC address or not in master mode\"}");
+    sendJsonStatus(400, "error", "Missing MAC address or not in master mode");
   }
 }
+void handleGetESPNOWStats() {
+  espnow_stats_t stats;
+  getESPNOWStats(&stats);
+  
+  char buffer[320];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("received", (unsigned long)stats.packetsReceived);
+  json.field("lost", (unsigned long)stats.packetsLost);
+  json.field("duplicated", (unsigned long)stats.packetsDuplicated);
+  json.field("reordered", (unsigned long)stats.packetsReordered);
+  json.field("injectedLoss", (unsigned long)stats.packetsInjectedLoss);
+  json.field("unpaired", (unsigned long)stats.packetsUnpaired);
+  json.field("rxAvgUs", (unsigned long)stats.rxTimeAvgUs);
+  json.field("rxMaxUs", (unsigned long)stats.rxTimeMaxUs);
+  json.field("latencyAvgUs", (unsigned long)stats.updateLatencyAvgUs);
+  json.field("latencyMaxUs", (unsigned long)stats.updateLatencyMaxUs);
+  json.field("slaves", numSlaveDevices);
+  json.endObject();
+  
+  // Start a fresh measurement window if asked
+  if (server.hasArg("reset")) {
+    resetESPNOWStats();
+  }
+  
+  sendJson(200, json);
+}
+
+void handleSetFaultInjection() {
+  if (!ENABLE_ESPNOW_FAULT_INJECTION) {
+    sendJsonStatus(400, "error", "Fault injection not enabled in this build");
+    return;
+  }
+  
+  int loss = server.hasArg("loss") ? server.arg("loss").toInt() : 0;
+  int duplicate = server.hasArg("duplicate") ? server.arg("duplicate").toInt() : 0;
+  int reorder = server.hasArg("reorder") ? server.arg("reorder").toInt() : 0;
+  
+  setFaultInjection(constrain(loss, 0, 100), constrain(duplicate, 0, 100), constrain(reorder, 0, 100));
+  resetESPNOWStats();
+  
+  sendJsonStatus(200, "success", "Fault injection updated");
+}
+
 void handleGetSensorData() {
+  // Readings arrive on the WiFi task - work from a consistent copy
+  sensor_data_t readings[MAX_SLAVE_DEVICES + 1];
+  copySensorReadings(readings);
+  
   // Create JSON with latest sensor readings
-  String json = "{\"sensors\":[";
+  char buffer[2560];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.beginArray("sensors");
   
+  unsigned long now = millis();
   for (int i = 0; i <= MAX_SLAVE_DEVICES; i++) {
-    if (i > 0 && latestSensorData[i].timestamp == 0) continue; // Skip uninitialized slave devices
-    
-    if (i > 0) json += ",";
+    if (i > 0 && readings[i].timestamp == 0) continue; // Skip uninitialized slave devices
     
-    json += "{";
-    json += "\"id\":" + String(latestSensorData[i].sensorId) + ",";
-    json += "\"distance\":" + String(latestSensorData[i].distance) + ",";
-    json += "\"direction\":" + String(latestSensorData[i].direction) + ",";
-    json += "\"age\":" + String(millis() - latestSensorData[i].timestamp) + ",";
-    json += "\"active\":" + String((millis() - latestSensorData[i].timestamp < 5000) ? "true" : "false");
-    json += "}";
+    json.beginObject();
+    json.field("id", readings[i].sensorId);
+    json.field("distance", readings[i].distance);
+    json.field("direction", readings[i].direction);
+    json.field("age", now - readings[i].timestamp);
+    json.field("energy", readings[i].energy);
+    json.field("lost", (unsigned long)getSensorPacketsLost(i));
+    json.field("weight", getSensorFusionWeight(i), 2);
+    json.field("active", now - readings[i].timestamp < 5000);
+    json.endObject();
   }
   
-  json += "],";
-  json += "\"selected\":" + String(currentDistance) + ",";
-  json += "\"mode\":" + String(sensorPriorityMode);
-  json += "}";
+  json.endArray();
+  json.field("selected", currentDistance);
+  json.field("mode", sensorPriorityMode);
+  json.endObject();
   
-  server.send(200, "application/json; charset=utf-8", json);
+  sendJson(200, json);
 }
 void handleSetMasterMac() {
   if (server.hasArg("mac") && deviceRole == DEVICE_ROLE_SLAVE) {
@@ -1286,21 +1918,18 @@ void handleSetMasterMac() {
       }
       
       if (allZeros) {
-        server.send(400, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Invalid MAC address - cannot be all zeros\"}");
+        sendJsonStatus(400, "error", "Invalid MAC address - cannot be all zeros");
         return;
       }
       
       // Store new master MAC address
       for (int i = 0; i < 6; i++) {
         masterAddress[i] = static_cast<uint8_t>(values[i]);
-        EEPROM.write(EEPROM_ADDR_MASTER_MAC + i, masterAddress[i]);
       }
       
-      // Commit to EEPROM first
-      if (!EEPROM.commit()) {
-        server.send(500, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Failed to save master MAC to EEPROM\"}");
+      // Store it before reconfiguring ESP-NOW
+      if (!saveEspnowSettings()) {
+        sendJsonStatus(500, "error", "Failed to save master MAC");
         return;
       }
       
@@ -1337,22 +1966,17 @@ void handleSetMasterMac() {
         esp_err_t sendResult = esp_now_send(masterAddress, (uint8_t*)&testData, sizeof(sensor_data_t));
         
         if (sendResult == ESP_OK) {
-          server.send(200, "application/json; charset=utf-8", 
-            "{\"status\":\"success\",\"message\":\"Master device configured and test message sent\"}");
+          sendJsonStatus(200, "success", "Master device configured and test message sent");
         } else {
-          server.send(200, "application/json; charset=utf-8", 
-            "{\"status\":\"warning\",\"message\":\"Master configured but test message failed\"}");
+          sendJsonStatus(200, "warning", "Master configured but test message failed");
         }
       } else {
-        server.send(500, "application/json; charset=utf-8", 
-          "{\"status\":\"error\",\"message\":\"Failed to add master as ESP-NOW peer\"}");
+        sendJsonStatus(500, "error", "Failed to add master as ESP-NOW peer");
       }
     } else {
-      server.send(400, "application/json; charset=utf-8", 
-        "{\"status\":\"error\",\"message\":\"Invalid MAC address format\"}");
+      sendJsonStatus(400, "error", "Invalid MAC address format");
     }
   } else {
-    server.send(400, "application/json; charset=utf-8", 
-      "{\"status\":\"error\",\"message\":\"Missing MAC address or not in slave mode\"}");
+    sendJsonStatus(400, "error", "Missing MAC address or not in slave mode");
   }
 }
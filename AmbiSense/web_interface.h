@@ -14,18 +14,16 @@
 extern WebServer server;
 
 /**
- * Initializes the web server
+ * Initializes the web server and starts its task
  */
 void setupWebServer();
 
 /**
- * Generate HTML for different pages
+ * Runs a settings request handed over by the web server task, if any.
+ * Call once per loop iteration; handlers that change render state only
+ * ever run here, between frames.
  */
-String getMainHTML();
-String getAdvancedHTML();
-String getEffectsHTML();
-String getMeshHTML();
-String getNetworkHTML();
+void serviceWebRequests();
 
 /**
  * Route handlers for web pages
@@ -43,6 +41,7 @@ void handleSimplePage();
 void handleDistance();
 void handleSettings();
 void handleSet();
+void handleSetBatch();  // Several settings, applied together
 void handleSetLightMode();
 void handleSetDirectionalLight();
 void handleSetCenterShift();
@@ -52,6 +51,8 @@ void handleSetMotionSmoothing();
 void handleSetMotionSmoothingParam();
 void handleSetEffectSpeed();
 void handleSetEffectIntensity();
+void handleGetPalette();  // Palette names and the custom palette's stops
+void handleSetPalette();  // Custom palette (?stops=position:RRGGBB,...), selected once set
 void handleSetSensorPriorityMode();  // Handler for sensor priority mode
 void handleResetDistanceValues();  // Handler for resetting distance values
 
@@ -67,6 +68,8 @@ void handleReinitLEDs();
 void handleSetLEDSegmentMode();
 void handleGetLEDSegmentInfo();
 void handleSetLEDSegmentInfo();
+void handleGetSegmentMap();
+void handleSetSegmentMap();
 
 /**
  * ESP-NOW handlers
@@ -78,7 +81,14 @@ void handleAddSlave();
 void handleRemoveSlave();
 void handleSetMasterMac();
 void handleGetSensorData();
+void handleGetESPNOWStats();
+void handleSetFaultInjection();
+void handleGetSensorGeometry();
+void handleSetSensorGeometry();
 void handleDiagnostics();
+void handleTelemetry();  // Heap, stack and allocation history (?format=bin for the raw ring)
+void handleProfile();    // Per-stage loop and web task timing (?reset=1 to clear)
+void handleBenchmark();  // Output stage against per-pixel setPixelColor()
 
 /**
  * WiFi management handlers
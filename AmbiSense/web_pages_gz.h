@@ -0,0 +1,2067 @@
+#ifndef WEB_PAGES_GZ_H
+#define WEB_PAGES_GZ_H
+
+#include <pgmspace.h>
+
+// GENERATED by tools/gen_web_pages.py from compressed_html_full.h - do not edit.
+// Each array is a fully composed page, gzip-compressed, served as-is.
+
+// GET /
+const uint8_t page_basic_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3d, 0x6b, 0x73, 0xdb, 0xb6,
+  0xb2, 0xdf, 0xf3, 0x2b, 0x50, 0xa5, 0x31, 0xc5, 0x63, 0x49, 0x96, 0x6c, 0xcb, 0x49, 0xc4, 0xc8,
+  0x39, 0xcd, 0xa3, 0xbd, 0x9e, 0x71, 0xda, 0x4c, 0x9d, 0x76, 0xee, 0x99, 0x4e, 0x67, 0x0a, 0x89,
+  0x90, 0xc4, 0x86, 0x22, 0x75, 0x48, 0xca, 0x8f, 0x2a, 0xfa, 0xef, 0x77, 0x17, 0x2f, 0x02, 0x7c,
+  0x48, 0xb4, 0x93, 0x73, 0x6f, 0x73, 0xe3, 0x53, 0x8b, 0x04, 0xb0, 0x8b, 0xdd, 0xc5, 0x3e, 0x01,
+  0xc8, 0xe7, 0xc5, 0x37, 0x6f, 0x7e, 0x7a, 0xfd, 0xe1, 0x5f, 0xef, 0xdf, 0x92, 0x45, 0xb6, 0x0c,
+  0xcf, 0x1f, 0xbd, 0xc0, 0x0f, 0x12, 0xd2, 0x68, 0x3e, 0x6e, 0xb1, 0xa8, 0x85, 0x0d, 0x8c, 0xfa,
+  0xf0, 0xb1, 0x64, 0x19, 0x25, 0xd3, 0x05, 0x4d, 0x52, 0x96, 0x8d, 0x5b, 0xbf, 0x7c, 0xf8, 0xbe,
+  0xfb, 0xac, 0xa5, 0x9a, 0x17, 0x59, 0xb6, 0xea, 0xb2, 0x7f, 0xaf, 0x83, 0xeb, 0x71, 0xeb, 0x75,
+  0x1c, 0x65, 0x2c, 0xca, 0xba, 0x1f, 0xee, 0x56, 0xac, 0x45, 0xa6, 0xe2, 0x6d, 0xdc, 0xca, 0xd8,
+  0x6d, 0x76, 0x84, 0xb8, 0x3d, 0x8d, 0x64, 0x9d, 0xcd, 0x04, 0x8e, 0x2c, 0xc8, 0x42, 0x76, 0xfe,
+  0xdd, 0x72, 0x12, 0x5c, 0xb1, 0x28, 0x65, 0xe4, 0x13, 0xf9, 0xc0, 0xa6, 0x8b, 0xf7, 0x71, 0x9a,
+  0xa5, 0xe4, 0x1d, 0xf3, 0x03, 0xfa, 0xe2, 0x48, 0x0c, 0x91, 0xd3, 0x45, 0x74, 0xc9, 0xc6, 0xce,
+  0x75, 0xc0, 0x6e, 0x56, 0x71, 0x92, 0x39, 0x7a, 0x12, 0xe7, 0x26, 0xf0, 0xb3, 0xc5, 0xd8, 0x67,
+  0xd7, 0xc1, 0x94, 0x75, 0xf9, 0x4b, 0x87, 0x04, 0x51, 0x90, 0x05, 0x34, 0xec, 0xa6, 0x53, 0x1a,
+  0xb2, 0xf1, 0xc0, 0x01, 0x24, 0x69, 0x76, 0x87, 0xc8, 0x46, 0x49, 0x1c, 0x67, 0x9b, 0x6e, 0x77,
+  0x95, 0x04, 0x4b, 0x9a, 0xdc, 0x8d, 0x1e, 0x9f, 0x9e, 0x9c, 0x0d, 0x18, 0xf3, 0x74, 0x4b, 0x37,
+  0x0c, 0xe6, 0x8b, 0x0c, 0xda, 0x9f, 0x3d, 0x1f, 0xb2, 0x19, 0xb4, 0xa7, 0xeb, 0xe9, 0x94, 0xa5,
+  0x29, 0xb4, 0x4c, 0xa7, 0xcf, 0x67, 0x7d, 0x68, 0x99, 0xcc, 0xbb, 0x3e, 0x4d, 0x3e, 0x8e, 0x1e,
+  0x0f, 0x8e, 0xf1, 0x47, 0xb4, 0x4c, 0x69, 0xe2, 0x43, 0x0b, 0xc3, 0x1f, 0x68, 0x41, 0xd6, 0x47,
+  0x8f, 0x67, 0xfc, 0x9f, 0x7c, 0xed, 0xa6, 0x0c, 0x88, 0xf6, 0xf9, 0xac, 0x93, 0x3e, 0xfe, 0x20,
+  0x64, 0x9c, 0xf8, 0x2c, 0xe9, 0x26, 0xd4, 0x0f, 0xd6, 0xe9, 0x68, 0x70, 0xbc, 0xba, 0xc5, 0x29,
+  0x17, 0xd4, 0x8f, 0x6f, 0x46, 0x7d, 0x32, 0xe8, 0xaf, 0x6e, 0xc9, 0x31, 0xfe, 0x4a, 0xe6, 0x13,
+  0xda, 0xee, 0x77, 0xf8, 0x4f, 0xef, 0xc4, 0x45, 0x94, 0x09, 0x8d, 0x52, 0x60, 0x33, 0x8e, 0x46,
+  0x34, 0x0c, 0x09, 0xb4, 0xa6, 0x84, 0xd1, 0x94, 0x6d, 0x1f, 0xfd, 0x63, 0x03, 0x8c, 0xcc, 0x83,
+  0x68, 0xd4, 0xf7, 0x56, 0xd4, 0xf7, 0x83, 0x68, 0x0e, 0x4f, 0x93, 0xf8, 0xb6, 0x9b, 0x06, 0x7f,
+  0xe1, 0x8b, 0x9c, 0x13, 0x5a, 0xb6, 0x8f, 0x26, 0xb1, 0x7f, 0xb7, 0x99, 0x81, 0x2c, 0xbb, 0x33,
+  0xba, 0x0c, 0xc2, 0xbb, 0x91, 0x73, 0xc5, 0xe6, 0x31, 0x23, 0xbf, 0x5c, 0x38, 0x9d, 0x0f, 0x74,
+  0x11, 0x2f, 0x69, 0xe7, 0x07, 0x16, 0xb1, 0x6b, 0xda, 0xf9, 0x95, 0x25, 0x3e, 0x8d, 0x68, 0x27,
+  0x85, 0x69, 0x81, 0x95, 0x24, 0x98, 0x79, 0x13, 0x3a, 0xfd, 0x38, 0x4f, 0xe2, 0x75, 0xe4, 0x77,
+  0xa7, 0x71, 0x18, 0x27, 0xa3, 0x6b, 0x9a, 0xb4, 0xb5, 0x7c, 0x5c, 0xcf, 0x6c, 0x44, 0x09, 0xb8,
+  0xde, 0x32, 0x88, 0xba, 0x0b, 0xc6, 0x25, 0x3c, 0xe8, 0xf7, 0xaf, 0x17, 0x9e, 0x1f, 0xa4, 0xab,
+  0x90, 0xde, 0x8d, 0x66, 0x21, 0xbb, 0xf5, 0xf0, 0x57, 0xd7, 0x0f, 0x12, 0x36, 0xe5, 0x6c, 0x01,
+  0xf8, 0x7a, 0x19, 0x79, 0x7f, 0xae, 0xd3, 0x2c, 0x98, 0xdd, 0x75, 0xe5, 0x8a, 0x8f, 0xd2, 0x15,
+  0x85, 0x95, 0x9e, 0xb0, 0xec, 0x86, 0xb1, 0x48, 0x73, 0x88, 0x52, 0x32, 0x08, 0x1a, 0x85, 0x41,
+  0xc4, 0x68, 0xd2, 0x9d, 0xa3, 0x64, 0x01, 0xaa, 0x3d, 0x38, 0x19, 0xfa, 0x6c, 0xde, 0x91, 0x6b,
+  0x46, 0xfa, 0x4f, 0x3a, 0x8f, 0x8f, 0x29, 0xfe, 0x80, 0x90, 0xfb, 0x4f, 0xdc, 0xed, 0xa3, 0xde,
+  0x92, 0x02, 0x71, 0x72, 0x92, 0x8d, 0x45, 0x57, 0x91, 0x82, 0x29, 0xfc, 0x62, 0x89, 0x47, 0x41,
+  0x55, 0xa2, 0x6e, 0x90, 0xb1, 0x65, 0xaa, 0x9a, 0x70, 0xf8, 0x68, 0x00, 0xc8, 0x70, 0x28, 0xe0,
+  0x63, 0xc9, 0xc6, 0xa0, 0x49, 0x8b, 0x07, 0x95, 0xc5, 0xf5, 0xec, 0xb5, 0x97, 0x9d, 0x66, 0x9b,
+  0x2b, 0x56, 0x4d, 0x68, 0x83, 0xe8, 0x17, 0x2f, 0xae, 0xc7, 0x15, 0x1d, 0x65, 0xf8, 0xc4, 0x5b,
+  0xd2, 0x5b, 0xa1, 0xf7, 0xa3, 0x53, 0x2e, 0x84, 0xf8, 0x9a, 0x25, 0xb3, 0x10, 0x20, 0x16, 0x81,
+  0xef, 0xa3, 0x84, 0x62, 0xa9, 0x26, 0x09, 0x0b, 0x69, 0x16, 0x5c, 0x83, 0x86, 0xf4, 0xd0, 0xbe,
+  0x6d, 0xda, 0x6a, 0xe4, 0x25, 0x66, 0x95, 0xb6, 0xe1, 0xa2, 0xd8, 0xac, 0x16, 0x61, 0x2d, 0xae,
+  0x90, 0x61, 0xbe, 0x16, 0x43, 0xa9, 0xb6, 0x1e, 0xd7, 0x7b, 0x2e, 0x27, 0x25, 0xa1, 0x12, 0x35,
+  0x45, 0x7a, 0x35, 0x75, 0x64, 0x31, 0x10, 0x9a, 0x09, 0x6a, 0xcb, 0x46, 0xc7, 0xa7, 0x80, 0x8e,
+  0xbf, 0xde, 0x08, 0xfd, 0x39, 0xeb, 0xf7, 0x3d, 0xa1, 0xe7, 0x20, 0xb4, 0x2c, 0x8b, 0x97, 0xa3,
+  0x67, 0x6a, 0x42, 0x6d, 0x3f, 0x60, 0x4e, 0x64, 0x58, 0xb4, 0x9e, 0x63, 0xb7, 0x82, 0x88, 0xbf,
+  0xba, 0x41, 0xe4, 0xc3, 0xda, 0x1d, 0xe7, 0xd3, 0xaf, 0x36, 0x31, 0x68, 0x5a, 0x90, 0xdd, 0x8d,
+  0xfa, 0xbd, 0xe7, 0x5e, 0x4e, 0xc9, 0x00, 0x29, 0x69, 0x82, 0x61, 0x34, 0x9a, 0xb0, 0x59, 0x9c,
+  0xb0, 0x8d, 0xd2, 0x1b, 0xc7, 0xc9, 0xe1, 0xe8, 0x24, 0x05, 0xf5, 0xce, 0x98, 0x97, 0xc5, 0xab,
+  0x51, 0x77, 0x08, 0xeb, 0x18, 0xb2, 0x59, 0x26, 0x9e, 0xc4, 0x6a, 0x1e, 0xe3, 0xe2, 0x4a, 0x63,
+  0xe1, 0xcf, 0xc6, 0x6a, 0xe1, 0x2a, 0x81, 0x7f, 0xd3, 0xab, 0x35, 0x0d, 0x92, 0x69, 0xc8, 0x3a,
+  0x9c, 0xcf, 0xe3, 0xe1, 0xb0, 0xa3, 0xfe, 0xeb, 0xf7, 0x06, 0x7c, 0xd1, 0xca, 0x1d, 0x2e, 0x79,
+  0x8a, 0x4b, 0xa6, 0xa8, 0x56, 0x3a, 0x8b, 0xba, 0x6f, 0x2e, 0x23, 0x34, 0x03, 0x0b, 0xcb, 0x2e,
+  0xce, 0xbb, 0xda, 0xd8, 0xf2, 0x3e, 0x3e, 0xae, 0x12, 0x84, 0x05, 0x01, 0x41, 0x65, 0xc2, 0x42,
+  0x6d, 0x4d, 0x93, 0x30, 0x9e, 0x7e, 0xac, 0x58, 0xb5, 0x82, 0x70, 0x8b, 0x7e, 0x23, 0xf7, 0x9c,
+  0xae, 0xa5, 0x02, 0xc3, 0x7e, 0x1f, 0x66, 0x4b, 0xc3, 0x00, 0x4d, 0x26, 0xb7, 0x38, 0xcb, 0x76,
+  0x2b, 0x8c, 0x74, 0x4e, 0x57, 0xa3, 0x81, 0xe0, 0x4d, 0xc0, 0x6e, 0x84, 0xd9, 0x7a, 0x80, 0x77,
+  0xf2, 0x31, 0x00, 0x85, 0x5d, 0xad, 0xc0, 0x16, 0x68, 0x34, 0x65, 0xa3, 0x28, 0x8e, 0x98, 0x5a,
+  0x04, 0xa4, 0xd4, 0xb6, 0xd9, 0xa1, 0xed, 0x73, 0x1e, 0x9f, 0x9c, 0x9c, 0x78, 0xf1, 0x3a, 0x43,
+  0x5b, 0x12, 0x90, 0x86, 0x93, 0x96, 0xec, 0xe8, 0x06, 0x57, 0x4f, 0x3f, 0x1a, 0xa9, 0x89, 0x25,
+  0x2b, 0xd9, 0x62, 0xbd, 0x9c, 0x6c, 0xea, 0xa8, 0x29, 0xbe, 0x4b, 0x57, 0x80, 0xd4, 0x29, 0xd7,
+  0x5a, 0x41, 0xa9, 0xad, 0x3f, 0xb6, 0x59, 0x7b, 0xd3, 0x75, 0x92, 0x82, 0xc4, 0x57, 0x71, 0xc0,
+  0x05, 0xb4, 0x8b, 0x6a, 0xd3, 0x25, 0xf5, 0x89, 0x0c, 0x51, 0x5c, 0xbd, 0xce, 0x9e, 0x76, 0x9e,
+  0x3f, 0xed, 0x1c, 0x9f, 0x3c, 0x03, 0xad, 0x1b, 0x5a, 0xdc, 0x2d, 0xe3, 0xbf, 0x80, 0x8e, 0x68,
+  0xce, 0x24, 0x67, 0x7f, 0x77, 0x8a, 0x17, 0xe8, 0x92, 0x6a, 0x56, 0x85, 0x23, 0x46, 0x05, 0x1f,
+  0xf1, 0xe4, 0xa2, 0x3d, 0x00, 0x0b, 0xcb, 0x95, 0xf0, 0x9a, 0x86, 0x6b, 0xb6, 0xc1, 0x28, 0x27,
+  0x78, 0x3c, 0x43, 0x27, 0xa8, 0xec, 0x09, 0x78, 0x24, 0x3c, 0xc2, 0x37, 0x71, 0xfc, 0x05, 0xad,
+  0x2a, 0x3b, 0xd2, 0xa2, 0x2f, 0xdc, 0x63, 0x43, 0x2e, 0x37, 0x70, 0x68, 0x03, 0x19, 0x32, 0x4c,
+  0xa3, 0x36, 0x06, 0x85, 0x72, 0x15, 0x4e, 0xce, 0x9a, 0x11, 0x57, 0x8c, 0x30, 0x86, 0x80, 0x03,
+  0xc8, 0xe5, 0x32, 0x82, 0x62, 0x2e, 0xf9, 0x5d, 0x2e, 0x61, 0x68, 0x91, 0xf2, 0x4c, 0x95, 0x37,
+  0x41, 0x07, 0x28, 0xcd, 0x11, 0x7b, 0x6d, 0x8f, 0x11, 0x44, 0x68, 0x4c, 0x5d, 0xe1, 0x38, 0x94,
+  0x5f, 0xac, 0x0c, 0x2c, 0xa6, 0x3c, 0x26, 0x71, 0xe8, 0x2b, 0x37, 0x93, 0xc8, 0x6c, 0xc3, 0x9e,
+  0xa0, 0x97, 0x6c, 0x84, 0x84, 0x20, 0x47, 0x1b, 0xc2, 0x3f, 0xab, 0x6f, 0xae, 0xfa, 0x86, 0x43,
+  0xec, 0xb5, 0xfa, 0x26, 0x79, 0x1f, 0xf6, 0x42, 0x5f, 0xc8, 0x30, 0xfd, 0x59, 0xc3, 0xec, 0x0f,
+  0x72, 0x41, 0x39, 0x78, 0x10, 0xad, 0xd6, 0x99, 0xf2, 0x45, 0x4a, 0x69, 0xb8, 0xb6, 0x3e, 0x54,
+  0x6b, 0x44, 0xb7, 0x70, 0x13, 0xe5, 0x64, 0xac, 0xa0, 0x31, 0x25, 0x91, 0x02, 0x71, 0x93, 0x35,
+  0xf8, 0xe8, 0xa8, 0xe0, 0xbf, 0x8d, 0xdc, 0x43, 0x53, 0x39, 0x6c, 0x94, 0x7d, 0xdd, 0x2b, 0x9b,
+  0x10, 0x04, 0xdf, 0x2c, 0x40, 0x70, 0x16, 0x23, 0x0d, 0xe4, 0x60, 0x70, 0x76, 0x56, 0x91, 0x36,
+  0xdc, 0xc7, 0x79, 0x18, 0x4a, 0x7a, 0xa2, 0x15, 0x2f, 0x77, 0x02, 0x6b, 0x70, 0xc6, 0xc9, 0x14,
+  0xd2, 0x6e, 0x08, 0xdf, 0x19, 0x20, 0xeb, 0x62, 0x76, 0xca, 0x25, 0xc2, 0x57, 0xcc, 0x70, 0x3c,
+  0x68, 0x0f, 0x83, 0x61, 0x95, 0xeb, 0x39, 0x75, 0xb5, 0xa4, 0x85, 0xeb, 0x31, 0x9c, 0x0c, 0x7f,
+  0x82, 0xc0, 0xca, 0xfe, 0xd5, 0xee, 0x9e, 0xac, 0x6e, 0x0b, 0xce, 0xec, 0x99, 0x55, 0x1e, 0x98,
+  0x38, 0xcf, 0xb8, 0x53, 0x02, 0x92, 0x80, 0x16, 0x48, 0xd7, 0xe9, 0x35, 0xf3, 0x37, 0x3a, 0x54,
+  0xcf, 0x82, 0x5b, 0xe6, 0xf3, 0xc4, 0x83, 0xdb, 0x52, 0x22, 0x53, 0x0c, 0xc3, 0x55, 0x71, 0x42,
+  0x8f, 0x9b, 0x2d, 0xaa, 0x2c, 0x8c, 0x78, 0x4a, 0x2d, 0xaa, 0xa9, 0xda, 0x05, 0xdc, 0xb9, 0x68,
+  0x15, 0x4c, 0xff, 0x77, 0xfb, 0x98, 0x63, 0x32, 0x56, 0x48, 0x8f, 0xca, 0x2b, 0x9e, 0x5d, 0x72,
+  0x36, 0x92, 0x3e, 0x9d, 0xea, 0xf4, 0x45, 0xda, 0x60, 0x09, 0xa7, 0x97, 0x2e, 0xe2, 0x9b, 0x4d,
+  0x25, 0x09, 0x7d, 0x97, 0xa7, 0x34, 0x71, 0x86, 0x0b, 0x53, 0xce, 0x67, 0x4d, 0x89, 0xf5, 0x4b,
+  0xea, 0x62, 0x68, 0xe2, 0xf1, 0x9e, 0xcc, 0x26, 0x37, 0x2b, 0x3d, 0x1f, 0x51, 0x29, 0xd7, 0xe8,
+  0x04, 0xb1, 0xa3, 0x9a, 0x00, 0x5d, 0x38, 0xdf, 0xa6, 0xa4, 0xd3, 0x15, 0xfe, 0x3e, 0x8c, 0x29,
+  0x8e, 0xed, 0xa2, 0x4e, 0x81, 0xf9, 0x6e, 0xaa, 0x93, 0xcf, 0xbe, 0xc8, 0x3c, 0xfb, 0xa6, 0x5d,
+  0xe7, 0x35, 0x9a, 0x9d, 0x76, 0x9a, 0x22, 0x7d, 0xea, 0x7a, 0x0f, 0xac, 0x92, 0xd4, 0x4a, 0x3c,
+  0x87, 0x7f, 0xb8, 0x12, 0xab, 0x20, 0x42, 0xa7, 0x29, 0xe6, 0x1f, 0x1a, 0x01, 0x89, 0x3f, 0x4b,
+  0xdb, 0x47, 0xf9, 0x02, 0xd5, 0x81, 0x6f, 0x2f, 0xec, 0xc0, 0xad, 0xca, 0x1b, 0x44, 0x0b, 0x70,
+  0x67, 0x15, 0xa6, 0x3a, 0x7b, 0xa0, 0x11, 0x3c, 0x70, 0x49, 0xe0, 0xdc, 0x64, 0x20, 0xf4, 0x08,
+  0xa8, 0xea, 0x42, 0xf6, 0x46, 0x82, 0x68, 0x86, 0x1b, 0x08, 0x98, 0xc9, 0x66, 0x74, 0x52, 0xe7,
+  0xd5, 0x0b, 0xb9, 0x70, 0x4e, 0xa9, 0x6a, 0x1a, 0x68, 0x82, 0x45, 0x5e, 0x28, 0x83, 0x66, 0xf7,
+  0x76, 0x44, 0xd7, 0x59, 0xec, 0x71, 0xbb, 0xe0, 0xee, 0x02, 0xf3, 0xb8, 0x9b, 0x84, 0xae, 0xc4,
+  0x7c, 0x32, 0x00, 0x40, 0x04, 0xe5, 0xc3, 0xac, 0x38, 0x80, 0x59, 0x52, 0xc1, 0x79, 0x95, 0x6a,
+  0x70, 0xae, 0xb9, 0x2b, 0x9a, 0x80, 0xa8, 0x77, 0xfa, 0xff, 0x52, 0x52, 0x9d, 0x6b, 0x69, 0xb9,
+  0xb8, 0xe1, 0x00, 0x3a, 0xec, 0xb3, 0x30, 0x0c, 0x56, 0x69, 0x90, 0x96, 0x12, 0x81, 0xbc, 0x14,
+  0x05, 0xcd, 0xe1, 0xd1, 0x0d, 0x18, 0xea, 0xd1, 0x29, 0xe2, 0xd8, 0x54, 0xad, 0x84, 0x35, 0x62,
+  0x34, 0xa2, 0x33, 0x34, 0xb2, 0x9d, 0xe5, 0x92, 0x14, 0x6e, 0x17, 0xfd, 0x6b, 0xad, 0xde, 0x1e,
+  0x5b, 0x8e, 0xab, 0x5b, 0x3d, 0xf3, 0x3f, 0x3f, 0xb2, 0xbb, 0x59, 0x42, 0x97, 0x2c, 0x25, 0xa8,
+  0x05, 0x9b, 0x2c, 0x36, 0xec, 0x3f, 0x89, 0x33, 0x30, 0xfe, 0xf6, 0xc9, 0x59, 0x1f, 0x5c, 0x9c,
+  0xbb, 0x05, 0x3a, 0x61, 0xf1, 0x33, 0x4c, 0xba, 0xbb, 0x52, 0x0b, 0x36, 0x95, 0x91, 0xa1, 0xd2,
+  0x37, 0x98, 0xca, 0xd1, 0x30, 0x7c, 0x73, 0x1d, 0x3f, 0xe9, 0x77, 0xc4, 0xff, 0xd0, 0x9f, 0x37,
+  0xaa, 0x9c, 0x8b, 0x44, 0x36, 0x2f, 0x41, 0xfb, 0x4d, 0xa5, 0x59, 0x0a, 0x03, 0xcf, 0xfb, 0xbb,
+  0x42, 0xbb, 0xdc, 0x3e, 0x73, 0xf5, 0x36, 0x8b, 0x26, 0x51, 0x24, 0x7a, 0x85, 0x24, 0xc4, 0xb6,
+  0x2a, 0x54, 0xfa, 0x5d, 0x8a, 0x6b, 0xa2, 0x13, 0xa9, 0x77, 0x8e, 0xee, 0xa4, 0x18, 0xf9, 0x9f,
+  0x16, 0xbc, 0xa4, 0xa2, 0xac, 0xb0, 0x67, 0x60, 0x16, 0x08, 0x4f, 0xcf, 0x3a, 0xc7, 0xfd, 0x41,
+  0xe7, 0xf8, 0x54, 0xe4, 0xaf, 0xfb, 0xca, 0x39, 0x4d, 0xcb, 0x1a, 0xdc, 0xc7, 0xa6, 0x90, 0x84,
+  0xe4, 0x9b, 0x09, 0x4f, 0x15, 0x97, 0x5c, 0xe2, 0x79, 0x16, 0x78, 0x1d, 0xa4, 0x6b, 0xd0, 0x9f,
+  0xbf, 0xc0, 0x04, 0x94, 0xff, 0xad, 0x2a, 0x30, 0x0b, 0x69, 0x73, 0x41, 0xb1, 0x06, 0x4d, 0xb7,
+  0x80, 0x70, 0x46, 0x69, 0x99, 0x65, 0x8d, 0xb0, 0xfc, 0x7f, 0x19, 0xff, 0x1e, 0x39, 0x64, 0xf1,
+  0x7c, 0x1e, 0xb2, 0x3a, 0xc7, 0xb9, 0x7b, 0x3f, 0xaf, 0x22, 0x5c, 0x94, 0x3d, 0x6d, 0x3e, 0x47,
+  0xa5, 0x12, 0xed, 0xd6, 0x18, 0x09, 0x99, 0xde, 0x04, 0xd9, 0x74, 0xb1, 0x29, 0x5b, 0xd5, 0x8e,
+  0xd2, 0xc3, 0x2a, 0x96, 0x4e, 0x4d, 0x3a, 0x04, 0x36, 0x22, 0x52, 0x78, 0xbd, 0xd4, 0x12, 0xac,
+  0xaf, 0x60, 0xfa, 0x06, 0x80, 0xd8, 0x79, 0x28, 0x8b, 0xbe, 0x98, 0x9c, 0x9a, 0xb6, 0x29, 0x32,
+  0xb5, 0xbe, 0x72, 0x82, 0xfd, 0xb2, 0x93, 0x13, 0xc5, 0x62, 0xbe, 0x3c, 0xbd, 0xd3, 0xb4, 0xb0,
+  0x80, 0x05, 0xba, 0x45, 0xc5, 0x2b, 0xbd, 0x44, 0x05, 0x35, 0x72, 0x91, 0x5a, 0x2d, 0xed, 0x0d,
+  0x50, 0x99, 0x65, 0x25, 0x76, 0xa6, 0x9c, 0xf0, 0x29, 0xd7, 0x43, 0x4e, 0xd4, 0x69, 0x95, 0xef,
+  0x15, 0x49, 0xe0, 0x4e, 0xba, 0x86, 0x98, 0xf7, 0x70, 0xf9, 0x8d, 0xa6, 0x0b, 0x36, 0xfd, 0xc8,
+  0xfc, 0xc3, 0x82, 0xac, 0xf6, 0x7a, 0xf4, 0x5d, 0xd0, 0x8a, 0xc5, 0xea, 0x2c, 0x13, 0x18, 0x41,
+  0xd5, 0xe0, 0x08, 0xba, 0x3e, 0x4b, 0xa7, 0x49, 0xb0, 0x42, 0x3a, 0xab, 0x77, 0xae, 0x70, 0x4d,
+  0x86, 0xf7, 0x4a, 0xee, 0x20, 0xda, 0x2c, 0xf1, 0x50, 0x83, 0xb4, 0x8d, 0xdd, 0xda, 0x67, 0xa0,
+  0x4d, 0xee, 0xc6, 0xd8, 0x2a, 0xb6, 0xc2, 0xe7, 0x13, 0x4f, 0xed, 0xe2, 0x6f, 0xf9, 0x26, 0xbd,
+  0x99, 0x08, 0x6c, 0x45, 0xa2, 0x90, 0x4f, 0x5f, 0xdc, 0x66, 0xc0, 0x35, 0xde, 0x3e, 0x7a, 0x71,
+  0x24, 0x4f, 0x3d, 0x5e, 0x1c, 0xc9, 0x03, 0x1d, 0xc4, 0x04, 0x1f, 0x7e, 0x70, 0x4d, 0xa6, 0x21,
+  0x4d, 0xd3, 0x71, 0xab, 0x90, 0x23, 0xb6, 0x48, 0xe0, 0xeb, 0xc6, 0x9f, 0x64, 0x9b, 0x0d, 0x21,
+  0xd3, 0xb5, 0xd6, 0xf9, 0x8b, 0x23, 0x68, 0x45, 0xe4, 0xe2, 0xc3, 0x18, 0x62, 0x6e, 0xa5, 0x17,
+  0xa0, 0x35, 0xb7, 0x85, 0x76, 0xb1, 0x65, 0xca, 0xcf, 0x9e, 0x06, 0xf9, 0xb1, 0x10, 0x10, 0x3e,
+  0x80, 0xa6, 0xd5, 0xf9, 0xcf, 0x14, 0xe4, 0xc8, 0x51, 0x26, 0x71, 0x08, 0xae, 0x8b, 0x5c, 0xbe,
+  0x7d, 0x43, 0xd2, 0x0c, 0x96, 0x09, 0x4f, 0x82, 0x66, 0xc1, 0x7c, 0x9d, 0xf0, 0x84, 0xee, 0xc5,
+  0xd1, 0xaa, 0x92, 0xa2, 0x6a, 0x62, 0xac, 0xf4, 0x0e, 0xfb, 0x44, 0x15, 0x66, 0x74, 0x13, 0xe1,
+  0x22, 0x5b, 0x24, 0x8e, 0xa6, 0x61, 0x30, 0xfd, 0x38, 0x6e, 0xdd, 0x40, 0xee, 0x1a, 0xdf, 0x40,
+  0x6e, 0x3d, 0xe5, 0x13, 0xf6, 0x16, 0x09, 0x9b, 0x8d, 0x9d, 0x23, 0xa7, 0x75, 0xfe, 0x8a, 0xa6,
+  0xc1, 0xf4, 0xc5, 0x91, 0xc0, 0x51, 0x89, 0x6c, 0x3f, 0x1a, 0xea, 0x5f, 0x63, 0x04, 0xf1, 0x01,
+  0xdd, 0x77, 0xf2, 0xf1, 0x33, 0x31, 0xb2, 0xd9, 0x8c, 0x4d, 0xb3, 0x14, 0x10, 0xbe, 0x15, 0x4f,
+  0x9f, 0x89, 0x0f, 0xf2, 0xa5, 0x05, 0x20, 0x7b, 0xb7, 0x0e, 0xb3, 0xa0, 0x8b, 0x8b, 0x14, 0x27,
+  0x9f, 0x89, 0x31, 0x02, 0xd7, 0x1f, 0x27, 0x1f, 0x01, 0xe9, 0x8f, 0xe2, 0xe9, 0x33, 0xf1, 0x81,
+  0x9d, 0xcd, 0xa3, 0x18, 0x82, 0xcc, 0x14, 0xb9, 0x7e, 0x93, 0xbf, 0x19, 0x78, 0x85, 0x86, 0x58,
+  0xca, 0x90, 0xef, 0x5a, 0xa3, 0x26, 0xf0, 0xc0, 0x72, 0xfe, 0xe3, 0x7a, 0x39, 0x81, 0x32, 0x2c,
+  0x9e, 0xa1, 0xbe, 0x01, 0xbc, 0x68, 0xb5, 0x0d, 0xa8, 0xbc, 0xfd, 0x83, 0xf0, 0xdc, 0x95, 0x90,
+  0xec, 0x6e, 0xc5, 0xc6, 0xad, 0x88, 0x63, 0x69, 0x91, 0x65, 0x10, 0x8d, 0x5b, 0x03, 0xf8, 0xa4,
+  0xb7, 0xe3, 0x16, 0x54, 0xb6, 0xfd, 0x56, 0x19, 0x09, 0x87, 0x13, 0x56, 0x08, 0x60, 0x97, 0xcc,
+  0x4f, 0x5b, 0x84, 0xa7, 0x36, 0xe3, 0xd6, 0x09, 0x00, 0x14, 0x4c, 0xd1, 0xd8, 0x75, 0x04, 0x7b,
+  0x84, 0x48, 0x1a, 0x09, 0xfb, 0x65, 0xfe, 0x1b, 0x86, 0xae, 0x16, 0x6c, 0x77, 0x08, 0x5e, 0x00,
+  0xda, 0xcf, 0x97, 0x05, 0x73, 0x2d, 0xdb, 0x48, 0x95, 0x00, 0xde, 0xc7, 0x37, 0xc0, 0xff, 0xab,
+  0xb5, 0x3f, 0x67, 0x19, 0x38, 0xaf, 0xef, 0xdc, 0x5c, 0x06, 0xb5, 0x1c, 0xf6, 0x25, 0x87, 0x50,
+  0x96, 0x22, 0x8b, 0x69, 0xc6, 0x56, 0xc0, 0xf6, 0x3e, 0x6e, 0x57, 0x38, 0x93, 0x98, 0x48, 0x73,
+  0xcc, 0xf9, 0x4d, 0x97, 0x78, 0xbe, 0x29, 0x41, 0x4b, 0x1e, 0x1a, 0xcc, 0x8e, 0x47, 0xc5, 0x08,
+  0x52, 0x39, 0x12, 0xa4, 0x24, 0x61, 0xfe, 0x1a, 0x8c, 0x86, 0xdc, 0x2c, 0x58, 0x44, 0xb2, 0x05,
+  0xe3, 0x0b, 0x47, 0x6e, 0xe2, 0x75, 0xe8, 0x13, 0x3f, 0xa1, 0x37, 0x64, 0x09, 0x51, 0x00, 0x3a,
+  0x28, 0xf6, 0xc2, 0xf8, 0x76, 0x9f, 0x8c, 0x49, 0x14, 0x93, 0x30, 0x58, 0x06, 0x19, 0x70, 0xc7,
+  0x67, 0x6b, 0x2c, 0x9e, 0x77, 0x50, 0x28, 0x2e, 0xd7, 0x4b, 0xf2, 0x46, 0x66, 0x7e, 0xa4, 0x3d,
+  0x5d, 0xba, 0x95, 0x6a, 0x52, 0x3c, 0xa5, 0x28, 0xea, 0x08, 0xdf, 0x1f, 0x2f, 0x08, 0x70, 0x88,
+  0x32, 0xd3, 0x8b, 0xdf, 0xb2, 0x51, 0x09, 0xa9, 0xc1, 0x78, 0x9c, 0x7b, 0x97, 0x5e, 0x98, 0xe3,
+  0x7e, 0x15, 0x9a, 0x72, 0xd2, 0x7f, 0x90, 0x32, 0xbc, 0xa3, 0xb7, 0xff, 0x01, 0x6e, 0x87, 0xd5,
+  0xec, 0xd6, 0xf0, 0x4b, 0x6f, 0x9b, 0xf1, 0x2b, 0xc6, 0x69, 0x7e, 0x1f, 0xc6, 0x30, 0x06, 0x99,
+  0xd7, 0x18, 0xd5, 0x6d, 0x26, 0x79, 0x54, 0x1d, 0xb7, 0x54, 0x6e, 0x40, 0x78, 0x5a, 0x4b, 0x70,
+  0x4f, 0x97, 0xef, 0x3c, 0x79, 0xc4, 0xce, 0x58, 0x45, 0x63, 0x29, 0x0e, 0x1a, 0x7b, 0xf1, 0x82,
+  0x66, 0xde, 0xf4, 0x5e, 0xb6, 0xec, 0x88, 0xae, 0xc6, 0x1e, 0x7a, 0x6b, 0xbf, 0xd8, 0xb9, 0x53,
+  0x30, 0x20, 0x39, 0x23, 0x04, 0xba, 0x7e, 0x96, 0x8e, 0x61, 0xbf, 0x1e, 0x1e, 0x0f, 0x87, 0x7a,
+  0x61, 0xf8, 0x73, 0xc5, 0xc2, 0x80, 0xdd, 0x49, 0x61, 0xef, 0x59, 0x19, 0x35, 0xf0, 0x8d, 0x90,
+  0x5e, 0xeb, 0x1c, 0x30, 0xd6, 0xf3, 0xda, 0x9c, 0xa3, 0x79, 0xeb, 0xfc, 0x87, 0x2f, 0xca, 0xd1,
+  0x3c, 0x81, 0x7a, 0xa4, 0x19, 0x4f, 0xf9, 0xd0, 0x2f, 0xcd, 0xd5, 0x04, 0xfc, 0xdb, 0x17, 0xe5,
+  0x6a, 0x02, 0xbd, 0xcd, 0x98, 0xd2, 0x23, 0x77, 0xf0, 0x74, 0x2f, 0x6b, 0x32, 0x1c, 0x75, 0xbb,
+  0xdf, 0x05, 0x64, 0x5f, 0xce, 0x53, 0x36, 0xe2, 0x5c, 0x4f, 0xbf, 0x9f, 0x75, 0x3d, 0x54, 0x8a,
+  0xaa, 0x96, 0x73, 0xc3, 0x1d, 0x18, 0xfb, 0x3f, 0x44, 0x56, 0xae, 0xc4, 0x28, 0x18, 0xc4, 0x85,
+  0x08, 0x9c, 0x9a, 0x12, 0x9e, 0xa8, 0xb4, 0x8e, 0x12, 0x96, 0xb2, 0x4c, 0x6d, 0x1a, 0xb4, 0x4a,
+  0x6e, 0xc5, 0x2a, 0x40, 0x89, 0x4a, 0xef, 0xf9, 0xf6, 0x84, 0x47, 0x8c, 0x5d, 0x01, 0xf2, 0x78,
+  0x36, 0x3b, 0xf5, 0x4f, 0x7d, 0x8f, 0x88, 0x0a, 0x84, 0x88, 0x6a, 0x8b, 0x70, 0x82, 0x7c, 0xa8,
+  0x41, 0x44, 0x6a, 0x3c, 0x22, 0x7c, 0x1f, 0x90, 0xd8, 0x65, 0x17, 0x91, 0xbe, 0xe9, 0x67, 0xa4,
+  0x85, 0x40, 0x3c, 0x3b, 0x02, 0x2f, 0x9f, 0x7b, 0xf8, 0x2c, 0x26, 0x6f, 0xd8, 0x8c, 0x42, 0xb2,
+  0x97, 0x02, 0xcf, 0x34, 0x67, 0xdc, 0x4e, 0xcc, 0xc4, 0x9b, 0x10, 0x1e, 0xee, 0xa7, 0xbf, 0x12,
+  0xef, 0xe7, 0x57, 0xf0, 0x4c, 0xae, 0xe4, 0x4e, 0x7b, 0x9e, 0x7e, 0x59, 0xe2, 0x2f, 0xee, 0x59,
+  0x15, 0x56, 0xc7, 0xde, 0x2f, 0x6a, 0x9d, 0xbf, 0x5e, 0x27, 0xb8, 0xb7, 0xa9, 0x49, 0xac, 0x50,
+  0x3e, 0x7b, 0x4f, 0x48, 0x96, 0x34, 0x90, 0xc5, 0x2b, 0x90, 0xd6, 0x79, 0xb7, 0x6b, 0xd9, 0x9b,
+  0xb5, 0x71, 0xd3, 0x3a, 0x9f, 0x2e, 0xa5, 0xc9, 0x55, 0xe0, 0xb6, 0x37, 0x6a, 0x5a, 0xe5, 0x4e,
+  0x55, 0x30, 0xc8, 0x3c, 0xec, 0xd7, 0x7c, 0xac, 0x5a, 0x60, 0x51, 0xe2, 0x11, 0xa8, 0xf0, 0x4a,
+  0x5e, 0xbe, 0xb1, 0x75, 0xe1, 0xe9, 0x00, 0x4e, 0xbe, 0xd2, 0x2b, 0x20, 0x0f, 0x06, 0x5a, 0xc6,
+  0x9d, 0xba, 0xc9, 0x1d, 0xf9, 0x99, 0x5e, 0x07, 0xe4, 0x0a, 0xda, 0x17, 0xa4, 0x5d, 0xb8, 0x60,
+  0xe7, 0x8a, 0x5a, 0x49, 0xd5, 0x56, 0xaf, 0xed, 0xda, 0xea, 0xea, 0x0e, 0xf2, 0xb6, 0xa5, 0x1a,
+  0xf2, 0x3a, 0x5e, 0xdd, 0x71, 0x9b, 0x20, 0x07, 0x53, 0x78, 0xf4, 0x40, 0x99, 0x8f, 0x87, 0xc5,
+  0x1b, 0x7b, 0x3d, 0xf2, 0x1d, 0x24, 0x6a, 0x7c, 0x18, 0xe6, 0x61, 0x29, 0x4b, 0xf0, 0x60, 0xa5,
+  0xae, 0x22, 0xb3, 0xcf, 0x5f, 0xa4, 0xea, 0xc8, 0xb6, 0x2b, 0xde, 0x74, 0xfe, 0x48, 0x69, 0x0e,
+  0xe1, 0x63, 0x88, 0xdc, 0xb1, 0x9b, 0xad, 0xc3, 0xf0, 0xee, 0x1b, 0x8d, 0x53, 0xa4, 0x82, 0xe7,
+  0x8f, 0x66, 0xeb, 0x88, 0xdf, 0x1b, 0x23, 0x78, 0x94, 0xc3, 0x31, 0xfc, 0x18, 0x67, 0xc1, 0x2c,
+  0x10, 0xc5, 0x41, 0xdb, 0xdd, 0x04, 0xb3, 0xb6, 0xac, 0x18, 0xd2, 0x62, 0xef, 0x87, 0x60, 0xc9,
+  0xe2, 0x75, 0xe6, 0x6e, 0xa6, 0x21, 0xa3, 0x89, 0x7c, 0xdb, 0x3b, 0x7a, 0x0b, 0x3e, 0x2a, 0xcd,
+  0xc0, 0xac, 0xf2, 0xae, 0xb1, 0x1f, 0x4f, 0xd7, 0x4b, 0xd0, 0xcf, 0x1e, 0xe4, 0xb1, 0x6f, 0x43,
+  0x86, 0x8f, 0xaf, 0xee, 0x2e, 0xfc, 0xb6, 0x63, 0xf1, 0xe6, 0xb8, 0x9e, 0x09, 0xd5, 0xe3, 0x32,
+  0xb9, 0x04, 0x2d, 0xec, 0x25, 0x6c, 0x09, 0xa5, 0x38, 0x0c, 0x07, 0x26, 0x60, 0x14, 0x40, 0x29,
+  0x6a, 0xda, 0xee, 0xf8, 0x7c, 0x53, 0x03, 0x05, 0xbe, 0x41, 0x83, 0xec, 0xa1, 0x7a, 0xdc, 0x10,
+  0xa5, 0x4d, 0xc8, 0xb6, 0x03, 0x39, 0x54, 0x1f, 0x3e, 0x06, 0x78, 0x1c, 0x66, 0x89, 0x5a, 0x59,
+  0x55, 0x5b, 0x59, 0x91, 0xbb, 0xa9, 0x15, 0x82, 0x69, 0x85, 0x8e, 0xdb, 0xe3, 0x1b, 0x09, 0xff,
+  0xf5, 0xe1, 0xdd, 0xe5, 0x58, 0xc1, 0x1e, 0x3a, 0x8d, 0x0c, 0xd3, 0xf1, 0x84, 0xe8, 0x65, 0x5a,
+  0x3b, 0x5e, 0xe1, 0xed, 0xd2, 0x8b, 0x28, 0x6b, 0xd7, 0xce, 0x2c, 0x47, 0x3a, 0xee, 0xcb, 0x1e,
+  0xf7, 0x0a, 0x9f, 0x3e, 0x39, 0x27, 0x7d, 0xc7, 0x55, 0x78, 0x44, 0xba, 0xd8, 0x04, 0x8f, 0x18,
+  0x69, 0xe3, 0xc9, 0x11, 0xe1, 0x69, 0x30, 0x8c, 0xa5, 0x73, 0x36, 0x7e, 0x47, 0xb3, 0x45, 0x0f,
+  0xa6, 0x6d, 0x43, 0xe9, 0xd3, 0x11, 0x2f, 0xf4, 0xb6, 0xdd, 0xef, 0xb4, 0xb5, 0xa0, 0xba, 0x92,
+  0x28, 0xf7, 0xa8, 0x2d, 0xd1, 0xea, 0x16, 0xf7, 0x1f, 0x00, 0xe5, 0x2a, 0xac, 0x96, 0x1f, 0xa9,
+  0x57, 0x31, 0x6b, 0x98, 0x26, 0x49, 0x5f, 0xa8, 0xbc, 0x44, 0xcb, 0x94, 0x00, 0xf5, 0x48, 0xec,
+  0xe1, 0x80, 0x05, 0xcc, 0xa6, 0x12, 0xc5, 0xc1, 0x41, 0x65, 0x73, 0x4f, 0xee, 0xbf, 0xb9, 0x1b,
+  0x29, 0x11, 0xb9, 0xa7, 0x38, 0x06, 0x86, 0xba, 0xb9, 0x78, 0x3c, 0x8b, 0xd8, 0x1e, 0x77, 0x8d,
+  0x3d, 0x71, 0x97, 0x17, 0x04, 0xfa, 0xc4, 0xa9, 0xec, 0xc7, 0xbd, 0xc6, 0xf1, 0x1f, 0xdf, 0xea,
+  0x7d, 0xca, 0xee, 0x60, 0xb8, 0x7d, 0xf2, 0xc7, 0x96, 0x85, 0x29, 0xdb, 0xd4, 0xe3, 0x6b, 0xdb,
+  0x33, 0xbb, 0x87, 0xce, 0x2e, 0xf4, 0x4e, 0xdf, 0x91, 0x76, 0x0d, 0x99, 0xea, 0x5e, 0x69, 0xa9,
+  0x6c, 0x56, 0x4b, 0x9b, 0xa7, 0x82, 0x7b, 0xc1, 0xf2, 0x84, 0x51, 0x03, 0x62, 0xba, 0xb5, 0x17,
+  0x4e, 0xe7, 0x64, 0x62, 0x5d, 0x72, 0x0a, 0x0f, 0x0e, 0xcc, 0x89, 0x0f, 0x0e, 0x0c, 0x6c, 0x6a,
+  0x21, 0x60, 0x70, 0xae, 0xdf, 0x39, 0xa4, 0x50, 0x63, 0x8b, 0xfc, 0x7c, 0x98, 0x89, 0xd4, 0x1e,
+  0x88, 0x13, 0xe4, 0xe3, 0x8c, 0xe9, 0xd4, 0xb0, 0x2a, 0x01, 0xe7, 0x49, 0xcb, 0xf8, 0x0f, 0xc8,
+  0x71, 0xdb, 0xdf, 0x6e, 0x80, 0x8e, 0x6d, 0x87, 0x7c, 0xbb, 0xe1, 0x13, 0xf1, 0x27, 0x44, 0xb5,
+  0x75, 0xff, 0xd8, 0x6e, 0xb5, 0x93, 0x59, 0xaf, 0x7c, 0x9a, 0x69, 0xb7, 0x61, 0x39, 0xf2, 0xb7,
+  0xd7, 0x30, 0xe3, 0x55, 0xbc, 0x86, 0xb5, 0x3d, 0x38, 0xf8, 0x46, 0x36, 0x2a, 0xf3, 0xba, 0xca,
+  0x12, 0x46, 0x97, 0xdf, 0xd3, 0x20, 0xcc, 0xb5, 0x91, 0xa5, 0xe3, 0x88, 0xdd, 0x10, 0x03, 0xae,
+  0xed, 0x1c, 0x31, 0x7c, 0x4b, 0x5f, 0x2e, 0xfe, 0x02, 0x1d, 0x05, 0xc1, 0xb2, 0xb4, 0x17, 0x47,
+  0x4b, 0x08, 0x34, 0x68, 0xc5, 0x0c, 0x3c, 0xa4, 0xe5, 0xe5, 0x34, 0xcf, 0xac, 0x07, 0x64, 0xd1,
+  0x1e, 0xe4, 0x2c, 0x41, 0xd6, 0x76, 0x3a, 0x8e, 0xfb, 0x5b, 0xff, 0x77, 0xd7, 0xdd, 0x0a, 0x70,
+  0x96, 0x24, 0x71, 0x32, 0xe6, 0xfe, 0x15, 0xde, 0xa7, 0x61, 0x9c, 0x02, 0xe1, 0xde, 0x0e, 0x02,
+  0xc7, 0x59, 0xb2, 0x66, 0xa6, 0xbb, 0xb7, 0xb9, 0xee, 0x0c, 0xd1, 0xfb, 0x7a, 0x09, 0xcb, 0xd6,
+  0x49, 0xb4, 0x9d, 0xb1, 0x6c, 0xba, 0x68, 0xe3, 0x4e, 0x97, 0x76, 0xa5, 0xd9, 0x82, 0x45, 0xb0,
+  0xaa, 0xe9, 0x0a, 0xd8, 0x04, 0x9a, 0xd5, 0x53, 0x0f, 0x93, 0xc0, 0xb6, 0x2b, 0xfb, 0xd5, 0xf8,
+  0x5a, 0x9e, 0xb4, 0x0b, 0x77, 0xb7, 0x6e, 0x0f, 0x42, 0x02, 0xcc, 0x22, 0x38, 0x39, 0xe7, 0xf2,
+  0x8b, 0x61, 0x0d, 0xf9, 0x7b, 0xbb, 0xf5, 0x16, 0x3f, 0x08, 0x27, 0x04, 0xa2, 0x1a, 0x51, 0x80,
+  0xa3, 0x56, 0x87, 0x0f, 0x40, 0xf8, 0x59, 0x10, 0x51, 0x88, 0xd4, 0x22, 0xca, 0xec, 0xe1, 0xcc,
+  0x0c, 0x2a, 0xa2, 0xff, 0xb5, 0x51, 0x0d, 0xb7, 0x0d, 0x1d, 0xfe, 0x3b, 0x9b, 0xa4, 0x00, 0x33,
+  0xeb, 0xf8, 0x7a, 0x38, 0x73, 0xd4, 0x3d, 0xac, 0xf9, 0xe0, 0xc0, 0x04, 0xfc, 0x3f, 0xb2, 0x6d,
+  0x93, 0x84, 0x87, 0x98, 0x76, 0xbe, 0xd6, 0x78, 0xc7, 0x01, 0x33, 0xa2, 0xd7, 0x0b, 0xac, 0xea,
+  0xd2, 0xb6, 0xcc, 0x92, 0x2e, 0xfc, 0x8e, 0x98, 0x0a, 0xdc, 0x3a, 0x84, 0x10, 0x9a, 0xd0, 0x65,
+  0x3a, 0x76, 0x1c, 0x94, 0x92, 0x1e, 0x31, 0x1e, 0x8f, 0x1d, 0xb9, 0x45, 0xea, 0xb8, 0x6a, 0x88,
+  0x6c, 0x18, 0x3b, 0x87, 0x1c, 0xde, 0xc3, 0xd0, 0x40, 0x8a, 0x50, 0x3a, 0x17, 0x50, 0x50, 0x2a,
+  0x8d, 0xd8, 0x0d, 0xa5, 0x22, 0xbf, 0x86, 0x92, 0x49, 0xc3, 0x4e, 0xa8, 0xbc, 0x94, 0xcc, 0x01,
+  0xf3, 0xb6, 0xdd, 0xb0, 0xb9, 0x26, 0x2b, 0x48, 0xd5, 0xb2, 0x1b, 0xce, 0x54, 0x65, 0x05, 0x99,
+  0xb7, 0xed, 0xa1, 0x37, 0x57, 0x67, 0x4d, 0xae, 0x6a, 0xda, 0x0d, 0xc9, 0x2f, 0xef, 0x5d, 0x41,
+  0x76, 0x96, 0x43, 0xea, 0x26, 0x1b, 0x52, 0x78, 0x31, 0xa9, 0x6c, 0x94, 0x9f, 0x4a, 0x30, 0x5f,
+  0xd6, 0x1f, 0xb5, 0x06, 0xa3, 0xe7, 0x52, 0x5a, 0x1a, 0x83, 0x14, 0xd1, 0xc3, 0x08, 0xd2, 0x0a,
+  0x68, 0x84, 0xa6, 0x7a, 0xca, 0x51, 0x02, 0xf0, 0x4b, 0xe7, 0x50, 0x90, 0x55, 0xf2, 0x95, 0x18,
+  0x4f, 0xbe, 0xd1, 0x0e, 0x33, 0xfe, 0xe8, 0x6e, 0xb2, 0x45, 0x12, 0xdf, 0x10, 0x1e, 0x28, 0xb8,
+  0xb7, 0x73, 0xae, 0xb0, 0x96, 0x49, 0x24, 0xe1, 0x58, 0x89, 0x64, 0x34, 0xc3, 0xe2, 0xd9, 0x39,
+  0xd4, 0x70, 0xa2, 0xc9, 0xdd, 0x8a, 0x31, 0x44, 0xb7, 0xff, 0x99, 0x62, 0xf1, 0xb1, 0x55, 0x1e,
+  0x18, 0x42, 0x86, 0x98, 0x51, 0x04, 0x0f, 0x0e, 0x84, 0xd2, 0x93, 0xb5, 0x8d, 0xe3, 0x6e, 0x6a,
+  0xca, 0x97, 0xad, 0x12, 0x7a, 0x01, 0x90, 0xbb, 0x5b, 0x00, 0xab, 0x14, 0xc0, 0xd8, 0x12, 0x92,
+  0x4e, 0x08, 0x79, 0x9d, 0xbd, 0xcf, 0xb3, 0x69, 0x81, 0x1f, 0xe6, 0x8f, 0x90, 0xb1, 0x4f, 0xc3,
+  0xb5, 0x0f, 0x86, 0xea, 0x48, 0x25, 0x79, 0xe9, 0xc8, 0xed, 0x21, 0x67, 0xa4, 0x9a, 0x64, 0xca,
+  0x68, 0x4e, 0xe2, 0x6e, 0xec, 0x77, 0x1e, 0x96, 0xe4, 0xb7, 0xc6, 0x6c, 0x1a, 0xb7, 0x34, 0x64,
+  0x09, 0xc4, 0x53, 0x11, 0x5f, 0xa0, 0x88, 0xc1, 0xe8, 0x22, 0xe7, 0x47, 0x79, 0x0b, 0xf6, 0x65,
+  0x74, 0x86, 0xe4, 0xfb, 0x97, 0xe8, 0x63, 0x14, 0xdf, 0x44, 0x44, 0x8a, 0xc1, 0xdd, 0xee, 0x09,
+  0x5c, 0xd5, 0x88, 0x1d, 0x19, 0xb5, 0xbc, 0xff, 0x67, 0x52, 0x14, 0xb9, 0x05, 0xee, 0xe2, 0x60,
+  0x39, 0xa8, 0xd8, 0xed, 0x91, 0xf7, 0x21, 0x5e, 0x78, 0x23, 0x59, 0x72, 0x47, 0xe8, 0x9c, 0x06,
+  0x51, 0xcf, 0xb1, 0x43, 0x30, 0x0c, 0x7c, 0xa5, 0x1d, 0xfa, 0xbb, 0xd8, 0x67, 0x6d, 0x16, 0xd1,
+  0x09, 0xcf, 0xa3, 0x0c, 0x93, 0xb2, 0x87, 0xbc, 0x94, 0x43, 0xc0, 0xd6, 0xd5, 0xe0, 0xda, 0xac,
+  0x44, 0x18, 0xc5, 0xe7, 0xdb, 0x44, 0x71, 0xb1, 0xab, 0xd6, 0x5a, 0x2f, 0x6e, 0x2d, 0x83, 0x97,
+  0xf4, 0x8e, 0x25, 0x6d, 0x19, 0x70, 0x2c, 0xfe, 0xe0, 0xf1, 0xe5, 0xc4, 0x1e, 0xa7, 0x5c, 0xd9,
+  0xdf, 0x9b, 0xb9, 0x37, 0xaa, 0x34, 0xa3, 0x21, 0x2f, 0xce, 0x2a, 0xd7, 0xaf, 0x38, 0xe8, 0x6b,
+  0x5b, 0xc1, 0x77, 0x31, 0x3e, 0x5d, 0x2d, 0xe3, 0x38, 0xc3, 0x24, 0xb4, 0x92, 0xc7, 0xc2, 0x98,
+  0xaf, 0x8d, 0x45, 0xbe, 0x2e, 0xdc, 0x00, 0x97, 0xf0, 0xcb, 0xe2, 0x4c, 0x77, 0xbd, 0xc4, 0x2e,
+  0x60, 0x88, 0x8f, 0xf8, 0xfb, 0x72, 0x23, 0xd2, 0x7a, 0xb1, 0x1e, 0xef, 0x31, 0x12, 0xb7, 0x79,
+  0x3c, 0xee, 0x94, 0xed, 0xae, 0xb0, 0x66, 0x7c, 0xf0, 0x4b, 0x3e, 0x78, 0x2c, 0x83, 0xf8, 0xa1,
+  0x73, 0x70, 0x6d, 0x66, 0x24, 0x7f, 0xef, 0x45, 0x14, 0x17, 0x2f, 0xae, 0x56, 0x8c, 0xf9, 0x15,
+  0x5e, 0xc6, 0xe8, 0x7d, 0xf9, 0xd5, 0x31, 0x75, 0x81, 0xc1, 0x07, 0x2f, 0x1a, 0xd4, 0x32, 0xa6,
+  0x47, 0x7c, 0x4d, 0xcc, 0x7d, 0xd0, 0x37, 0xd5, 0xb0, 0x68, 0xad, 0x0d, 0x0d, 0xf9, 0x85, 0xb6,
+  0x77, 0xe9, 0xd7, 0xc1, 0xd8, 0x7b, 0xca, 0xbf, 0xa7, 0x52, 0xcb, 0xd1, 0x4a, 0xf4, 0x7f, 0x05,
+  0xcc, 0xd0, 0xd5, 0x2a, 0xbc, 0x7b, 0xbd, 0x4e, 0xb3, 0x78, 0xa9, 0x98, 0x52, 0xd5, 0x30, 0xb4,
+  0xad, 0xd2, 0xf1, 0x6f, 0xfd, 0xce, 0xe0, 0xf8, 0x19, 0x7e, 0xdb, 0xf5, 0xf7, 0xde, 0x92, 0xae,
+  0xda, 0x6d, 0xb5, 0x6b, 0xd8, 0x09, 0xdc, 0xf1, 0xb9, 0x7a, 0x39, 0x84, 0x8c, 0xeb, 0xb0, 0xb6,
+  0x48, 0x97, 0xe2, 0xb8, 0x02, 0x84, 0xce, 0x61, 0xe0, 0x8a, 0x74, 0xb0, 0x97, 0xae, 0x27, 0x78,
+  0xf5, 0x0c, 0x22, 0xce, 0x00, 0x24, 0xf0, 0x67, 0x1c, 0x44, 0x7c, 0xff, 0xc7, 0xac, 0x36, 0x24,
+  0x49, 0x2f, 0x05, 0x29, 0xce, 0x21, 0xff, 0xfc, 0x1c, 0x69, 0x7e, 0x63, 0x4a, 0xb3, 0x58, 0x9f,
+  0x98, 0x39, 0xb1, 0xeb, 0xed, 0xe3, 0xc6, 0x91, 0x7c, 0x8c, 0x9d, 0x33, 0xc7, 0xab, 0x5b, 0x97,
+  0x26, 0x59, 0xb4, 0x91, 0x36, 0x8b, 0x74, 0x53, 0x72, 0x4d, 0x6e, 0x68, 0x8a, 0xa7, 0x22, 0xe2,
+  0xd8, 0x06, 0xb3, 0x76, 0x3e, 0x4c, 0x53, 0x68, 0xa5, 0x9a, 0x78, 0xd7, 0x30, 0x5f, 0x40, 0x25,
+  0xc2, 0xb9, 0x16, 0xa1, 0xde, 0xdb, 0x02, 0x71, 0x55, 0xca, 0xa9, 0x31, 0xbb, 0x5c, 0x4a, 0xb2,
+  0xd1, 0x53, 0xd2, 0x9d, 0x72, 0x0d, 0xea, 0x85, 0x2c, 0x9a, 0x67, 0x0b, 0x50, 0xd9, 0x13, 0x48,
+  0xb2, 0x8d, 0xf6, 0x59, 0x9c, 0xbc, 0xa5, 0x40, 0x51, 0x1b, 0x17, 0x90, 0x2b, 0xce, 0xe6, 0x7e,
+  0xca, 0x32, 0x76, 0x1e, 0x8b, 0xd5, 0x17, 0xdf, 0xbe, 0xec, 0x65, 0xf1, 0x25, 0x5e, 0x74, 0x7a,
+  0x4d, 0x71, 0x43, 0x70, 0x6b, 0xea, 0x7f, 0xb5, 0xee, 0x13, 0x79, 0x17, 0x93, 0x48, 0xec, 0x28,
+  0x73, 0xdb, 0xa8, 0x41, 0xc6, 0xea, 0xaa, 0xa0, 0x3a, 0x2f, 0xcb, 0x2d, 0x41, 0x36, 0x8c, 0x37,
+  0xba, 0x14, 0x1f, 0xed, 0x38, 0x9c, 0xd1, 0x05, 0xbc, 0xa0, 0xbd, 0x03, 0xfe, 0x2d, 0x08, 0x2f,
+  0xb9, 0x68, 0xea, 0xc1, 0x8c, 0x41, 0x1a, 0x50, 0x9c, 0x7f, 0x5f, 0x2d, 0x82, 0x59, 0x56, 0x0f,
+  0x68, 0x0c, 0xd2, 0x80, 0xca, 0x2c, 0x75, 0xf0, 0xaf, 0x07, 0x2f, 0x0d, 0xd5, 0x48, 0xae, 0x59,
+  0x18, 0xe3, 0x05, 0xec, 0x06, 0x48, 0x4a, 0x43, 0x73, 0x4a, 0x12, 0xe6, 0x07, 0x5c, 0xc4, 0xdf,
+  0xd3, 0x69, 0x06, 0xca, 0x5e, 0x4f, 0x48, 0x61, 0x64, 0x89, 0x99, 0xf7, 0x3f, 0x40, 0x89, 0xb5,
+  0x9f, 0x11, 0x3e, 0xac, 0x04, 0x7c, 0xd1, 0x0c, 0xf8, 0xc2, 0x02, 0x9e, 0x58, 0x95, 0x59, 0x3d,
+  0xb4, 0x3d, 0x0e, 0xc0, 0xe5, 0xe1, 0x4d, 0xc7, 0x3e, 0xda, 0x19, 0x35, 0x3e, 0x2d, 0xd2, 0x08,
+  0x96, 0x71, 0xc3, 0x65, 0x2c, 0x0c, 0xcc, 0x51, 0x6c, 0xd5, 0x6e, 0x64, 0xec, 0xdf, 0xf1, 0x4d,
+  0xfb, 0x5f, 0x7e, 0xbe, 0xbc, 0x62, 0x34, 0x99, 0x2e, 0x78, 0x42, 0x98, 0xb6, 0x0d, 0x9d, 0x56,
+  0x7a, 0xde, 0xd3, 0x4d, 0x96, 0xee, 0xea, 0x6e, 0xa3, 0xd1, 0xd2, 0x51, 0x3d, 0xc0, 0x68, 0x2c,
+  0xeb, 0xa2, 0x54, 0x04, 0x3d, 0xb8, 0x34, 0xe0, 0x08, 0x8f, 0xfa, 0x4a, 0x2a, 0x55, 0x04, 0x2b,
+  0x0d, 0xe0, 0x60, 0x25, 0x7d, 0xcb, 0xa7, 0x29, 0xf4, 0x88, 0xe1, 0x96, 0x6e, 0x95, 0x48, 0xe2,
+  0xcd, 0xd6, 0xc0, 0x8b, 0xea, 0x81, 0x17, 0x7a, 0x60, 0x41, 0x67, 0xf4, 0x48, 0xbb, 0x3d, 0xd7,
+  0x0c, 0x59, 0x34, 0xe6, 0x03, 0x6d, 0x5d, 0x28, 0x69, 0x80, 0x1e, 0x57, 0xe8, 0xd8, 0x5a, 0x81,
+  0x93, 0xa7, 0x21, 0x4e, 0x67, 0xb3, 0x64, 0xd9, 0x22, 0xf6, 0x47, 0xce, 0xfb, 0x9f, 0xae, 0x3e,
+  0x38, 0x1d, 0xd4, 0x81, 0x11, 0xfe, 0xda, 0xee, 0x8b, 0x06, 0x0f, 0x8e, 0x9a, 0x35, 0x81, 0x50,
+  0x85, 0x36, 0xbc, 0xda, 0xa0, 0x2e, 0x67, 0x6b, 0xb7, 0x5a, 0x75, 0x2f, 0xc1, 0x71, 0x1f, 0xb2,
+  0x03, 0x95, 0x96, 0x62, 0xa9, 0xbe, 0xfb, 0x00, 0xd1, 0x82, 0xdd, 0x2b, 0x9a, 0x56, 0x44, 0x03,
+  0x43, 0xc0, 0xbc, 0xe9, 0xe1, 0x41, 0xb5, 0x14, 0x24, 0x44, 0x58, 0x5d, 0xc6, 0xc8, 0xcd, 0xa5,
+  0xea, 0xfc, 0xf4, 0xe9, 0xb4, 0xef, 0xed, 0xc7, 0x21, 0xb7, 0xba, 0xac, 0x7d, 0xac, 0xfb, 0xa3,
+  0xab, 0x08, 0x40, 0x02, 0x8b, 0xd1, 0xf1, 0xe9, 0x53, 0x33, 0x04, 0xb5, 0x14, 0x35, 0xc5, 0x55,
+  0x11, 0xd4, 0x04, 0x02, 0xa3, 0xa3, 0x29, 0x82, 0x5a, 0x62, 0x9a, 0xe2, 0xaa, 0x0d, 0x91, 0xe2,
+  0x72, 0x02, 0x37, 0xea, 0xb6, 0xb0, 0x83, 0x1a, 0x67, 0x07, 0xe8, 0x7b, 0xc7, 0xe2, 0x32, 0xc2,
+  0x3d, 0xa6, 0xa9, 0x22, 0xfc, 0x8b, 0xce, 0x58, 0x1b, 0xb6, 0xcb, 0xd3, 0xd4, 0xb8, 0x63, 0x9c,
+  0x66, 0x70, 0xef, 0x69, 0x1a, 0x31, 0xf6, 0x39, 0x33, 0xd6, 0xe5, 0x12, 0x15, 0xe2, 0x2b, 0x8c,
+  0x44, 0xf4, 0xc3, 0xfb, 0xa2, 0x6f, 0xb6, 0x50, 0x0f, 0x9a, 0xa9, 0x2a, 0xa9, 0xa9, 0x57, 0x02,
+  0x3e, 0xac, 0x99, 0x84, 0x4c, 0x88, 0x7b, 0x29, 0xda, 0xfd, 0xe7, 0xb8, 0x68, 0x46, 0xfc, 0x85,
+  0x42, 0xdc, 0xbf, 0x1f, 0xe6, 0x7b, 0x51, 0x5f, 0x9e, 0x04, 0x43, 0x5d, 0xd3, 0xc4, 0xce, 0xbd,
+  0x77, 0x0a, 0x28, 0x3c, 0x8d, 0xdd, 0xfb, 0xe9, 0xd3, 0x8c, 0x86, 0x29, 0x6b, 0x38, 0x33, 0xdf,
+  0x2e, 0x6f, 0x36, 0xb5, 0x1c, 0x6a, 0xfa, 0xcb, 0x42, 0x27, 0xfa, 0xb9, 0x5d, 0xd3, 0x16, 0x13,
+  0x51, 0xf7, 0xde, 0x29, 0xab, 0x98, 0xb6, 0x70, 0xa7, 0x49, 0xec, 0x11, 0x37, 0xe1, 0xbb, 0x94,
+  0xc7, 0xba, 0xf7, 0x4f, 0x79, 0x55, 0xf0, 0xb3, 0xba, 0x0b, 0x34, 0x40, 0x08, 0x5f, 0xaf, 0x74,
+  0x88, 0x17, 0x5f, 0x03, 0x30, 0xeb, 0xf5, 0x3d, 0x65, 0x64, 0x29, 0x87, 0x29, 0x17, 0x94, 0x95,
+  0x13, 0xa8, 0x82, 0x52, 0xbc, 0xe7, 0xc7, 0x5d, 0xff, 0x5e, 0xb3, 0xe4, 0xee, 0x8a, 0x85, 0x0c,
+  0x3d, 0x03, 0x24, 0x49, 0x6d, 0xe7, 0x71, 0x9e, 0x83, 0x3f, 0x2e, 0xf9, 0xf8, 0xce, 0xe3, 0x92,
+  0x77, 0x84, 0x51, 0x05, 0x07, 0x93, 0xc3, 0x71, 0x93, 0xcd, 0x5f, 0xa5, 0x3d, 0x7a, 0x92, 0x0a,
+  0x5d, 0x9d, 0x8b, 0x77, 0x99, 0x69, 0x65, 0xe2, 0x22, 0xb8, 0x3c, 0x50, 0xab, 0x3f, 0x98, 0xe3,
+  0x30, 0xbd, 0xc0, 0x3f, 0x54, 0x27, 0x6e, 0x12, 0x6d, 0x2f, 0x8e, 0xf8, 0x75, 0xf3, 0xb1, 0x92,
+  0x08, 0x30, 0x6f, 0x62, 0xb4, 0xcc, 0x15, 0xbf, 0x43, 0x24, 0xb4, 0x76, 0x6b, 0xe5, 0x61, 0xd4,
+  0xf7, 0x85, 0x50, 0x50, 0x84, 0x90, 0xb7, 0x19, 0x15, 0xb9, 0x68, 0xad, 0x91, 0x60, 0xdb, 0xe1,
+  0x73, 0xff, 0xc6, 0xff, 0xdc, 0x65, 0x2b, 0x35, 0x51, 0xb4, 0x7e, 0x57, 0x5f, 0x6d, 0x15, 0xd7,
+  0x45, 0x54, 0xa7, 0xbb, 0xc1, 0xc9, 0xf8, 0x24, 0xaa, 0x49, 0xde, 0xd3, 0x10, 0x17, 0xe3, 0xd4,
+  0xde, 0x8c, 0x38, 0xf2, 0x13, 0x43, 0x08, 0x85, 0x95, 0xc4, 0x13, 0x41, 0xf1, 0x77, 0x33, 0xc9,
+  0x2c, 0x48, 0xf0, 0x66, 0x83, 0x79, 0x33, 0x43, 0xdc, 0xff, 0xfc, 0x82, 0x4c, 0xfc, 0x08, 0x0e,
+  0xa4, 0x9e, 0x07, 0x39, 0xdd, 0xbd, 0xd9, 0x88, 0x00, 0x2b, 0x9e, 0x6f, 0x0a, 0x78, 0xce, 0x82,
+  0x26, 0x0a, 0xe4, 0xc2, 0x2f, 0x7a, 0xe1, 0x7d, 0x56, 0x16, 0x31, 0xa0, 0xeb, 0xcd, 0x4f, 0xef,
+  0xe4, 0xca, 0x5d, 0x82, 0x3d, 0x00, 0x15, 0x1d, 0x63, 0x91, 0x8b, 0xf7, 0xcc, 0x76, 0x9a, 0xbb,
+  0x91, 0x07, 0xbb, 0x9b, 0xea, 0xac, 0x7b, 0xbb, 0x0b, 0x5e, 0x6f, 0x4e, 0x09, 0x68, 0xbd, 0x03,
+  0xb6, 0x13, 0xc8, 0xdc, 0x6f, 0x46, 0xc8, 0x2f, 0x97, 0xd6, 0xdb, 0x98, 0x0b, 0x49, 0xb4, 0xee,
+  0xf1, 0x1a, 0xc1, 0xef, 0xca, 0xa1, 0xf5, 0xa0, 0xc6, 0x0e, 0xab, 0xe0, 0xa7, 0xea, 0x17, 0xc4,
+  0xfa, 0xce, 0x32, 0x4c, 0x2f, 0xee, 0x25, 0xc9, 0x13, 0xf3, 0xb1, 0x83, 0x5f, 0x7e, 0x70, 0xb6,
+  0x2e, 0x7e, 0x29, 0x5a, 0x5e, 0x18, 0xcf, 0xaf, 0x8e, 0xcb, 0x7b, 0x79, 0x71, 0x84, 0x48, 0x4c,
+  0xbb, 0xc7, 0x77, 0xf9, 0x85, 0x83, 0x7c, 0x5d, 0xbd, 0xc6, 0xae, 0x50, 0xfe, 0x59, 0xb8, 0x2f,
+  0xee, 0xb1, 0xf2, 0xc7, 0x86, 0x57, 0x09, 0x3e, 0xcb, 0xb3, 0xa1, 0x1d, 0xfc, 0x96, 0x5f, 0x46,
+  0xea, 0x98, 0xf7, 0x8b, 0x3a, 0xc6, 0x85, 0xa1, 0xdf, 0x73, 0x62, 0x38, 0x70, 0xe0, 0xbb, 0xca,
+  0xa8, 0xec, 0xcb, 0x7c, 0xdb, 0xad, 0x22, 0xa8, 0x6c, 0xa1, 0x53, 0x7e, 0x11, 0xcc, 0xb2, 0xcb,
+  0xe2, 0x1d, 0x31, 0x89, 0xbc, 0x93, 0x53, 0x88, 0x35, 0xb0, 0x5a, 0x16, 0x79, 0x03, 0xec, 0x82,
+  0x33, 0x5a, 0xab, 0x2d, 0xfa, 0xe2, 0x98, 0x67, 0x8e, 0xaf, 0x12, 0x90, 0xba, 0x81, 0x8d, 0x95,
+  0xdf, 0x45, 0xf4, 0x8e, 0x65, 0xb8, 0xe6, 0xf9, 0x8d, 0x49, 0x83, 0x88, 0xa3, 0xb3, 0x3e, 0x28,
+  0x7d, 0xfc, 0x3d, 0xfe, 0x75, 0xad, 0xf6, 0x60, 0x47, 0x12, 0x98, 0x7f, 0x3d, 0xb7, 0x60, 0x25,
+  0xf6, 0x2c, 0x5e, 0xa5, 0xec, 0x6c, 0x82, 0x1f, 0x24, 0x40, 0xcd, 0xbd, 0x2d, 0xc2, 0x5d, 0x59,
+  0xab, 0xfe, 0x6e, 0x2e, 0x50, 0xdc, 0x68, 0xce, 0xf2, 0xc9, 0x52, 0x8e, 0x63, 0xec, 0x1c, 0x1a,
+  0x13, 0xff, 0xc7, 0x8f, 0x98, 0xcc, 0xf0, 0xf1, 0xc5, 0xae, 0x15, 0xdd, 0xe7, 0x56, 0xd1, 0x4e,
+  0xd9, 0xe6, 0x5f, 0x97, 0xaa, 0x16, 0x2d, 0x7e, 0xd5, 0xdd, 0x92, 0xac, 0xa5, 0xe6, 0x0d, 0x34,
+  0x5c, 0x1a, 0xb1, 0xfd, 0x85, 0x89, 0xfd, 0xdf, 0x93, 0xb0, 0xc1, 0xe4, 0x55, 0xc7, 0xfd, 0x5f,
+  0x8b, 0xb0, 0xc0, 0x8c, 0x8b, 0x8e, 0xf5, 0x45, 0x80, 0x71, 0x41, 0xd2, 0x02, 0xd6, 0x77, 0x1d,
+  0x1b, 0xdc, 0xf4, 0xb5, 0x00, 0x8d, 0xab, 0x8e, 0x8d, 0x6e, 0xfb, 0xda, 0x24, 0xeb, 0xcb, 0x8e,
+  0x4d, 0x6e, 0xfc, 0x56, 0x5c, 0x33, 0xcc, 0x6f, 0xa0, 0xca, 0xa7, 0x43, 0xe7, 0x20, 0xbf, 0x5f,
+  0x2a, 0x9f, 0xb0, 0x4d, 0xdf, 0x1e, 0x95, 0x4f, 0xd0, 0x66, 0x5d, 0x0c, 0xcd, 0x5f, 0xa0, 0xc7,
+  0xb8, 0xf8, 0xa9, 0x1e, 0xa1, 0xd5, 0xba, 0xd4, 0x99, 0xbf, 0x20, 0x26, 0xe3, 0xce, 0xa6, 0x7e,
+  0xfe, 0xdf, 0x3f, 0xcd, 0xad, 0xbe, 0x35, 0x5e, 0xdc, 0xfa, 0xcc, 0xef, 0x8c, 0xc3, 0x8f, 0x67,
+  0x6f, 0x66, 0x96, 0xa2, 0x6f, 0x7d, 0xd2, 0xb3, 0x87, 0x2d, 0x7d, 0x16, 0xb6, 0x23, 0x0d, 0x2a,
+  0x18, 0xcd, 0x58, 0xef, 0x59, 0xcb, 0x8e, 0x07, 0xf8, 0xf4, 0x76, 0x11, 0x47, 0xe3, 0x30, 0x61,
+  0x7b, 0xdd, 0x02, 0x41, 0x46, 0xa7, 0xd7, 0xd4, 0x98, 0x73, 0x68, 0xd9, 0x81, 0x09, 0xeb, 0x5e,
+  0xe8, 0xaa, 0x74, 0xee, 0x9e, 0x88, 0x6c, 0xe7, 0x60, 0x40, 0x8b, 0x8e, 0x46, 0xd0, 0xbb, 0xc9,
+  0x68, 0x82, 0xa8, 0xec, 0x69, 0x72, 0x04, 0x79, 0x5f, 0x13, 0xf8, 0x9d, 0xb4, 0x34, 0x41, 0x55,
+  0xf4, 0x5c, 0x39, 0xb4, 0xea, 0xd9, 0x0f, 0xab, 0xd2, 0xbc, 0x1a, 0x32, 0xf6, 0x23, 0x2a, 0xfb,
+  0xc0, 0x1c, 0x3a, 0xef, 0x6b, 0x02, 0xbf, 0x87, 0x94, 0x26, 0xc8, 0x4a, 0x4e, 0xd5, 0x10, 0xa8,
+  0xea, 0x6a, 0x00, 0xbd, 0x87, 0x92, 0x1c, 0x55, 0x55, 0x6e, 0xe5, 0x7d, 0x6e, 0x71, 0xd1, 0xe4,
+  0xdc, 0xa7, 0xaa, 0xae, 0x11, 0x07, 0x3f, 0x9f, 0x3b, 0xfb, 0xd6, 0xaa, 0x6d, 0x8e, 0xe4, 0xdf,
+  0x7a, 0xe2, 0xff, 0x07, 0x1c, 0xe7, 0xff, 0x03, 0xed, 0x29, 0xf0, 0xa7, 0xf3, 0x63, 0x00, 0x00,
+};
+const size_t page_basic_gz_len = 5792;
+
+// GET /advanced
+const uint8_t page_advanced_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3d, 0xdb, 0x72, 0xdb, 0x46,
+  0x96, 0xef, 0xfe, 0x8a, 0x0e, 0x1d, 0x0b, 0xc4, 0x88, 0xa4, 0x40, 0x4a, 0x94, 0x6d, 0xd2, 0x94,
+  0x27, 0xb1, 0x9d, 0x59, 0x55, 0xc9, 0x89, 0x2a, 0x52, 0x52, 0x3b, 0x95, 0x4a, 0x55, 0x40, 0xa0,
+  0x49, 0x22, 0x06, 0x01, 0x0e, 0x00, 0xea, 0x12, 0x9a, 0x0f, 0xfb, 0x03, 0xf3, 0x30, 0xb5, 0xef,
+  0xfb, 0xb6, 0x5b, 0xb5, 0x2f, 0xfb, 0x07, 0xfb, 0x4d, 0xfb, 0x09, 0x7b, 0x4e, 0xdf, 0xd0, 0x8d,
+  0x0b, 0x2f, 0x92, 0x67, 0x27, 0x5e, 0x6b, 0x22, 0x12, 0xdd, 0xe7, 0x9c, 0x3e, 0xf7, 0x3e, 0x7d,
+  0x81, 0xe6, 0xd5, 0x17, 0x6f, 0xbf, 0x7b, 0x73, 0xfd, 0xe7, 0xcb, 0x77, 0x64, 0x96, 0xcd, 0xc3,
+  0xb3, 0x27, 0xaf, 0xf0, 0x83, 0x84, 0x6e, 0x34, 0x1d, 0x35, 0x68, 0xd4, 0xc0, 0x06, 0xea, 0xfa,
+  0xf0, 0x31, 0xa7, 0x99, 0x4b, 0xbc, 0x99, 0x9b, 0xa4, 0x34, 0x1b, 0x35, 0x7e, 0xb8, 0xfe, 0xa6,
+  0xfd, 0xa2, 0x21, 0x9b, 0x67, 0x59, 0xb6, 0x68, 0xd3, 0xbf, 0x2c, 0x83, 0x9b, 0x51, 0xe3, 0x4d,
+  0x1c, 0x65, 0x34, 0xca, 0xda, 0xd7, 0xf7, 0x0b, 0xda, 0x20, 0x1e, 0x7f, 0x1a, 0x35, 0x32, 0x7a,
+  0x97, 0x1d, 0x21, 0xed, 0xa1, 0x22, 0xb2, 0xcc, 0x26, 0x9c, 0x46, 0x16, 0x64, 0x21, 0x3d, 0xfb,
+  0x6a, 0x3e, 0x0e, 0xae, 0x68, 0x94, 0x52, 0xf2, 0x91, 0x5c, 0x53, 0x6f, 0x76, 0x19, 0xa7, 0x59,
+  0x4a, 0xde, 0x53, 0x3f, 0x70, 0x5f, 0x1d, 0x71, 0x10, 0x31, 0x5c, 0xe4, 0xce, 0xe9, 0xc8, 0xba,
+  0x09, 0xe8, 0xed, 0x22, 0x4e, 0x32, 0x4b, 0x0d, 0x62, 0xdd, 0x06, 0x7e, 0x36, 0x1b, 0xf9, 0xf4,
+  0x26, 0xf0, 0x68, 0x9b, 0x3d, 0xb4, 0x48, 0x10, 0x05, 0x59, 0xe0, 0x86, 0xed, 0xd4, 0x73, 0x43,
+  0x3a, 0xea, 0x5a, 0x40, 0x24, 0xcd, 0xee, 0x91, 0xd8, 0x20, 0x89, 0xe3, 0x6c, 0xd5, 0x6e, 0x2f,
+  0x92, 0x60, 0xee, 0x26, 0xf7, 0x83, 0xa7, 0x27, 0xc7, 0xa7, 0x5d, 0x4a, 0x87, 0xaa, 0xa5, 0x1d,
+  0x06, 0xd3, 0x59, 0x06, 0xed, 0x2f, 0x5e, 0xf6, 0xe9, 0x04, 0xda, 0xd3, 0xa5, 0xe7, 0xd1, 0x34,
+  0x85, 0x16, 0xcf, 0x7b, 0x39, 0x71, 0xa0, 0x65, 0x3c, 0x6d, 0xfb, 0x6e, 0xf2, 0x61, 0xf0, 0xb4,
+  0xdb, 0xc3, 0x1f, 0xde, 0xe2, 0xb9, 0x89, 0x0f, 0x2d, 0x14, 0x7f, 0xa0, 0x05, 0x45, 0x1f, 0x3c,
+  0x9d, 0xb0, 0x7f, 0xe2, 0xb1, 0x9d, 0x52, 0x60, 0xda, 0x67, 0xa3, 0x8e, 0x1d, 0xfc, 0x41, 0xcc,
+  0x38, 0xf1, 0x69, 0xd2, 0x4e, 0x5c, 0x3f, 0x58, 0xa6, 0x83, 0x6e, 0x6f, 0x71, 0x87, 0x43, 0xce,
+  0x5c, 0x3f, 0xbe, 0x1d, 0x38, 0xa4, 0xeb, 0x2c, 0xee, 0x48, 0x0f, 0x7f, 0x25, 0xd3, 0xb1, 0xdb,
+  0x74, 0x5a, 0xec, 0xa7, 0x73, 0x6c, 0x23, 0xc9, 0xc4, 0x8d, 0x52, 0x10, 0x33, 0x8e, 0x06, 0x6e,
+  0x18, 0x12, 0x68, 0x4d, 0x09, 0x75, 0x53, 0xba, 0x7e, 0xf2, 0x87, 0x15, 0x08, 0x32, 0x0d, 0xa2,
+  0x81, 0x33, 0x5c, 0xb8, 0xbe, 0x1f, 0x44, 0x53, 0xf8, 0x36, 0x8e, 0xef, 0xda, 0x69, 0xf0, 0x1b,
+  0x3e, 0x88, 0x31, 0xa1, 0x65, 0xfd, 0x64, 0x1c, 0xfb, 0xf7, 0xab, 0x09, 0xe8, 0xb2, 0x3d, 0x71,
+  0xe7, 0x41, 0x78, 0x3f, 0xb0, 0xae, 0xe8, 0x34, 0xa6, 0xe4, 0x87, 0x73, 0xab, 0x75, 0xed, 0xce,
+  0xe2, 0xb9, 0xdb, 0xfa, 0x13, 0x8d, 0xe8, 0x8d, 0xdb, 0xfa, 0x91, 0x26, 0xbe, 0x1b, 0xb9, 0xad,
+  0x14, 0x86, 0x05, 0x51, 0x92, 0x60, 0x32, 0x1c, 0xbb, 0xde, 0x87, 0x69, 0x12, 0x2f, 0x23, 0xbf,
+  0xed, 0xc5, 0x61, 0x9c, 0x0c, 0x6e, 0xdc, 0xa4, 0xa9, 0xf4, 0x63, 0x0f, 0xf5, 0x46, 0xd4, 0x80,
+  0x3d, 0x9c, 0x07, 0x51, 0x7b, 0x46, 0x99, 0x86, 0xbb, 0x8e, 0x73, 0x33, 0x1b, 0xfa, 0x41, 0xba,
+  0x08, 0xdd, 0xfb, 0xc1, 0x24, 0xa4, 0x77, 0x43, 0xfc, 0xd5, 0xf6, 0x83, 0x84, 0x7a, 0x4c, 0x2c,
+  0x40, 0x5f, 0xce, 0xa3, 0xe1, 0xaf, 0xcb, 0x34, 0x0b, 0x26, 0xf7, 0x6d, 0x61, 0xf1, 0x41, 0xba,
+  0x70, 0xc1, 0xd2, 0x63, 0x9a, 0xdd, 0x52, 0x1a, 0x29, 0x09, 0x51, 0x4b, 0x1a, 0x43, 0x83, 0x30,
+  0x88, 0xa8, 0x9b, 0xb4, 0xa7, 0xa8, 0x59, 0xc0, 0x6a, 0x76, 0x8f, 0xfb, 0x3e, 0x9d, 0xb6, 0x84,
+  0xcd, 0x88, 0xf3, 0xac, 0xf5, 0xb4, 0xe7, 0xe2, 0x0f, 0x28, 0xd9, 0x79, 0x66, 0xaf, 0x9f, 0x74,
+  0xe6, 0x2e, 0x30, 0x27, 0x06, 0x59, 0x19, 0x7c, 0x15, 0x39, 0xf0, 0xe0, 0x17, 0x4d, 0x86, 0x2e,
+  0xb8, 0x4a, 0xd4, 0x0e, 0x32, 0x3a, 0x4f, 0x65, 0x13, 0x82, 0x0f, 0xba, 0x40, 0x0c, 0x41, 0x81,
+  0x1e, 0x4d, 0x56, 0x1a, 0x4f, 0x4a, 0x3d, 0xe8, 0x2c, 0xf6, 0xd0, 0xb4, 0xbd, 0xe8, 0xd4, 0xdb,
+  0x6c, 0x6e, 0x35, 0xee, 0x0d, 0xbc, 0x9f, 0x3f, 0xd8, 0x43, 0xe6, 0xe8, 0xa8, 0xc3, 0x67, 0xc3,
+  0xb9, 0x7b, 0xc7, 0xfd, 0x7e, 0x70, 0xc2, 0x94, 0x10, 0xdf, 0xd0, 0x64, 0x12, 0x02, 0xc6, 0x2c,
+  0xf0, 0x7d, 0xd4, 0x50, 0x2c, 0xdc, 0x24, 0xa1, 0xa1, 0x9b, 0x05, 0x37, 0xe0, 0x21, 0x1d, 0x8c,
+  0x6f, 0x93, 0xb7, 0x1a, 0x7d, 0xf1, 0x51, 0x45, 0x6c, 0xd8, 0xa8, 0x36, 0xa3, 0x85, 0x47, 0x8b,
+  0xcd, 0x75, 0x98, 0xdb, 0xa2, 0x2f, 0xdc, 0x76, 0xc8, 0xfc, 0x9e, 0xe9, 0x49, 0x6a, 0xa8, 0xc4,
+  0x4d, 0x91, 0x5f, 0xc5, 0x1d, 0x99, 0x75, 0xb9, 0x67, 0x82, 0xdb, 0xd2, 0x41, 0xef, 0x04, 0xc8,
+  0xb1, 0xc7, 0x5b, 0xee, 0x3f, 0xa7, 0x8e, 0x33, 0xe4, 0x7e, 0x0e, 0x4a, 0xcb, 0xb2, 0x78, 0x3e,
+  0x78, 0x21, 0x07, 0x54, 0xf1, 0x03, 0xe1, 0x44, 0xfa, 0xc5, 0xe8, 0xe9, 0xd9, 0x15, 0x4c, 0xfc,
+  0xd6, 0x0e, 0x22, 0x1f, 0x6c, 0xd7, 0xcb, 0x87, 0x5f, 0xac, 0x62, 0xf0, 0xb4, 0x20, 0xbb, 0x1f,
+  0x38, 0x9d, 0x97, 0xc3, 0x9c, 0x93, 0x2e, 0x72, 0xb2, 0x0b, 0x85, 0xc1, 0x60, 0x4c, 0x27, 0x71,
+  0x42, 0x57, 0xd2, 0x6f, 0x2c, 0x2b, 0xc7, 0x73, 0xc7, 0x29, 0xb8, 0x77, 0x46, 0x87, 0x59, 0xbc,
+  0x18, 0xb4, 0xfb, 0x60, 0xc7, 0x90, 0x4e, 0x32, 0xfe, 0x8d, 0x5b, 0xb3, 0x87, 0xc6, 0x15, 0xc1,
+  0xc2, 0xbe, 0x6b, 0xd6, 0x42, 0x2b, 0x41, 0x7e, 0x53, 0xd6, 0xf2, 0x82, 0xc4, 0x0b, 0x69, 0x8b,
+  0xc9, 0xd9, 0xeb, 0xf7, 0x5b, 0xf2, 0x3f, 0xa7, 0xd3, 0x65, 0x46, 0x2b, 0x77, 0xd8, 0xe4, 0x39,
+  0x9a, 0x4c, 0x72, 0x2d, 0x7d, 0x16, 0x7d, 0x5f, 0x37, 0x23, 0x34, 0x83, 0x08, 0xf3, 0x36, 0x8e,
+  0xbb, 0x58, 0x99, 0xfa, 0xee, 0xf5, 0xaa, 0x14, 0x61, 0x60, 0xc0, 0xa4, 0x32, 0xa6, 0xa1, 0x8a,
+  0xa6, 0x71, 0x18, 0x7b, 0x1f, 0x2a, 0xac, 0x56, 0x50, 0x6e, 0x31, 0x6f, 0xe4, 0x99, 0xd3, 0x36,
+  0x5c, 0xa0, 0xef, 0x38, 0x30, 0x5a, 0x1a, 0x06, 0x18, 0x32, 0x79, 0xc4, 0x19, 0xb1, 0x5b, 0x11,
+  0xa4, 0x53, 0x77, 0x31, 0xe8, 0x72, 0xd9, 0x38, 0xee, 0x8a, 0x87, 0xed, 0x10, 0xe8, 0x8e, 0x3f,
+  0x04, 0xe0, 0xb0, 0x8b, 0x05, 0xc4, 0x82, 0x1b, 0x79, 0x74, 0x10, 0xc5, 0x11, 0x95, 0x46, 0x40,
+  0x4e, 0xcd, 0x98, 0xed, 0x9b, 0x39, 0xe7, 0xe9, 0xf1, 0xf1, 0xf1, 0x30, 0x5e, 0x66, 0x18, 0x4b,
+  0x1c, 0x53, 0x4b, 0xd2, 0x42, 0x1c, 0xd5, 0x60, 0xab, 0xe1, 0x07, 0x03, 0x39, 0xb0, 0x10, 0x25,
+  0x9b, 0x2d, 0xe7, 0xe3, 0x55, 0x1d, 0x37, 0xc5, 0x67, 0x91, 0x0a, 0x90, 0x3b, 0x99, 0x5a, 0x2b,
+  0x38, 0x35, 0xfd, 0xc7, 0x0c, 0xeb, 0xa1, 0xb7, 0x4c, 0x52, 0xd0, 0xf8, 0x22, 0x0e, 0x98, 0x82,
+  0x36, 0x71, 0xad, 0xa7, 0x24, 0x87, 0x88, 0x29, 0x8a, 0xb9, 0xd7, 0xe9, 0xf3, 0xd6, 0xcb, 0xe7,
+  0xad, 0xde, 0xf1, 0x0b, 0xf0, 0xba, 0xbe, 0x21, 0xdd, 0x3c, 0xfe, 0x0d, 0xf8, 0x88, 0xa6, 0x54,
+  0x48, 0xf6, 0x7b, 0xe7, 0x78, 0x86, 0x29, 0xa9, 0xc6, 0x2a, 0x8c, 0x30, 0x3a, 0xf8, 0x80, 0x15,
+  0x17, 0xcd, 0x2e, 0x44, 0x58, 0xee, 0x84, 0x37, 0x6e, 0xb8, 0xa4, 0x2b, 0x9c, 0xe5, 0xb8, 0x8c,
+  0xa7, 0x98, 0x04, 0x65, 0x3c, 0x81, 0x8c, 0x84, 0xcd, 0xf0, 0xbb, 0x24, 0xfe, 0x82, 0x57, 0x95,
+  0x13, 0x69, 0x31, 0x17, 0x6e, 0x89, 0x21, 0x9b, 0x05, 0x38, 0xb4, 0x81, 0x0e, 0x29, 0x96, 0x51,
+  0x2b, 0x8d, 0x43, 0x61, 0x85, 0xe3, 0xd3, 0xdd, 0x98, 0x2b, 0xce, 0x30, 0x9a, 0x82, 0x03, 0xa8,
+  0xe5, 0x32, 0x82, 0x6a, 0x2e, 0xe5, 0x5d, 0xa6, 0x61, 0x68, 0x11, 0xfa, 0x4c, 0x65, 0x36, 0xc1,
+  0x04, 0x28, 0xc2, 0x11, 0x7b, 0xcd, 0x8c, 0x11, 0x44, 0x18, 0x4c, 0x6d, 0x9e, 0x38, 0x64, 0x5e,
+  0xac, 0x9c, 0x58, 0x74, 0x7d, 0x8c, 0xe3, 0xd0, 0x97, 0x69, 0x26, 0x11, 0xd5, 0x86, 0x39, 0x40,
+  0x27, 0x59, 0x71, 0x0d, 0x41, 0x8d, 0xd6, 0x87, 0x7f, 0x46, 0xdf, 0x54, 0xf6, 0xf5, 0xfb, 0xd8,
+  0x6b, 0xf4, 0x8d, 0xf3, 0x3e, 0xec, 0x85, 0xbe, 0x90, 0x62, 0xf9, 0xb3, 0x84, 0xd1, 0x1f, 0x94,
+  0x82, 0x72, 0xf4, 0x20, 0x5a, 0x2c, 0x33, 0x99, 0x8b, 0xa4, 0xd3, 0x30, 0x6f, 0x7d, 0xa8, 0xd7,
+  0xf0, 0x6e, 0x9e, 0x26, 0xca, 0xc5, 0x58, 0xc1, 0x63, 0x4a, 0x2a, 0x05, 0xe6, 0xc6, 0x4b, 0xc8,
+  0xd1, 0x51, 0x21, 0x7f, 0x6b, 0xb5, 0x87, 0xe2, 0xb2, 0xbf, 0x53, 0xf5, 0xb5, 0x57, 0x35, 0xc1,
+  0x19, 0xbe, 0x9d, 0x81, 0xe2, 0x0c, 0x41, 0x76, 0xd0, 0x83, 0x26, 0xd9, 0x69, 0x45, 0xd9, 0xb0,
+  0x4f, 0xf2, 0xd0, 0x9c, 0xf4, 0x58, 0x39, 0x5e, 0x9e, 0x04, 0x96, 0x90, 0x8c, 0x13, 0x0f, 0xca,
+  0x6e, 0x98, 0xbe, 0x33, 0x20, 0xd6, 0xc6, 0xea, 0x94, 0x69, 0x84, 0x59, 0x4c, 0x4b, 0x3c, 0x18,
+  0x0f, 0xdd, 0x7e, 0x55, 0xea, 0x39, 0xb1, 0x95, 0xa6, 0x79, 0xea, 0xd1, 0x92, 0x0c, 0xfb, 0x06,
+  0x13, 0x2b, 0xfd, 0x73, 0xb3, 0x7d, 0xbc, 0xb8, 0x2b, 0x24, 0xb3, 0x17, 0xc6, 0xf2, 0x40, 0xa7,
+  0x79, 0xca, 0x92, 0x12, 0xb0, 0x04, 0xbc, 0x40, 0xb9, 0xee, 0xde, 0x50, 0x7f, 0xa5, 0xa6, 0xea,
+  0x49, 0x70, 0x47, 0x7d, 0x56, 0x78, 0xb0, 0x58, 0x4a, 0x44, 0x89, 0xa1, 0xa5, 0x2a, 0xc6, 0x68,
+  0x6f, 0x37, 0xa3, 0x8a, 0x85, 0x11, 0x2b, 0xa9, 0xf9, 0x6a, 0xaa, 0xd6, 0x80, 0x1b, 0x8d, 0x56,
+  0x21, 0xf4, 0x3f, 0x37, 0x7b, 0x8c, 0x92, 0x66, 0x21, 0x05, 0x95, 0xaf, 0x78, 0x36, 0xe9, 0x59,
+  0x2b, 0xfa, 0x54, 0xa9, 0xe3, 0xf0, 0xb2, 0xc1, 0x50, 0x4e, 0x27, 0x9d, 0xc5, 0xb7, 0xab, 0x4a,
+  0x16, 0x1c, 0x9b, 0x95, 0x34, 0x71, 0x86, 0x86, 0x29, 0xd7, 0xb3, 0xba, 0xc6, 0x9c, 0x92, 0xbb,
+  0x68, 0x9e, 0xd8, 0xdb, 0x52, 0xd9, 0xe4, 0x61, 0xa5, 0xc6, 0x23, 0xb2, 0xe4, 0x1a, 0x1c, 0x23,
+  0x75, 0x74, 0x13, 0xe0, 0x0b, 0xc7, 0x5b, 0x95, 0x7c, 0xba, 0x22, 0xdf, 0x87, 0xb1, 0x8b, 0xb0,
+  0x6d, 0xf4, 0x29, 0x08, 0xdf, 0x55, 0x75, 0xf1, 0xe9, 0xf0, 0xca, 0xd3, 0xd1, 0xe3, 0x3a, 0x5f,
+  0xa3, 0x99, 0x65, 0xa7, 0xae, 0xd2, 0xe7, 0xf6, 0xf0, 0x81, 0xab, 0x24, 0x69, 0x89, 0x97, 0xf0,
+  0x0f, 0x2d, 0xb1, 0x08, 0x22, 0x4c, 0x9a, 0x7c, 0xfc, 0xbe, 0x36, 0x21, 0xb1, 0xef, 0x22, 0xf6,
+  0x51, 0xbf, 0xc0, 0x75, 0xe0, 0x9b, 0x86, 0xed, 0xda, 0x55, 0x75, 0x03, 0x6f, 0x01, 0xe9, 0x8c,
+  0x85, 0xa9, 0xaa, 0x1e, 0xdc, 0x08, 0xbe, 0x30, 0x4d, 0xe0, 0xd8, 0xa4, 0xcb, 0xfd, 0x08, 0xb8,
+  0x6a, 0x43, 0xf5, 0x46, 0x82, 0x68, 0x82, 0x1b, 0x08, 0x58, 0xc9, 0x66, 0xee, 0xb8, 0x2e, 0xab,
+  0x17, 0x6a, 0xe1, 0x9c, 0x53, 0xd9, 0xd4, 0x55, 0x0c, 0xf3, 0xba, 0x50, 0x4c, 0x9a, 0xed, 0xbb,
+  0x81, 0xbb, 0xcc, 0xe2, 0x21, 0x8b, 0x0b, 0x96, 0x2e, 0xb0, 0x8e, 0xbb, 0x4d, 0xdc, 0x05, 0x1f,
+  0x4f, 0x4c, 0x00, 0x30, 0x83, 0x32, 0x30, 0x63, 0x1e, 0xc0, 0x2a, 0xa9, 0x90, 0xbc, 0x4a, 0x6b,
+  0x70, 0xe6, 0xb9, 0x0b, 0x37, 0x01, 0x55, 0x6f, 0xcc, 0xff, 0xa5, 0xa2, 0x3a, 0xf7, 0xd2, 0xf2,
+  0xe2, 0x86, 0x21, 0xa8, 0x69, 0x9f, 0x86, 0x61, 0xb0, 0x48, 0x83, 0xb4, 0x54, 0x08, 0xe4, 0x4b,
+  0x51, 0xf0, 0x1c, 0x36, 0xbb, 0x81, 0x40, 0x1d, 0xd7, 0x43, 0x1a, 0xab, 0x2a, 0x4b, 0x18, 0x10,
+  0x83, 0x81, 0x3b, 0xc1, 0x20, 0xdb, 0xb8, 0x5c, 0x12, 0xca, 0x6d, 0x63, 0x7e, 0xad, 0xf5, 0xdb,
+  0x9e, 0x91, 0xb8, 0xda, 0xd5, 0x23, 0xff, 0xf1, 0x03, 0xbd, 0x9f, 0x24, 0xee, 0x9c, 0xa6, 0x04,
+  0xbd, 0x60, 0x95, 0xc5, 0x5a, 0xfc, 0x27, 0x71, 0x06, 0xc1, 0xdf, 0x3c, 0x3e, 0x75, 0x20, 0xc5,
+  0xd9, 0x6b, 0xe0, 0x13, 0x8c, 0x9f, 0x61, 0xd1, 0xdd, 0x16, 0x5e, 0xb0, 0xaa, 0x9c, 0x19, 0x2a,
+  0x73, 0x83, 0xee, 0x1c, 0x3b, 0x4e, 0xdf, 0xcc, 0xc7, 0x8f, 0x9d, 0x16, 0xff, 0x1f, 0xe6, 0xf3,
+  0x9d, 0x56, 0xce, 0x45, 0x26, 0x77, 0x5f, 0x82, 0x3a, 0xbb, 0x6a, 0xb3, 0x34, 0x0d, 0xbc, 0x74,
+  0x36, 0x4d, 0xed, 0x62, 0xfb, 0xcc, 0x56, 0xdb, 0x2c, 0x8a, 0x45, 0x5e, 0xe8, 0x15, 0x8a, 0x10,
+  0x33, 0xaa, 0xd0, 0xe9, 0x37, 0x39, 0xae, 0x4e, 0x8e, 0x97, 0xde, 0x39, 0xb9, 0xe3, 0xe2, 0xcc,
+  0xff, 0xbc, 0x90, 0x25, 0x25, 0x67, 0x85, 0x3d, 0x03, 0x7d, 0x81, 0xf0, 0xfc, 0xb4, 0xd5, 0x73,
+  0xba, 0xad, 0xde, 0x09, 0xaf, 0x5f, 0xb7, 0x2d, 0xe7, 0x14, 0x2f, 0x4b, 0x48, 0x1f, 0xab, 0x42,
+  0x11, 0x92, 0x6f, 0x26, 0x3c, 0x97, 0x52, 0x32, 0x8d, 0xe7, 0x55, 0xe0, 0x4d, 0x90, 0x2e, 0xc1,
+  0x7f, 0x7e, 0x83, 0x10, 0x90, 0xf9, 0xb7, 0x6a, 0x81, 0x59, 0x28, 0x9b, 0x0b, 0x8e, 0xd5, 0xdd,
+  0x75, 0x0b, 0x08, 0x47, 0x14, 0x91, 0x59, 0xf6, 0x08, 0x23, 0xff, 0x97, 0xe9, 0x6f, 0xd1, 0x43,
+  0x16, 0x4f, 0xa7, 0x21, 0xad, 0x4b, 0x9c, 0x9b, 0xf7, 0xf3, 0x2a, 0xa6, 0x8b, 0x72, 0xa6, 0xcd,
+  0xc7, 0xa8, 0x74, 0xa2, 0xcd, 0x1e, 0x23, 0x30, 0xd3, 0xdb, 0x20, 0xf3, 0x66, 0xab, 0x72, 0x54,
+  0x6d, 0x58, 0x7a, 0x18, 0x8b, 0xa5, 0x13, 0x9d, 0x0f, 0x4e, 0x8d, 0xf0, 0x12, 0x5e, 0x99, 0x5a,
+  0xa0, 0x39, 0x12, 0xc7, 0xd1, 0x10, 0xf8, 0xce, 0x43, 0x59, 0xf5, 0xc5, 0xe2, 0x54, 0x8f, 0x4d,
+  0x5e, 0xa9, 0x39, 0x32, 0x09, 0x3a, 0xe5, 0x24, 0xc7, 0x17, 0x8b, 0xb9, 0x79, 0x3a, 0x27, 0x69,
+  0xc1, 0x80, 0x05, 0xbe, 0xf9, 0x8a, 0x57, 0x64, 0x89, 0x0a, 0x6e, 0x84, 0x91, 0x1a, 0x0d, 0x95,
+  0x0d, 0xd0, 0x99, 0xc5, 0x4a, 0xec, 0x54, 0x26, 0xe1, 0x13, 0xe6, 0x87, 0x8c, 0xa9, 0x93, 0xaa,
+  0xdc, 0xcb, 0x8b, 0xc0, 0x8d, 0x7c, 0xf5, 0xb1, 0xee, 0x61, 0xfa, 0x1b, 0x78, 0x33, 0xea, 0x7d,
+  0xa0, 0xfe, 0x61, 0x41, 0x57, 0x5b, 0x33, 0xfa, 0x26, 0x6c, 0x29, 0x62, 0x75, 0x95, 0x09, 0x82,
+  0xa0, 0x6b, 0x30, 0x02, 0x6d, 0x9f, 0xa6, 0x5e, 0x12, 0x2c, 0x90, 0xcf, 0xea, 0x9d, 0x2b, 0xb4,
+  0x49, 0x7f, 0xaf, 0xe2, 0x0e, 0x66, 0x9b, 0x39, 0x1e, 0x6a, 0x90, 0xa6, 0xb6, 0x5b, 0xfb, 0x02,
+  0xbc, 0xc9, 0x5e, 0x69, 0x5b, 0xc5, 0xc6, 0xf4, 0xf9, 0x6c, 0x28, 0x77, 0xf1, 0xd7, 0x6c, 0x93,
+  0x5e, 0x2f, 0x04, 0xd6, 0xbc, 0x50, 0xc8, 0x87, 0x2f, 0x6e, 0x33, 0xa0, 0x8d, 0xd7, 0x4f, 0x5e,
+  0x1d, 0x89, 0x53, 0x8f, 0x57, 0x47, 0xe2, 0x40, 0x07, 0x29, 0xc1, 0x87, 0x1f, 0xdc, 0x10, 0x2f,
+  0x74, 0xd3, 0x74, 0xd4, 0x28, 0xd4, 0x88, 0x0d, 0x12, 0xf8, 0xaa, 0xf1, 0x3b, 0xd1, 0x66, 0x62,
+  0x88, 0x72, 0xad, 0x71, 0xf6, 0xea, 0x08, 0x5a, 0x91, 0x38, 0xff, 0xd0, 0x40, 0xf4, 0xad, 0xf4,
+  0x02, 0xb6, 0x92, 0xb6, 0xd0, 0xce, 0xb7, 0x4c, 0xd9, 0xd9, 0x53, 0x37, 0x3f, 0x16, 0x02, 0xc6,
+  0xbb, 0xd0, 0xb4, 0x38, 0xfb, 0xde, 0x05, 0x3d, 0x32, 0x92, 0x49, 0x1c, 0x42, 0xea, 0x22, 0x17,
+  0xef, 0xde, 0x92, 0x34, 0x03, 0x33, 0xe1, 0x49, 0xd0, 0x24, 0x98, 0x2e, 0x13, 0x56, 0xd0, 0xbd,
+  0x3a, 0x5a, 0x54, 0x72, 0x54, 0xcd, 0x8c, 0x51, 0xde, 0x61, 0x1f, 0x5f, 0x85, 0x69, 0xdd, 0xa4,
+  0x41, 0xe2, 0xc8, 0x0b, 0x03, 0xef, 0xc3, 0xa8, 0x71, 0x0b, 0x55, 0x6b, 0x7c, 0x0b, 0x55, 0xb5,
+  0xc7, 0x86, 0xea, 0xcc, 0x12, 0x3a, 0x19, 0x59, 0x47, 0x56, 0xe3, 0xec, 0x6b, 0x37, 0x0d, 0xbc,
+  0x57, 0x47, 0x1c, 0xbb, 0x92, 0x0c, 0xcf, 0xb4, 0xdb, 0x89, 0xb9, 0xfe, 0x0d, 0xce, 0x20, 0x3e,
+  0x10, 0xfd, 0x4a, 0x7c, 0xdd, 0x48, 0x77, 0x3b, 0x45, 0x3a, 0x99, 0x50, 0x2f, 0x4b, 0x81, 0xe0,
+  0x3b, 0xfe, 0xed, 0x91, 0xf4, 0xa0, 0x5e, 0x9a, 0x01, 0xb1, 0xf7, 0xcb, 0x30, 0x0b, 0xda, 0x68,
+  0xa4, 0x38, 0x79, 0x24, 0xc5, 0x08, 0x52, 0x7f, 0x9c, 0x7c, 0x00, 0xa2, 0xdf, 0xf2, 0x6f, 0x8f,
+  0xa4, 0x07, 0x71, 0x36, 0x8d, 0x62, 0x98, 0x64, 0x3c, 0x94, 0xfa, 0x6d, 0xfe, 0xa4, 0xd1, 0xe5,
+  0x1e, 0xa2, 0x8e, 0x05, 0x61, 0x35, 0xc8, 0xce, 0x9c, 0xda, 0xe2, 0x60, 0x64, 0xdb, 0x06, 0x42,
+  0xd5, 0xa2, 0x42, 0x84, 0x2b, 0x5b, 0x8f, 0x3b, 0x44, 0xac, 0x07, 0x45, 0x50, 0xea, 0x9b, 0xdd,
+  0xe6, 0x2a, 0xa1, 0xa7, 0x56, 0x09, 0x05, 0x72, 0x5b, 0xb6, 0x90, 0xd6, 0x45, 0x9e, 0x55, 0xa9,
+  0x67, 0xec, 0x7b, 0xbd, 0x60, 0xc9, 0x9e, 0xfb, 0x40, 0x5b, 0x20, 0xe8, 0xc7, 0x3e, 0xe2, 0x10,
+  0xcc, 0x2c, 0x55, 0x85, 0x24, 0x42, 0x84, 0x8a, 0xf9, 0x5f, 0x34, 0xc9, 0xd4, 0x5f, 0x29, 0x80,
+  0x96, 0x7e, 0xcc, 0xf4, 0x61, 0x70, 0xdd, 0x20, 0x0c, 0x66, 0xd4, 0x68, 0xb7, 0x03, 0x88, 0xc4,
+  0x81, 0xf5, 0x3f, 0xff, 0xf6, 0xaf, 0xff, 0x0e, 0x56, 0xc3, 0x0f, 0xc2, 0x1d, 0x96, 0x5c, 0xcd,
+  0xdc, 0x05, 0xad, 0x88, 0xe9, 0xfc, 0x98, 0x01, 0x43, 0x97, 0x55, 0x02, 0x67, 0x17, 0x28, 0x35,
+  0xb9, 0x5a, 0xb8, 0x90, 0x09, 0x78, 0x8b, 0x39, 0x78, 0xe1, 0xac, 0x00, 0x11, 0x59, 0xd2, 0x27,
+  0xd9, 0xfd, 0x02, 0xb8, 0x60, 0xbb, 0xd4, 0x0d, 0x32, 0x0f, 0xa2, 0x51, 0xa3, 0x0b, 0x9f, 0xee,
+  0x1d, 0x7c, 0x3a, 0x4e, 0x83, 0xb0, 0xea, 0x72, 0xd4, 0x38, 0x81, 0xaf, 0x06, 0x29, 0x91, 0x2f,
+  0x71, 0x54, 0x1c, 0x94, 0x39, 0xe7, 0x0c, 0x89, 0x8c, 0x1a, 0xb8, 0x7c, 0xbb, 0x72, 0x6f, 0xe8,
+  0x1b, 0xf6, 0x9c, 0x36, 0x2d, 0x05, 0x65, 0xb5, 0x48, 0x36, 0x0b, 0xd2, 0x0e, 0x23, 0x6a, 0x37,
+  0x2a, 0x59, 0x64, 0x7d, 0x05, 0xea, 0x3f, 0xb2, 0xb6, 0xb3, 0x13, 0xa7, 0x90, 0x79, 0xd3, 0x39,
+  0x9e, 0x00, 0x0b, 0xfc, 0xd2, 0x1c, 0xd6, 0x38, 0x7b, 0xc3, 0xd3, 0x66, 0x0a, 0xa3, 0x52, 0xc2,
+  0x26, 0x18, 0x12, 0x4f, 0xd8, 0xc3, 0x3c, 0xbe, 0x01, 0xab, 0x13, 0x36, 0x02, 0xe1, 0x5e, 0x02,
+  0x56, 0x43, 0x72, 0x95, 0x59, 0xb4, 0x4a, 0xe3, 0xd7, 0x89, 0x1b, 0x84, 0xe4, 0x82, 0x46, 0xd3,
+  0x6c, 0xf6, 0x68, 0x9d, 0x3b, 0x42, 0xe7, 0xbd, 0x5c, 0xe5, 0xd5, 0x1a, 0xcf, 0x70, 0x54, 0x3e,
+  0xa8, 0xae, 0xf3, 0x09, 0x85, 0x2a, 0xac, 0x69, 0x1d, 0xa5, 0x34, 0xbb, 0xce, 0x21, 0x5e, 0x73,
+  0x52, 0xd6, 0xa1, 0xa6, 0xf5, 0x0e, 0x88, 0x1f, 0x35, 0x93, 0xd1, 0x59, 0xd2, 0xf9, 0x35, 0x8d,
+  0xa3, 0xa6, 0x2d, 0x5a, 0xfc, 0xd1, 0xd9, 0x2a, 0x98, 0x34, 0xfd, 0x0e, 0x94, 0xf2, 0xd9, 0x32,
+  0x1d, 0x8d, 0x46, 0x96, 0x58, 0x28, 0x58, 0x36, 0xee, 0x11, 0xa1, 0x45, 0xfd, 0x6f, 0x63, 0xa8,
+  0x60, 0x03, 0x9e, 0x75, 0x9a, 0xf6, 0x7a, 0xbb, 0x09, 0x35, 0x76, 0x85, 0x11, 0xf7, 0xb5, 0x21,
+  0x47, 0x96, 0x76, 0x63, 0xf4, 0x1e, 0x6b, 0xb9, 0x37, 0x2c, 0x91, 0x40, 0x78, 0x05, 0x93, 0xec,
+  0xd1, 0x96, 0x6b, 0xf7, 0xa5, 0xed, 0xfa, 0xdb, 0x6c, 0xc7, 0x13, 0x18, 0x1b, 0xb6, 0xc6, 0x76,
+  0x6f, 0x72, 0x88, 0x7f, 0xbc, 0xed, 0x34, 0x76, 0x1f, 0x68, 0x3b, 0x86, 0xcb, 0xec, 0xc6, 0x69,
+  0x11, 0x59, 0x67, 0x4b, 0x73, 0x56, 0xdb, 0x6f, 0x53, 0xda, 0xc4, 0x04, 0xf9, 0x2f, 0xe4, 0x6a,
+  0x1e, 0xc7, 0xa0, 0x17, 0xf0, 0x83, 0x03, 0x72, 0x99, 0x40, 0x81, 0xe9, 0xf1, 0x1a, 0x68, 0x27,
+  0xf3, 0x5f, 0x4a, 0x26, 0x14, 0x95, 0x4f, 0x16, 0xbe, 0x7a, 0xca, 0xec, 0x55, 0x3b, 0x81, 0x54,
+  0x81, 0x1a, 0x5c, 0x77, 0x85, 0xe5, 0xc2, 0x87, 0xba, 0xfc, 0x7d, 0x8c, 0x00, 0x97, 0x6e, 0xe2,
+  0xce, 0x9b, 0x56, 0x09, 0xfe, 0x1b, 0x28, 0xa9, 0xe2, 0xc4, 0x48, 0xa5, 0x47, 0x30, 0xee, 0x76,
+  0x7b, 0x96, 0x28, 0x09, 0xab, 0xf6, 0xf6, 0x36, 0x2b, 0x23, 0x90, 0xe6, 0xd6, 0x4c, 0x28, 0x2b,
+  0x9b, 0x21, 0xcf, 0xc6, 0xf0, 0xdd, 0x5f, 0x7a, 0x94, 0xfc, 0x1a, 0xe0, 0xa9, 0xc0, 0xbe, 0x91,
+  0xf9, 0x23, 0x85, 0x9a, 0x06, 0x56, 0x90, 0x7f, 0x67, 0xd3, 0x74, 0xab, 0x4d, 0x73, 0x23, 0x46,
+  0xdf, 0xd5, 0x34, 0x25, 0xf8, 0x07, 0x9b, 0xa6, 0x44, 0x49, 0x98, 0xa6, 0xfb, 0x50, 0xd3, 0x48,
+  0x82, 0xc4, 0x73, 0x43, 0x6f, 0x19, 0xb2, 0xa0, 0x4f, 0xf7, 0xb5, 0x46, 0x1e, 0x59, 0x84, 0x4b,
+  0xf6, 0x77, 0x31, 0x46, 0xbf, 0x26, 0x4e, 0xd4, 0xe0, 0x7c, 0xec, 0x6d, 0x61, 0x52, 0x00, 0x7f,
+  0x48, 0x7c, 0x14, 0x48, 0x08, 0x1b, 0xf4, 0xf7, 0xb5, 0x81, 0x50, 0x5b, 0x4a, 0x26, 0xcb, 0x6c,
+  0x99, 0xd0, 0x3c, 0x4c, 0xc6, 0x6e, 0x0a, 0x0b, 0x38, 0xf8, 0x22, 0xad, 0xb3, 0x67, 0xe2, 0xfb,
+  0xeb, 0x7f, 0x91, 0xcb, 0xf3, 0xb7, 0xe4, 0x4f, 0xa0, 0xe6, 0x74, 0xdf, 0x5c, 0x77, 0xc9, 0xd0,
+  0xfe, 0x2f, 0xa3, 0x49, 0x8a, 0x7d, 0x89, 0x03, 0xef, 0x98, 0xe4, 0x18, 0xec, 0x23, 0x52, 0x1b,
+  0xc3, 0x7f, 0x68, 0xec, 0x5c, 0x26, 0x31, 0x5e, 0xb1, 0x84, 0xef, 0x6e, 0x48, 0xa6, 0x40, 0x88,
+  0x80, 0x46, 0x73, 0xeb, 0x89, 0x35, 0xf8, 0xde, 0x41, 0x24, 0xf1, 0xcf, 0x3f, 0xb5, 0x05, 0x72,
+  0x03, 0x6c, 0xd4, 0xff, 0xf9, 0x1e, 0xfa, 0x3f, 0x7f, 0xa4, 0xfe, 0xcf, 0x75, 0xfd, 0xef, 0xa9,
+  0xfe, 0x73, 0xa8, 0x10, 0xa6, 0xc9, 0x3e, 0xaa, 0xdf, 0x12, 0x2e, 0xff, 0xf1, 0x9f, 0xe4, 0x9a,
+  0xed, 0x84, 0x55, 0x05, 0x4b, 0x71, 0xab, 0x16, 0x45, 0x4c, 0x61, 0xa9, 0x51, 0xe8, 0x67, 0xc6,
+  0xc2, 0x7d, 0x0e, 0xb9, 0x70, 0x24, 0xef, 0x63, 0x1f, 0xd6, 0x64, 0x08, 0x2a, 0x4d, 0x5c, 0x40,
+  0xe1, 0x3b, 0xa2, 0x45, 0x13, 0xb2, 0xcd, 0xb9, 0x71, 0x7c, 0xc7, 0xf5, 0x95, 0x2f, 0x44, 0x91,
+  0x9c, 0x6e, 0x1c, 0x28, 0x02, 0xbf, 0x36, 0x3a, 0x9b, 0xcc, 0x16, 0x62, 0x6f, 0xcf, 0xae, 0x61,
+  0x53, 0xd8, 0xfd, 0x4c, 0x31, 0xa6, 0xbc, 0x6c, 0x37, 0x27, 0xcd, 0x87, 0xcc, 0x31, 0x53, 0x1a,
+  0xe2, 0x22, 0xd4, 0x64, 0xf7, 0xc2, 0xbd, 0xa7, 0x49, 0x2d, 0xbf, 0xac, 0xb7, 0xa9, 0x2f, 0xf1,
+  0xe4, 0x2a, 0xb7, 0xea, 0xea, 0x44, 0xf9, 0x6e, 0xc7, 0x8b, 0x8a, 0x5d, 0x7f, 0x75, 0x5b, 0x65,
+  0x62, 0x9c, 0xea, 0x15, 0x76, 0xbe, 0x51, 0x94, 0x98, 0x39, 0x52, 0x5e, 0x82, 0x9f, 0xbd, 0x0d,
+  0xe6, 0xe4, 0x0d, 0xa2, 0xbf, 0x3a, 0xe2, 0x7d, 0x25, 0xa0, 0x2e, 0xae, 0x11, 0x01, 0x80, 0x5c,
+  0xba, 0xec, 0x1a, 0x43, 0x2d, 0x60, 0xaf, 0x71, 0xf6, 0x4d, 0x90, 0xe8, 0xfd, 0x47, 0x5c, 0x3f,
+  0x3b, 0x55, 0xc1, 0xf1, 0x6d, 0x44, 0x40, 0x20, 0x28, 0x80, 0x4b, 0x6b, 0xcf, 0x5b, 0xa8, 0xdf,
+  0x49, 0xc1, 0xbd, 0x48, 0x90, 0x12, 0xac, 0x66, 0xeb, 0x13, 0xcd, 0x7e, 0xde, 0xfb, 0x56, 0xde,
+  0x2c, 0x86, 0xe0, 0x62, 0xfb, 0x04, 0x8f, 0xf6, 0x5f, 0x75, 0x57, 0x99, 0x91, 0x2b, 0xf8, 0x83,
+  0x36, 0x1c, 0xeb, 0xfe, 0xe4, 0x1e, 0xbc, 0x9f, 0xf4, 0x3c, 0xd1, 0xe9, 0x15, 0xe5, 0x23, 0x85,
+  0x9f, 0xc7, 0xb5, 0xf5, 0x3b, 0x48, 0xff, 0xde, 0xec, 0xfd, 0x24, 0xc2, 0x6f, 0x49, 0x74, 0x7f,
+  0xfb, 0x6f, 0x82, 0x2b, 0x3c, 0x72, 0x25, 0x6e, 0x76, 0x48, 0x95, 0x99, 0x7b, 0x88, 0xfc, 0x49,
+  0xdb, 0x45, 0xc4, 0xfb, 0x1f, 0x72, 0xaf, 0x55, 0xa2, 0x36, 0x81, 0x45, 0x46, 0xeb, 0x2b, 0x70,
+  0x69, 0xd9, 0xa9, 0x11, 0x96, 0xfb, 0x88, 0x06, 0x47, 0xc5, 0xc3, 0xd7, 0xc2, 0x74, 0x61, 0x1e,
+  0x7c, 0x42, 0xc4, 0x2d, 0x13, 0x3c, 0xa4, 0x27, 0x6f, 0x45, 0x7b, 0x85, 0x85, 0xcd, 0xc3, 0x4d,
+  0xb9, 0x1b, 0x74, 0x43, 0x25, 0x4a, 0xe3, 0xac, 0xdd, 0x36, 0x14, 0x69, 0x9c, 0x40, 0x36, 0xce,
+  0xbc, 0xb9, 0x50, 0x65, 0x05, 0x6d, 0xf3, 0xc4, 0xb1, 0x51, 0xee, 0x94, 0x5b, 0xd6, 0x6c, 0x50,
+  0xea, 0xff, 0x98, 0xc3, 0x9a, 0xd9, 0x8c, 0x40, 0x32, 0x2b, 0x1d, 0x06, 0x6c, 0xfa, 0x30, 0x92,
+  0x30, 0x5e, 0x73, 0xc1, 0xc1, 0x17, 0xca, 0x3e, 0xe2, 0x86, 0x4b, 0x43, 0x7b, 0x39, 0x64, 0x7c,
+  0x4f, 0xbe, 0x77, 0x6f, 0x02, 0x72, 0x05, 0xed, 0x33, 0xd2, 0x2c, 0xbc, 0x29, 0x62, 0xf3, 0x4d,
+  0x7f, 0x79, 0x48, 0xf0, 0xc6, 0x3c, 0x24, 0xb8, 0xba, 0x4f, 0x33, 0x3a, 0x97, 0x20, 0x6f, 0xe2,
+  0xc5, 0x3d, 0xdb, 0x19, 0x25, 0x07, 0x1e, 0x7c, 0x1d, 0x92, 0x9e, 0xd3, 0xeb, 0x17, 0x5f, 0x3d,
+  0xe9, 0x30, 0xb3, 0x33, 0xb0, 0x14, 0x16, 0x72, 0x29, 0x4d, 0xf0, 0x86, 0x50, 0xdd, 0xd1, 0x82,
+  0x79, 0x91, 0x88, 0xeb, 0x4b, 0xb6, 0xb1, 0x1d, 0x07, 0x10, 0x4f, 0x7a, 0x0e, 0x61, 0x30, 0x44,
+  0xec, 0x4a, 0x4c, 0x96, 0x61, 0x78, 0xff, 0x45, 0x5e, 0x19, 0xb0, 0x5c, 0x79, 0xf6, 0x64, 0xb2,
+  0x8c, 0xf8, 0x6a, 0xa3, 0x66, 0xcf, 0x02, 0xf7, 0x38, 0xc4, 0xd6, 0x77, 0x5a, 0xec, 0xbd, 0x0e,
+  0xe6, 0x34, 0x5e, 0x66, 0xf6, 0xca, 0x0b, 0xa9, 0x9b, 0x88, 0xa7, 0xad, 0xd0, 0x6b, 0xc8, 0x21,
+  0x69, 0x46, 0x22, 0xad, 0x6b, 0xe4, 0xc7, 0xde, 0x72, 0x0e, 0xfe, 0xd9, 0x99, 0xd2, 0xec, 0x5d,
+  0x48, 0xf1, 0xeb, 0xd7, 0xf7, 0xe7, 0x7e, 0xd3, 0x32, 0x64, 0xb3, 0xec, 0xa1, 0x8e, 0xd5, 0x61,
+  0x3a, 0xb9, 0x00, 0x2f, 0xec, 0x24, 0x14, 0x12, 0x3c, 0x05, 0x70, 0x10, 0x02, 0xa0, 0x70, 0x47,
+  0x4e, 0x70, 0xd3, 0xb4, 0x47, 0x67, 0xab, 0x1a, 0x2c, 0x98, 0x14, 0x15, 0xca, 0x16, 0xae, 0x47,
+  0x3b, 0x92, 0x34, 0x19, 0x59, 0xb7, 0x8e, 0x1d, 0x28, 0xe5, 0xd6, 0xad, 0x2e, 0xde, 0xeb, 0x32,
+  0x54, 0x2d, 0xa3, 0xaa, 0x29, 0xa3, 0xc8, 0x5e, 0xd5, 0x2a, 0x41, 0x8f, 0x42, 0xcb, 0xee, 0xb0,
+  0x13, 0xb1, 0x7f, 0xba, 0x7e, 0x7f, 0x31, 0x92, 0xb8, 0x87, 0xd6, 0x4e, 0x81, 0x69, 0x0d, 0xb9,
+  0xea, 0xa1, 0xa6, 0x45, 0x72, 0xa3, 0x05, 0xbe, 0x26, 0x05, 0x25, 0x60, 0xb3, 0x76, 0x64, 0x01,
+  0x69, 0xd9, 0xaf, 0x79, 0x71, 0xf1, 0xf1, 0xa3, 0x75, 0xec, 0x58, 0xb6, 0xa4, 0xe3, 0xde, 0xed,
+  0x4a, 0x87, 0x43, 0x9a, 0x74, 0x72, 0x42, 0x78, 0xad, 0x11, 0x60, 0x5d, 0x48, 0xe7, 0xef, 0xdd,
+  0x6c, 0xd6, 0x81, 0x61, 0x9b, 0x50, 0xb7, 0xb4, 0xf8, 0x83, 0x7b, 0xd7, 0x74, 0x5a, 0x4d, 0xa5,
+  0xa8, 0xb6, 0x60, 0xca, 0x3e, 0x6a, 0x0a, 0xb2, 0xaa, 0xc5, 0xfe, 0x03, 0x56, 0xce, 0x92, 0xaa,
+  0x91, 0x47, 0xea, 0x5d, 0xcc, 0x00, 0x53, 0x2c, 0x99, 0xb3, 0xad, 0x40, 0xa8, 0x27, 0x62, 0x82,
+  0x03, 0x15, 0xdc, 0x1a, 0xac, 0x22, 0x71, 0x70, 0x50, 0xd9, 0xac, 0x66, 0xab, 0x95, 0xd0, 0x88,
+  0x28, 0xc3, 0x47, 0x20, 0x50, 0x3b, 0x57, 0xcf, 0xd0, 0x60, 0xb6, 0xc3, 0x52, 0x63, 0x87, 0xbf,
+  0x94, 0x06, 0x0a, 0x7d, 0x66, 0x55, 0xf6, 0xe3, 0xc9, 0xc9, 0xe8, 0x97, 0x2f, 0xd5, 0x81, 0x7b,
+  0xbb, 0xdb, 0x5f, 0x3f, 0xfb, 0x65, 0x4d, 0xc3, 0x94, 0xae, 0xea, 0xe9, 0x35, 0xcd, 0x91, 0xed,
+  0x43, 0x6b, 0x13, 0x79, 0xcb, 0xb1, 0x44, 0x5c, 0xc3, 0x42, 0x7c, 0xab, 0xb6, 0x00, 0x86, 0x2d,
+  0x58, 0x94, 0xb6, 0xa7, 0x09, 0xa5, 0xd1, 0x56, 0x34, 0x06, 0x65, 0x22, 0x8e, 0xe1, 0x61, 0x2b,
+  0x1e, 0x02, 0x49, 0x34, 0xb0, 0x4b, 0xce, 0xe1, 0xc1, 0x81, 0x3e, 0xf0, 0xc1, 0x81, 0x46, 0x4d,
+  0x1a, 0x02, 0x80, 0x73, 0xff, 0xce, 0x31, 0x45, 0xad, 0xad, 0xb3, 0x9f, 0x83, 0xe9, 0x44, 0x4d,
+  0x40, 0x1c, 0x20, 0x87, 0xd3, 0x86, 0x93, 0x60, 0x55, 0x0a, 0xce, 0xab, 0xf3, 0xd1, 0x2f, 0xc9,
+  0x74, 0xdc, 0xfc, 0x72, 0x05, 0x7c, 0xac, 0x5b, 0xe4, 0xcb, 0x15, 0x1b, 0x88, 0x7d, 0x43, 0x52,
+  0x6b, 0xfb, 0x97, 0xf5, 0x5a, 0x25, 0x19, 0xbe, 0xe2, 0x54, 0x69, 0x46, 0x4f, 0xe4, 0xef, 0x6e,
+  0x60, 0xc4, 0xab, 0x78, 0x09, 0xb6, 0x3d, 0x38, 0xf8, 0x42, 0x34, 0xca, 0xf0, 0xba, 0xca, 0x12,
+  0xea, 0xce, 0xbf, 0x71, 0x83, 0x30, 0xf7, 0x46, 0x9a, 0x8e, 0x22, 0x7a, 0x4b, 0x34, 0xbc, 0xa6,
+  0x75, 0x44, 0xf1, 0x29, 0x7d, 0x3d, 0xfb, 0x0d, 0x7c, 0x14, 0x14, 0x4b, 0xd3, 0x4e, 0x1c, 0xcd,
+  0x61, 0xa2, 0xc1, 0x28, 0xa6, 0x90, 0x21, 0x8d, 0x2c, 0xa7, 0x64, 0xa6, 0x1d, 0x60, 0xcb, 0xed,
+  0x40, 0xcd, 0x12, 0x64, 0x4d, 0xab, 0x65, 0xd9, 0x3f, 0x39, 0x3f, 0xdb, 0xf6, 0x9a, 0xa3, 0xd3,
+  0x24, 0x89, 0x93, 0x11, 0xcb, 0xaf, 0xf0, 0xec, 0x85, 0x71, 0x0a, 0x8c, 0x0f, 0x37, 0x30, 0x38,
+  0xca, 0x92, 0x25, 0xd5, 0xd3, 0xbd, 0x29, 0x75, 0xab, 0x8f, 0xd9, 0x77, 0x98, 0xd0, 0x6c, 0x99,
+  0x44, 0x6b, 0xb9, 0xe7, 0xef, 0xe7, 0xa9, 0x94, 0xef, 0xed, 0xd3, 0x74, 0x01, 0x62, 0x02, 0xcf,
+  0xf2, 0x5b, 0x07, 0x6f, 0x54, 0xe4, 0x3b, 0xfd, 0x02, 0xbe, 0x56, 0x26, 0x95, 0xc2, 0xed, 0xb5,
+  0xdd, 0x81, 0x29, 0x01, 0x46, 0xe1, 0x92, 0x9c, 0x31, 0xfd, 0xc5, 0x60, 0x43, 0xf6, 0xdc, 0x6c,
+  0xbc, 0xc3, 0x0f, 0xc2, 0x18, 0xc1, 0xe5, 0x88, 0x44, 0x1c, 0x34, 0x5a, 0x0c, 0x00, 0xf1, 0x27,
+  0x01, 0xd4, 0xf0, 0xe1, 0x3d, 0x9f, 0x65, 0xb6, 0x48, 0xa6, 0x4f, 0x2a, 0xbc, 0x9f, 0xad, 0xac,
+  0x2e, 0xf9, 0x4b, 0x17, 0x4d, 0xcd, 0x87, 0x7f, 0xcf, 0x21, 0xc9, 0xd1, 0x3c, 0x8d, 0xf3, 0x7a,
+  0x3c, 0x1d, 0x6a, 0x8f, 0x68, 0x3e, 0x38, 0xd0, 0x11, 0xff, 0x41, 0xb1, 0xad, 0xb3, 0xf0, 0x90,
+  0xd0, 0xce, 0x6d, 0x5d, 0x3c, 0xed, 0x15, 0x55, 0xd2, 0xb9, 0xdf, 0xe2, 0x43, 0x41, 0x5a, 0x87,
+  0x29, 0x04, 0xb7, 0x99, 0xd2, 0x91, 0x65, 0xa1, 0x96, 0x14, 0x04, 0x9e, 0x53, 0x45, 0xcb, 0xf9,
+  0x05, 0xf5, 0x53, 0xcb, 0x96, 0x20, 0xa2, 0x61, 0x64, 0x1d, 0x32, 0xfc, 0x21, 0x4e, 0x0d, 0xa4,
+  0x88, 0xa5, 0x6a, 0x01, 0x89, 0x25, 0xcb, 0x88, 0xcd, 0x58, 0x72, 0xe6, 0x57, 0x58, 0xa2, 0x68,
+  0xd8, 0x88, 0x35, 0x66, 0xf5, 0x70, 0xc4, 0x0e, 0xd3, 0x24, 0x62, 0xde, 0xb6, 0x19, 0x37, 0xf7,
+  0x64, 0x89, 0x29, 0x5b, 0x36, 0xe3, 0xe9, 0xae, 0x2c, 0x31, 0xf3, 0xb6, 0x2d, 0xfc, 0xe6, 0xee,
+  0xac, 0xd8, 0x95, 0x4d, 0x9b, 0x31, 0xf3, 0x73, 0x7a, 0x85, 0xa9, 0x9a, 0x4c, 0x4c, 0x9e, 0xc5,
+  0x84, 0xb3, 0xb9, 0xec, 0x10, 0x8f, 0xfa, 0x62, 0xfd, 0x51, 0x1b, 0x30, 0x6a, 0x2c, 0xe9, 0xa5,
+  0x31, 0x68, 0x11, 0x33, 0x0c, 0x67, 0xad, 0x40, 0x86, 0x7b, 0xea, 0x50, 0x3b, 0x1c, 0x7d, 0x6d,
+  0x1d, 0x72, 0xb6, 0x4a, 0xb9, 0x12, 0xe7, 0x93, 0x2f, 0x54, 0xc2, 0x8c, 0x3f, 0xd8, 0xab, 0x6c,
+  0x96, 0xc4, 0xb7, 0x84, 0x4d, 0x14, 0x2c, 0xdb, 0x59, 0x57, 0xb8, 0x96, 0x49, 0x04, 0xe3, 0xb8,
+  0x12, 0x61, 0x27, 0xa5, 0x03, 0x62, 0x1d, 0x2a, 0x3c, 0xde, 0x64, 0xaf, 0x39, 0x0c, 0x51, 0xed,
+  0xfc, 0xa8, 0x75, 0x2d, 0x33, 0x30, 0x4c, 0x19, 0xe2, 0xb8, 0x95, 0x4d, 0x1e, 0xe5, 0x13, 0xd7,
+  0x55, 0xdd, 0x91, 0xab, 0x54, 0x7a, 0x01, 0x91, 0xa5, 0x5b, 0x40, 0xab, 0x54, 0xc0, 0xc8, 0x50,
+  0x92, 0x2a, 0x08, 0xd9, 0x3a, 0x7b, 0x5b, 0x66, 0x53, 0x0a, 0x3f, 0xcc, 0xbf, 0x42, 0xc5, 0xee,
+  0x85, 0x4b, 0x1f, 0xaf, 0x65, 0x08, 0x27, 0x79, 0x6d, 0xbd, 0xe5, 0xe4, 0xac, 0x81, 0x6c, 0x12,
+  0x25, 0xa3, 0x3e, 0x88, 0xbd, 0x32, 0x9f, 0xd9, 0xb4, 0x24, 0xfe, 0xfc, 0x81, 0xc9, 0xe3, 0xda,
+  0x0d, 0x69, 0x02, 0xf3, 0x29, 0x9f, 0x5f, 0x60, 0x11, 0x83, 0xb3, 0x8b, 0x18, 0x1f, 0xf5, 0xcd,
+  0xc5, 0x17, 0xb3, 0x33, 0x14, 0xdf, 0x3f, 0x44, 0x1f, 0x22, 0xdc, 0x20, 0x13, 0x6a, 0xb0, 0xd7,
+  0x5b, 0x26, 0xae, 0x6a, 0xc2, 0x96, 0x98, 0xb5, 0x86, 0xff, 0xcf, 0xb4, 0xc8, 0x6b, 0x0b, 0x3c,
+  0x58, 0xc5, 0xe5, 0xa0, 0x14, 0xb7, 0x43, 0x2e, 0x43, 0x7c, 0x73, 0x83, 0x64, 0xc9, 0x3d, 0x71,
+  0x71, 0xc3, 0xbc, 0x63, 0x99, 0x53, 0x70, 0x79, 0x1f, 0x99, 0x46, 0xee, 0x98, 0xd5, 0x51, 0x5a,
+  0x48, 0x99, 0x20, 0xaf, 0x05, 0x08, 0xc4, 0xba, 0x04, 0xae, 0xad, 0x4a, 0xcc, 0xfb, 0x07, 0x0f,
+  0x8f, 0x89, 0xa2, 0xb1, 0xab, 0x6c, 0xad, 0x8c, 0x5b, 0x2b, 0x20, 0xdf, 0x78, 0x16, 0x13, 0x8e,
+  0x21, 0x1f, 0x7c, 0x7d, 0x5d, 0xd8, 0xbe, 0x96, 0xa9, 0xec, 0xf7, 0x2d, 0x5c, 0x69, 0x17, 0xb5,
+  0xca, 0x7e, 0x45, 0xa0, 0xcf, 0xcd, 0x82, 0xc5, 0xcd, 0xd2, 0x2a, 0x19, 0x0b, 0x30, 0x9f, 0x9b,
+  0x88, 0xcc, 0x2e, 0x2c, 0x00, 0xe7, 0xf0, 0xcb, 0x90, 0x4c, 0x75, 0xbd, 0xc6, 0x2e, 0x10, 0x88,
+  0x41, 0xfc, 0x7e, 0xa5, 0x29, 0x1f, 0x1c, 0xb2, 0xf9, 0xb8, 0x55, 0x8e, 0xbb, 0x82, 0xcd, 0x18,
+  0xf0, 0x6b, 0x06, 0x3c, 0x12, 0x93, 0xf8, 0xa1, 0x75, 0x70, 0xa3, 0x57, 0x24, 0xbf, 0x6f, 0x23,
+  0xf2, 0x0b, 0x99, 0x57, 0x0b, 0x4a, 0xfd, 0x8a, 0x2c, 0xa3, 0xf5, 0xbe, 0xfe, 0xec, 0x84, 0xc2,
+  0x63, 0x57, 0x7c, 0x39, 0xe1, 0xbe, 0x56, 0x30, 0x05, 0xf1, 0x39, 0x09, 0x77, 0xad, 0x5e, 0xb9,
+  0xc0, 0x45, 0x6b, 0xed, 0xd4, 0x90, 0xbf, 0x99, 0xf1, 0x3e, 0xfd, 0x3c, 0x04, 0x13, 0x27, 0x95,
+  0xb5, 0x12, 0x2d, 0x78, 0xff, 0x67, 0x20, 0x8c, 0xbb, 0x58, 0x84, 0xf7, 0x6f, 0x96, 0x69, 0x16,
+  0xcf, 0xa5, 0x50, 0x72, 0x35, 0x0c, 0x6d, 0x8b, 0x74, 0xf4, 0x93, 0xd3, 0xea, 0xf6, 0x5e, 0xe0,
+  0x9f, 0x6d, 0xf9, 0xb9, 0x33, 0x77, 0x17, 0xcd, 0xa6, 0xdc, 0x35, 0x6c, 0x05, 0xf6, 0xe8, 0x4c,
+  0x3e, 0x1c, 0x42, 0xc5, 0x75, 0x58, 0xbb, 0x48, 0x17, 0xea, 0xb8, 0x02, 0x82, 0xd6, 0x61, 0x60,
+  0xf3, 0x72, 0xb0, 0x93, 0x2e, 0xc7, 0xf8, 0x0e, 0x05, 0xcc, 0x38, 0x5d, 0xd0, 0xc0, 0xaf, 0x71,
+  0x10, 0xb1, 0xfd, 0x1f, 0x7d, 0xb5, 0x21, 0x58, 0x7a, 0xcd, 0x59, 0xb1, 0x0e, 0xd9, 0xe7, 0x63,
+  0xb4, 0xf9, 0x85, 0xae, 0xcd, 0xe2, 0xfa, 0x44, 0xaf, 0x89, 0xed, 0xe1, 0x36, 0x69, 0x2c, 0x21,
+  0xc7, 0xc8, 0x3a, 0xb5, 0x86, 0xb5, 0x17, 0x3c, 0x77, 0xa8, 0xa2, 0xb5, 0xb2, 0x99, 0x97, 0x9b,
+  0x42, 0x6a, 0x72, 0xeb, 0xa6, 0x78, 0x2a, 0xc2, 0x8f, 0x6d, 0xb0, 0x6a, 0x67, 0x60, 0x8a, 0x43,
+  0xa3, 0xd4, 0xc4, 0x97, 0x66, 0x72, 0x03, 0x4a, 0x15, 0x4e, 0x95, 0x0a, 0xad, 0xfa, 0x7b, 0xab,
+  0x5c, 0x4f, 0x3b, 0x8b, 0xcb, 0xb4, 0x24, 0x1a, 0x87, 0x52, 0xbb, 0x1e, 0xf3, 0xa0, 0x4e, 0xc8,
+  0xee, 0x09, 0x83, 0xcb, 0x1e, 0x43, 0x91, 0xad, 0xb5, 0x4f, 0xe2, 0xe4, 0x9d, 0x0b, 0x1c, 0x35,
+  0xd1, 0x80, 0xcc, 0x71, 0x56, 0xfb, 0x39, 0xcb, 0xc8, 0x7a, 0xca, 0xad, 0xcf, 0xff, 0x8c, 0x48,
+  0x27, 0x8b, 0x2f, 0xe2, 0x5b, 0x9a, 0xbc, 0x71, 0x71, 0x43, 0x70, 0xad, 0xfb, 0x7f, 0xb5, 0xef,
+  0x13, 0xf1, 0x52, 0x11, 0x11, 0xd4, 0x51, 0xe7, 0x66, 0x50, 0x57, 0x9e, 0xc3, 0xca, 0x48, 0x10,
+  0x0d, 0xa3, 0x95, 0x5a, 0x8a, 0x0f, 0x36, 0x1c, 0xce, 0xa8, 0x05, 0x3c, 0xe7, 0xbd, 0xa5, 0xdd,
+  0xbf, 0xae, 0x47, 0xd3, 0x80, 0x14, 0xa2, 0x76, 0xf9, 0xb7, 0x1e, 0x51, 0x03, 0x52, 0x88, 0xa5,
+  0x5b, 0xa6, 0xf5, 0xe8, 0x25, 0x50, 0x45, 0xa4, 0x74, 0x1f, 0xb2, 0x9e, 0x48, 0x09, 0x34, 0xe7,
+  0xa4, 0x70, 0x9f, 0x6f, 0x03, 0x23, 0xc5, 0xcb, 0x83, 0x45, 0x61, 0xd8, 0xbd, 0xb2, 0xed, 0x82,
+  0xf0, 0xeb, 0x6b, 0x45, 0xe4, 0xf3, 0xdd, 0x90, 0xcf, 0x0d, 0x64, 0xf3, 0x86, 0x50, 0x3d, 0xb6,
+  0x09, 0x07, 0xe8, 0xe2, 0xf0, 0xa6, 0x65, 0x1e, 0xed, 0x0c, 0x76, 0x3e, 0x2d, 0x52, 0x04, 0x0a,
+  0xd7, 0x1c, 0xea, 0x29, 0x14, 0x00, 0x73, 0x12, 0x6b, 0xb9, 0x1b, 0x19, 0xfb, 0xf7, 0x6c, 0xd3,
+  0xfe, 0x87, 0xef, 0x2f, 0xae, 0xa8, 0x9b, 0x78, 0x33, 0x56, 0x10, 0xa6, 0x4d, 0xcd, 0xa7, 0xa5,
+  0x9f, 0x77, 0x54, 0x93, 0xe1, 0xbb, 0xaa, 0x5b, 0x6b, 0x34, 0x7c, 0x54, 0x01, 0x68, 0x8d, 0xad,
+  0x9a, 0xbb, 0xd3, 0x39, 0x70, 0x09, 0x00, 0xaf, 0xbb, 0xb5, 0x6a, 0xee, 0xf5, 0xe6, 0x68, 0x25,
+  0x00, 0x86, 0x56, 0xf2, 0xb7, 0x7c, 0x98, 0x42, 0x0f, 0x07, 0x37, 0x7c, 0xab, 0xc4, 0x12, 0x6b,
+  0x36, 0x00, 0xcf, 0xab, 0x01, 0xcf, 0x15, 0x60, 0xc1, 0x67, 0x14, 0xa4, 0xd9, 0x9e, 0x7b, 0x86,
+  0x58, 0x34, 0xe6, 0x80, 0xa6, 0x2f, 0x94, 0x3c, 0x40, 0xc1, 0x15, 0x3a, 0xd6, 0xc6, 0xc4, 0xc9,
+  0xca, 0x10, 0xab, 0xb5, 0x9a, 0xd3, 0x6c, 0x16, 0xfb, 0x03, 0xeb, 0xf2, 0xbb, 0xab, 0x6b, 0xab,
+  0x85, 0x3e, 0x30, 0xc0, 0x5f, 0xeb, 0x6d, 0xb3, 0xc1, 0x83, 0x67, 0xcd, 0x9a, 0x89, 0x50, 0x4e,
+  0x6d, 0x78, 0xb5, 0x41, 0xbe, 0x65, 0xa8, 0xd2, 0x6a, 0xd5, 0xbd, 0x04, 0xcb, 0x7e, 0xc8, 0x0e,
+  0x54, 0x5a, 0x9a, 0x4b, 0xd5, 0xdd, 0x07, 0x98, 0x2d, 0xe8, 0x5e, 0xb3, 0x69, 0xc5, 0x6c, 0xa0,
+  0x29, 0x98, 0x35, 0x3d, 0x7c, 0x52, 0x2d, 0x4d, 0x12, 0x7c, 0x5a, 0xe5, 0xb7, 0xd2, 0x2e, 0x64,
+  0xe7, 0xc7, 0x8f, 0x27, 0xce, 0x70, 0x3b, 0x0d, 0xb1, 0xd5, 0x65, 0xec, 0x63, 0xed, 0x4f, 0xae,
+  0x62, 0x02, 0xe2, 0x54, 0xb4, 0x8e, 0x8f, 0x1f, 0x77, 0x23, 0x50, 0xcb, 0xd1, 0xae, 0xb4, 0x2a,
+  0x26, 0x35, 0x4e, 0x40, 0xeb, 0xd8, 0x95, 0x40, 0x2d, 0x33, 0xbb, 0xd2, 0xaa, 0x9d, 0x22, 0xf9,
+  0xe5, 0x04, 0x16, 0xd4, 0x4d, 0x1e, 0x07, 0x35, 0xc9, 0x0e, 0xc8, 0x77, 0x7a, 0xfc, 0x32, 0xc2,
+  0x1e, 0xc3, 0x54, 0x31, 0xfe, 0x49, 0x47, 0xac, 0x9d, 0xb6, 0xcb, 0xc3, 0xd4, 0xa4, 0x63, 0x1c,
+  0xa6, 0xbb, 0xf7, 0x30, 0x3b, 0x09, 0xf6, 0x98, 0x11, 0xeb, 0x6a, 0x89, 0x0a, 0xf5, 0x15, 0x20,
+  0x91, 0x7c, 0x7f, 0x5f, 0xf2, 0xbb, 0x19, 0xea, 0x41, 0x23, 0x55, 0x15, 0x35, 0xf5, 0x4e, 0xc0,
+  0xc0, 0x76, 0xd3, 0x50, 0xe9, 0xb2, 0xfe, 0xae, 0x8e, 0xb6, 0xff, 0x18, 0xe7, 0xbb, 0x31, 0x7f,
+  0x2e, 0x09, 0x3b, 0xfb, 0x51, 0xde, 0x8b, 0xfb, 0xf2, 0x20, 0x38, 0xd5, 0xed, 0x5a, 0xd8, 0xd9,
+  0x7b, 0x97, 0x80, 0x3c, 0xd3, 0x98, 0xbd, 0x1f, 0x3f, 0x4e, 0xdc, 0x30, 0xa5, 0x3b, 0x8e, 0xcc,
+  0xb6, 0xcb, 0x77, 0x1b, 0x5a, 0x80, 0xea, 0xf9, 0xb2, 0xd0, 0x89, 0x79, 0x6e, 0xd3, 0xb0, 0xc5,
+  0x42, 0xd4, 0xde, 0xbb, 0x64, 0xe5, 0xc3, 0x16, 0xee, 0x34, 0xf1, 0x3d, 0xe2, 0x5d, 0xe4, 0x2e,
+  0xd5, 0xb1, 0xf6, 0xfe, 0x25, 0xaf, 0x9c, 0xfc, 0x8c, 0xee, 0x02, 0x0f, 0x30, 0x85, 0x2f, 0x17,
+  0x6a, 0x8a, 0xe7, 0x7f, 0x13, 0x52, 0x5f, 0xaf, 0x6f, 0x59, 0x46, 0x96, 0x6a, 0x98, 0xf2, 0x82,
+  0xb2, 0x72, 0x00, 0xb9, 0xa0, 0xe4, 0xcf, 0xf9, 0x71, 0xd7, 0x5f, 0x96, 0x34, 0xb9, 0xbf, 0x62,
+  0x97, 0xd9, 0xe3, 0x04, 0x8a, 0xa4, 0xa6, 0xf5, 0x34, 0xaf, 0xc1, 0x9f, 0x96, 0x72, 0x7c, 0xeb,
+  0x69, 0x29, 0x3b, 0x02, 0x54, 0x21, 0xc1, 0xe4, 0x78, 0x2c, 0x64, 0xf3, 0x47, 0x11, 0x8f, 0x43,
+  0xc1, 0x85, 0x5a, 0x9d, 0xf3, 0x67, 0x51, 0x69, 0x65, 0xfc, 0xd6, 0xbd, 0x38, 0x50, 0xab, 0x3f,
+  0x98, 0x63, 0x38, 0x9d, 0xc0, 0x3f, 0x94, 0x27, 0x6e, 0x82, 0x6c, 0x27, 0x8e, 0xd8, 0xed, 0xed,
+  0x91, 0xd4, 0x08, 0x08, 0xaf, 0x53, 0x34, 0xc2, 0x35, 0x7f, 0x5b, 0x61, 0x6d, 0xd4, 0x61, 0xae,
+  0xef, 0x73, 0xa5, 0xa0, 0x0a, 0xa1, 0x6e, 0xd3, 0x56, 0xe4, 0xbc, 0xb5, 0x46, 0x83, 0x4d, 0x8b,
+  0x8d, 0xfd, 0x13, 0xfb, 0xbb, 0xed, 0x8d, 0x54, 0x27, 0xd1, 0xf8, 0x59, 0xfe, 0x8d, 0x16, 0x7e,
+  0x5d, 0x44, 0x76, 0xda, 0x2b, 0x1c, 0x8c, 0x0d, 0x22, 0x9b, 0xc4, 0x3d, 0x0d, 0x7e, 0x31, 0x4e,
+  0xee, 0xcd, 0xf0, 0x23, 0x3f, 0xf1, 0x5e, 0x86, 0x0b, 0x96, 0xc4, 0x13, 0x41, 0xfe, 0x07, 0xe0,
+  0xc9, 0x24, 0x48, 0xf0, 0x66, 0x83, 0x7e, 0x33, 0x83, 0xdf, 0xff, 0xfc, 0x84, 0x42, 0x7c, 0x8b,
+  0xef, 0xaa, 0xd4, 0xca, 0x20, 0x86, 0xdb, 0x5b, 0x8c, 0x08, 0xdf, 0x78, 0x60, 0x2f, 0x8e, 0x22,
+  0x3e, 0x13, 0x41, 0x31, 0x05, 0x7a, 0x61, 0x17, 0xbd, 0xf0, 0x3e, 0x2b, 0x8d, 0x28, 0xf0, 0xf5,
+  0xf6, 0xbb, 0xf7, 0xc2, 0x72, 0x17, 0x10, 0x0f, 0xc0, 0x45, 0x4b, 0x33, 0x72, 0xf1, 0x9e, 0xd9,
+  0xc6, 0x70, 0xd7, 0xea, 0x60, 0x7b, 0x55, 0x5d, 0x75, 0xaf, 0x37, 0xe1, 0xab, 0xcd, 0x29, 0x8e,
+  0xad, 0x76, 0xc0, 0x36, 0x22, 0xe9, 0xfb, 0xcd, 0x88, 0xf9, 0xe9, 0xca, 0x7a, 0x93, 0x72, 0xa1,
+  0x88, 0x56, 0x3d, 0xc3, 0x9d, 0xf0, 0x37, 0xd5, 0xd0, 0x0a, 0x68, 0xe7, 0x84, 0x55, 0xc8, 0x53,
+  0xf5, 0x06, 0x31, 0xfe, 0xf8, 0x0e, 0x0c, 0xcf, 0xef, 0x25, 0x89, 0x13, 0xf3, 0x91, 0x85, 0xef,
+  0xfd, 0x58, 0x6b, 0x1b, 0x5f, 0xbd, 0x11, 0x17, 0xc6, 0xe1, 0xab, 0xf8, 0xc3, 0x3e, 0xec, 0xff,
+  0x6d, 0xe1, 0xec, 0x7f, 0x01, 0xe1, 0x16, 0x2a, 0xd4, 0xe0, 0x61, 0x00, 0x00,
+};
+const size_t page_advanced_gz_len = 5725;
+
+// GET /effects
+const uint8_t page_effects_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3c, 0x69, 0x73, 0xdb, 0x38,
+  0xb2, 0xdf, 0xf3, 0x2b, 0x38, 0xca, 0xc4, 0x14, 0xd7, 0x92, 0x4c, 0xc9, 0x96, 0x93, 0x48, 0x91,
+  0xb3, 0x33, 0x39, 0x76, 0x5d, 0xe5, 0x4c, 0x5c, 0xeb, 0x64, 0xf7, 0x6d, 0x4d, 0x4d, 0xd5, 0x40,
+  0x24, 0x24, 0x71, 0x42, 0x91, 0x5a, 0x92, 0xb2, 0xad, 0x28, 0xfa, 0xef, 0xdb, 0x8d, 0x8b, 0x00,
+  0x0f, 0x1d, 0xce, 0xd4, 0x7b, 0xc9, 0x8b, 0x67, 0x2c, 0x12, 0xe8, 0x6e, 0x34, 0x1a, 0x7d, 0x02,
+  0x90, 0x5f, 0xfc, 0xf0, 0xfa, 0xfd, 0xab, 0x0f, 0xff, 0xbe, 0x7e, 0x63, 0xcd, 0xb2, 0x79, 0x78,
+  0xf1, 0xe8, 0x05, 0x7e, 0x58, 0x21, 0x89, 0xa6, 0xa3, 0x06, 0x8d, 0x1a, 0xd8, 0x40, 0x89, 0x0f,
+  0x1f, 0x73, 0x9a, 0x11, 0xcb, 0x9b, 0x91, 0x24, 0xa5, 0xd9, 0xa8, 0xf1, 0xf1, 0xc3, 0xdb, 0xf6,
+  0xb3, 0x86, 0x6c, 0x9e, 0x65, 0xd9, 0xa2, 0x4d, 0xff, 0xb3, 0x0c, 0x6e, 0x47, 0x8d, 0x57, 0x71,
+  0x94, 0xd1, 0x28, 0x6b, 0x7f, 0x58, 0x2d, 0x68, 0xc3, 0xf2, 0xf8, 0xdb, 0xa8, 0x91, 0xd1, 0xfb,
+  0xec, 0x04, 0x69, 0x0f, 0x15, 0x91, 0x65, 0x36, 0xe1, 0x34, 0xb2, 0x20, 0x0b, 0xe9, 0xc5, 0x4f,
+  0xf3, 0x71, 0x70, 0x43, 0xa3, 0x94, 0x5a, 0x5f, 0xac, 0x0f, 0xd4, 0x9b, 0x5d, 0xc7, 0x69, 0x96,
+  0x5a, 0xef, 0xa8, 0x1f, 0x90, 0x17, 0x27, 0x1c, 0x44, 0x0c, 0x17, 0x91, 0x39, 0x1d, 0xd9, 0xb7,
+  0x01, 0xbd, 0x5b, 0xc4, 0x49, 0x66, 0xab, 0x41, 0xec, 0xbb, 0xc0, 0xcf, 0x66, 0x23, 0x9f, 0xde,
+  0x06, 0x1e, 0x6d, 0xb3, 0x97, 0x96, 0x15, 0x44, 0x41, 0x16, 0x90, 0xb0, 0x9d, 0x7a, 0x24, 0xa4,
+  0xa3, 0xae, 0x0d, 0x44, 0xd2, 0x6c, 0x85, 0xc4, 0x06, 0x49, 0x1c, 0x67, 0xeb, 0x76, 0x7b, 0x91,
+  0x04, 0x73, 0x92, 0xac, 0x06, 0x8f, 0xcf, 0x4e, 0xcf, 0xbb, 0x94, 0x0e, 0x55, 0x4b, 0x3b, 0x0c,
+  0xa6, 0xb3, 0x0c, 0xda, 0x9f, 0x3d, 0xef, 0xd3, 0x09, 0xb4, 0xa7, 0x4b, 0xcf, 0xa3, 0x69, 0x0a,
+  0x2d, 0x9e, 0xf7, 0x7c, 0xe2, 0x42, 0xcb, 0x78, 0xda, 0xf6, 0x49, 0xf2, 0x69, 0xf0, 0xb8, 0xdb,
+  0xc3, 0x1f, 0xde, 0xe2, 0x91, 0xc4, 0x87, 0x16, 0x8a, 0x3f, 0xd0, 0x82, 0x53, 0x1f, 0x3c, 0x9e,
+  0xb0, 0x7f, 0xe2, 0xb5, 0x9d, 0x52, 0x60, 0xda, 0x67, 0xa3, 0x8e, 0x5d, 0xfc, 0x41, 0xcc, 0x38,
+  0xf1, 0x69, 0xd2, 0x4e, 0x88, 0x1f, 0x2c, 0xd3, 0x41, 0xb7, 0xb7, 0xb8, 0xc7, 0x21, 0x67, 0xc4,
+  0x8f, 0xef, 0x06, 0xae, 0xd5, 0x75, 0x17, 0xf7, 0x56, 0x0f, 0x7f, 0x25, 0xd3, 0x31, 0x69, 0xba,
+  0x2d, 0xf6, 0xd3, 0x39, 0x75, 0x90, 0x64, 0x42, 0xa2, 0x14, 0xa6, 0x19, 0x47, 0x03, 0x12, 0x86,
+  0x16, 0xb4, 0xa6, 0x16, 0x25, 0x29, 0xdd, 0x3c, 0xfa, 0xcb, 0x1a, 0x26, 0x32, 0x0d, 0xa2, 0x81,
+  0x3b, 0x5c, 0x10, 0xdf, 0x0f, 0xa2, 0x29, 0x3c, 0x8d, 0xe3, 0xfb, 0x76, 0x1a, 0x7c, 0xc6, 0x17,
+  0x31, 0x26, 0xb4, 0x6c, 0x1e, 0x8d, 0x63, 0x7f, 0xb5, 0x9e, 0x80, 0x2c, 0xdb, 0x13, 0x32, 0x0f,
+  0xc2, 0xd5, 0xc0, 0xbe, 0xa1, 0xd3, 0x98, 0x5a, 0x1f, 0x2f, 0xed, 0xd6, 0x07, 0x32, 0x8b, 0xe7,
+  0xa4, 0xf5, 0x37, 0x1a, 0xd1, 0x5b, 0xd2, 0xfa, 0x27, 0x4d, 0x7c, 0x12, 0x91, 0x56, 0x0a, 0xc3,
+  0xc2, 0x54, 0x92, 0x60, 0x32, 0x1c, 0x13, 0xef, 0xd3, 0x34, 0x89, 0x97, 0x91, 0xdf, 0xf6, 0xe2,
+  0x30, 0x4e, 0x06, 0xb7, 0x24, 0x69, 0x2a, 0xf9, 0x38, 0x43, 0xbd, 0x11, 0x25, 0xe0, 0x0c, 0xe7,
+  0x41, 0xd4, 0x9e, 0x51, 0x26, 0xe1, 0xae, 0xeb, 0xde, 0xce, 0x86, 0x7e, 0x90, 0x2e, 0x42, 0xb2,
+  0x1a, 0x4c, 0x42, 0x7a, 0x3f, 0xc4, 0x5f, 0x6d, 0x3f, 0x48, 0xa8, 0xc7, 0xa6, 0x05, 0xe8, 0xcb,
+  0x79, 0x34, 0xfc, 0x63, 0x99, 0x66, 0xc1, 0x64, 0xd5, 0x16, 0x2b, 0x3e, 0x48, 0x17, 0x04, 0x56,
+  0x7a, 0x4c, 0xb3, 0x3b, 0x4a, 0x23, 0x35, 0x43, 0x94, 0x92, 0xc6, 0xd0, 0x20, 0x0c, 0x22, 0x4a,
+  0x92, 0xf6, 0x14, 0x25, 0x0b, 0x58, 0xcd, 0xee, 0x69, 0xdf, 0xa7, 0xd3, 0x96, 0x58, 0x33, 0xcb,
+  0x7d, 0xd2, 0x7a, 0xdc, 0x23, 0xf8, 0x03, 0x42, 0x76, 0x9f, 0x38, 0x9b, 0x47, 0x9d, 0x39, 0x01,
+  0xe6, 0xc4, 0x20, 0x6b, 0x83, 0xaf, 0x22, 0x07, 0x1e, 0xfc, 0xa2, 0xc9, 0x90, 0x80, 0xaa, 0x44,
+  0xed, 0x20, 0xa3, 0xf3, 0x54, 0x36, 0x21, 0xf8, 0xa0, 0x0b, 0xc4, 0x10, 0x14, 0xe8, 0xd1, 0x64,
+  0xad, 0xf1, 0xa4, 0xc4, 0x83, 0xca, 0xe2, 0x0c, 0xcd, 0xb5, 0x17, 0x9d, 0x7a, 0x9b, 0xc3, 0x57,
+  0x8d, 0x6b, 0x03, 0xef, 0xe7, 0x2f, 0xce, 0x90, 0x29, 0x3a, 0xca, 0xf0, 0xc9, 0x70, 0x4e, 0xee,
+  0xb9, 0xde, 0x0f, 0xce, 0x98, 0x10, 0xe2, 0x5b, 0x9a, 0x4c, 0x42, 0xc0, 0x98, 0x05, 0xbe, 0x8f,
+  0x12, 0x8a, 0x85, 0x9a, 0x24, 0x34, 0x24, 0x59, 0x70, 0x0b, 0x1a, 0xd2, 0x41, 0xfb, 0x36, 0x79,
+  0xab, 0x91, 0x17, 0x1f, 0x55, 0xd8, 0x86, 0x83, 0x62, 0x33, 0x5a, 0xb8, 0xb5, 0x38, 0x5c, 0x86,
+  0xf9, 0x5a, 0xf4, 0x85, 0xda, 0x0e, 0x99, 0xde, 0x33, 0x39, 0x49, 0x09, 0x95, 0xb8, 0x29, 0xf2,
+  0xab, 0xb8, 0xb3, 0x66, 0x5d, 0xae, 0x99, 0xa0, 0xb6, 0x74, 0xd0, 0x3b, 0x03, 0x72, 0xec, 0xf5,
+  0x8e, 0xeb, 0xcf, 0xb9, 0xeb, 0x0e, 0xb9, 0x9e, 0x83, 0xd0, 0xb2, 0x2c, 0x9e, 0x0f, 0x9e, 0xc9,
+  0x01, 0x95, 0xfd, 0x80, 0x39, 0x59, 0xfd, 0xa2, 0xf5, 0xf4, 0x9c, 0x0a, 0x26, 0x3e, 0xb7, 0x83,
+  0xc8, 0x87, 0xb5, 0xeb, 0xe5, 0xc3, 0x2f, 0xd6, 0x31, 0x68, 0x5a, 0x90, 0xad, 0x06, 0x6e, 0xe7,
+  0xf9, 0x30, 0xe7, 0xa4, 0x8b, 0x9c, 0xec, 0x43, 0x61, 0x30, 0x18, 0xd3, 0x49, 0x9c, 0xd0, 0xb5,
+  0xd4, 0x1b, 0xdb, 0xce, 0xf1, 0xc8, 0x38, 0x05, 0xf5, 0xce, 0xe8, 0x30, 0x8b, 0x17, 0x83, 0x76,
+  0x1f, 0xd6, 0x31, 0xa4, 0x93, 0x8c, 0x3f, 0xf1, 0xd5, 0xec, 0xe1, 0xe2, 0x0a, 0x63, 0x61, 0xcf,
+  0xda, 0x6a, 0xe1, 0x2a, 0x81, 0x7f, 0x53, 0xab, 0xe5, 0x05, 0x89, 0x17, 0xd2, 0x16, 0x9b, 0x67,
+  0xaf, 0xdf, 0x6f, 0xc9, 0xff, 0xdd, 0x4e, 0x97, 0x2d, 0x5a, 0xb9, 0xc3, 0xb1, 0x9e, 0xe2, 0x92,
+  0x49, 0xae, 0xa5, 0xce, 0xa2, 0xee, 0xeb, 0xcb, 0x08, 0xcd, 0x30, 0x85, 0x79, 0x1b, 0xc7, 0x5d,
+  0xac, 0x4d, 0x79, 0xf7, 0x7a, 0x55, 0x82, 0x30, 0x30, 0x20, 0xa8, 0x8c, 0x69, 0xa8, 0xac, 0x69,
+  0x1c, 0xc6, 0xde, 0xa7, 0x8a, 0x55, 0x2b, 0x08, 0xb7, 0xe8, 0x37, 0x72, 0xcf, 0xe9, 0x18, 0x2a,
+  0xd0, 0x77, 0x5d, 0x18, 0x2d, 0x0d, 0x03, 0x34, 0x99, 0xdc, 0xe2, 0x0c, 0xdb, 0xad, 0x30, 0xd2,
+  0x29, 0x59, 0x0c, 0xba, 0x7c, 0x6e, 0x1c, 0x77, 0xcd, 0xcd, 0x76, 0x08, 0x74, 0xc7, 0x9f, 0x02,
+  0x50, 0xd8, 0xc5, 0x02, 0x6c, 0x81, 0x44, 0x1e, 0x1d, 0x44, 0x71, 0x44, 0xe5, 0x22, 0x20, 0xa7,
+  0xa6, 0xcd, 0xf6, 0x4d, 0x9f, 0xf3, 0xf8, 0xf4, 0xf4, 0x74, 0x18, 0x2f, 0x33, 0xb4, 0x25, 0x8e,
+  0xa9, 0x39, 0x69, 0x31, 0x1d, 0xd5, 0xe0, 0xa8, 0xe1, 0x07, 0x03, 0x39, 0xb0, 0x98, 0x4a, 0x36,
+  0x5b, 0xce, 0xc7, 0xeb, 0x3a, 0x6e, 0x8a, 0xef, 0xc2, 0x15, 0x20, 0x77, 0xd2, 0xb5, 0x56, 0x70,
+  0x6a, 0xea, 0x8f, 0x69, 0xd6, 0x43, 0x6f, 0x99, 0xa4, 0x20, 0xf1, 0x45, 0x1c, 0x30, 0x01, 0x6d,
+  0xe3, 0x5a, 0x77, 0x49, 0xae, 0x25, 0x42, 0x14, 0x53, 0xaf, 0xf3, 0xa7, 0xad, 0xe7, 0x4f, 0x5b,
+  0xbd, 0xd3, 0x67, 0xa0, 0x75, 0x7d, 0x63, 0x76, 0xf3, 0xf8, 0x33, 0xf0, 0x11, 0x4d, 0xa9, 0x98,
+  0xd9, 0xb7, 0xce, 0xf1, 0x0c, 0x5d, 0x52, 0xcd, 0xaa, 0x30, 0xc2, 0xa8, 0xe0, 0x03, 0x96, 0x5c,
+  0x34, 0xbb, 0x60, 0x61, 0xb9, 0x12, 0xde, 0x92, 0x70, 0x49, 0xd7, 0x18, 0xe5, 0xf8, 0x1c, 0xcf,
+  0xd1, 0x09, 0x4a, 0x7b, 0x82, 0x39, 0x5a, 0x2c, 0xc2, 0xef, 0xe3, 0xf8, 0x0b, 0x5a, 0x55, 0x76,
+  0xa4, 0x45, 0x5f, 0xb8, 0xc3, 0x86, 0x1c, 0x66, 0xe0, 0xd0, 0x06, 0x32, 0xa4, 0x98, 0x46, 0xad,
+  0x35, 0x0e, 0xc5, 0x2a, 0x9c, 0x9e, 0xef, 0xc7, 0x5c, 0x31, 0xc2, 0x68, 0x02, 0x0e, 0x20, 0x97,
+  0xcb, 0x2c, 0x14, 0x73, 0xc9, 0xef, 0x32, 0x09, 0x43, 0x8b, 0x90, 0x67, 0x2a, 0xbd, 0x09, 0x3a,
+  0x40, 0x61, 0x8e, 0xd8, 0x6b, 0x7a, 0x8c, 0x20, 0x42, 0x63, 0x6a, 0x73, 0xc7, 0x21, 0xfd, 0x62,
+  0x65, 0x60, 0xd1, 0xe5, 0x31, 0x8e, 0x43, 0x5f, 0xba, 0x99, 0x44, 0x64, 0x1b, 0xe6, 0x00, 0x9d,
+  0x64, 0xcd, 0x25, 0x04, 0x39, 0x5a, 0x1f, 0xfe, 0x19, 0x7d, 0x53, 0xd9, 0xd7, 0xef, 0x63, 0xaf,
+  0xd1, 0x37, 0xce, 0xfb, 0xb0, 0x17, 0xfa, 0x42, 0x8a, 0xe9, 0xcf, 0x12, 0x46, 0x7f, 0x90, 0x0b,
+  0xca, 0xd1, 0x83, 0x68, 0xb1, 0xcc, 0xa4, 0x2f, 0x92, 0x4a, 0xc3, 0xb4, 0xf5, 0xa1, 0x5a, 0xc3,
+  0xbb, 0xb9, 0x9b, 0x28, 0x27, 0x63, 0x05, 0x8d, 0x29, 0x89, 0x14, 0x98, 0x1b, 0x2f, 0xc1, 0x47,
+  0x47, 0x05, 0xff, 0xad, 0xe5, 0x1e, 0x8a, 0xcb, 0xfe, 0x5e, 0xd9, 0xd7, 0x41, 0xd9, 0x04, 0x67,
+  0xf8, 0x6e, 0x06, 0x82, 0x33, 0x26, 0xb2, 0x87, 0x1c, 0xb4, 0x99, 0x9d, 0x57, 0xa4, 0x0d, 0x87,
+  0x38, 0x0f, 0x4d, 0x49, 0x4f, 0x95, 0xe2, 0xe5, 0x4e, 0x60, 0x09, 0xce, 0x38, 0xf1, 0x20, 0xed,
+  0x86, 0xf0, 0x9d, 0x01, 0xb1, 0x36, 0x66, 0xa7, 0x4c, 0x22, 0x6c, 0xc5, 0x34, 0xc7, 0x83, 0xf6,
+  0xd0, 0xed, 0x57, 0xb9, 0x9e, 0x33, 0x47, 0x49, 0x9a, 0xbb, 0x1e, 0xcd, 0xc9, 0xb0, 0x27, 0x08,
+  0xac, 0xf4, 0xdf, 0xcd, 0xf6, 0xe9, 0xe2, 0xbe, 0xe0, 0xcc, 0x9e, 0x19, 0xe5, 0x81, 0x4e, 0xf3,
+  0x9c, 0x39, 0x25, 0x60, 0x09, 0x78, 0x81, 0x74, 0x9d, 0xdc, 0x52, 0x7f, 0xad, 0x42, 0xf5, 0x24,
+  0xb8, 0xa7, 0x3e, 0x4b, 0x3c, 0x98, 0x2d, 0x25, 0x22, 0xc5, 0xd0, 0x5c, 0x15, 0x63, 0xb4, 0xb7,
+  0xdf, 0xa2, 0x8a, 0xc2, 0x88, 0xa5, 0xd4, 0xbc, 0x9a, 0xaa, 0x5d, 0xc0, 0xad, 0x8b, 0x56, 0x31,
+  0xe9, 0xff, 0x69, 0xf6, 0x18, 0x25, 0x6d, 0x85, 0x14, 0x54, 0x5e, 0xf1, 0x6c, 0x93, 0xb3, 0x96,
+  0xf4, 0xa9, 0x54, 0xc7, 0xe5, 0x69, 0x83, 0x21, 0x9c, 0x4e, 0x3a, 0x8b, 0xef, 0xd6, 0x95, 0x2c,
+  0xb8, 0x0e, 0x4b, 0x69, 0xe2, 0x0c, 0x17, 0xa6, 0x9c, 0xcf, 0xea, 0x12, 0x73, 0x4b, 0xea, 0xa2,
+  0x69, 0x62, 0x6f, 0x47, 0x66, 0x93, 0x9b, 0x95, 0x1a, 0xcf, 0x92, 0x29, 0xd7, 0xe0, 0x14, 0xa9,
+  0xa3, 0x9a, 0x00, 0x5f, 0x38, 0xde, 0xba, 0xa4, 0xd3, 0x15, 0xfe, 0x3e, 0x8c, 0x09, 0xc2, 0xb6,
+  0x51, 0xa7, 0xc0, 0x7c, 0xd7, 0xd5, 0xc9, 0xa7, 0xcb, 0x33, 0x4f, 0x57, 0xb7, 0xeb, 0xbc, 0x46,
+  0x33, 0xd3, 0x4e, 0x5d, 0xa4, 0x4f, 0x9d, 0xe1, 0x03, 0xab, 0x24, 0xb9, 0x12, 0xcf, 0xe1, 0x1f,
+  0xae, 0xc4, 0x22, 0x88, 0xd0, 0x69, 0xf2, 0xf1, 0xfb, 0x5a, 0x40, 0x62, 0xcf, 0xc2, 0xf6, 0x51,
+  0xbe, 0xc0, 0x75, 0xe0, 0x9b, 0x0b, 0xdb, 0x75, 0xaa, 0xf2, 0x06, 0xde, 0x02, 0xb3, 0x33, 0x0a,
+  0x53, 0x95, 0x3d, 0x90, 0x08, 0x1e, 0x98, 0x24, 0x70, 0x6c, 0xab, 0xcb, 0xf5, 0x08, 0xb8, 0x6a,
+  0x43, 0xf6, 0x66, 0x05, 0xd1, 0x04, 0x37, 0x10, 0x30, 0x93, 0xcd, 0xc8, 0xb8, 0xce, 0xab, 0x17,
+  0x72, 0xe1, 0x9c, 0x53, 0xd9, 0xd4, 0x55, 0x0c, 0xf3, 0xbc, 0x50, 0x04, 0xcd, 0xf6, 0xfd, 0x80,
+  0x2c, 0xb3, 0x78, 0xc8, 0xec, 0x82, 0xb9, 0x0b, 0xcc, 0xe3, 0xee, 0x12, 0xb2, 0xe0, 0xe3, 0x89,
+  0x00, 0x00, 0x11, 0x94, 0x81, 0x19, 0x71, 0x00, 0xb3, 0xa4, 0x82, 0xf3, 0x2a, 0xd5, 0xe0, 0x4c,
+  0x73, 0x17, 0x24, 0x01, 0x51, 0x6f, 0xf5, 0xff, 0xa5, 0xa4, 0x3a, 0xd7, 0xd2, 0x72, 0x71, 0xc3,
+  0x10, 0x54, 0xd8, 0xa7, 0x61, 0x18, 0x2c, 0xd2, 0x20, 0x2d, 0x25, 0x02, 0x79, 0x29, 0x0a, 0x9a,
+  0xc3, 0xa2, 0x1b, 0x4c, 0xa8, 0x43, 0x3c, 0xa4, 0xb1, 0xae, 0x5a, 0x09, 0x03, 0x62, 0x30, 0x20,
+  0x13, 0x34, 0xb2, 0xad, 0xe5, 0x92, 0x10, 0x6e, 0x1b, 0xfd, 0x6b, 0xad, 0xde, 0xf6, 0x0c, 0xc7,
+  0xd5, 0xae, 0x1e, 0xf9, 0xaf, 0x9f, 0xe8, 0x6a, 0x92, 0x90, 0x39, 0x4d, 0x2d, 0xd4, 0x82, 0x75,
+  0x16, 0x6b, 0xf6, 0x9f, 0xc4, 0x19, 0x18, 0x7f, 0xf3, 0xf4, 0xdc, 0x05, 0x17, 0xe7, 0x6c, 0x80,
+  0x4f, 0x58, 0xfc, 0x0c, 0x93, 0xee, 0xb6, 0xd0, 0x82, 0x75, 0x65, 0x64, 0xa8, 0xf4, 0x0d, 0xba,
+  0x72, 0xec, 0x19, 0xbe, 0x99, 0x8e, 0x9f, 0xba, 0x2d, 0xfe, 0x1f, 0xfa, 0xf3, 0xbd, 0x2a, 0xe7,
+  0x22, 0x93, 0xfb, 0x97, 0xa0, 0xee, 0xbe, 0xd2, 0x2c, 0x85, 0x81, 0xe7, 0xee, 0xb6, 0xd0, 0x2e,
+  0xb6, 0xcf, 0x1c, 0xb5, 0xcd, 0xa2, 0x58, 0xe4, 0x89, 0x5e, 0x21, 0x09, 0x31, 0xad, 0x0a, 0x95,
+  0x7e, 0x9b, 0xe2, 0xea, 0xe4, 0x78, 0xea, 0x9d, 0x93, 0x3b, 0x2d, 0x46, 0xfe, 0xa7, 0x05, 0x2f,
+  0x29, 0x39, 0x2b, 0xec, 0x19, 0xe8, 0x05, 0xc2, 0xd3, 0xf3, 0x56, 0xcf, 0xed, 0xb6, 0x7a, 0x67,
+  0x3c, 0x7f, 0xdd, 0x55, 0xce, 0x29, 0x5e, 0x96, 0xe0, 0x3e, 0xd6, 0x85, 0x24, 0x24, 0xdf, 0x4c,
+  0x78, 0x2a, 0x67, 0xc9, 0x24, 0x9e, 0x67, 0x81, 0xb7, 0x41, 0xba, 0x04, 0xfd, 0xf9, 0x0c, 0x26,
+  0x20, 0xfd, 0x6f, 0x55, 0x81, 0x59, 0x48, 0x9b, 0x0b, 0x8a, 0xd5, 0xdd, 0x77, 0x0b, 0x08, 0x47,
+  0x14, 0x96, 0x59, 0xd6, 0x08, 0xc3, 0xff, 0x97, 0xe9, 0xef, 0x90, 0x43, 0x16, 0x4f, 0xa7, 0x21,
+  0xad, 0x73, 0x9c, 0xdb, 0xf7, 0xf3, 0x2a, 0xc2, 0x45, 0xd9, 0xd3, 0xe6, 0x63, 0x54, 0x2a, 0xd1,
+  0x76, 0x8d, 0x11, 0x98, 0xe9, 0x5d, 0x90, 0x79, 0xb3, 0x75, 0xd9, 0xaa, 0xb6, 0x94, 0x1e, 0x46,
+  0xb1, 0x74, 0xa6, 0xf3, 0xc1, 0xa9, 0x59, 0x3c, 0x85, 0x57, 0x4b, 0x2d, 0xd0, 0x5c, 0x89, 0xe3,
+  0x6a, 0x08, 0x7c, 0xe7, 0xa1, 0x2c, 0xfa, 0x62, 0x72, 0xaa, 0xdb, 0x26, 0xcf, 0xd4, 0x5c, 0xe9,
+  0x04, 0xdd, 0xb2, 0x93, 0xe3, 0xc5, 0x62, 0xbe, 0x3c, 0x9d, 0xb3, 0xb4, 0xb0, 0x80, 0x05, 0xbe,
+  0x79, 0xc5, 0x2b, 0xbc, 0x44, 0x05, 0x37, 0x62, 0x91, 0x1a, 0x0d, 0xe5, 0x0d, 0x50, 0x99, 0x45,
+  0x25, 0x76, 0x2e, 0x9d, 0xf0, 0x19, 0xd3, 0x43, 0xc6, 0xd4, 0x59, 0x95, 0xef, 0xe5, 0x49, 0xe0,
+  0x56, 0xbe, 0xfa, 0x98, 0xf7, 0x30, 0xf9, 0x0d, 0xbc, 0x19, 0xf5, 0x3e, 0x51, 0xff, 0xb8, 0x20,
+  0xab, 0x9d, 0x1e, 0x7d, 0x1b, 0xb6, 0x9c, 0x62, 0x75, 0x96, 0x09, 0x13, 0x41, 0xd5, 0x60, 0x04,
+  0xda, 0x3e, 0x4d, 0xbd, 0x24, 0x58, 0x20, 0x9f, 0xd5, 0x3b, 0x57, 0xb8, 0x26, 0xfd, 0x83, 0x92,
+  0x3b, 0x88, 0x36, 0x73, 0x3c, 0xd4, 0xb0, 0x9a, 0xda, 0x6e, 0xed, 0x33, 0xd0, 0x26, 0x67, 0xad,
+  0x6d, 0x15, 0x1b, 0xe1, 0xf3, 0xc9, 0x50, 0xee, 0xe2, 0x6f, 0xd8, 0x26, 0xbd, 0x9e, 0x08, 0x6c,
+  0x78, 0xa2, 0x90, 0x0f, 0x5f, 0xdc, 0x66, 0xc0, 0x35, 0xde, 0x3c, 0x7a, 0x71, 0x22, 0x4e, 0x3d,
+  0x5e, 0x9c, 0x88, 0x03, 0x1d, 0xa4, 0x04, 0x1f, 0x7e, 0x70, 0x6b, 0x79, 0x21, 0x49, 0xd3, 0x51,
+  0xa3, 0x90, 0x23, 0x36, 0xac, 0xc0, 0x57, 0x8d, 0xef, 0x45, 0x9b, 0x89, 0x21, 0xd2, 0xb5, 0xc6,
+  0xc5, 0x8b, 0x13, 0x68, 0x45, 0xe2, 0xfc, 0x43, 0x03, 0xd1, 0xb7, 0xd2, 0x0b, 0xd8, 0x6a, 0xb6,
+  0x85, 0x76, 0xbe, 0x65, 0xca, 0xce, 0x9e, 0xba, 0xf9, 0xb1, 0x10, 0x30, 0xde, 0x85, 0xa6, 0xc5,
+  0xc5, 0x3f, 0x08, 0xc8, 0x91, 0x91, 0x4c, 0xe2, 0x10, 0x5c, 0x97, 0x75, 0xf5, 0xe6, 0xb5, 0x95,
+  0x66, 0xb0, 0x4c, 0x78, 0x12, 0x34, 0x09, 0xa6, 0xcb, 0x84, 0x25, 0x74, 0x2f, 0x4e, 0x16, 0x95,
+  0x1c, 0x55, 0x33, 0x63, 0xa4, 0x77, 0xd8, 0xc7, 0xab, 0x30, 0xad, 0xdb, 0x6a, 0x58, 0x71, 0xe4,
+  0x85, 0x81, 0xf7, 0x69, 0xd4, 0xb8, 0x83, 0xac, 0x35, 0xbe, 0x83, 0xac, 0xda, 0x63, 0x43, 0x75,
+  0x66, 0x09, 0x9d, 0x8c, 0xec, 0x13, 0xbb, 0x71, 0xf1, 0x33, 0x49, 0x03, 0xef, 0xc5, 0x09, 0xc7,
+  0x7e, 0x20, 0x19, 0xe2, 0xdf, 0x62, 0xec, 0xf0, 0x81, 0xdc, 0x4f, 0xe2, 0x71, 0x2b, 0x45, 0xee,
+  0xbb, 0x77, 0xd3, 0xa5, 0x93, 0x09, 0xf5, 0xb2, 0x14, 0xc8, 0xbe, 0xe1, 0x4f, 0x5f, 0xc9, 0x27,
+  0xe4, 0x4b, 0x33, 0x20, 0xf6, 0x6e, 0x19, 0x66, 0x41, 0x1b, 0x17, 0x29, 0x4e, 0xbe, 0x92, 0x62,
+  0x04, 0xae, 0x3f, 0x4e, 0x3e, 0x01, 0xd1, 0x5f, 0xf8, 0xd3, 0x57, 0xd2, 0x03, 0x3b, 0x9b, 0x46,
+  0x31, 0x04, 0x19, 0x0f, 0x67, 0xfd, 0x3a, 0x7f, 0xd3, 0xe8, 0x72, 0x0d, 0x31, 0x94, 0x21, 0xdf,
+  0xb5, 0x46, 0x4d, 0x60, 0x81, 0xe5, 0xe2, 0x0a, 0x5d, 0x9e, 0xf5, 0x2e, 0xf6, 0x41, 0x13, 0x79,
+  0xcb, 0xa3, 0x17, 0x29, 0x0d, 0x41, 0x8c, 0xdc, 0x4e, 0xb0, 0x1b, 0x7b, 0x19, 0x53, 0x33, 0xdc,
+  0xe2, 0x04, 0xfb, 0xa0, 0xd9, 0x95, 0x6c, 0x6f, 0x66, 0xb3, 0x20, 0xed, 0xb0, 0xd4, 0xc4, 0x69,
+  0x58, 0xcc, 0x1a, 0x91, 0xed, 0xf2, 0xfe, 0x49, 0x79, 0x83, 0xe7, 0x59, 0x45, 0xe8, 0x57, 0x5b,
+  0x56, 0x13, 0x23, 0xb5, 0x2f, 0x84, 0x3f, 0x64, 0x3f, 0x66, 0xee, 0xcb, 0x62, 0x23, 0x8f, 0x1a,
+  0x6e, 0xe3, 0xe2, 0x06, 0x32, 0x13, 0x30, 0x21, 0xd0, 0x29, 0xde, 0x55, 0x82, 0xe9, 0x36, 0xc0,
+  0xc8, 0x82, 0x68, 0x1c, 0xdf, 0xd5, 0x82, 0xf4, 0x1a, 0x17, 0xaf, 0x90, 0x03, 0xeb, 0x5f, 0x50,
+  0x32, 0xd7, 0x42, 0x9d, 0x82, 0x3d, 0x24, 0x94, 0xc0, 0xcc, 0xa3, 0x69, 0x2d, 0xd0, 0x19, 0x70,
+  0x84, 0xb5, 0x51, 0x2d, 0x40, 0x1f, 0xc7, 0x9a, 0xd3, 0xac, 0x16, 0xe0, 0xbc, 0x71, 0x71, 0xbd,
+  0x0c, 0xd3, 0x7a, 0x3e, 0x9e, 0x36, 0x2e, 0xde, 0x06, 0x49, 0x7d, 0xff, 0xb3, 0xc6, 0xc5, 0x07,
+  0xf0, 0x3a, 0x58, 0x66, 0xbf, 0x9a, 0x91, 0x2d, 0x84, 0x9e, 0x83, 0x12, 0x41, 0x62, 0x66, 0xdd,
+  0x78, 0x24, 0xaa, 0x17, 0x1f, 0xc8, 0xf8, 0x5d, 0xcc, 0x5a, 0xae, 0x49, 0x02, 0xda, 0x16, 0xd2,
+  0x54, 0x03, 0x3e, 0xe1, 0x5a, 0x53, 0xe9, 0x9b, 0xaa, 0x14, 0x8f, 0xdb, 0xaa, 0x75, 0xb3, 0xa0,
+  0xe8, 0x06, 0xa4, 0xea, 0xe9, 0x5e, 0xb8, 0x70, 0xea, 0x81, 0xa8, 0x2c, 0x7c, 0x59, 0xd9, 0x6a,
+  0x01, 0xfc, 0xb0, 0xfd, 0xf6, 0x86, 0x35, 0x0f, 0x22, 0x5c, 0x5a, 0x0b, 0x42, 0x0b, 0xf2, 0xe8,
+  0x36, 0x94, 0x7c, 0xe1, 0xd1, 0x20, 0xc5, 0x3d, 0x3f, 0xf7, 0x16, 0x6c, 0xd8, 0x82, 0x4e, 0xbf,
+  0xc9, 0x7b, 0x0c, 0xad, 0xae, 0x64, 0x8b, 0xf5, 0x95, 0x28, 0xfe, 0x93, 0xb5, 0x5e, 0xf4, 0xdd,
+  0x42, 0xe4, 0x38, 0x48, 0x24, 0x97, 0xe8, 0xc8, 0x21, 0x8b, 0x58, 0xfd, 0xef, 0x8b, 0x45, 0x0d,
+  0x5d, 0x29, 0x1a, 0xd5, 0xfb, 0x00, 0xf1, 0x28, 0xdc, 0xaf, 0x13, 0xd1, 0x07, 0x95, 0x60, 0x59,
+  0x1f, 0x82, 0x39, 0x85, 0x6c, 0x23, 0x75, 0xbe, 0x5a, 0x4c, 0xae, 0x10, 0xd3, 0xa9, 0x8b, 0x72,
+  0x4a, 0x33, 0xba, 0x28, 0x8a, 0xac, 0x5a, 0x66, 0x79, 0xb6, 0xf7, 0x2e, 0x45, 0x81, 0x31, 0xfa,
+  0xa3, 0x86, 0x1f, 0x7b, 0xcb, 0x39, 0x84, 0xe2, 0xce, 0x14, 0x04, 0x17, 0x52, 0x7c, 0xfc, 0x79,
+  0x75, 0xe9, 0x37, 0x6d, 0x1d, 0x9e, 0x89, 0xc1, 0x76, 0x3a, 0x98, 0x46, 0x89, 0xcb, 0x25, 0xa3,
+  0x5c, 0xaa, 0x05, 0xf1, 0xe7, 0xb3, 0xc6, 0x49, 0x1f, 0x24, 0xfd, 0xd2, 0x98, 0x28, 0xfa, 0xa2,
+  0xec, 0xa1, 0x40, 0x51, 0x11, 0xa8, 0x94, 0x21, 0x82, 0x9b, 0x4a, 0xe2, 0x34, 0x9d, 0x40, 0xf6,
+  0x62, 0xdd, 0xcd, 0x68, 0x64, 0x65, 0x33, 0x6a, 0xcd, 0xc1, 0xf5, 0xb7, 0x2c, 0xe6, 0xad, 0x2d,
+  0xf8, 0x6f, 0x41, 0xd8, 0xe6, 0xb0, 0xc5, 0x79, 0x4e, 0xad, 0xa6, 0x6b, 0x8d, 0xa0, 0x54, 0xc0,
+  0x62, 0x31, 0x83, 0xf5, 0x41, 0xfa, 0x7b, 0x2f, 0x31, 0x77, 0xc0, 0xd7, 0x9c, 0x62, 0x65, 0x50,
+  0x12, 0xa3, 0x15, 0x84, 0x24, 0x30, 0xbe, 0x9d, 0x80, 0xb4, 0x2b, 0xd8, 0x40, 0x3c, 0xfa, 0x3b,
+  0x78, 0xe7, 0x6d, 0xc1, 0xe8, 0xbd, 0x47, 0xb7, 0x78, 0x64, 0x88, 0x43, 0x6f, 0x21, 0xe3, 0x4f,
+  0xb3, 0xad, 0x41, 0x68, 0x89, 0x07, 0x56, 0xdb, 0xa2, 0xd0, 0x0d, 0x93, 0x2c, 0x64, 0x9c, 0x4c,
+  0xf2, 0xdb, 0xc2, 0xd1, 0x2b, 0x28, 0x6c, 0xe3, 0x79, 0xa5, 0xd3, 0xdf, 0xa5, 0x42, 0x48, 0x3a,
+  0xb5, 0xbc, 0x95, 0x87, 0xa9, 0xed, 0x78, 0x65, 0x09, 0xe1, 0x30, 0x45, 0x3a, 0x54, 0x41, 0x18,
+  0x17, 0x65, 0x0d, 0x41, 0x34, 0xb1, 0xde, 0x46, 0x39, 0xce, 0x8e, 0xa2, 0xdc, 0xca, 0xad, 0x97,
+  0xa2, 0x57, 0x60, 0xab, 0xdd, 0xd0, 0x95, 0xec, 0x06, 0x4a, 0xa1, 0xdc, 0x13, 0x80, 0x1e, 0xb8,
+  0xee, 0x33, 0x77, 0x3f, 0xb4, 0x6e, 0x8e, 0x86, 0x48, 0x93, 0xc9, 0x7e, 0x68, 0xbd, 0xaa, 0xd1,
+  0x84, 0x64, 0xcc, 0x64, 0x91, 0xbf, 0x69, 0xe9, 0x22, 0x59, 0x2c, 0xc2, 0x15, 0x17, 0x8f, 0xb4,
+  0x06, 0xf0, 0x10, 0x1f, 0x53, 0x6a, 0x15, 0x65, 0xb6, 0x2d, 0x4d, 0x2c, 0x6e, 0xb1, 0x15, 0x7c,
+  0x8c, 0xb9, 0xbd, 0x85, 0x4a, 0x91, 0xe0, 0x56, 0xac, 0xf5, 0x5a, 0xb4, 0x57, 0xac, 0xa2, 0xb9,
+  0x85, 0x25, 0x2a, 0x30, 0xc8, 0xed, 0x25, 0x4a, 0xe3, 0xa2, 0xdd, 0x36, 0x34, 0xc8, 0xd8, 0x67,
+  0x6a, 0x5c, 0x78, 0x73, 0xa1, 0x22, 0x15, 0xb4, 0xcd, 0x7d, 0xa5, 0x46, 0xb9, 0x53, 0x96, 0x11,
+  0x6c, 0x50, 0x08, 0xd1, 0x39, 0xac, 0xe9, 0x1d, 0x2c, 0x70, 0x0e, 0xa5, 0x92, 0x6f, 0xdb, 0x87,
+  0xa1, 0xa6, 0x78, 0x98, 0x81, 0x83, 0x2f, 0xd4, 0xe2, 0x88, 0x73, 0x8c, 0x86, 0x76, 0x05, 0x90,
+  0xe9, 0xfd, 0x6d, 0x60, 0xdd, 0x40, 0xfb, 0xcc, 0x6a, 0x16, 0xee, 0x03, 0x3a, 0xbc, 0xb4, 0x93,
+  0xa5, 0xe0, 0x2b, 0xb3, 0x14, 0xbc, 0x59, 0x41, 0x60, 0x9a, 0x4b, 0x90, 0x57, 0xf1, 0x62, 0xc5,
+  0xf6, 0x4a, 0xac, 0x23, 0x0f, 0x1e, 0x87, 0x56, 0xcf, 0xed, 0xf5, 0x8b, 0x17, 0x0c, 0x3b, 0xd6,
+  0x4f, 0x61, 0x68, 0x31, 0xb0, 0xd4, 0x02, 0x3f, 0x41, 0x13, 0x3c, 0x07, 0xaa, 0x2b, 0x20, 0xcd,
+  0xe3, 0x22, 0x2e, 0x2f, 0xd9, 0x76, 0xc3, 0x9a, 0x2e, 0x1e, 0xdd, 0x88, 0x77, 0x8b, 0xc1, 0x58,
+  0x62, 0x83, 0x71, 0xb2, 0x0c, 0xc3, 0xd5, 0x0f, 0x79, 0x34, 0x61, 0x66, 0x7f, 0xf1, 0x68, 0xb2,
+  0x8c, 0xd8, 0x35, 0x37, 0x0b, 0x4f, 0x9e, 0x18, 0x85, 0x5f, 0x20, 0x7d, 0x9c, 0x04, 0xbc, 0x96,
+  0x69, 0x3a, 0xeb, 0x60, 0xd2, 0x14, 0x05, 0x4e, 0x5a, 0xec, 0xc5, 0x38, 0x17, 0x2f, 0x33, 0x67,
+  0x0d, 0xfe, 0x82, 0x24, 0xe2, 0x6d, 0x27, 0xf4, 0x06, 0xc2, 0x7d, 0x9a, 0x59, 0x91, 0xd6, 0x35,
+  0xaa, 0x8d, 0xc6, 0xc6, 0xdc, 0x6c, 0x67, 0xa8, 0x63, 0x75, 0x98, 0x4c, 0xae, 0x40, 0x0b, 0x3b,
+  0x09, 0x9d, 0xc7, 0xb7, 0x14, 0xc0, 0x61, 0x12, 0x00, 0x85, 0xd1, 0x58, 0x70, 0xd3, 0x74, 0x46,
+  0x17, 0xeb, 0x1a, 0x2c, 0x08, 0x32, 0x0a, 0x65, 0x07, 0xd7, 0xa3, 0x3d, 0x49, 0x9a, 0x8c, 0x6c,
+  0x5a, 0x98, 0xad, 0xc0, 0x47, 0x17, 0x4f, 0xef, 0x0c, 0x51, 0x4b, 0xab, 0x6a, 0x4a, 0x2b, 0x72,
+  0xd6, 0xb5, 0x42, 0xd0, 0xad, 0x10, 0xb2, 0x11, 0xb6, 0xef, 0xf1, 0xf7, 0x0f, 0xef, 0xae, 0x46,
+  0x12, 0xf7, 0xd8, 0xde, 0xcb, 0x30, 0xed, 0x21, 0x17, 0x3d, 0xe4, 0x53, 0x48, 0x6e, 0xb4, 0xc0,
+  0xcb, 0xb0, 0x90, 0xf3, 0x35, 0x6b, 0x47, 0x16, 0x90, 0xb6, 0xf3, 0x92, 0x07, 0xeb, 0x2f, 0x5f,
+  0xec, 0x53, 0xd7, 0x76, 0x24, 0x1d, 0x72, 0xbf, 0x2f, 0x1d, 0x0e, 0x69, 0xd2, 0xc9, 0x09, 0xe1,
+  0xe1, 0x35, 0xc0, 0x12, 0x48, 0x12, 0xde, 0x41, 0xc5, 0xd6, 0x81, 0x61, 0x9b, 0x90, 0x07, 0xb4,
+  0xf8, 0x0b, 0xb9, 0x6f, 0xba, 0xad, 0xa6, 0x12, 0x54, 0x5b, 0x30, 0xe5, 0x9c, 0x34, 0x05, 0x59,
+  0xd5, 0xe2, 0xfc, 0x05, 0xb0, 0x1c, 0x49, 0xd5, 0xf0, 0x23, 0xf5, 0x2a, 0x66, 0x80, 0x29, 0x96,
+  0xd4, 0xfd, 0x4f, 0x56, 0x44, 0x0b, 0x84, 0x7a, 0x22, 0x26, 0x38, 0x50, 0x01, 0xb3, 0xa9, 0x24,
+  0x71, 0x74, 0x54, 0xd9, 0xdc, 0x11, 0xdb, 0x85, 0xce, 0x5a, 0x48, 0x44, 0x6c, 0x81, 0x8e, 0x60,
+  0x42, 0xed, 0x5c, 0x3c, 0x43, 0x83, 0xd9, 0x0e, 0x73, 0x8d, 0x1d, 0x7e, 0xf5, 0x18, 0x04, 0xfa,
+  0xc4, 0xae, 0xec, 0xc7, 0xad, 0xd1, 0xd1, 0xef, 0x3f, 0xaa, 0x6d, 0xd5, 0x76, 0xb7, 0xbf, 0x79,
+  0xf2, 0xfb, 0x86, 0x42, 0xd5, 0xba, 0xae, 0xa7, 0xd7, 0x34, 0x47, 0x76, 0x8e, 0xed, 0x6d, 0xe4,
+  0x6d, 0xd7, 0x16, 0x76, 0x9d, 0x50, 0x7f, 0xa7, 0xb4, 0x12, 0x51, 0x84, 0x29, 0x69, 0x4f, 0x13,
+  0x4a, 0xa3, 0x9d, 0x68, 0x0c, 0xca, 0x44, 0x1c, 0xc3, 0xcb, 0x4e, 0x3c, 0x04, 0x92, 0x68, 0xb0,
+  0x2e, 0x39, 0x87, 0x47, 0x47, 0xfa, 0xc0, 0x47, 0x47, 0x1a, 0x35, 0xb9, 0x10, 0x00, 0x9c, 0xeb,
+  0x77, 0x8e, 0x29, 0x72, 0x57, 0x9d, 0xfd, 0x1c, 0x4c, 0x27, 0x6a, 0x02, 0xe2, 0x00, 0x39, 0x9c,
+  0x36, 0x9c, 0x04, 0xab, 0x12, 0x70, 0x9e, 0xed, 0x8e, 0x7e, 0x4f, 0xa6, 0xe3, 0xe6, 0x8f, 0x6b,
+  0xe0, 0x63, 0xd3, 0xb2, 0x7e, 0x5c, 0xb3, 0x81, 0xd8, 0x13, 0x92, 0xda, 0x38, 0xbf, 0x6f, 0x36,
+  0xca, 0xc9, 0x2c, 0x17, 0x3e, 0xc9, 0x94, 0xdb, 0x30, 0x1c, 0xf9, 0x9b, 0x5b, 0x18, 0xf1, 0x26,
+  0x5e, 0xc2, 0xda, 0x1e, 0x1d, 0xfd, 0x20, 0x1a, 0xa5, 0x79, 0xdd, 0x64, 0x09, 0x25, 0xf3, 0xb7,
+  0x24, 0x08, 0x73, 0x6d, 0xa4, 0xe9, 0x28, 0xa2, 0x77, 0x96, 0x86, 0xd7, 0xb4, 0x4f, 0x28, 0xbe,
+  0xa5, 0x2f, 0x67, 0x9f, 0x41, 0x47, 0x41, 0xb0, 0x34, 0xed, 0xc4, 0xd1, 0x1c, 0x02, 0x0d, 0x5a,
+  0x31, 0x05, 0x0f, 0x69, 0x78, 0x39, 0x35, 0x67, 0xda, 0x01, 0xb6, 0x48, 0x07, 0x72, 0x96, 0x20,
+  0x6b, 0xda, 0x2d, 0xdb, 0xf9, 0xd5, 0xfd, 0xcd, 0x71, 0x36, 0x1c, 0x9d, 0x26, 0x49, 0x9c, 0x8c,
+  0x98, 0x7f, 0x85, 0x77, 0x2f, 0x8c, 0x53, 0x60, 0x7c, 0xb8, 0x85, 0xc1, 0x51, 0x96, 0x2c, 0xa9,
+  0xee, 0xee, 0xcd, 0x59, 0xb7, 0xfa, 0xe8, 0x7d, 0x87, 0x09, 0xcd, 0x96, 0x49, 0xb4, 0x99, 0xd0,
+  0xcc, 0x9b, 0x35, 0x71, 0x63, 0x4e, 0xb9, 0x52, 0xa8, 0x92, 0x22, 0x58, 0xd5, 0x74, 0x01, 0xd3,
+  0x04, 0x9e, 0xe5, 0x13, 0x2b, 0xf8, 0x9a, 0x8e, 0xe8, 0x97, 0xf0, 0xb5, 0x73, 0x52, 0x2e, 0xdc,
+  0xd9, 0x38, 0x1d, 0x08, 0x09, 0x30, 0x0a, 0x9f, 0xc9, 0x05, 0x93, 0x5f, 0x0c, 0x6b, 0xc8, 0xde,
+  0x9b, 0x8d, 0x37, 0xf8, 0x61, 0x31, 0x46, 0x20, 0xaa, 0x59, 0x12, 0x71, 0xd0, 0x68, 0x31, 0x00,
+  0xc4, 0x9f, 0x04, 0x11, 0x81, 0x48, 0xcd, 0xa3, 0xcc, 0x8e, 0x99, 0xe9, 0x41, 0x85, 0xf7, 0xb3,
+  0x14, 0xfe, 0x9a, 0x5f, 0xad, 0x6b, 0x6a, 0x3a, 0xfc, 0x2d, 0x9b, 0x24, 0x47, 0xf3, 0x34, 0xce,
+  0xeb, 0xf1, 0x74, 0xa8, 0x03, 0xac, 0xf9, 0xe8, 0x48, 0x47, 0xfc, 0x3f, 0xb2, 0x6d, 0x9d, 0x85,
+  0x87, 0x98, 0x76, 0xbe, 0xd6, 0x78, 0x25, 0x03, 0x33, 0xa2, 0x57, 0xbc, 0x92, 0x6f, 0x8a, 0x2c,
+  0xe9, 0xd2, 0x6f, 0xf1, 0xa1, 0xc0, 0xad, 0x43, 0x08, 0x21, 0x09, 0x99, 0xa7, 0x23, 0xdb, 0x46,
+  0x29, 0x29, 0x88, 0xd1, 0x68, 0x64, 0x47, 0xcb, 0xf9, 0x15, 0xf5, 0x53, 0xdb, 0x91, 0x20, 0xa2,
+  0x61, 0x64, 0x1f, 0x33, 0xfc, 0x21, 0x86, 0x06, 0xab, 0x88, 0xa5, 0x72, 0x01, 0x89, 0x25, 0xd3,
+  0x88, 0xed, 0x58, 0x32, 0xf2, 0x2b, 0x2c, 0x91, 0x34, 0x6c, 0xc5, 0x1a, 0xb3, 0x7c, 0x38, 0x02,
+  0x6f, 0x92, 0x23, 0xe6, 0x6d, 0xdb, 0x71, 0x73, 0x4d, 0x96, 0x98, 0xb2, 0x65, 0x3b, 0x9e, 0xae,
+  0xca, 0x12, 0x33, 0x6f, 0xdb, 0xc1, 0x6f, 0xae, 0xce, 0x8a, 0x5d, 0xd9, 0xb4, 0x1d, 0x93, 0xed,
+  0xdd, 0xdf, 0x40, 0x76, 0x96, 0x63, 0xaa, 0x26, 0x13, 0x93, 0x7b, 0x31, 0xa1, 0x6c, 0x84, 0xed,
+  0xd7, 0x51, 0x5f, 0xd4, 0x1f, 0xb5, 0x06, 0xa3, 0xc6, 0x92, 0x5a, 0x1a, 0x83, 0x14, 0xd1, 0xc3,
+  0x70, 0xd6, 0x0a, 0x64, 0xb8, 0xa6, 0x0e, 0xa5, 0xa3, 0x04, 0xe4, 0x97, 0xf6, 0x31, 0x67, 0xab,
+  0xe4, 0x2b, 0x31, 0x9e, 0xfc, 0xa0, 0x1c, 0x66, 0xfc, 0xc9, 0x59, 0x67, 0xb3, 0x24, 0xbe, 0xb3,
+  0x58, 0xa0, 0x60, 0xde, 0xce, 0xbe, 0xc1, 0x5a, 0x26, 0x11, 0x8c, 0x63, 0x25, 0x92, 0x91, 0x6c,
+  0x99, 0x0e, 0x2c, 0xfb, 0x58, 0xe1, 0xf1, 0x26, 0x67, 0xc3, 0x61, 0x2c, 0xd5, 0xfe, 0x47, 0x8a,
+  0xc5, 0xc7, 0x46, 0x7a, 0x60, 0x08, 0x19, 0x7c, 0x44, 0x1e, 0x3c, 0x18, 0x12, 0x4a, 0x4f, 0xd4,
+  0x36, 0xb6, 0xb3, 0xae, 0x29, 0x5f, 0x36, 0x52, 0xe8, 0x05, 0x44, 0xe6, 0x6e, 0x01, 0xad, 0x52,
+  0x00, 0x23, 0x43, 0x48, 0x2a, 0x21, 0x64, 0x75, 0xf6, 0x2e, 0xcf, 0xa6, 0x04, 0x7e, 0x9c, 0x3f,
+  0x42, 0xc6, 0xee, 0x85, 0x4b, 0x1f, 0x0c, 0xd5, 0x16, 0x4a, 0xf2, 0xd2, 0x7e, 0xcd, 0xc9, 0xd9,
+  0x03, 0xd9, 0x24, 0x52, 0x46, 0x7d, 0x10, 0x67, 0x6d, 0xbe, 0x1b, 0xfb, 0x90, 0x06, 0x8f, 0x1b,
+  0x12, 0xd2, 0x04, 0xe2, 0x29, 0x8f, 0x2f, 0x50, 0xc4, 0x60, 0x74, 0x11, 0xe3, 0xa3, 0xbc, 0xf9,
+  0xf4, 0x45, 0x74, 0x86, 0xe4, 0xfb, 0x63, 0xf4, 0x29, 0x8a, 0xef, 0x22, 0x4b, 0x88, 0xc1, 0xd9,
+  0xec, 0x08, 0x5c, 0xd5, 0x84, 0x6d, 0x11, 0xb5, 0x86, 0xff, 0xcf, 0xa4, 0xc8, 0x73, 0x0b, 0x2b,
+  0x8b, 0x59, 0x05, 0x2d, 0xa7, 0xdb, 0xb1, 0xae, 0x43, 0xbc, 0x9f, 0x67, 0x65, 0xc9, 0xca, 0x22,
+  0x53, 0x12, 0x44, 0x1d, 0xdb, 0x0c, 0xc1, 0x00, 0xf8, 0xb3, 0x72, 0xe8, 0xec, 0xdc, 0x8d, 0x46,
+  0x64, 0xcc, 0xf2, 0x28, 0xcd, 0xa4, 0x4c, 0x90, 0x97, 0x02, 0x04, 0x6c, 0x5d, 0x02, 0xd7, 0x66,
+  0x25, 0xdc, 0x28, 0xbe, 0xde, 0x26, 0x8a, 0x8b, 0x5d, 0xb5, 0xd6, 0x6a, 0x71, 0x6b, 0x27, 0x78,
+  0x45, 0x56, 0x34, 0x69, 0x8a, 0x80, 0x63, 0xcc, 0x0f, 0x1e, 0x5f, 0x8e, 0x4d, 0x38, 0xe9, 0xca,
+  0xbe, 0xed, 0xc9, 0xbd, 0x96, 0xa5, 0x19, 0x09, 0x59, 0x71, 0x56, 0xb9, 0x7e, 0x45, 0xa0, 0xef,
+  0x6d, 0x05, 0xf9, 0xf1, 0xe0, 0xcd, 0x3c, 0x8e, 0xd9, 0xd9, 0x68, 0xe5, 0x1c, 0x0b, 0x30, 0xdf,
+  0xdb, 0x14, 0xf3, 0x83, 0x6f, 0xdc, 0xb9, 0x36, 0x66, 0xa6, 0xba, 0x5e, 0x62, 0x17, 0x4c, 0x88,
+  0x41, 0x7c, 0xbb, 0xb3, 0xe1, 0x69, 0x3d, 0x5f, 0x8f, 0x6b, 0x8c, 0xc4, 0x4d, 0x16, 0x8f, 0x5b,
+  0x65, 0xbb, 0x2b, 0xac, 0x19, 0x03, 0x7e, 0xc9, 0x80, 0x47, 0x22, 0x88, 0x1f, 0xdb, 0x47, 0xb7,
+  0x7a, 0x46, 0xf2, 0x6d, 0x2f, 0xa2, 0x7e, 0xd2, 0x5b, 0x9e, 0xad, 0xd6, 0xfb, 0xf2, 0xbb, 0x9b,
+  0x54, 0x7e, 0x46, 0x5b, 0x37, 0x31, 0x05, 0xf1, 0x3d, 0x4d, 0xae, 0x70, 0x02, 0x5a, 0x17, 0x1a,
+  0xf4, 0xd3, 0xce, 0xef, 0x63, 0x62, 0xf2, 0x9c, 0xa6, 0x6e, 0x46, 0xe2, 0x60, 0xe8, 0x3b, 0x98,
+  0x4c, 0xd5, 0xe1, 0x93, 0xa8, 0x86, 0xa1, 0x6d, 0x91, 0x8e, 0x7e, 0x75, 0x5b, 0xdd, 0xde, 0x33,
+  0xfc, 0x72, 0xee, 0x6f, 0x9d, 0x39, 0x59, 0x34, 0x9b, 0x72, 0xd7, 0xb0, 0x15, 0x38, 0xa3, 0x0b,
+  0xf9, 0x72, 0x0c, 0x19, 0xd7, 0x71, 0x6d, 0x91, 0xae, 0x9d, 0x93, 0xd9, 0xc7, 0x81, 0xc3, 0xd3,
+  0xc1, 0x4e, 0xba, 0x1c, 0xe3, 0x4d, 0x39, 0x88, 0x38, 0x5d, 0x90, 0xc0, 0x1f, 0x71, 0x10, 0xb1,
+  0xfd, 0x1f, 0xbd, 0xda, 0x10, 0x2c, 0xbd, 0xe4, 0xac, 0xd8, 0xc7, 0xec, 0xf3, 0x6b, 0xa4, 0xf9,
+  0x83, 0x2e, 0xcd, 0x62, 0x7d, 0xa2, 0xe7, 0xc4, 0xce, 0x70, 0xd7, 0x6c, 0x6c, 0x31, 0x8f, 0x91,
+  0x7d, 0x6e, 0x0f, 0xeb, 0xd6, 0x65, 0x9f, 0x2c, 0x5a, 0x4b, 0x9b, 0x79, 0xba, 0x29, 0x66, 0x6d,
+  0xdd, 0x91, 0x14, 0x4f, 0x45, 0xf8, 0xb1, 0x0d, 0x66, 0xed, 0x0c, 0x4c, 0x71, 0x68, 0xa4, 0x9a,
+  0x78, 0x35, 0x32, 0x5f, 0x40, 0x29, 0xc2, 0xa9, 0x12, 0xa1, 0xda, 0xdb, 0x02, 0x71, 0x55, 0xca,
+  0x69, 0xef, 0xe9, 0x32, 0x29, 0x89, 0xc6, 0xa1, 0x94, 0xae, 0xc7, 0x34, 0xa8, 0x13, 0xd2, 0x68,
+  0x9a, 0xcd, 0x40, 0x65, 0x4f, 0x21, 0xc9, 0xd6, 0xda, 0x27, 0x71, 0xf2, 0x86, 0x00, 0x47, 0x4d,
+  0x5c, 0x40, 0xa6, 0x38, 0xeb, 0xc3, 0x94, 0x65, 0x64, 0x3f, 0xe6, 0xab, 0xcf, 0xbf, 0x2c, 0xda,
+  0xc9, 0xe2, 0xab, 0xf8, 0x8e, 0x26, 0xaf, 0x08, 0x6e, 0x08, 0x6e, 0x74, 0xfd, 0xaf, 0xd6, 0x7d,
+  0x4b, 0x5c, 0x1d, 0x95, 0x77, 0x1e, 0x50, 0xe6, 0xa6, 0x51, 0x83, 0x8c, 0xe5, 0xfd, 0x46, 0x79,
+  0x5e, 0x96, 0x5b, 0x82, 0x68, 0x18, 0xad, 0x55, 0x29, 0x3e, 0xd8, 0x72, 0x38, 0xa3, 0x0a, 0x78,
+  0xce, 0x7b, 0x0b, 0xfc, 0x5b, 0x10, 0x5e, 0x31, 0xd1, 0x0c, 0xb6, 0x5d, 0x33, 0x91, 0x40, 0x0a,
+  0x91, 0x5f, 0x34, 0xbf, 0x99, 0x05, 0x93, 0xac, 0x1e, 0x51, 0x03, 0x52, 0x88, 0xd2, 0x2c, 0x55,
+  0xf0, 0xaf, 0x47, 0x2f, 0x81, 0x2a, 0x22, 0xb7, 0x34, 0x8c, 0xf1, 0xbe, 0xf8, 0x1e, 0x44, 0x4a,
+  0xa0, 0x39, 0x27, 0x09, 0xf5, 0x03, 0x26, 0xe2, 0xb7, 0xc4, 0xcb, 0x40, 0xd9, 0xeb, 0x19, 0x29,
+  0x40, 0x96, 0x26, 0x73, 0xfd, 0x37, 0x28, 0xb1, 0x76, 0x4f, 0x84, 0x81, 0x95, 0x90, 0x2f, 0xf7,
+  0x43, 0xbe, 0x34, 0x90, 0xc7, 0x46, 0x65, 0x56, 0x8f, 0x6d, 0xc2, 0x01, 0xba, 0x38, 0xbc, 0x69,
+  0x99, 0x47, 0x3b, 0x83, 0xbd, 0x4f, 0x8b, 0x14, 0x81, 0x79, 0xbc, 0xe7, 0x32, 0x16, 0x00, 0x73,
+  0x12, 0x1b, 0xb9, 0x1b, 0x19, 0xfb, 0x2b, 0xb6, 0x69, 0xff, 0xf1, 0x1f, 0x57, 0x37, 0x94, 0x24,
+  0xde, 0x8c, 0x25, 0x84, 0x69, 0x53, 0xd3, 0x69, 0xa9, 0xe7, 0x1d, 0xd5, 0x64, 0xe8, 0xae, 0xea,
+  0xd6, 0x1a, 0x0d, 0x1d, 0x55, 0x00, 0x5a, 0x63, 0x59, 0x17, 0x85, 0x22, 0x28, 0xe0, 0x12, 0xc0,
+  0x09, 0x1e, 0xf5, 0x95, 0x54, 0xaa, 0x88, 0x56, 0x02, 0x60, 0x68, 0x25, 0x7d, 0xcb, 0x87, 0x29,
+  0xf4, 0x70, 0x70, 0x43, 0xb7, 0x4a, 0x2c, 0xb1, 0x66, 0x03, 0xf0, 0xb2, 0x1a, 0xf0, 0x52, 0x01,
+  0x16, 0x74, 0x46, 0x41, 0x9a, 0xed, 0xb9, 0x66, 0x88, 0xa2, 0x31, 0x07, 0x34, 0x75, 0xa1, 0xa4,
+  0x01, 0x0a, 0xae, 0xd0, 0xb1, 0x31, 0x02, 0x27, 0x4b, 0x43, 0xec, 0xd6, 0x7a, 0x4e, 0xb3, 0x59,
+  0xec, 0x0f, 0xec, 0xeb, 0xf7, 0x37, 0x1f, 0xec, 0x16, 0xea, 0xc0, 0x00, 0x7f, 0x6d, 0x76, 0x45,
+  0x83, 0x07, 0x47, 0xcd, 0x9a, 0x40, 0x28, 0x43, 0x1b, 0x5e, 0x6d, 0x90, 0x37, 0xca, 0x95, 0x5b,
+  0xad, 0xba, 0x97, 0x60, 0x3b, 0x0f, 0xd9, 0x81, 0x4a, 0x4b, 0xb1, 0x54, 0xdd, 0x7d, 0x80, 0x68,
+  0x41, 0x0f, 0x8a, 0xa6, 0x15, 0xd1, 0x40, 0x13, 0x30, 0x6b, 0x7a, 0x78, 0x50, 0x2d, 0x05, 0x09,
+  0x1e, 0x56, 0xe7, 0x31, 0xce, 0xe6, 0x4a, 0x76, 0x7e, 0xf9, 0x72, 0xe6, 0x0e, 0x77, 0xd3, 0xa8,
+  0xba, 0x95, 0x78, 0x38, 0xb9, 0x8a, 0x00, 0xc4, 0xa9, 0x68, 0x1d, 0x5f, 0xbe, 0xec, 0x47, 0xa0,
+  0x96, 0xa3, 0x7d, 0x69, 0x55, 0x04, 0x35, 0x4e, 0x40, 0xeb, 0xd8, 0x97, 0x40, 0x2d, 0x33, 0xfb,
+  0xd2, 0xaa, 0x0d, 0x91, 0xfc, 0x72, 0x02, 0x33, 0xea, 0x26, 0xb7, 0x83, 0x1a, 0x67, 0x07, 0xe4,
+  0x3b, 0x3d, 0x7e, 0x19, 0xe1, 0x80, 0x61, 0xaa, 0x18, 0xff, 0x53, 0x47, 0xac, 0x0d, 0xdb, 0xe5,
+  0x61, 0x6a, 0xdc, 0x31, 0x0e, 0xd3, 0x3d, 0x78, 0x98, 0xbd, 0x26, 0xf6, 0x35, 0x23, 0xd6, 0xe5,
+  0x12, 0x15, 0xe2, 0x2b, 0x40, 0x22, 0xf9, 0xfe, 0xa1, 0xe4, 0xf7, 0x5b, 0xa8, 0x07, 0x8d, 0x54,
+  0x95, 0xd4, 0xd4, 0x2b, 0x01, 0x03, 0xdb, 0x4f, 0x42, 0x3a, 0xc6, 0x41, 0x8a, 0x76, 0xf8, 0x18,
+  0x97, 0xfb, 0x31, 0x7f, 0x29, 0x09, 0xbb, 0x87, 0x51, 0x3e, 0x88, 0xfb, 0xf2, 0x20, 0x18, 0xea,
+  0xf6, 0x4d, 0xec, 0x9c, 0x83, 0x53, 0x40, 0xee, 0x69, 0xcc, 0xde, 0x2f, 0x5f, 0x26, 0x24, 0x4c,
+  0xe9, 0x9e, 0x23, 0xb3, 0xed, 0xf2, 0xfd, 0x86, 0x16, 0xa0, 0xba, 0xbf, 0x2c, 0x74, 0xa2, 0x9f,
+  0xdb, 0x36, 0x6c, 0x31, 0x11, 0x75, 0x0e, 0x4e, 0x59, 0xf9, 0xb0, 0x85, 0x3b, 0x4d, 0x7c, 0x8f,
+  0x78, 0x9f, 0x79, 0x97, 0xf2, 0x58, 0xe7, 0xf0, 0x94, 0x57, 0x06, 0x3f, 0xa3, 0xbb, 0xc0, 0x03,
+  0x84, 0xf0, 0xe5, 0x42, 0x85, 0x78, 0xfe, 0x97, 0x7f, 0xf4, 0x7a, 0x7d, 0x47, 0x19, 0x59, 0xca,
+  0x61, 0xca, 0x05, 0x65, 0xe5, 0x00, 0xb2, 0xa0, 0xe4, 0xef, 0xf9, 0x71, 0xd7, 0x7f, 0x96, 0x34,
+  0x59, 0xf1, 0x2b, 0xdd, 0x71, 0x02, 0x49, 0x52, 0xd3, 0x7e, 0x9c, 0xe7, 0xe0, 0x8f, 0x4b, 0x3e,
+  0xbe, 0xf5, 0xb8, 0xe4, 0x1d, 0x01, 0xaa, 0xe0, 0x60, 0x72, 0x3c, 0x66, 0xb2, 0xf9, 0xab, 0xb0,
+  0xc7, 0xa1, 0xe0, 0x42, 0x55, 0xe7, 0xfc, 0x5d, 0x64, 0x5a, 0x19, 0xbf, 0xcf, 0x2c, 0x0e, 0xd4,
+  0xea, 0x0f, 0xe6, 0x18, 0x4e, 0x27, 0xf0, 0x8f, 0xe5, 0x89, 0x9b, 0x20, 0xdb, 0x91, 0xdf, 0xac,
+  0x90, 0x12, 0x81, 0xc9, 0xeb, 0x14, 0x6b, 0xbe, 0x43, 0xb1, 0x31, 0xf2, 0x30, 0xe2, 0xfb, 0xf2,
+  0x9e, 0xfb, 0x4d, 0x08, 0x79, 0x9b, 0x56, 0x91, 0xf3, 0xd6, 0x1a, 0x09, 0x36, 0x6d, 0x36, 0xf6,
+  0xaf, 0xec, 0xaf, 0x73, 0x36, 0x52, 0x9d, 0x44, 0xe3, 0x37, 0xf9, 0x4d, 0x5c, 0x7e, 0x5d, 0x44,
+  0x76, 0x3a, 0x6b, 0x1c, 0x8c, 0x0d, 0x22, 0x9b, 0xc4, 0x3d, 0x0d, 0x7e, 0x31, 0x4e, 0xee, 0xcd,
+  0xf0, 0x23, 0x3f, 0xf1, 0xbd, 0x06, 0x02, 0x2b, 0x89, 0x27, 0x82, 0xfc, 0xcf, 0x7c, 0x5a, 0x93,
+  0x20, 0xc1, 0x9b, 0x0d, 0xfa, 0xcd, 0x0c, 0x7e, 0xff, 0xf3, 0x4f, 0x9c, 0xc4, 0x2f, 0xf8, 0xb5,
+  0xbe, 0xda, 0x39, 0x88, 0xe1, 0x0e, 0x9e, 0x46, 0x04, 0x54, 0xf1, 0x7c, 0x93, 0xe3, 0xb3, 0x29,
+  0x28, 0xa6, 0x40, 0x2e, 0xec, 0xa2, 0x17, 0xde, 0x67, 0xa5, 0x11, 0x05, 0xbe, 0x5e, 0xbf, 0x7f,
+  0x27, 0x56, 0xee, 0x0a, 0xec, 0x01, 0xb8, 0x68, 0x69, 0x8b, 0x5c, 0xbc, 0x67, 0xb6, 0xd5, 0xdc,
+  0xb5, 0x3c, 0xd8, 0x59, 0x57, 0x67, 0xdd, 0x9b, 0x6d, 0xf8, 0x6a, 0x73, 0x8a, 0x63, 0xab, 0x1d,
+  0xb0, 0xad, 0x48, 0xfa, 0x7e, 0x33, 0x62, 0xfe, 0x79, 0x69, 0xbd, 0x49, 0xb9, 0x90, 0x44, 0xab,
+  0x9e, 0xe1, 0x83, 0xbf, 0x6b, 0x54, 0x22, 0xb5, 0xb7, 0xc3, 0x2a, 0xf8, 0xa9, 0xfa, 0x05, 0x31,
+  0xbe, 0x62, 0x0d, 0xc3, 0xf3, 0x7b, 0x49, 0xe2, 0xc4, 0x7c, 0x64, 0xe3, 0xf7, 0x68, 0xec, 0x8d,
+  0x83, 0x5f, 0x22, 0x11, 0x17, 0xc6, 0xe1, 0x51, 0x7c, 0x7d, 0x9b, 0xfd, 0x4d, 0xdd, 0x8b, 0xff,
+  0x02, 0x03, 0x6a, 0x4e, 0x57, 0xc6, 0x57, 0x00, 0x00,
+};
+const size_t page_effects_gz_len = 5337;
+
+// GET /mesh
+const uint8_t page_mesh_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x8e, 0x1b, 0x49,
+  0x96, 0xd8, 0x7b, 0x7d, 0x45, 0x88, 0xea, 0x56, 0x32, 0x57, 0x24, 0x8b, 0x64, 0x5d, 0x24, 0x91,
+  0x62, 0xc9, 0xea, 0x52, 0x6b, 0xb6, 0x60, 0xa9, 0x47, 0x50, 0xa9, 0x67, 0x66, 0xd1, 0xd3, 0x86,
+  0x92, 0xcc, 0x60, 0x31, 0x47, 0x64, 0x26, 0x37, 0x33, 0x59, 0xa5, 0x6a, 0x8a, 0x3f, 0x60, 0xc0,
+  0x4f, 0xde, 0x27, 0xbf, 0x2c, 0xec, 0x17, 0x03, 0x06, 0xfc, 0x60, 0xc0, 0x80, 0xdf, 0xfd, 0x29,
+  0xfe, 0x02, 0x7f, 0x82, 0xcf, 0x89, 0x7b, 0x44, 0x5e, 0x48, 0x56, 0x69, 0x67, 0xba, 0x17, 0x96,
+  0xba, 0x45, 0x32, 0x32, 0xe2, 0xc4, 0x39, 0x27, 0xce, 0x2d, 0x4e, 0x5c, 0xf2, 0xf9, 0x83, 0x57,
+  0xbf, 0x3f, 0xff, 0xf0, 0x0f, 0xef, 0xbe, 0x27, 0xb3, 0x7c, 0x31, 0x3f, 0x3b, 0x78, 0x8e, 0x1f,
+  0x64, 0x1e, 0xc4, 0x57, 0xa3, 0x06, 0x8d, 0x1b, 0x58, 0x40, 0x83, 0x10, 0x3e, 0x16, 0x34, 0x0f,
+  0xc8, 0x64, 0x16, 0xa4, 0x19, 0xcd, 0x47, 0x8d, 0x1f, 0x3f, 0xbc, 0x6e, 0x3f, 0x6d, 0xc8, 0xe2,
+  0x59, 0x9e, 0x2f, 0xdb, 0xf4, 0x1f, 0x57, 0xd1, 0xf5, 0xa8, 0x71, 0x9e, 0xc4, 0x39, 0x8d, 0xf3,
+  0xf6, 0x87, 0xdb, 0x25, 0x6d, 0x90, 0x09, 0xff, 0x35, 0x6a, 0xe4, 0xf4, 0x73, 0x7e, 0x88, 0xb0,
+  0x87, 0x0a, 0xc8, 0x2a, 0x9f, 0x72, 0x18, 0x79, 0x94, 0xcf, 0xe9, 0xd9, 0xcb, 0xc5, 0x38, 0xba,
+  0xa4, 0x71, 0x46, 0xc9, 0x17, 0xf2, 0x81, 0x4e, 0x66, 0xef, 0x92, 0x2c, 0xcf, 0xc8, 0x5b, 0x1a,
+  0x46, 0xc1, 0xf3, 0x43, 0x5e, 0x45, 0x74, 0x17, 0x07, 0x0b, 0x3a, 0xf2, 0xae, 0x23, 0x7a, 0xb3,
+  0x4c, 0xd2, 0xdc, 0x53, 0x9d, 0x78, 0x37, 0x51, 0x98, 0xcf, 0x46, 0x21, 0xbd, 0x8e, 0x26, 0xb4,
+  0xcd, 0x7e, 0xb4, 0x48, 0x14, 0x47, 0x79, 0x14, 0xcc, 0xdb, 0xd9, 0x24, 0x98, 0xd3, 0x51, 0xcf,
+  0x03, 0x20, 0x59, 0x7e, 0x8b, 0xc0, 0x06, 0x69, 0x92, 0xe4, 0xeb, 0x76, 0x7b, 0x99, 0x46, 0x8b,
+  0x20, 0xbd, 0x1d, 0x3c, 0x3c, 0x3e, 0x3a, 0xed, 0x51, 0x3a, 0x54, 0x25, 0xed, 0x79, 0x74, 0x35,
+  0xcb, 0xa1, 0xfc, 0xe9, 0xb3, 0x13, 0x3a, 0x85, 0xf2, 0x6c, 0x35, 0x99, 0xd0, 0x2c, 0x83, 0x92,
+  0xc9, 0xe4, 0xd9, 0xb4, 0x0b, 0x25, 0xe3, 0xab, 0x76, 0x18, 0xa4, 0x9f, 0x06, 0x0f, 0x7b, 0x7d,
+  0xfc, 0xcb, 0x4b, 0x26, 0x41, 0x1a, 0x42, 0x09, 0xc5, 0xbf, 0x50, 0x82, 0xa4, 0x0f, 0x1e, 0x4e,
+  0xd9, 0x1f, 0xf1, 0xb3, 0x9d, 0x51, 0x40, 0x3a, 0x64, 0xbd, 0x8e, 0xbb, 0xf8, 0x17, 0x5b, 0x26,
+  0x69, 0x48, 0xd3, 0x76, 0x1a, 0x84, 0xd1, 0x2a, 0x1b, 0xf4, 0xfa, 0xcb, 0xcf, 0xd8, 0xe5, 0x2c,
+  0x08, 0x93, 0x9b, 0x41, 0x97, 0xf4, 0xba, 0xcb, 0xcf, 0xa4, 0x8f, 0xff, 0xa4, 0x57, 0xe3, 0xa0,
+  0xd9, 0x6d, 0xb1, 0xbf, 0x9d, 0x23, 0x1f, 0x41, 0xa6, 0x41, 0x9c, 0x01, 0x99, 0x49, 0x3c, 0x08,
+  0xe6, 0x73, 0x02, 0xa5, 0x19, 0xa1, 0x41, 0x46, 0x37, 0x07, 0x7f, 0xb7, 0x06, 0x42, 0xae, 0xa2,
+  0x78, 0xd0, 0x1d, 0x2e, 0x83, 0x30, 0x8c, 0xe2, 0x2b, 0xf8, 0x36, 0x4e, 0x3e, 0xb7, 0xb3, 0xe8,
+  0x17, 0xfc, 0x21, 0xfa, 0x84, 0x92, 0xcd, 0xc1, 0x38, 0x09, 0x6f, 0xd7, 0x53, 0xe0, 0x65, 0x7b,
+  0x1a, 0x2c, 0xa2, 0xf9, 0xed, 0xc0, 0xbb, 0xa4, 0x57, 0x09, 0x25, 0x3f, 0x5e, 0x78, 0xad, 0x0f,
+  0xc1, 0x2c, 0x59, 0x04, 0xad, 0xdf, 0xd1, 0x98, 0x5e, 0x07, 0xad, 0x3f, 0xd0, 0x34, 0x0c, 0xe2,
+  0xa0, 0x95, 0x41, 0xb7, 0x40, 0x4a, 0x1a, 0x4d, 0x87, 0xe3, 0x60, 0xf2, 0xe9, 0x2a, 0x4d, 0x56,
+  0x71, 0xd8, 0x9e, 0x24, 0xf3, 0x24, 0x1d, 0x5c, 0x07, 0x69, 0x53, 0xf1, 0xc7, 0x1f, 0x9a, 0x85,
+  0xc8, 0x01, 0x7f, 0xb8, 0x88, 0xe2, 0xf6, 0x8c, 0x32, 0x0e, 0xf7, 0xba, 0xdd, 0xeb, 0xd9, 0x30,
+  0x8c, 0xb2, 0xe5, 0x3c, 0xb8, 0x1d, 0x4c, 0xe7, 0xf4, 0xf3, 0x10, 0xff, 0x69, 0x87, 0x51, 0x4a,
+  0x27, 0x8c, 0x2c, 0x68, 0xbe, 0x5a, 0xc4, 0xc3, 0xbf, 0xac, 0xb2, 0x3c, 0x9a, 0xde, 0xb6, 0xc5,
+  0x88, 0x0f, 0xb2, 0x65, 0x00, 0x23, 0x3d, 0xa6, 0xf9, 0x0d, 0xa5, 0xb1, 0xa2, 0x10, 0xb9, 0x64,
+  0x20, 0x34, 0x98, 0x47, 0x31, 0x0d, 0xd2, 0xf6, 0x15, 0x72, 0x16, 0x5a, 0x35, 0x7b, 0x47, 0x27,
+  0x21, 0xbd, 0x6a, 0x89, 0x31, 0x23, 0xdd, 0x6f, 0x5b, 0x0f, 0xfb, 0x01, 0xfe, 0x05, 0x26, 0x77,
+  0xbf, 0xf5, 0x37, 0x07, 0x9d, 0x45, 0x00, 0xc8, 0x89, 0x4e, 0xd6, 0x16, 0x5e, 0x2e, 0x06, 0x13,
+  0xf8, 0x87, 0xa6, 0xc3, 0x00, 0x44, 0x25, 0x6e, 0x47, 0x39, 0x5d, 0x64, 0xb2, 0x08, 0xab, 0x0f,
+  0x7a, 0x00, 0x0c, 0xab, 0x02, 0x3c, 0x9a, 0xae, 0x0d, 0x9c, 0x14, 0x7b, 0x50, 0x58, 0xfc, 0xa1,
+  0x3d, 0xf6, 0xe2, 0xa1, 0x59, 0xe6, 0xf3, 0x51, 0xe3, 0xd2, 0xc0, 0x9f, 0xf3, 0x1f, 0xfe, 0x90,
+  0x09, 0x3a, 0xf2, 0xf0, 0xdb, 0xe1, 0x22, 0xf8, 0xcc, 0xe5, 0x7e, 0x70, 0xcc, 0x98, 0x90, 0x5c,
+  0xd3, 0x74, 0x3a, 0x87, 0x16, 0xb3, 0x28, 0x0c, 0x91, 0x43, 0x89, 0x10, 0x93, 0x94, 0xce, 0x83,
+  0x3c, 0xba, 0x06, 0x09, 0xe9, 0xa0, 0x7e, 0xdb, 0xb8, 0x55, 0xf0, 0x8b, 0xf7, 0x2a, 0x74, 0xc3,
+  0x47, 0xb6, 0x59, 0x25, 0x5c, 0x5b, 0x7c, 0xce, 0x43, 0x3d, 0x16, 0x27, 0x42, 0x6c, 0x87, 0x4c,
+  0xee, 0x19, 0x9f, 0x24, 0x87, 0x0a, 0xd8, 0xb8, 0xf8, 0x2a, 0xec, 0xc8, 0xac, 0xc7, 0x25, 0x13,
+  0xc4, 0x96, 0x0e, 0xfa, 0xc7, 0x00, 0x8e, 0xfd, 0xbc, 0xe1, 0xf2, 0x73, 0xda, 0xed, 0x0e, 0xb9,
+  0x9c, 0x03, 0xd3, 0xf2, 0x3c, 0x59, 0x0c, 0x9e, 0xca, 0x0e, 0x95, 0xfe, 0x80, 0x3a, 0x91, 0x13,
+  0x57, 0x7b, 0xfa, 0x7e, 0x09, 0x12, 0xbf, 0xb4, 0xa3, 0x38, 0x84, 0xb1, 0xeb, 0xeb, 0xee, 0x97,
+  0xeb, 0x04, 0x24, 0x2d, 0xca, 0x6f, 0x07, 0xdd, 0xce, 0xb3, 0xa1, 0xc6, 0xa4, 0x87, 0x98, 0xec,
+  0x02, 0x61, 0x30, 0x18, 0xd3, 0x69, 0x92, 0xd2, 0xb5, 0x94, 0x1b, 0xcf, 0xd3, 0xed, 0x82, 0x71,
+  0x06, 0xe2, 0x9d, 0xd3, 0x61, 0x9e, 0x2c, 0x07, 0xed, 0x13, 0x18, 0xc7, 0x39, 0x9d, 0xe6, 0xfc,
+  0x1b, 0x1f, 0xcd, 0x3e, 0x0e, 0xae, 0x50, 0x16, 0xf6, 0xdd, 0x18, 0x2d, 0x1c, 0x25, 0xb0, 0x6f,
+  0x6a, 0xb4, 0x26, 0x51, 0x3a, 0x99, 0xd3, 0x16, 0xa3, 0xb3, 0x7f, 0x72, 0xd2, 0x92, 0xff, 0x77,
+  0x3b, 0x3d, 0x36, 0x68, 0xc5, 0x07, 0x3e, 0x79, 0x82, 0x43, 0x26, 0xb1, 0x96, 0x32, 0x8b, 0xb2,
+  0x6f, 0x0e, 0x23, 0x14, 0x03, 0x09, 0x8b, 0x36, 0xf6, 0xbb, 0x5c, 0xdb, 0xfc, 0xee, 0xf7, 0xcb,
+  0x18, 0x61, 0xb5, 0x00, 0xa7, 0x32, 0xa6, 0x73, 0xa5, 0x4d, 0xe3, 0x79, 0x32, 0xf9, 0x54, 0x32,
+  0x6a, 0x0e, 0x73, 0x5d, 0xbb, 0xa1, 0x2d, 0xa7, 0x6f, 0x89, 0xc0, 0x49, 0xb7, 0x0b, 0xbd, 0x65,
+  0xf3, 0x08, 0x55, 0x46, 0x6b, 0x9c, 0xa5, 0xbb, 0x25, 0x4a, 0x7a, 0x15, 0x2c, 0x07, 0x3d, 0x4e,
+  0x1b, 0x6f, 0xbb, 0xe6, 0x6a, 0x3b, 0x04, 0xb8, 0xe3, 0x4f, 0x11, 0x08, 0xec, 0x72, 0x09, 0xba,
+  0x10, 0xc4, 0x13, 0x3a, 0x88, 0x93, 0x98, 0xca, 0x41, 0x40, 0x4c, 0x6d, 0x9d, 0x3d, 0xb1, 0x6d,
+  0xce, 0xc3, 0xa3, 0xa3, 0xa3, 0x61, 0xb2, 0xca, 0x51, 0x97, 0x78, 0x4b, 0xc3, 0x48, 0x0b, 0x72,
+  0x54, 0x81, 0xaf, 0xba, 0x1f, 0x0c, 0x64, 0xc7, 0x82, 0x94, 0x7c, 0xb6, 0x5a, 0x8c, 0xd7, 0x55,
+  0xd8, 0xb8, 0xbf, 0x85, 0x29, 0x40, 0xec, 0xa4, 0x69, 0x2d, 0xc1, 0xd4, 0x96, 0x1f, 0x5b, 0xad,
+  0x87, 0x93, 0x55, 0x9a, 0x01, 0xc7, 0x97, 0x49, 0xc4, 0x18, 0x54, 0x87, 0xb5, 0x69, 0x92, 0xba,
+  0x44, 0xb8, 0x28, 0x26, 0x5e, 0xa7, 0x4f, 0x5a, 0xcf, 0x9e, 0xb4, 0xfa, 0x47, 0x4f, 0x41, 0xea,
+  0x4e, 0x2c, 0xea, 0x16, 0xc9, 0x2f, 0x80, 0x47, 0x7c, 0x45, 0x05, 0x65, 0xbf, 0x76, 0x8c, 0x67,
+  0x68, 0x92, 0x2a, 0x46, 0x85, 0x01, 0x46, 0x01, 0x1f, 0xb0, 0xe0, 0xa2, 0xd9, 0x03, 0x0d, 0xd3,
+  0x42, 0x78, 0x1d, 0xcc, 0x57, 0x74, 0x8d, 0x5e, 0x8e, 0xd3, 0x78, 0x8a, 0x46, 0x50, 0xea, 0x13,
+  0xd0, 0x48, 0x98, 0x87, 0xdf, 0xc5, 0xf0, 0x3b, 0x52, 0x55, 0x34, 0xa4, 0xae, 0x2d, 0xdc, 0xa2,
+  0x43, 0x3e, 0x53, 0x70, 0x28, 0x03, 0x1e, 0x52, 0x0c, 0xa3, 0xd6, 0x06, 0x86, 0x62, 0x14, 0x8e,
+  0x4e, 0x77, 0x43, 0xce, 0xf5, 0x30, 0x06, 0x83, 0x23, 0x88, 0xe5, 0x72, 0x82, 0x6c, 0x2e, 0xd8,
+  0x5d, 0xc6, 0x61, 0x28, 0x11, 0xfc, 0xcc, 0xa4, 0x35, 0x41, 0x03, 0x28, 0xd4, 0x11, 0x9f, 0xda,
+  0x16, 0x23, 0x8a, 0x51, 0x99, 0xda, 0xdc, 0x70, 0x48, 0xbb, 0x58, 0xea, 0x58, 0x4c, 0x7e, 0x8c,
+  0x93, 0x79, 0x28, 0xcd, 0x4c, 0x2a, 0xa2, 0x0d, 0xbb, 0x83, 0x4e, 0xba, 0xe6, 0x1c, 0x82, 0x18,
+  0xed, 0x04, 0xfe, 0x58, 0xcf, 0xae, 0xe4, 0xb3, 0x93, 0x13, 0x7c, 0x6a, 0x3d, 0x1b, 0xeb, 0x67,
+  0xf8, 0x14, 0x9e, 0xcd, 0x29, 0x86, 0x3f, 0x2b, 0xe8, 0xfd, 0x4e, 0x26, 0x48, 0x37, 0x8f, 0xe2,
+  0xe5, 0x2a, 0x97, 0xb6, 0x48, 0x0a, 0x0d, 0x93, 0xd6, 0xbb, 0x4a, 0x0d, 0x7f, 0xcc, 0xcd, 0x44,
+  0x31, 0x18, 0x73, 0x24, 0xa6, 0xc0, 0x52, 0x40, 0x6e, 0xbc, 0x02, 0x1b, 0x1d, 0x3b, 0xf6, 0xdb,
+  0x88, 0x3d, 0x14, 0x96, 0x27, 0x3b, 0x45, 0x5f, 0x7b, 0x45, 0x13, 0x1c, 0xe1, 0x9b, 0x19, 0x30,
+  0xce, 0x22, 0x64, 0x07, 0x3e, 0x18, 0x94, 0x9d, 0x96, 0x84, 0x0d, 0xfb, 0x18, 0x0f, 0x43, 0x48,
+  0x8f, 0x94, 0xe0, 0x69, 0x23, 0xb0, 0x02, 0x63, 0x9c, 0x4e, 0x20, 0xec, 0x06, 0xf7, 0x9d, 0x03,
+  0xb0, 0x36, 0x46, 0xa7, 0x8c, 0x23, 0x6c, 0xc4, 0x0c, 0xc3, 0x83, 0xfa, 0xd0, 0x3b, 0x29, 0x33,
+  0x3d, 0xc7, 0xbe, 0xe2, 0x34, 0x37, 0x3d, 0x86, 0x91, 0x61, 0xdf, 0xc0, 0xb1, 0xd2, 0x7f, 0x68,
+  0xb6, 0x8f, 0x96, 0x9f, 0x1d, 0x63, 0xf6, 0xd4, 0x9a, 0x1e, 0x98, 0x30, 0x4f, 0x99, 0x51, 0x02,
+  0x94, 0x00, 0x17, 0x08, 0xd7, 0x83, 0x6b, 0x1a, 0xae, 0x95, 0xab, 0x9e, 0x46, 0x9f, 0x69, 0xc8,
+  0x02, 0x0f, 0xa6, 0x4b, 0xa9, 0x08, 0x31, 0x0c, 0x53, 0xc5, 0x10, 0xed, 0xef, 0x36, 0xa8, 0x62,
+  0x62, 0xc4, 0x42, 0x6a, 0x3e, 0x9b, 0xaa, 0x1c, 0xc0, 0xda, 0x41, 0x2b, 0x21, 0xfa, 0x4f, 0xcd,
+  0x3e, 0x83, 0x64, 0x8c, 0x90, 0xaa, 0xa5, 0x67, 0x3c, 0x75, 0x7c, 0x36, 0x82, 0x3e, 0x15, 0xea,
+  0x74, 0x79, 0xd8, 0x60, 0x31, 0xa7, 0x93, 0xcd, 0x92, 0x9b, 0x75, 0x29, 0x0a, 0x5d, 0x9f, 0x85,
+  0x34, 0x49, 0x8e, 0x03, 0x53, 0x8c, 0x67, 0x4d, 0x8e, 0x75, 0x0b, 0xe2, 0x62, 0x48, 0x62, 0x7f,
+  0x4b, 0x64, 0xa3, 0xd5, 0x4a, 0xf5, 0x47, 0x64, 0xc8, 0x35, 0x38, 0x42, 0xe8, 0x28, 0x26, 0x80,
+  0x17, 0xf6, 0xb7, 0x2e, 0xc8, 0x74, 0x89, 0xbd, 0x9f, 0x27, 0x01, 0xd6, 0x6d, 0xa3, 0x4c, 0x81,
+  0xfa, 0xae, 0xcb, 0x83, 0xcf, 0x2e, 0x8f, 0x3c, 0xbb, 0xa6, 0x5e, 0xeb, 0x39, 0x9a, 0x1d, 0x76,
+  0x9a, 0x2c, 0x7d, 0xe2, 0x0f, 0xef, 0x38, 0x4b, 0x92, 0x23, 0xf1, 0x0c, 0xfe, 0xe0, 0x48, 0x2c,
+  0xa3, 0x18, 0x8d, 0x26, 0xef, 0xff, 0xc4, 0x70, 0x48, 0xec, 0xbb, 0xd0, 0x7d, 0xe4, 0x2f, 0x60,
+  0x1d, 0x85, 0xf6, 0xc0, 0xf6, 0xfc, 0xb2, 0xb8, 0x81, 0x97, 0x00, 0x75, 0xd6, 0xc4, 0x54, 0x45,
+  0x0f, 0x41, 0x0c, 0x5f, 0x18, 0x27, 0xb0, 0x6f, 0xd2, 0xe3, 0x72, 0x04, 0x58, 0xb5, 0x21, 0x7a,
+  0x23, 0x51, 0x3c, 0xc5, 0x04, 0x02, 0x46, 0xb2, 0x79, 0x30, 0xae, 0xb2, 0xea, 0x4e, 0x2c, 0xac,
+  0x31, 0x95, 0x45, 0x3d, 0x85, 0x30, 0x8f, 0x0b, 0x85, 0xd3, 0x6c, 0x7f, 0x1e, 0x04, 0xab, 0x3c,
+  0x19, 0x32, 0xbd, 0x60, 0xe6, 0x02, 0xe3, 0xb8, 0x9b, 0x34, 0x58, 0xf2, 0xfe, 0x84, 0x03, 0x00,
+  0x0f, 0xca, 0xaa, 0x59, 0x7e, 0x00, 0xa3, 0x24, 0xc7, 0x78, 0x15, 0xe6, 0xe0, 0x4c, 0x72, 0x97,
+  0x41, 0x0a, 0xac, 0xae, 0xb5, 0xff, 0x85, 0xa0, 0x5a, 0x4b, 0x69, 0x71, 0x72, 0xc3, 0x1a, 0x28,
+  0xb7, 0x4f, 0xe7, 0xf3, 0x68, 0x99, 0x45, 0x59, 0x21, 0x10, 0xd0, 0x53, 0x51, 0x90, 0x1c, 0xe6,
+  0xdd, 0x80, 0xa0, 0x4e, 0x30, 0x41, 0x18, 0xeb, 0xb2, 0x91, 0xb0, 0x6a, 0x0c, 0x06, 0xc1, 0x14,
+  0x95, 0xac, 0x76, 0xba, 0x24, 0x98, 0xdb, 0x46, 0xfb, 0x5a, 0x29, 0xb7, 0x7d, 0xcb, 0x70, 0xb5,
+  0xcb, 0x7b, 0xfe, 0x37, 0x9f, 0xe8, 0xed, 0x34, 0x0d, 0x16, 0x34, 0x23, 0x28, 0x05, 0xeb, 0x3c,
+  0x31, 0xf4, 0x3f, 0x4d, 0x72, 0x50, 0xfe, 0xe6, 0xd1, 0x69, 0x17, 0x4c, 0x9c, 0xbf, 0x01, 0x3c,
+  0x61, 0xf0, 0x73, 0x0c, 0xba, 0xdb, 0x42, 0x0a, 0xd6, 0xa5, 0x9e, 0xa1, 0xd4, 0x36, 0x98, 0xc2,
+  0xb1, 0xa3, 0xfb, 0x66, 0x32, 0x7e, 0xd4, 0x6d, 0xf1, 0xff, 0xd0, 0x9e, 0xef, 0x34, 0x73, 0x76,
+  0x91, 0xdc, 0x7d, 0x0a, 0xda, 0xdd, 0x95, 0x9b, 0x05, 0x37, 0xf0, 0xac, 0x5b, 0xe7, 0xda, 0x45,
+  0xfa, 0xcc, 0x57, 0x69, 0x16, 0x85, 0x22, 0x0f, 0xf4, 0x9c, 0x20, 0xc4, 0xd6, 0x2a, 0x14, 0xfa,
+  0x3a, 0xc1, 0x35, 0xc1, 0xf1, 0xd0, 0x5b, 0x83, 0x3b, 0x72, 0x3d, 0xff, 0x13, 0xc7, 0x4a, 0x4a,
+  0xcc, 0x9c, 0x9c, 0x81, 0x39, 0x41, 0x78, 0x72, 0xda, 0xea, 0x77, 0x7b, 0xad, 0xfe, 0x31, 0x8f,
+  0x5f, 0xb7, 0x4d, 0xe7, 0x14, 0x2e, 0x2b, 0x30, 0x1f, 0x6b, 0x27, 0x08, 0xd1, 0xc9, 0x84, 0x27,
+  0x92, 0x4a, 0xc6, 0x71, 0x1d, 0x05, 0x5e, 0x47, 0xd9, 0x0a, 0xe4, 0xe7, 0x17, 0x50, 0x01, 0x69,
+  0x7f, 0xcb, 0x26, 0x98, 0x4e, 0xd8, 0xec, 0x08, 0x56, 0x6f, 0xd7, 0x14, 0x10, 0xf6, 0x28, 0x34,
+  0xb3, 0x28, 0x11, 0x96, 0xfd, 0x2f, 0xc2, 0xdf, 0xc2, 0x87, 0x3c, 0xb9, 0xba, 0x9a, 0xd3, 0x2a,
+  0xc3, 0x59, 0x9f, 0xcf, 0x2b, 0x71, 0x17, 0x45, 0x4b, 0xab, 0xfb, 0x28, 0x15, 0xa2, 0x7a, 0x89,
+  0x11, 0x2d, 0xb3, 0x9b, 0x28, 0x9f, 0xcc, 0xd6, 0x45, 0xad, 0xaa, 0x99, 0x7a, 0x58, 0x93, 0xa5,
+  0x63, 0x13, 0x0f, 0x0e, 0x8d, 0xf0, 0x10, 0x5e, 0x0d, 0xb5, 0x68, 0xd6, 0x95, 0x6d, 0xba, 0x46,
+  0x03, 0x9e, 0x79, 0x28, 0xb2, 0xde, 0x0d, 0x4e, 0x4d, 0xdd, 0xe4, 0x91, 0x5a, 0x57, 0x1a, 0xc1,
+  0x6e, 0xd1, 0xc8, 0xf1, 0xc9, 0xa2, 0x1e, 0x9e, 0xce, 0x71, 0xe6, 0x0c, 0xa0, 0x83, 0x37, 0x9f,
+  0xf1, 0x0a, 0x2b, 0x51, 0x82, 0x8d, 0x18, 0xa4, 0x46, 0x43, 0x59, 0x03, 0x14, 0x66, 0x31, 0x13,
+  0x3b, 0x95, 0x46, 0xf8, 0x98, 0xc9, 0x21, 0x43, 0xea, 0xb8, 0xcc, 0xf6, 0xf2, 0x20, 0xb0, 0x16,
+  0xaf, 0x13, 0x8c, 0x7b, 0x18, 0xff, 0x06, 0x93, 0x19, 0x9d, 0x7c, 0xa2, 0xe1, 0x63, 0x87, 0x57,
+  0x5b, 0x2d, 0x7a, 0x5d, 0x6b, 0x49, 0x62, 0x79, 0x94, 0x09, 0x84, 0xa0, 0x68, 0x30, 0x00, 0xed,
+  0x90, 0x66, 0x93, 0x34, 0x5a, 0x22, 0x9e, 0xe5, 0x99, 0x2b, 0x1c, 0x93, 0x93, 0xbd, 0x82, 0x3b,
+  0xf0, 0x36, 0x0b, 0x5c, 0xd4, 0x20, 0x4d, 0x23, 0x5b, 0xfb, 0x14, 0xa4, 0xc9, 0x5f, 0x1b, 0xa9,
+  0x62, 0xcb, 0x7d, 0x7e, 0x3b, 0x94, 0x59, 0xfc, 0x0d, 0x4b, 0xd2, 0x9b, 0x81, 0xc0, 0x86, 0x07,
+  0x0a, 0xba, 0x7b, 0x37, 0xcd, 0x80, 0x63, 0xbc, 0x39, 0x78, 0x7e, 0x28, 0x56, 0x3d, 0x9e, 0x1f,
+  0x8a, 0x05, 0x1d, 0x84, 0x04, 0x1f, 0x61, 0x74, 0x4d, 0x26, 0xf3, 0x20, 0xcb, 0x46, 0x0d, 0x27,
+  0x46, 0x6c, 0x90, 0x28, 0x54, 0x85, 0xbf, 0x17, 0x65, 0x76, 0x0b, 0x11, 0xae, 0x35, 0xce, 0x9e,
+  0x1f, 0x42, 0x29, 0x02, 0xe7, 0x1f, 0x46, 0x15, 0x33, 0x95, 0xee, 0xb4, 0x56, 0xd4, 0x3a, 0xe5,
+  0x3c, 0x65, 0xca, 0xd6, 0x9e, 0x7a, 0x7a, 0x59, 0x08, 0x10, 0xef, 0x41, 0xd1, 0xf2, 0xec, 0x7d,
+  0x00, 0x7c, 0x64, 0x20, 0xd3, 0x64, 0x0e, 0xa6, 0x8b, 0xbc, 0xf9, 0xfe, 0x15, 0xc9, 0x72, 0x18,
+  0x26, 0x5c, 0x09, 0x9a, 0x46, 0x57, 0xab, 0x94, 0x05, 0x74, 0xcf, 0x0f, 0x97, 0xa5, 0x18, 0x95,
+  0x23, 0x63, 0x85, 0x77, 0xf8, 0x8c, 0xcf, 0xc2, 0x8c, 0xc7, 0xa4, 0x41, 0x92, 0x78, 0x32, 0x8f,
+  0x26, 0x9f, 0x46, 0x8d, 0x1b, 0x88, 0x5a, 0x93, 0x1b, 0x88, 0xaa, 0x27, 0xac, 0xab, 0xce, 0x2c,
+  0xa5, 0xd3, 0x91, 0x77, 0xe8, 0x35, 0xce, 0xbe, 0x0b, 0xb2, 0x68, 0xf2, 0xfc, 0x90, 0xb7, 0xbe,
+  0x23, 0x98, 0x20, 0xbc, 0x46, 0xdf, 0x11, 0x02, 0xb8, 0x97, 0xe2, 0xeb, 0x3d, 0x21, 0xd2, 0xe9,
+  0x94, 0x4e, 0xf2, 0x0c, 0x00, 0x7e, 0xcf, 0xbf, 0xd5, 0xc2, 0xe3, 0xbe, 0x60, 0x3b, 0x54, 0x88,
+  0x97, 0x66, 0x00, 0xf2, 0xed, 0x6a, 0x9e, 0x47, 0x6d, 0x1c, 0xa4, 0x24, 0xbd, 0x27, 0x9e, 0x31,
+  0x98, 0xfe, 0x24, 0xfd, 0x04, 0x40, 0x7f, 0xe0, 0xdf, 0xee, 0x09, 0x0f, 0xf4, 0xec, 0x2a, 0x4e,
+  0xc0, 0xc9, 0x4c, 0x90, 0xf6, 0x57, 0xfa, 0x97, 0x01, 0x97, 0x4b, 0x88, 0x5a, 0x16, 0x84, 0xd9,
+  0x20, 0x5b, 0x73, 0x6a, 0x8b, 0x85, 0x91, 0x6d, 0x09, 0x84, 0xb2, 0x49, 0x85, 0x50, 0x57, 0x36,
+  0x1f, 0xef, 0x12, 0x31, 0x1f, 0x14, 0x4a, 0x69, 0x26, 0xbb, 0xed, 0x59, 0x42, 0x5f, 0xcd, 0x12,
+  0x1c, 0x70, 0x5b, 0x52, 0x48, 0xb8, 0x60, 0x05, 0x23, 0xd1, 0x16, 0x88, 0x9b, 0x4b, 0x39, 0x62,
+  0x61, 0xcb, 0x0e, 0x3f, 0x05, 0x76, 0x02, 0xad, 0x12, 0x9f, 0x2e, 0x8a, 0xa4, 0x39, 0x2f, 0x45,
+  0x8a, 0x4d, 0x9b, 0x71, 0xc4, 0xdb, 0x30, 0x12, 0x73, 0xba, 0x36, 0x8c, 0x95, 0x68, 0x0e, 0x9c,
+  0x99, 0x07, 0xcb, 0x8c, 0x0e, 0xe4, 0x17, 0xb7, 0xe3, 0xd2, 0x0c, 0x95, 0x44, 0xe4, 0x69, 0x31,
+  0x76, 0x71, 0xba, 0x24, 0xf9, 0x6c, 0x5d, 0x93, 0x15, 0x36, 0x9c, 0x8d, 0xb2, 0x97, 0x7d, 0x31,
+  0x71, 0x32, 0xe2, 0x73, 0x24, 0xd2, 0xb5, 0xde, 0xce, 0x18, 0x17, 0xfa, 0x0d, 0xd7, 0x85, 0xa9,
+  0x58, 0xe5, 0x7c, 0xef, 0xf8, 0xf8, 0xd8, 0x04, 0xdf, 0xe3, 0x6b, 0x0d, 0x16, 0xb8, 0x74, 0x00,
+  0x22, 0x9d, 0xb7, 0x27, 0xb3, 0x68, 0x1e, 0x22, 0x70, 0x1b, 0x16, 0xce, 0xd8, 0x4a, 0x9a, 0xf0,
+  0xec, 0x90, 0xc9, 0xc3, 0xe3, 0x2e, 0xfe, 0x2d, 0x56, 0x15, 0x53, 0xaa, 0x36, 0x2f, 0x76, 0xa4,
+  0xe3, 0x18, 0xfe, 0x56, 0x8c, 0xb7, 0x48, 0xe6, 0x20, 0x40, 0x60, 0x14, 0x2e, 0xa1, 0x83, 0xc1,
+  0x8d, 0x55, 0x42, 0xd4, 0x7d, 0x8a, 0x4e, 0x6d, 0xb5, 0xd0, 0xa9, 0xd4, 0xf0, 0xb4, 0x1b, 0xe8,
+  0xa7, 0x37, 0x34, 0xf8, 0xa4, 0x9f, 0x9d, 0x8e, 0x4f, 0xc7, 0xf8, 0x0c, 0x26, 0x56, 0xab, 0xac,
+  0x6d, 0x4d, 0x0a, 0x0d, 0xb8, 0xfc, 0x69, 0x14, 0xdb, 0xcf, 0x4f, 0x4f, 0x4f, 0xf1, 0xe1, 0x24,
+  0x88, 0xdb, 0x29, 0xcd, 0xc0, 0xf4, 0x64, 0xcc, 0x59, 0xea, 0xd5, 0x31, 0x43, 0x70, 0xda, 0xb7,
+  0x7c, 0x82, 0xbd, 0x5d, 0xd4, 0xcc, 0x01, 0x55, 0x72, 0xda, 0x15, 0x99, 0x16, 0xb1, 0xa3, 0x00,
+  0x75, 0xae, 0x84, 0xe3, 0xb2, 0xba, 0xa5, 0xe5, 0x96, 0x22, 0x19, 0x4b, 0x44, 0xf7, 0x0a, 0x7f,
+  0x35, 0x2a, 0xb8, 0x05, 0x62, 0xa7, 0xbc, 0x8f, 0xa8, 0xbf, 0x08, 0x26, 0x6e, 0x8c, 0x20, 0xd8,
+  0xf9, 0xec, 0x99, 0x58, 0xd0, 0x14, 0x8b, 0xfe, 0x8b, 0x04, 0x2c, 0x24, 0xe2, 0xa1, 0x1b, 0xf3,
+  0x21, 0xac, 0x8a, 0x31, 0x50, 0xa7, 0x8a, 0x8b, 0x05, 0x47, 0x4c, 0xce, 0xc7, 0x79, 0xdc, 0xce,
+  0x16, 0xc1, 0x7c, 0xae, 0x14, 0xe6, 0x54, 0xa6, 0xb0, 0x6d, 0x9d, 0x70, 0x5a, 0x1f, 0xeb, 0x5c,
+  0x0f, 0x4f, 0x58, 0xd8, 0x81, 0xb0, 0x8c, 0x86, 0x70, 0x51, 0x57, 0xf4, 0x02, 0xe0, 0xed, 0xa1,
+  0xe1, 0x3b, 0x34, 0x0c, 0x2b, 0x20, 0x2a, 0xa6, 0x74, 0x01, 0xd2, 0x61, 0xd5, 0xe5, 0xf2, 0xe8,
+  0xd4, 0xcd, 0xe8, 0xd5, 0x82, 0xf2, 0x44, 0x3e, 0x84, 0x14, 0x2a, 0xf8, 0xbb, 0x4a, 0xa3, 0x70,
+  0x88, 0xff, 0x00, 0x87, 0x17, 0x4b, 0x0c, 0x19, 0xdb, 0x7c, 0x6f, 0x02, 0x98, 0xce, 0x69, 0x4a,
+  0xe0, 0x7f, 0x9e, 0xd0, 0x2f, 0x13, 0xa3, 0x94, 0x06, 0xe0, 0x28, 0x17, 0x30, 0x1a, 0x09, 0x4c,
+  0x0a, 0x1d, 0x55, 0xec, 0x05, 0xf8, 0xd7, 0xc9, 0xa2, 0x17, 0xc4, 0xd4, 0xb2, 0xa0, 0xe6, 0x34,
+  0x13, 0xb7, 0x11, 0xac, 0x5d, 0x31, 0xaf, 0x91, 0xc5, 0x53, 0x0d, 0x8c, 0xcb, 0xed, 0xbd, 0x05,
+  0xb3, 0x6a, 0xf2, 0xdd, 0x7b, 0xea, 0x58, 0x54, 0xb6, 0x22, 0x53, 0x36, 0xfb, 0xae, 0xcd, 0x08,
+  0xf4, 0x2c, 0x91, 0x85, 0xaa, 0x60, 0xe9, 0x93, 0x14, 0xa6, 0x56, 0x98, 0x40, 0x8c, 0xc0, 0xeb,
+  0x27, 0x32, 0x6b, 0x68, 0xac, 0x25, 0x96, 0x2f, 0x25, 0x5a, 0xab, 0x41, 0x4f, 0x99, 0x08, 0x29,
+  0x60, 0xc2, 0xd6, 0x94, 0x88, 0x92, 0xb3, 0x74, 0x88, 0x82, 0xac, 0x6d, 0x95, 0x81, 0x4c, 0x09,
+  0x04, 0x66, 0xb2, 0x54, 0x04, 0x6e, 0x47, 0xd0, 0x56, 0xb0, 0xd1, 0x38, 0xfb, 0xbf, 0xff, 0xfc,
+  0x5f, 0xff, 0x3b, 0x79, 0xc5, 0xf4, 0x8e, 0x9c, 0xdb, 0xd1, 0x6c, 0x21, 0x90, 0xd5, 0x6b, 0xeb,
+  0x18, 0xaf, 0x32, 0x8e, 0x9d, 0x89, 0xa6, 0xef, 0x93, 0x39, 0x04, 0xcc, 0xbc, 0x08, 0x22, 0x1b,
+  0x3a, 0x87, 0x6e, 0x58, 0x38, 0xcf, 0x55, 0x1a, 0x1f, 0xb3, 0xe0, 0x69, 0x86, 0x4b, 0xb1, 0xa3,
+  0xc6, 0x6a, 0x19, 0x82, 0x24, 0xbf, 0x52, 0xcf, 0x9a, 0xf9, 0x2c, 0xca, 0x3a, 0x6c, 0x24, 0xfd,
+  0x06, 0x61, 0x78, 0x63, 0x88, 0x55, 0x5c, 0xeb, 0xe9, 0x97, 0x4a, 0xa9, 0x2b, 0x87, 0xca, 0xee,
+  0x4f, 0x2d, 0xad, 0x76, 0xa6, 0xea, 0x48, 0x44, 0xc2, 0xa6, 0x5a, 0x84, 0xf5, 0x3c, 0x6a, 0xf4,
+  0x20, 0xb6, 0x04, 0xcf, 0x48, 0x21, 0xaa, 0xe4, 0x0f, 0x0a, 0x35, 0xfa, 0x8d, 0xb3, 0xcb, 0x79,
+  0x70, 0x4d, 0x8d, 0x0a, 0x87, 0x9c, 0x5a, 0x24, 0x1b, 0x2d, 0x8f, 0x64, 0x56, 0x61, 0x3e, 0x27,
+  0x61, 0x93, 0xe0, 0xea, 0x2a, 0xa5, 0x57, 0x40, 0x7f, 0x46, 0xb8, 0x8b, 0x24, 0xc0, 0x8c, 0x80,
+  0x4c, 0xd3, 0x64, 0x41, 0x16, 0x18, 0xda, 0x2e, 0xc1, 0x8d, 0xb2, 0x5e, 0x32, 0x12, 0xc4, 0x21,
+  0x11, 0x33, 0x8f, 0x8c, 0xcd, 0x3b, 0xa8, 0x0c, 0xa7, 0x59, 0x67, 0x46, 0x34, 0xb9, 0xdb, 0x38,
+  0xbd, 0x7d, 0x79, 0x4e, 0x5e, 0x86, 0x21, 0x38, 0xb2, 0x4c, 0x0f, 0x17, 0x36, 0x15, 0x3c, 0xb7,
+  0xb4, 0x52, 0x19, 0x96, 0x92, 0xc4, 0x48, 0xc3, 0x6e, 0x57, 0xb2, 0x72, 0xb8, 0xc5, 0x09, 0xaa,
+  0xd8, 0xd6, 0xf5, 0x03, 0xe5, 0xab, 0xc9, 0x52, 0x2b, 0x8a, 0x99, 0x4e, 0x31, 0xc2, 0x7d, 0x37,
+  0x8e, 0x60, 0x28, 0x02, 0xc4, 0xd8, 0x90, 0xc3, 0xb7, 0xc1, 0xa4, 0x71, 0xf6, 0x86, 0xcf, 0x30,
+  0x3b, 0x9d, 0x0e, 0x70, 0x11, 0x9e, 0xeb, 0x49, 0x9b, 0x88, 0xf8, 0x55, 0x90, 0x3f, 0x49, 0x96,
+  0xb7, 0xd0, 0x44, 0x30, 0xac, 0xa9, 0x45, 0xb3, 0x92, 0x4e, 0xb1, 0xa5, 0x6f, 0xb7, 0xf5, 0xc3,
+  0xd3, 0x62, 0x4a, 0xdd, 0x09, 0x0c, 0x9d, 0xd5, 0xfc, 0xc6, 0xd9, 0x39, 0x60, 0x54, 0x98, 0x4a,
+  0x6c, 0x13, 0x3c, 0xc6, 0x00, 0xf0, 0xc8, 0xaf, 0x4c, 0x61, 0xfc, 0x00, 0x1a, 0x47, 0x38, 0x57,
+  0xbc, 0x8c, 0xc9, 0x45, 0xc0, 0xc9, 0x24, 0x20, 0x3e, 0xe4, 0xfb, 0xcb, 0x77, 0xed, 0x1f, 0x7e,
+  0xff, 0x47, 0xb2, 0x0c, 0xa2, 0x14, 0x08, 0xdd, 0x55, 0xdc, 0x44, 0x4f, 0x28, 0xe6, 0xc0, 0xb7,
+  0x4b, 0x6e, 0x6b, 0x1a, 0xae, 0x70, 0x31, 0x56, 0x68, 0xd1, 0x14, 0x6a, 0x71, 0x37, 0xd1, 0x44,
+  0x30, 0x8c, 0x62, 0x92, 0xdf, 0x2e, 0x29, 0xdf, 0xf7, 0xe9, 0xa0, 0x71, 0x81, 0x8f, 0x1b, 0x04,
+  0x1a, 0x4f, 0xe8, 0x0c, 0x7c, 0x01, 0x4d, 0x47, 0x8d, 0x3f, 0xfd, 0x69, 0x60, 0xff, 0xd7, 0x20,
+  0x10, 0xd4, 0xcd, 0x69, 0x7c, 0x95, 0xcf, 0xc0, 0x0e, 0x3c, 0x69, 0xd4, 0x0a, 0x76, 0x61, 0x14,
+  0xf7, 0x31, 0x40, 0x05, 0x79, 0xaf, 0x5c, 0xd6, 0x6d, 0x94, 0x88, 0x64, 0x46, 0xf3, 0xb7, 0x92,
+  0xb0, 0x0a, 0x81, 0x24, 0xfd, 0x82, 0x54, 0x9a, 0xc1, 0xc9, 0xc3, 0x6e, 0xb7, 0xbb, 0x45, 0x28,
+  0xb7, 0x2c, 0x5a, 0xa3, 0x18, 0xc6, 0x31, 0x0c, 0x6e, 0x51, 0x12, 0x71, 0xbc, 0x90, 0xf9, 0x13,
+  0x5e, 0x01, 0x46, 0xff, 0x92, 0x45, 0xd5, 0x0a, 0x51, 0x33, 0x83, 0xec, 0x64, 0x8e, 0x4a, 0x10,
+  0x29, 0x48, 0x4c, 0x15, 0xfc, 0x0f, 0x6c, 0xd8, 0xe5, 0x98, 0xb9, 0x76, 0xde, 0xc9, 0x16, 0x6d,
+  0xb3, 0xd3, 0xdf, 0x23, 0x95, 0x30, 0xdb, 0x03, 0x73, 0xc9, 0x45, 0xb3, 0x54, 0x4d, 0xf2, 0x84,
+  0xd0, 0x0c, 0xe7, 0x3c, 0x51, 0x36, 0x53, 0xfa, 0xa2, 0xf1, 0xaa, 0x55, 0x99, 0x12, 0x2f, 0xfc,
+  0x3f, 0xc8, 0x25, 0x8f, 0x00, 0xe1, 0x93, 0xaf, 0x0e, 0xef, 0xe8, 0x81, 0x65, 0xb3, 0xb7, 0x49,
+  0x58, 0xee, 0x82, 0xe7, 0x34, 0x14, 0x75, 0xb0, 0x4a, 0xd1, 0x0d, 0x83, 0x5b, 0xc1, 0x07, 0xbf,
+  0x12, 0x1f, 0xdc, 0x65, 0xd2, 0x05, 0x0c, 0x58, 0x25, 0xab, 0xac, 0xd2, 0x0f, 0xf7, 0x30, 0xb9,
+  0x82, 0x39, 0x38, 0x10, 0x40, 0x4c, 0x56, 0xdd, 0xc1, 0x1b, 0xeb, 0x5e, 0x06, 0x24, 0x03, 0xc2,
+  0xc0, 0xe9, 0xb2, 0xa4, 0x5e, 0x8b, 0x18, 0x90, 0x07, 0xda, 0x23, 0x8b, 0x00, 0xbd, 0xe0, 0x7a,
+  0x95, 0x4c, 0x8a, 0x0a, 0x3c, 0x8a, 0x6a, 0xe8, 0xa1, 0x36, 0xe3, 0xfa, 0x6a, 0x5b, 0xb8, 0xe3,
+  0x28, 0x83, 0xb8, 0xa7, 0xb9, 0x1e, 0x66, 0xd3, 0xf4, 0xc5, 0xab, 0xc5, 0x18, 0x84, 0xc9, 0xc4,
+  0x85, 0xd5, 0x06, 0xd3, 0x16, 0xc5, 0xc8, 0x58, 0xdb, 0x04, 0xb2, 0x67, 0x18, 0x53, 0xd4, 0x0e,
+  0xf6, 0xbd, 0xec, 0x5d, 0xa3, 0x34, 0x1f, 0x5a, 0x47, 0xde, 0x1b, 0x66, 0x81, 0x77, 0xa6, 0x8f,
+  0x57, 0x17, 0x04, 0xf6, 0x1c, 0x02, 0x31, 0x5c, 0x3a, 0xc7, 0xdd, 0x4d, 0x7f, 0x15, 0x02, 0x77,
+  0xd2, 0xf2, 0xff, 0xf8, 0x9f, 0x95, 0xa5, 0x78, 0x4b, 0xb3, 0x99, 0xc9, 0x9c, 0x5a, 0x2f, 0xe7,
+  0x2c, 0x4d, 0x9e, 0x08, 0xcd, 0xb1, 0x33, 0x94, 0xfc, 0x97, 0x91, 0xa3, 0xc4, 0x9c, 0xc5, 0xeb,
+  0x24, 0x55, 0x19, 0x6d, 0x1e, 0x03, 0x9a, 0x71, 0x4c, 0x99, 0x77, 0x83, 0x08, 0x17, 0xda, 0x55,
+  0xe6, 0x41, 0x0b, 0xbd, 0x40, 0xdb, 0x4b, 0xa6, 0x73, 0x60, 0x66, 0x30, 0x68, 0xdd, 0x02, 0xbe,
+  0xc4, 0x2f, 0x61, 0xd6, 0x39, 0x24, 0x22, 0xae, 0xde, 0xb5, 0x5b, 0x3e, 0xaf, 0xbe, 0x6b, 0xcf,
+  0x62, 0x0a, 0xde, 0x38, 0x7b, 0xcf, 0xc0, 0x54, 0x3b, 0x32, 0xe4, 0xe1, 0x7b, 0x9e, 0xf6, 0xd1,
+  0x2a, 0x6d, 0xe4, 0x82, 0xea, 0x15, 0x5a, 0x42, 0x78, 0x03, 0x16, 0xa5, 0x6e, 0xd1, 0xa2, 0x4c,
+  0x25, 0xfe, 0x6d, 0x9c, 0xdc, 0xc4, 0xe4, 0x07, 0xb0, 0xcc, 0x46, 0x3c, 0xc4, 0x73, 0x6c, 0x4a,
+  0xbe, 0x74, 0xde, 0x4d, 0xa8, 0x05, 0x9b, 0x35, 0x7c, 0x60, 0x05, 0x58, 0x5b, 0x2c, 0xbd, 0xe4,
+  0xe9, 0x19, 0x7c, 0x3f, 0xfb, 0x81, 0x79, 0x08, 0xf8, 0x82, 0x3f, 0xac, 0x70, 0x4b, 0x94, 0x5d,
+  0xb2, 0xc4, 0x8b, 0xfe, 0xc9, 0x5c, 0x2b, 0xff, 0x79, 0x08, 0x30, 0x0e, 0xf0, 0xab, 0x80, 0x88,
+  0xab, 0x39, 0x6e, 0x97, 0xdf, 0x41, 0x59, 0x43, 0x76, 0x87, 0xf3, 0x96, 0x39, 0x86, 0xd7, 0xa3,
+  0xc6, 0xb1, 0x62, 0x52, 0x31, 0x7a, 0xd7, 0x49, 0xb6, 0x06, 0xe0, 0x47, 0x62, 0x24, 0x57, 0x7a,
+  0x51, 0x34, 0xec, 0x79, 0xa8, 0xfb, 0x16, 0x2b, 0x48, 0x87, 0x8c, 0xe0, 0x9d, 0x55, 0xee, 0xdf,
+  0x93, 0xf7, 0x34, 0x98, 0xb7, 0x3f, 0x44, 0x0b, 0xca, 0x2c, 0x3b, 0x4e, 0xf7, 0xc1, 0x59, 0xb2,
+  0x8c, 0x48, 0xc9, 0x50, 0xb8, 0x49, 0x93, 0xc6, 0x76, 0xae, 0xcb, 0x24, 0x42, 0x15, 0xdf, 0xf9,
+  0x4a, 0x05, 0xb9, 0x78, 0xa5, 0x38, 0x2b, 0xf1, 0xa8, 0xe2, 0xfc, 0x1b, 0x88, 0x3b, 0xc8, 0x8f,
+  0xcc, 0x3b, 0x6f, 0x61, 0xbf, 0xd5, 0xb7, 0x3d, 0x00, 0x67, 0x2f, 0x8f, 0xc1, 0x59, 0x0f, 0x4e,
+  0x5f, 0x0d, 0xfa, 0x47, 0x03, 0x36, 0xdb, 0x41, 0x66, 0xc2, 0xff, 0x4f, 0x4e, 0xc8, 0x64, 0xa1,
+  0x7e, 0xf1, 0x39, 0x92, 0x24, 0xce, 0xcc, 0xbc, 0x82, 0x25, 0x60, 0x9f, 0x62, 0x9a, 0xa4, 0x5a,
+  0x74, 0x3b, 0x7d, 0x98, 0x99, 0x5e, 0x25, 0xe6, 0xe8, 0xe4, 0xa9, 0x04, 0x61, 0x65, 0x7f, 0x1b,
+  0xac, 0xc1, 0x77, 0x4f, 0x07, 0xaf, 0x4e, 0x07, 0xbd, 0x97, 0x83, 0x67, 0x3d, 0x0b, 0x91, 0xe7,
+  0xbc, 0x9f, 0xb3, 0x5e, 0xff, 0x94, 0x61, 0x24, 0x7e, 0xd6, 0xa2, 0xc6, 0xd3, 0xbe, 0x30, 0x99,
+  0x66, 0x9f, 0x45, 0xd4, 0x8e, 0x4b, 0x50, 0x63, 0x8f, 0xce, 0xfb, 0x83, 0xe3, 0xd7, 0x83, 0xa7,
+  0xdf, 0x0d, 0x5e, 0x9e, 0x58, 0x48, 0xb4, 0xdb, 0xb5, 0xfd, 0x61, 0x22, 0xb9, 0x71, 0xf6, 0x47,
+  0xf8, 0xd7, 0xed, 0xab, 0xdf, 0xe9, 0x15, 0xfa, 0x2a, 0x0a, 0xa9, 0x61, 0xdb, 0xdd, 0xdd, 0x13,
+  0x95, 0xd6, 0xa9, 0x67, 0xa5, 0xc9, 0x4d, 0xb7, 0x54, 0x97, 0x38, 0x2f, 0xcc, 0xc9, 0xcb, 0x96,
+  0x88, 0x59, 0xfe, 0x15, 0xf5, 0xe2, 0x9f, 0xff, 0x0b, 0x79, 0xc9, 0x46, 0x8a, 0x08, 0xf1, 0x6c,
+  0x86, 0x69, 0x74, 0x0d, 0xe8, 0x88, 0x14, 0x83, 0x5f, 0xe2, 0x9c, 0x6a, 0x96, 0xa6, 0x8c, 0x24,
+  0x9b, 0x46, 0xc7, 0x19, 0x77, 0xd2, 0x26, 0x72, 0xa4, 0x2d, 0x43, 0x68, 0xea, 0x71, 0xa5, 0xa1,
+  0x30, 0x98, 0xd7, 0xef, 0xee, 0xe6, 0xff, 0x76, 0x5a, 0xa3, 0x63, 0x16, 0xe2, 0x0f, 0x11, 0xbd,
+  0x21, 0xaf, 0x57, 0x10, 0x2f, 0xd6, 0x2f, 0xd9, 0x19, 0x76, 0xc2, 0xdd, 0xee, 0xe4, 0xc4, 0x70,
+  0x76, 0x62, 0x11, 0xa2, 0xcd, 0x55, 0x8a, 0xdb, 0xe2, 0x88, 0xd6, 0xfc, 0x82, 0xe5, 0xb1, 0x33,
+  0x9a, 0x62, 0x35, 0x1c, 0x06, 0x48, 0x36, 0x69, 0xa0, 0xa8, 0x9a, 0x12, 0x6a, 0xed, 0xf9, 0x69,
+  0x9c, 0x4d, 0xb4, 0x36, 0x14, 0x60, 0xdb, 0x7b, 0x7c, 0x1a, 0xc5, 0x87, 0x72, 0x09, 0x56, 0x4c,
+  0x18, 0xfe, 0xa0, 0xeb, 0xda, 0xc1, 0x13, 0x81, 0xd8, 0xa9, 0xe0, 0xc9, 0xea, 0x3e, 0x2c, 0x2f,
+  0x87, 0x1b, 0x4b, 0xb1, 0xf3, 0xa5, 0x1a, 0x33, 0xb1, 0xa7, 0xb4, 0x61, 0x1c, 0xc7, 0x1c, 0xdf,
+  0x92, 0xf7, 0xc1, 0x75, 0x44, 0x2e, 0xa1, 0x7c, 0x46, 0x9a, 0xce, 0xd9, 0x4c, 0x9f, 0x2f, 0xb3,
+  0xcb, 0x65, 0xf9, 0x73, 0x7b, 0x59, 0xfe, 0xf2, 0x16, 0x26, 0x6c, 0x0b, 0x59, 0x05, 0xb3, 0x25,
+  0x2c, 0xeb, 0x4a, 0x1e, 0x61, 0x2a, 0x67, 0x08, 0x33, 0xe3, 0xfe, 0x89, 0x7b, 0xd8, 0xb3, 0x43,
+  0x5e, 0xc2, 0xb8, 0xb3, 0x6a, 0x19, 0x01, 0x77, 0x48, 0x53, 0xdc, 0x93, 0x5b, 0xb5, 0x98, 0x6f,
+  0x6f, 0xdd, 0x95, 0xc1, 0x28, 0x2f, 0xbb, 0x64, 0x45, 0x67, 0x07, 0x72, 0x02, 0x47, 0x58, 0x1d,
+  0x22, 0xd2, 0xcd, 0x53, 0x10, 0xaf, 0xdb, 0x07, 0x7a, 0x12, 0xca, 0x66, 0x22, 0x67, 0x07, 0xd3,
+  0x55, 0xcc, 0x5c, 0x16, 0xc1, 0x5d, 0xc0, 0x0c, 0xc2, 0x0f, 0x49, 0x1e, 0x4d, 0x23, 0x2e, 0xb3,
+  0x4d, 0x7f, 0x1d, 0x4d, 0x9b, 0x42, 0x90, 0x33, 0xf7, 0x29, 0xfa, 0xb4, 0x64, 0x95, 0xfb, 0xeb,
+  0xc9, 0x9c, 0x06, 0xa9, 0xf8, 0xb5, 0xb5, 0xf6, 0x06, 0xdc, 0x2b, 0xb8, 0x97, 0xd8, 0x78, 0x34,
+  0x0a, 0x93, 0xc9, 0x0a, 0x03, 0xea, 0xce, 0x15, 0xcd, 0xbf, 0x9f, 0x53, 0xfc, 0xfa, 0xdd, 0xed,
+  0x45, 0xd8, 0xf4, 0x2c, 0xda, 0x3c, 0x7f, 0x68, 0xb6, 0xea, 0x30, 0x9e, 0x60, 0x6c, 0xd3, 0xe1,
+  0xd1, 0x18, 0x54, 0x07, 0x22, 0xa0, 0x16, 0xb4, 0x92, 0xd8, 0x34, 0xfd, 0xd1, 0xd9, 0xba, 0xa2,
+  0x15, 0xd8, 0x3f, 0xd5, 0x64, 0x0b, 0xd6, 0xa3, 0x1d, 0x41, 0xda, 0x88, 0x6c, 0x5a, 0x47, 0xdd,
+  0x6e, 0x17, 0x3e, 0x7a, 0xb8, 0x93, 0xda, 0x62, 0xb5, 0xd4, 0xaa, 0xa6, 0xd4, 0x22, 0x7f, 0x5d,
+  0xc9, 0x04, 0x53, 0x0b, 0x3d, 0xbf, 0xc3, 0xf6, 0xa0, 0xfc, 0xfd, 0x87, 0xb7, 0x6f, 0x46, 0xb2,
+  0xed, 0x63, 0x6f, 0x27, 0xc5, 0xf4, 0x86, 0x9c, 0xf5, 0x30, 0x5d, 0x41, 0x70, 0xa3, 0x25, 0x1e,
+  0x4c, 0xbe, 0x88, 0xf3, 0x66, 0x65, 0xcf, 0xa2, 0xa6, 0xe7, 0xbf, 0xe0, 0x33, 0xf3, 0x2f, 0x5f,
+  0xbc, 0xa3, 0xae, 0xe7, 0x4b, 0x38, 0xc1, 0xe7, 0x5d, 0xe1, 0xf0, 0x9a, 0x36, 0x1c, 0x0d, 0x08,
+  0x33, 0x4e, 0x50, 0x37, 0xb8, 0xa2, 0xa3, 0xb7, 0x41, 0x3e, 0xeb, 0x40, 0xb7, 0x4d, 0x98, 0x26,
+  0xb5, 0xf8, 0x8f, 0xe0, 0x73, 0xb3, 0xdb, 0x6a, 0x2a, 0x46, 0xb5, 0x05, 0x52, 0xfe, 0x61, 0x53,
+  0x80, 0x55, 0x25, 0xfe, 0xdf, 0x41, 0x2b, 0x5f, 0x42, 0xb5, 0xec, 0x48, 0xb5, 0x88, 0x59, 0xd5,
+  0x14, 0x4a, 0xea, 0x2c, 0xee, 0x1b, 0xd4, 0x4c, 0xd1, 0xa0, 0x1a, 0x88, 0x5d, 0x1d, 0xa0, 0x80,
+  0xda, 0x94, 0x82, 0x78, 0xf4, 0xa8, 0xb4, 0xb8, 0x23, 0xb6, 0x6e, 0xf9, 0x6b, 0xc1, 0x11, 0xb1,
+  0x1d, 0x6d, 0x04, 0x04, 0xb5, 0x35, 0x7b, 0x86, 0x16, 0xb2, 0x1d, 0x66, 0x1a, 0x3b, 0xfc, 0x18,
+  0x38, 0x30, 0xf4, 0x5b, 0xaf, 0xf4, 0x39, 0xba, 0xeb, 0xd1, 0xc7, 0x6f, 0xd4, 0x16, 0xb7, 0x76,
+  0xef, 0x64, 0xf3, 0xed, 0xc7, 0x0d, 0x9d, 0x67, 0x74, 0x5d, 0x0d, 0xaf, 0x69, 0xf7, 0xec, 0x3f,
+  0xf6, 0xea, 0xc0, 0x7b, 0x5d, 0x4f, 0xe8, 0x75, 0x4a, 0xc3, 0xad, 0xdc, 0x82, 0x3a, 0x7f, 0x40,
+  0x31, 0x50, 0xdc, 0xbe, 0x4a, 0x29, 0x8d, 0xb7, 0x36, 0x63, 0xb5, 0xec, 0x86, 0x63, 0xf8, 0xb1,
+  0xb5, 0x1d, 0x56, 0x92, 0xcd, 0x60, 0x5c, 0x34, 0x86, 0x8f, 0x1e, 0x99, 0x1d, 0x3f, 0x7a, 0x64,
+  0x40, 0x93, 0x03, 0x01, 0x95, 0xb5, 0x7c, 0xeb, 0x96, 0x22, 0x51, 0x65, 0xa2, 0xaf, 0xab, 0x99,
+  0x40, 0xed, 0x8a, 0xd8, 0x81, 0xae, 0x67, 0x74, 0x27, 0xab, 0x95, 0x31, 0x58, 0x87, 0x66, 0xa3,
+  0x8f, 0xe9, 0xd5, 0xb8, 0xf9, 0xcd, 0x1a, 0xf0, 0xd8, 0xb4, 0xc8, 0x37, 0x6b, 0xd6, 0x11, 0xfb,
+  0x86, 0xa0, 0x36, 0xfe, 0xc7, 0xcd, 0x46, 0x19, 0x19, 0xb1, 0xc6, 0x25, 0xcd, 0x8c, 0x69, 0xc8,
+  0xbf, 0xbf, 0xc6, 0xdc, 0x4c, 0xb2, 0x82, 0xb1, 0x7d, 0xf4, 0xe8, 0x81, 0x28, 0x94, 0xea, 0x05,
+  0x31, 0x37, 0x0d, 0x16, 0xaf, 0x83, 0x68, 0xae, 0xa5, 0x91, 0x66, 0xa3, 0x18, 0x22, 0x14, 0xa3,
+  0x5d, 0xd3, 0x3b, 0xa4, 0xf8, 0x2b, 0x7b, 0x31, 0xfb, 0x05, 0x64, 0x14, 0x18, 0x4b, 0xb3, 0x4e,
+  0x12, 0x2f, 0xc0, 0xd1, 0xa0, 0x16, 0x53, 0xb0, 0x90, 0x96, 0x95, 0x53, 0x34, 0xd3, 0x0e, 0xae,
+  0x36, 0x75, 0x20, 0x66, 0x89, 0xf2, 0xa6, 0xd7, 0xf2, 0xfc, 0x9f, 0xba, 0x3f, 0xfb, 0xfe, 0x86,
+  0x37, 0xa7, 0x69, 0x9a, 0xa4, 0x23, 0x66, 0x5f, 0xe1, 0xf7, 0x64, 0x9e, 0x64, 0x80, 0xf8, 0xb0,
+  0x06, 0xc1, 0x51, 0x9e, 0xae, 0xa8, 0x69, 0xee, 0x6d, 0xaa, 0x5b, 0x27, 0x68, 0x7d, 0x87, 0x29,
+  0xcd, 0x57, 0x69, 0xbc, 0x99, 0xd2, 0x7c, 0x32, 0x6b, 0x62, 0x00, 0xa6, 0x4c, 0x29, 0x4c, 0x68,
+  0x62, 0x18, 0xd5, 0x6c, 0x09, 0x64, 0x02, 0xce, 0xf2, 0x5b, 0x07, 0xe3, 0xbf, 0xa6, 0x2f, 0x9e,
+  0xcb, 0xfa, 0x95, 0x34, 0x29, 0x13, 0xee, 0x6f, 0xfc, 0x0e, 0xb8, 0x04, 0xe8, 0x85, 0x53, 0x72,
+  0xc6, 0xf8, 0x97, 0xc0, 0x18, 0xb2, 0xdf, 0xcd, 0xc6, 0xf7, 0xf8, 0x41, 0x18, 0x22, 0x18, 0xea,
+  0xca, 0x86, 0x83, 0x46, 0x8b, 0x55, 0xc0, 0xf6, 0xd3, 0x08, 0xc2, 0xfe, 0xf9, 0x2d, 0xf7, 0x32,
+  0x5b, 0x28, 0x33, 0x9d, 0x0a, 0x7f, 0x7e, 0x8e, 0x21, 0xf0, 0x3b, 0x7e, 0xcc, 0xb1, 0x69, 0xc8,
+  0xf0, 0xaf, 0x59, 0x25, 0x79, 0xb3, 0x89, 0x81, 0x79, 0x75, 0x3b, 0xb3, 0xd6, 0x1e, 0xda, 0xfc,
+  0xe8, 0x91, 0xd9, 0xf0, 0x6f, 0xa4, 0xdb, 0x26, 0x0a, 0x77, 0x51, 0x6d, 0x3d, 0xd6, 0xb8, 0xc9,
+  0x07, 0x23, 0xa2, 0x73, 0x96, 0x48, 0xcf, 0x9a, 0x22, 0x4a, 0xba, 0x08, 0x5b, 0xbc, 0x2b, 0x30,
+  0xeb, 0xe0, 0x42, 0x82, 0x34, 0x58, 0x64, 0x23, 0xcf, 0x43, 0x2e, 0xa9, 0x1a, 0xa3, 0xd1, 0xc8,
+  0x8b, 0x57, 0x8b, 0x37, 0x34, 0xcc, 0x3c, 0x5f, 0x56, 0x11, 0x05, 0x23, 0xef, 0x31, 0x6b, 0x3f,
+  0x44, 0xd7, 0x40, 0xdc, 0x56, 0x2a, 0x16, 0x90, 0xad, 0x64, 0x18, 0x51, 0xdf, 0x4a, 0x7a, 0x7e,
+  0xd5, 0x4a, 0x04, 0x0d, 0xb5, 0xad, 0xc6, 0x2c, 0x1e, 0x8e, 0xc1, 0x9a, 0xe8, 0x86, 0xba, 0xac,
+  0xbe, 0xad, 0x96, 0x64, 0xd9, 0x52, 0x96, 0xd4, 0xb7, 0x33, 0x45, 0x59, 0xb6, 0xd4, 0x65, 0x5b,
+  0xf0, 0xd5, 0xe2, 0xac, 0xd0, 0x95, 0x45, 0xf5, 0x2d, 0xd9, 0xb9, 0xcf, 0x4b, 0x88, 0xce, 0x74,
+  0x4b, 0x55, 0x64, 0xb7, 0xe4, 0x56, 0x4c, 0x08, 0x5b, 0xc0, 0x26, 0xc9, 0x34, 0x14, 0xf3, 0x8f,
+  0x4a, 0x85, 0x51, 0x7d, 0x49, 0x29, 0x4d, 0x80, 0x8b, 0x68, 0x61, 0x38, 0x6a, 0x0e, 0x18, 0x2e,
+  0xa9, 0x43, 0x69, 0x28, 0xa1, 0xf1, 0x0b, 0xef, 0x31, 0x47, 0xab, 0x60, 0x2b, 0xd1, 0x9f, 0x3c,
+  0x50, 0x06, 0x33, 0xf9, 0xe4, 0xaf, 0xf3, 0x59, 0x9a, 0xdc, 0x10, 0xe6, 0x28, 0x98, 0xb5, 0xf3,
+  0x2e, 0x71, 0x2e, 0x93, 0x0a, 0xc4, 0x71, 0x26, 0xc2, 0x12, 0x7a, 0x03, 0xe2, 0x3d, 0x56, 0xed,
+  0x78, 0x91, 0xbf, 0xe1, 0x75, 0x88, 0x2a, 0xff, 0x4b, 0x86, 0x93, 0x8f, 0x8d, 0xb4, 0xc0, 0xe0,
+  0x32, 0x78, 0x8f, 0xdc, 0x79, 0xb0, 0x46, 0xc8, 0x3d, 0x31, 0xb7, 0xf1, 0xfc, 0x75, 0xc5, 0xf4,
+  0x65, 0x23, 0x99, 0xee, 0x34, 0x64, 0xe6, 0x16, 0x9a, 0x95, 0x32, 0x60, 0x64, 0x31, 0x49, 0x05,
+  0x84, 0x6c, 0x9e, 0xbd, 0xcd, 0xb2, 0x29, 0x86, 0x3f, 0xd6, 0x5f, 0x21, 0x62, 0x9f, 0xcc, 0x57,
+  0x21, 0x28, 0xaa, 0x27, 0x84, 0xe4, 0x85, 0xf7, 0x8a, 0x83, 0xf3, 0x06, 0xb2, 0x48, 0x84, 0x8c,
+  0x66, 0x27, 0xfe, 0xda, 0xfe, 0xcd, 0xdc, 0x92, 0xb8, 0x70, 0xc8, 0xc6, 0x71, 0x13, 0xcc, 0x69,
+  0x0a, 0xfe, 0x94, 0xfb, 0x17, 0x98, 0xc4, 0xa0, 0x77, 0x11, 0xfd, 0x23, 0xbf, 0x39, 0xf9, 0xc2,
+  0x3b, 0x43, 0xf0, 0xfd, 0x63, 0xfc, 0x89, 0xa5, 0x77, 0x05, 0x1b, 0xfc, 0xcd, 0x16, 0xc7, 0x55,
+  0x0e, 0xd8, 0x13, 0x5e, 0x6b, 0xf8, 0xaf, 0x8c, 0x8b, 0x3c, 0xb6, 0xc0, 0x15, 0x56, 0x9c, 0x0e,
+  0x4a, 0x72, 0x3b, 0xe4, 0xdd, 0x1c, 0xcf, 0x4a, 0x92, 0x3c, 0xbd, 0x25, 0xc1, 0x55, 0x10, 0xc5,
+  0x1d, 0xcf, 0x76, 0xc1, 0x50, 0xf1, 0x3b, 0x65, 0xd0, 0xd9, 0x9a, 0x26, 0x8d, 0x31, 0x0d, 0x07,
+  0x71, 0x94, 0xa1, 0x52, 0x76, 0x95, 0x17, 0xa2, 0x0a, 0xe8, 0xba, 0xac, 0x5c, 0x19, 0x95, 0x70,
+  0xa5, 0xb8, 0xbf, 0x4e, 0xb8, 0x83, 0x5d, 0x36, 0xd6, 0x6a, 0x70, 0x2b, 0x09, 0x7c, 0x13, 0xdc,
+  0xd2, 0xb4, 0x29, 0x1c, 0x8e, 0x45, 0x1f, 0x7c, 0x7d, 0x31, 0xb6, 0xeb, 0x49, 0x53, 0xf6, 0xeb,
+  0x26, 0xee, 0x95, 0x9c, 0x9a, 0x05, 0x73, 0x36, 0x39, 0x2b, 0x1d, 0x3f, 0xb7, 0xd2, 0x6f, 0x6d,
+  0x04, 0xdf, 0x26, 0x6c, 0xdf, 0xc2, 0x22, 0x49, 0x72, 0x0c, 0x42, 0x4b, 0x69, 0x74, 0xea, 0xfc,
+  0xd6, 0x48, 0x64, 0xe3, 0xc2, 0x14, 0x70, 0x01, 0xff, 0x58, 0x94, 0xa9, 0x47, 0x2f, 0xf0, 0x11,
+  0x10, 0xc4, 0x6a, 0xfc, 0x7a, 0xa9, 0xe1, 0x61, 0x3d, 0x1f, 0x8f, 0x77, 0xe8, 0x89, 0x9b, 0xcc,
+  0x1f, 0xb7, 0x8a, 0x7a, 0xe7, 0x8c, 0x19, 0xab, 0xfc, 0x82, 0x55, 0x1e, 0x09, 0x27, 0xfe, 0xd8,
+  0x7b, 0x74, 0x6d, 0x46, 0x24, 0xbf, 0xee, 0x41, 0xe4, 0x27, 0x77, 0x2e, 0x97, 0x94, 0x86, 0x25,
+  0x56, 0xc6, 0x78, 0xfa, 0xe2, 0x37, 0x47, 0xd4, 0x05, 0x3a, 0x9f, 0x2c, 0xca, 0x6f, 0x2b, 0x09,
+  0x53, 0x35, 0x7e, 0x4b, 0xc4, 0x7d, 0x50, 0x87, 0x1c, 0x71, 0xd2, 0x5a, 0xe9, 0x1a, 0xf4, 0x59,
+  0xc8, 0xb7, 0xd9, 0x6f, 0x83, 0xb0, 0x77, 0x01, 0xbb, 0xe2, 0xa4, 0x92, 0xa2, 0x25, 0x7f, 0xfe,
+  0x1b, 0x20, 0x26, 0x58, 0x2e, 0xe7, 0xb7, 0xe7, 0xab, 0x2c, 0x4f, 0x16, 0x92, 0x28, 0x39, 0x1b,
+  0x86, 0xb2, 0x65, 0x36, 0xfa, 0xa9, 0xdb, 0xea, 0xf5, 0x9f, 0xe2, 0x45, 0x69, 0x3f, 0x77, 0x16,
+  0xc1, 0xb2, 0xd9, 0x94, 0x59, 0xc3, 0x56, 0xe4, 0x8f, 0xce, 0xe4, 0x8f, 0xc7, 0x10, 0x71, 0x3d,
+  0xae, 0x9c, 0xa4, 0x0b, 0x76, 0x5c, 0x02, 0x40, 0xef, 0x71, 0xe4, 0xf3, 0x70, 0xb0, 0x93, 0xad,
+  0xc6, 0xb8, 0xaf, 0x09, 0x3c, 0x4e, 0x0f, 0x38, 0xf0, 0x97, 0x24, 0x8a, 0x59, 0xfe, 0xc7, 0x9c,
+  0x6d, 0x08, 0x94, 0x5e, 0x70, 0x54, 0xbc, 0xc7, 0xec, 0xf3, 0x3e, 0xdc, 0x7c, 0x60, 0x72, 0xd3,
+  0x9d, 0x9f, 0x98, 0x31, 0xb1, 0x3f, 0xdc, 0x46, 0x8d, 0x27, 0xe8, 0x18, 0x79, 0xa7, 0xde, 0xb0,
+  0x6a, 0x5c, 0x76, 0x89, 0xa2, 0x8d, 0xb0, 0x99, 0x87, 0x9b, 0x82, 0x6a, 0x72, 0x13, 0x64, 0xb8,
+  0x2a, 0xc2, 0x97, 0x6d, 0x30, 0x6a, 0x67, 0xd5, 0x14, 0x86, 0x56, 0xa8, 0x89, 0xc7, 0x54, 0xf5,
+  0x00, 0x4a, 0x16, 0x5e, 0x29, 0x16, 0xaa, 0xdc, 0x16, 0xb0, 0xab, 0x94, 0x4f, 0x3b, 0x93, 0xcb,
+  0xb8, 0x24, 0x0a, 0x87, 0x92, 0xbb, 0x13, 0x26, 0x41, 0x1d, 0xb1, 0x61, 0x75, 0x34, 0x3a, 0x82,
+  0x20, 0xdb, 0x28, 0x9f, 0x26, 0xe9, 0xf7, 0x01, 0x60, 0xd4, 0xc4, 0x01, 0x64, 0x82, 0xb3, 0xde,
+  0x4f, 0x58, 0x46, 0xde, 0x43, 0x3e, 0xfa, 0xfc, 0xe2, 0xae, 0x4e, 0x9e, 0xbc, 0x49, 0x6e, 0x68,
+  0x7a, 0x1e, 0x60, 0x42, 0x70, 0x63, 0xca, 0x7f, 0xb9, 0xec, 0x13, 0x71, 0x8c, 0x97, 0x08, 0xe8,
+  0xc8, 0x73, 0x5b, 0xa9, 0x81, 0xc7, 0xf2, 0xac, 0xa9, 0x5c, 0x2f, 0xd3, 0x9a, 0x20, 0x0a, 0x46,
+  0x6b, 0x35, 0x15, 0x1f, 0xd4, 0x2c, 0xce, 0xa8, 0x09, 0x3c, 0xc7, 0xbd, 0x05, 0xf6, 0x2d, 0x9a,
+  0xf3, 0xad, 0x61, 0xd5, 0xcd, 0x8c, 0x4a, 0xaa, 0x21, 0x5f, 0x6a, 0xbe, 0x9c, 0x45, 0xd3, 0xbc,
+  0xba, 0xa1, 0x51, 0x49, 0x35, 0x94, 0x6a, 0xa9, 0x9c, 0x7f, 0x75, 0xf3, 0x42, 0x55, 0x05, 0xe4,
+  0x9a, 0xce, 0x13, 0x3c, 0xbb, 0xbf, 0x03, 0x90, 0x42, 0x55, 0x8d, 0x49, 0x4a, 0xc3, 0x88, 0xb1,
+  0xf8, 0x75, 0x30, 0xc9, 0x41, 0xd8, 0xab, 0x11, 0x71, 0x6a, 0x16, 0x88, 0x79, 0xf7, 0x3b, 0x98,
+  0x62, 0x6d, 0x27, 0x84, 0x55, 0x2b, 0x34, 0xbe, 0xd8, 0xad, 0xf1, 0x85, 0xd5, 0x78, 0x6c, 0xcd,
+  0xcc, 0xaa, 0x5b, 0xdb, 0xf5, 0xa0, 0xb9, 0x58, 0xbc, 0x69, 0xd9, 0x4b, 0x3b, 0x83, 0x9d, 0x57,
+  0x8b, 0x14, 0x80, 0x45, 0xb2, 0xe3, 0x30, 0x3a, 0x15, 0x35, 0x88, 0x8d, 0xcc, 0x46, 0x26, 0xe1,
+  0x2d, 0x4b, 0xda, 0xff, 0xf8, 0xfe, 0xcd, 0x25, 0x0d, 0xd2, 0xc9, 0x8c, 0x05, 0x84, 0x59, 0xd3,
+  0x90, 0x69, 0x29, 0xe7, 0x1d, 0x55, 0x64, 0xc9, 0xae, 0x7a, 0x6c, 0x14, 0x5a, 0x32, 0xaa, 0x2a,
+  0x18, 0x85, 0x45, 0x59, 0x14, 0x82, 0xa0, 0x2a, 0x17, 0x2a, 0x1c, 0xe2, 0x52, 0x5f, 0x41, 0xa4,
+  0xdc, 0x66, 0x85, 0x0a, 0xac, 0x59, 0x41, 0xde, 0x74, 0x37, 0xce, 0x13, 0x5e, 0xdd, 0x92, 0xad,
+  0x02, 0x4a, 0xac, 0xd8, 0xaa, 0x78, 0x51, 0x5e, 0xf1, 0x42, 0x55, 0x74, 0x64, 0x46, 0xd5, 0xb4,
+  0xcb, 0xb5, 0x64, 0x88, 0x49, 0xa3, 0xae, 0x68, 0xcb, 0x42, 0x41, 0x02, 0x54, 0x3d, 0xe7, 0xc1,
+  0xc6, 0x72, 0x9c, 0x2c, 0x0c, 0xf1, 0x5a, 0xeb, 0x05, 0xcd, 0x67, 0x49, 0x38, 0xf0, 0xde, 0xfd,
+  0xfe, 0xf2, 0x83, 0xd7, 0x42, 0x19, 0x18, 0xe0, 0x3f, 0x9b, 0x6d, 0xde, 0xe0, 0xce, 0x5e, 0xb3,
+  0xc2, 0x11, 0x4a, 0xd7, 0x86, 0x5b, 0x1b, 0xe4, 0xe9, 0x7e, 0x65, 0x56, 0xcb, 0xf6, 0x25, 0x78,
+  0xfe, 0x5d, 0x32, 0x50, 0x59, 0xc1, 0x97, 0xaa, 0xbd, 0x0f, 0xe0, 0x2d, 0xe8, 0x5e, 0xde, 0xb4,
+  0xc4, 0x1b, 0x18, 0x0c, 0x66, 0x45, 0x77, 0x77, 0xaa, 0x05, 0x27, 0xc1, 0xdd, 0xea, 0x22, 0x41,
+  0x6a, 0xde, 0xc8, 0x87, 0x5f, 0xbe, 0x1c, 0x77, 0x87, 0xdb, 0x61, 0x88, 0x54, 0x97, 0x95, 0xc7,
+  0xda, 0x1f, 0x5c, 0x89, 0x03, 0xe2, 0x50, 0x8c, 0x07, 0x5f, 0xbe, 0xec, 0x06, 0xa0, 0x12, 0xa3,
+  0x5d, 0x61, 0x95, 0x38, 0x35, 0x0e, 0xc0, 0x78, 0xb0, 0x2b, 0x80, 0x4a, 0x64, 0x76, 0x85, 0x55,
+  0xe9, 0x22, 0xf9, 0xe6, 0x04, 0xa6, 0xd4, 0x4d, 0xae, 0x07, 0x15, 0xc6, 0x0e, 0xc0, 0x77, 0xfa,
+  0x7c, 0x33, 0xc2, 0x1e, 0xdd, 0x94, 0x21, 0xfe, 0x55, 0x7b, 0xac, 0x74, 0xdb, 0xc5, 0x6e, 0x2a,
+  0xcc, 0x31, 0x76, 0xd3, 0xdb, 0xbb, 0x9b, 0x9d, 0x08, 0xbb, 0x4f, 0x8f, 0x55, 0xb1, 0x44, 0x09,
+  0xfb, 0x9c, 0x9a, 0x08, 0xfe, 0x64, 0x5f, 0xf0, 0xbb, 0x0d, 0xd4, 0x9d, 0x7a, 0x2a, 0x0b, 0x6a,
+  0xaa, 0x85, 0x80, 0x55, 0xdb, 0x8d, 0x43, 0x66, 0x8b, 0xbd, 0x04, 0x6d, 0xff, 0x3e, 0x2e, 0x76,
+  0x43, 0xfe, 0x42, 0x02, 0xee, 0xee, 0x07, 0x79, 0x2f, 0xec, 0x8b, 0x9d, 0xa0, 0xab, 0xdb, 0x35,
+  0xb0, 0xf3, 0xf7, 0x0e, 0x01, 0xb9, 0xa5, 0xb1, 0x9f, 0x7e, 0xf9, 0x32, 0x0d, 0xe6, 0x19, 0xdd,
+  0xb1, 0x67, 0x96, 0x2e, 0xdf, 0xad, 0x6b, 0x51, 0xd5, 0xb4, 0x97, 0xce, 0x43, 0xb4, 0x73, 0x75,
+  0xdd, 0xba, 0x81, 0xa8, 0xbf, 0x77, 0xc8, 0xca, 0xbb, 0x75, 0xf6, 0x34, 0xf1, 0x1c, 0xf1, 0x2e,
+  0x74, 0x17, 0xe2, 0x58, 0x7f, 0xff, 0x90, 0x57, 0x3a, 0x3f, 0xeb, 0xb1, 0x83, 0x03, 0xb8, 0xf0,
+  0xd5, 0x52, 0xb9, 0x78, 0x7e, 0x0b, 0xb3, 0x39, 0x5f, 0xdf, 0x32, 0x8d, 0x2c, 0xc4, 0x30, 0xc5,
+  0x09, 0x65, 0x69, 0x07, 0x72, 0x42, 0xc9, 0x7f, 0xeb, 0xe5, 0xae, 0x7f, 0x5c, 0xd1, 0xf4, 0x96,
+  0x1f, 0x1e, 0x49, 0x52, 0x08, 0x92, 0x9a, 0xde, 0x43, 0x1d, 0x83, 0x3f, 0x2c, 0xd8, 0xf8, 0xd6,
+  0xc3, 0x82, 0x75, 0x84, 0x5a, 0x8e, 0x81, 0xd1, 0xed, 0x98, 0xca, 0xea, 0x9f, 0x42, 0x1f, 0x87,
+  0x02, 0x0b, 0x35, 0x3b, 0xe7, 0xbf, 0x45, 0xa4, 0x95, 0xf3, 0xa3, 0x6d, 0x62, 0x41, 0xad, 0x7a,
+  0x61, 0x8e, 0xb5, 0xe9, 0x44, 0xe1, 0x63, 0xb9, 0xe2, 0x26, 0xc0, 0x76, 0x92, 0x98, 0x1d, 0x96,
+  0x1a, 0x49, 0x8e, 0x00, 0xf1, 0x26, 0x44, 0x4b, 0x5d, 0xf5, 0x51, 0xbf, 0x8d, 0x15, 0x87, 0x15,
+  0xcf, 0xf2, 0xa8, 0x19, 0x39, 0x2f, 0xad, 0xe0, 0x60, 0xd3, 0x63, 0x7d, 0xff, 0xc4, 0xde, 0x94,
+  0xd2, 0xc8, 0x4c, 0x10, 0x8d, 0x9f, 0xe5, 0xad, 0x68, 0x7c, 0xbb, 0x88, 0x7c, 0xe8, 0xaf, 0xb1,
+  0x33, 0xd6, 0x89, 0x2c, 0x12, 0xfb, 0x34, 0xf8, 0xc6, 0x38, 0x99, 0x9b, 0xe1, 0x4b, 0x7e, 0xe2,
+  0x38, 0x63, 0x40, 0xd8, 0x71, 0x13, 0x71, 0x20, 0x93, 0x4c, 0xa3, 0x14, 0x77, 0x36, 0x98, 0x3b,
+  0x33, 0x4a, 0x8f, 0x05, 0xdd, 0x87, 0x08, 0x3c, 0x34, 0x53, 0x4d, 0x83, 0xe8, 0x6e, 0x6f, 0x32,
+  0xf0, 0x9c, 0x0b, 0xae, 0x6f, 0xf2, 0xf6, 0x8c, 0x04, 0x85, 0x14, 0xf0, 0x85, 0x6d, 0xf4, 0xc2,
+  0xfd, 0xac, 0x34, 0xa6, 0x80, 0xd7, 0xab, 0xdf, 0xbf, 0x15, 0x23, 0x87, 0x67, 0xd7, 0x01, 0x8b,
+  0x96, 0x31, 0xc8, 0xee, 0x3e, 0xb3, 0x5a, 0x75, 0x37, 0xe2, 0x60, 0x7f, 0x5d, 0x1e, 0x75, 0x6f,
+  0xea, 0xda, 0xab, 0xe4, 0x14, 0x6f, 0xad, 0x32, 0x60, 0xb5, 0x8d, 0xcc, 0x7c, 0x33, 0xb6, 0xfc,
+  0x7a, 0x61, 0xbd, 0x0d, 0xd9, 0x09, 0xa2, 0xd5, 0x93, 0xe1, 0x4e, 0xed, 0xeb, 0x62, 0x68, 0x55,
+  0x69, 0x67, 0x83, 0xe5, 0xd8, 0xa9, 0xea, 0x01, 0xb1, 0xae, 0xbb, 0x83, 0xee, 0xf9, 0xbe, 0x24,
+  0xb1, 0x62, 0x3e, 0xf2, 0xf0, 0x38, 0x99, 0xb7, 0xf1, 0xf1, 0x60, 0xab, 0xd8, 0x30, 0xae, 0xb7,
+  0x8e, 0xe3, 0x26, 0x23, 0xbc, 0x88, 0x8b, 0x1f, 0x14, 0xc2, 0x15, 0x8b, 0x14, 0x38, 0x30, 0x64,
+  0xe5, 0x51, 0x86, 0xa7, 0xf8, 0x62, 0x44, 0x65, 0x44, 0xb8, 0x09, 0x3e, 0x38, 0x38, 0x3c, 0x24,
+  0x17, 0xfc, 0xf5, 0x44, 0xd1, 0x2f, 0x94, 0x35, 0x25, 0x78, 0xad, 0x99, 0x14, 0x26, 0x28, 0xce,
+  0x6f, 0xb5, 0x2a, 0xe1, 0x45, 0xc4, 0x78, 0x4a, 0xf1, 0x43, 0x30, 0x6e, 0xfa, 0x64, 0x7d, 0x40,
+  0x18, 0x71, 0xfc, 0x10, 0xe1, 0x45, 0x3c, 0x4d, 0x40, 0xd4, 0x44, 0x19, 0x93, 0x7f, 0x75, 0xba,
+  0x10, 0x4b, 0xe1, 0x3f, 0xe8, 0x8c, 0x1f, 0x31, 0xc5, 0x13, 0x55, 0x6d, 0x3c, 0x52, 0x45, 0xc4,
+  0x91, 0x2a, 0x44, 0x2a, 0x9a, 0x12, 0x7e, 0x40, 0x1f, 0x6a, 0x16, 0x69, 0x00, 0x9c, 0x81, 0x81,
+  0xf2, 0x97, 0xd8, 0x7a, 0xc7, 0xcf, 0xa9, 0xbc, 0x82, 0x21, 0x69, 0xe1, 0x8d, 0xae, 0x5d, 0xa3,
+  0x23, 0x54, 0x0b, 0x79, 0x40, 0xd7, 0xbe, 0x94, 0x4f, 0x62, 0x68, 0x9e, 0xcd, 0x45, 0x14, 0x37,
+  0x8c, 0x1b, 0xbc, 0x57, 0x69, 0x4e, 0x52, 0x18, 0x4d, 0x77, 0xe1, 0xcf, 0xb8, 0xa3, 0x04, 0x1f,
+  0x73, 0x3e, 0x20, 0x69, 0x30, 0xef, 0x3e, 0x9c, 0x81, 0xe1, 0x25, 0xc6, 0xf5, 0x05, 0xfc, 0xb4,
+  0xaa, 0x38, 0x83, 0x46, 0xc6, 0xa0, 0xf1, 0x21, 0x41, 0x9b, 0x84, 0x70, 0x09, 0x91, 0x7b, 0xb6,
+  0xed, 0xdb, 0x11, 0x80, 0xd4, 0x9a, 0x5d, 0xdb, 0x76, 0x5d, 0x8f, 0x91, 0x2c, 0xe1, 0x98, 0xf7,
+  0x39, 0xd4, 0x43, 0x31, 0x6b, 0x7a, 0x92, 0x6d, 0x30, 0x02, 0x8c, 0x24, 0x32, 0x1a, 0x91, 0x3e,
+  0xd0, 0xc5, 0xa8, 0x62, 0xd6, 0x55, 0xe0, 0x4b, 0x0a, 0xb8, 0xda, 0xc2, 0x09, 0x7d, 0x7a, 0xec,
+  0x6e, 0x4a, 0x6f, 0x28, 0x6a, 0x9b, 0xfd, 0x98, 0x7a, 0x84, 0x35, 0x8d, 0xfb, 0x26, 0xfe, 0xec,
+  0x9c, 0xa4, 0x6f, 0x93, 0x6c, 0x16, 0xa4, 0x94, 0xdc, 0x44, 0xf9, 0xcc, 0x3e, 0x72, 0xcf, 0xee,
+  0xa2, 0x10, 0x77, 0x50, 0xb0, 0x5e, 0x36, 0x84, 0xed, 0x27, 0x62, 0xc8, 0x8a, 0x9a, 0x7b, 0x60,
+  0xcb, 0x94, 0xe9, 0x9e, 0xc8, 0x96, 0xdc, 0x8e, 0xc1, 0x31, 0xe3, 0x5c, 0x35, 0xf7, 0x29, 0x28,
+  0xd1, 0x79, 0x81, 0x38, 0x8e, 0x3c, 0xf2, 0x98, 0x21, 0xeb, 0x33, 0x04, 0x84, 0xc9, 0x23, 0xa3,
+  0x33, 0xa2, 0x8c, 0x9e, 0xf1, 0x80, 0x5d, 0x09, 0x03, 0xcf, 0xd6, 0xac, 0x8c, 0x8f, 0x96, 0x91,
+  0x21, 0x82, 0x41, 0x03, 0x34, 0x55, 0x8e, 0x48, 0x55, 0x23, 0x55, 0xc7, 0x48, 0x86, 0xaa, 0x42,
+  0x99, 0x12, 0xf3, 0x3f, 0x42, 0xac, 0x65, 0x62, 0x88, 0x88, 0x54, 0x8d, 0x7a, 0x2e, 0x7c, 0xd9,
+  0x2b, 0xad, 0x2d, 0x42, 0x49, 0x9c, 0x5c, 0xd2, 0x9f, 0xe3, 0x3f, 0xc7, 0x48, 0xf6, 0x80, 0x20,
+  0xc9, 0x4a, 0xc8, 0x7a, 0xe4, 0x05, 0xf1, 0xf8, 0xa0, 0x79, 0x04, 0x9e, 0x31, 0x61, 0x03, 0xdc,
+  0x1f, 0x13, 0x0f, 0x5b, 0xbc, 0x83, 0xae, 0x40, 0x04, 0xf0, 0x2c, 0x0e, 0x9d, 0xa6, 0x68, 0x9b,
+  0xa2, 0x98, 0xf4, 0x09, 0xbf, 0xc8, 0x94, 0x5d, 0xb7, 0xc0, 0xd6, 0xce, 0x08, 0xbf, 0xbc, 0x20,
+  0xeb, 0x78, 0x36, 0xe6, 0xef, 0x45, 0xa3, 0x25, 0x82, 0x61, 0x97, 0x79, 0x73, 0x0c, 0x79, 0x75,
+  0xcd, 0x1e, 0xf3, 0x18, 0x09, 0x32, 0x58, 0x9d, 0x0e, 0x4b, 0x29, 0x72, 0xa6, 0xe9, 0xb7, 0x48,
+  0x5f, 0x1a, 0x17, 0xfc, 0x23, 0x25, 0xce, 0xe5, 0x82, 0xde, 0xa3, 0xb4, 0x2a, 0x18, 0x11, 0x41,
+  0xb8, 0x99, 0xa9, 0x23, 0x5f, 0xbe, 0x90, 0xc2, 0xae, 0x2f, 0x87, 0x00, 0xf0, 0x01, 0x39, 0x09,
+  0xd3, 0x64, 0x19, 0x62, 0x25, 0x80, 0xcc, 0x5e, 0x97, 0x92, 0xc0, 0x68, 0x33, 0xc7, 0xb6, 0x75,
+  0x04, 0x37, 0xec, 0x73, 0x23, 0xc4, 0xc8, 0x48, 0xe6, 0x99, 0x82, 0x54, 0xea, 0xb5, 0x18, 0x09,
+  0x6c, 0x43, 0xb4, 0x41, 0x84, 0xd7, 0x22, 0x22, 0xb7, 0x77, 0x60, 0x51, 0x2e, 0x6e, 0xca, 0xe4,
+  0x0f, 0x4b, 0x9b, 0x96, 0xee, 0xd4, 0x92, 0x50, 0xf6, 0x20, 0xb5, 0x9c, 0xd0, 0x8d, 0x32, 0xdf,
+  0x10, 0xb4, 0x90, 0xe2, 0xed, 0x31, 0xa4, 0xb9, 0x88, 0x32, 0xbc, 0xd1, 0x81, 0x68, 0x57, 0xb6,
+  0x58, 0x72, 0x8b, 0xc8, 0x86, 0xda, 0xb7, 0xb7, 0xe3, 0xe8, 0xeb, 0x54, 0x18, 0x93, 0x94, 0x79,
+  0x65, 0xf7, 0xc6, 0xec, 0x64, 0x9e, 0x59, 0x4d, 0xc7, 0x38, 0x43, 0x43, 0x09, 0x43, 0xac, 0xbf,
+  0xe6, 0x69, 0xb4, 0x30, 0xbd, 0x23, 0x04, 0x1c, 0x11, 0x93, 0x1c, 0xc7, 0xbc, 0x2c, 0x82, 0xdc,
+  0x04, 0xf4, 0x2e, 0xc0, 0x97, 0x7b, 0xa0, 0x85, 0x3f, 0xfc, 0x77, 0xcd, 0x9f, 0xba, 0xed, 0x67,
+  0x2f, 0xdb, 0xaf, 0x83, 0xf6, 0xf4, 0xe7, 0x75, 0x7f, 0xf3, 0xd3, 0xa0, 0xfd, 0xb3, 0xbf, 0x3e,
+  0xd9, 0x38, 0xc5, 0xfe, 0x37, 0x87, 0x43, 0x61, 0xe0, 0x1f, 0x20, 0x26, 0x20, 0x7a, 0x0f, 0x34,
+  0x20, 0xb0, 0x75, 0x59, 0xde, 0x84, 0xdf, 0xbe, 0x34, 0x1b, 0x76, 0x8c, 0xca, 0x92, 0x74, 0x10,
+  0xa2, 0x5e, 0x23, 0x7a, 0x16, 0x6e, 0xa0, 0x8f, 0x1c, 0x3d, 0x52, 0xb8, 0x3e, 0x47, 0x0e, 0xaf,
+  0xd8, 0x23, 0xab, 0xed, 0x21, 0xd0, 0x09, 0x76, 0x95, 0x0d, 0x37, 0x53, 0x15, 0x71, 0xb7, 0x8d,
+  0xbc, 0xd8, 0x2a, 0x63, 0x31, 0x6e, 0xee, 0x92, 0xcd, 0x7f, 0x82, 0x61, 0x79, 0x2b, 0x19, 0xd9,
+  0xc9, 0x93, 0x1f, 0xb1, 0x31, 0x5f, 0x81, 0x04, 0x65, 0x65, 0x57, 0x3d, 0x34, 0x0f, 0x7f, 0x6a,
+  0xff, 0x7c, 0x78, 0xd5, 0x22, 0xde, 0x40, 0xf9, 0x35, 0x73, 0x47, 0x8e, 0x1c, 0xa0, 0x17, 0x00,
+  0x81, 0xd9, 0x5f, 0x1a, 0x4f, 0x20, 0xf2, 0xfe, 0xf1, 0xfd, 0xc5, 0x79, 0xb2, 0x58, 0x82, 0x37,
+  0x88, 0xf3, 0xa6, 0xd9, 0x97, 0xff, 0x37, 0xb6, 0xcd, 0xa6, 0x3d, 0x10, 0xb1, 0x89, 0xbe, 0x51,
+  0x46, 0x6c, 0xdf, 0x05, 0x61, 0x66, 0xf7, 0x39, 0xe7, 0x74, 0x7e, 0xab, 0xea, 0xcb, 0x2d, 0xfc,
+  0xf6, 0xad, 0x38, 0x75, 0xc2, 0xeb, 0xd6, 0x35, 0xcd, 0x69, 0x39, 0x34, 0xbc, 0x63, 0x67, 0x1f,
+  0x88, 0x58, 0xdf, 0x81, 0x6a, 0x3d, 0xaf, 0x8f, 0x26, 0x6a, 0x5a, 0xe8, 0x1c, 0x0b, 0x36, 0x12,
+  0xa7, 0xa5, 0x77, 0x68, 0xc6, 0x0e, 0x4f, 0xbf, 0xa1, 0x53, 0xe6, 0xe2, 0x0b, 0xc7, 0xa7, 0x6b,
+  0x00, 0x20, 0x25, 0xfa, 0xd4, 0x1f, 0xb6, 0x66, 0xe7, 0xa7, 0xcf, 0xe5, 0x35, 0x05, 0x28, 0xda,
+  0x5c, 0xd6, 0xb8, 0xe5, 0x37, 0x45, 0x6a, 0x0b, 0x54, 0x8e, 0x1a, 0x5b, 0x64, 0x67, 0xc4, 0x14,
+  0x70, 0x29, 0x11, 0x09, 0x11, 0x66, 0x42, 0x4b, 0x30, 0x72, 0xea, 0xb9, 0x6d, 0x6d, 0x30, 0xea,
+  0x2f, 0xc5, 0x42, 0x55, 0x33, 0x99, 0x72, 0xbe, 0x43, 0xff, 0x72, 0x81, 0xc7, 0xf0, 0xf4, 0xfa,
+  0xa2, 0x06, 0xcd, 0x01, 0xe1, 0x07, 0x58, 0x10, 0x00, 0xc6, 0xa3, 0xc8, 0x10, 0xe9, 0xef, 0x9d,
+  0x20, 0x4a, 0x5f, 0xa6, 0x04, 0x33, 0x68, 0x6f, 0x87, 0x78, 0xa5, 0xe0, 0x98, 0x65, 0xf8, 0xc2,
+  0xfd, 0x12, 0x57, 0x96, 0xff, 0xaf, 0x20, 0x38, 0xa6, 0xec, 0xaa, 0xcf, 0x7b, 0x28, 0x08, 0xbf,
+  0x2d, 0x65, 0x4f, 0x05, 0xf9, 0xa7, 0xff, 0x29, 0x15, 0x04, 0x6d, 0xd7, 0x94, 0x85, 0x4b, 0x3b,
+  0x06, 0x46, 0x7b, 0xea, 0x4c, 0x01, 0xbd, 0xea, 0x58, 0x4d, 0xc0, 0x2b, 0x88, 0xeb, 0xbe, 0x11,
+  0xdb, 0xdd, 0x43, 0x2d, 0x91, 0x18, 0x10, 0xb3, 0x15, 0xf4, 0xaf, 0xc5, 0x40, 0xeb, 0xc0, 0x16,
+  0xe8, 0xd8, 0x0a, 0xb8, 0x2c, 0xc1, 0xfe, 0x9a, 0x62, 0xfd, 0x2f, 0x21, 0xd4, 0xfb, 0x8a, 0xf4,
+  0x9d, 0x04, 0xfa, 0x9e, 0xe2, 0xbc, 0xa3, 0x30, 0xdb, 0x61, 0x6f, 0xbb, 0x10, 0xe2, 0xd6, 0xc3,
+  0xdb, 0x22, 0xb3, 0x07, 0x7b, 0xca, 0xab, 0x8a, 0xb0, 0x59, 0x5e, 0x92, 0xdf, 0x55, 0x67, 0x44,
+  0x6a, 0x18, 0x5d, 0x15, 0x63, 0x6f, 0x1d, 0x38, 0xe3, 0xc5, 0x08, 0xee, 0x65, 0x76, 0x93, 0x79,
+  0xb4, 0x1c, 0x27, 0x41, 0x1a, 0xea, 0xe8, 0xd8, 0xbd, 0xff, 0xd2, 0x8e, 0x8f, 0x85, 0x18, 0xd4,
+  0x09, 0x87, 0xba, 0x75, 0xb3, 0x34, 0x38, 0x2e, 0x39, 0x0f, 0x62, 0xe4, 0x26, 0xb0, 0xda, 0xa3,
+  0x47, 0xac, 0xf6, 0x03, 0x0c, 0xa8, 0xf4, 0xb5, 0x9d, 0x2a, 0xa6, 0x8a, 0x83, 0xeb, 0xe8, 0x0a,
+  0x6f, 0xe2, 0xed, 0x28, 0xe4, 0x3b, 0x37, 0x69, 0x94, 0x53, 0x64, 0x39, 0x0b, 0x71, 0x79, 0xc0,
+  0xc6, 0x67, 0x7a, 0x52, 0x2d, 0xb7, 0x44, 0x61, 0xc0, 0x9e, 0x0f, 0x14, 0x82, 0xc3, 0x34, 0x48,
+  0x23, 0x35, 0xdd, 0x24, 0xe2, 0xaa, 0x11, 0x44, 0x95, 0x9d, 0x4b, 0x41, 0xbd, 0x8c, 0x72, 0xb6,
+  0x65, 0x10, 0xb8, 0x14, 0xd1, 0xd0, 0x52, 0x22, 0x51, 0x7b, 0x44, 0xd8, 0x19, 0xdd, 0x4e, 0x1e,
+  0xa4, 0xc0, 0x19, 0x5b, 0xcf, 0xe4, 0xc1, 0x17, 0xa1, 0x5f, 0xbc, 0x85, 0xcb, 0x0a, 0xfc, 0x53,
+  0x7c, 0x82, 0x02, 0x74, 0xce, 0x3a, 0x7d, 0xe0, 0x39, 0xb5, 0xca, 0xd5, 0xc5, 0xf6, 0xe9, 0x85,
+  0x29, 0xb0, 0x76, 0xa1, 0xa5, 0x7d, 0x99, 0x98, 0x0e, 0xdd, 0xaa, 0xe5, 0x1d, 0xb2, 0x5b, 0x50,
+  0x55, 0x87, 0x9b, 0x16, 0xe9, 0x9d, 0xa8, 0x29, 0xb5, 0xbd, 0xcf, 0xa4, 0xc6, 0x5e, 0x9a, 0x5a,
+  0x60, 0x8b, 0x6b, 0xd1, 0x62, 0xc2, 0xa0, 0xbd, 0x0e, 0xe6, 0x73, 0xc4, 0x83, 0x65, 0x68, 0xd8,
+  0x15, 0x70, 0x64, 0x9c, 0x26, 0x37, 0x19, 0x4d, 0x6d, 0x63, 0x89, 0xc4, 0xbd, 0x4c, 0x69, 0x60,
+  0xca, 0xed, 0x04, 0x7e, 0xe7, 0xf2, 0xb8, 0x68, 0xd3, 0xc3, 0x2a, 0x01, 0x14, 0x69, 0x3b, 0x26,
+  0x1b, 0xa9, 0xe0, 0x6a, 0xa1, 0x63, 0x2a, 0x05, 0x05, 0x77, 0xfa, 0x74, 0xf0, 0x15, 0xb9, 0x71,
+  0x78, 0x8e, 0x77, 0xeb, 0x37, 0x65, 0xab, 0x22, 0x18, 0xbe, 0x10, 0xa0, 0x85, 0x4e, 0xc1, 0xa0,
+  0x9f, 0xe9, 0x04, 0xe6, 0x26, 0x0b, 0xd0, 0x60, 0xb4, 0xad, 0xcb, 0x5b, 0xcf, 0x2f, 0xef, 0x87,
+  0xaf, 0x1c, 0x54, 0xf4, 0x23, 0xec, 0x88, 0xa9, 0xe1, 0x5c, 0x4a, 0x2d, 0x45, 0xe7, 0x4e, 0x0f,
+  0xd5, 0x44, 0xdb, 0x07, 0x27, 0xae, 0x2a, 0x01, 0x84, 0x7b, 0x7a, 0x82, 0x6b, 0x18, 0x1b, 0x76,
+  0x29, 0xd6, 0x2d, 0x15, 0xd6, 0x7e, 0x63, 0xa7, 0x54, 0xc5, 0xcd, 0xc6, 0xf2, 0x9e, 0x6a, 0x82,
+  0xa7, 0x3c, 0xdc, 0xdc, 0x2a, 0x4f, 0xe8, 0xbe, 0x13, 0x55, 0xf8, 0x51, 0x11, 0xd6, 0xaf, 0x31,
+  0x85, 0xb3, 0xeb, 0x18, 0xe7, 0x46, 0x10, 0x73, 0x6c, 0xf0, 0xb7, 0x9c, 0xb0, 0xd5, 0x46, 0x01,
+  0xf5, 0x89, 0x16, 0x87, 0x3f, 0x5a, 0xa2, 0xdd, 0xdc, 0x34, 0xde, 0x6a, 0x13, 0xca, 0x0b, 0x29,
+  0x91, 0x77, 0x65, 0x9c, 0x94, 0x57, 0x78, 0x6a, 0x16, 0xca, 0x15, 0x2f, 0x23, 0xed, 0x5d, 0x67,
+  0xa8, 0xad, 0x8a, 0x7c, 0x40, 0x99, 0x0d, 0xc6, 0x65, 0x2a, 0x4c, 0xdd, 0x49, 0xa6, 0x58, 0xf5,
+  0x8a, 0xce, 0x1c, 0x2f, 0xaa, 0xf7, 0x0a, 0x42, 0xb4, 0xa5, 0x91, 0xca, 0xca, 0x16, 0x53, 0xa8,
+  0x40, 0x97, 0x71, 0x75, 0xe9, 0xbf, 0x8e, 0x91, 0xc7, 0x01, 0x45, 0xfc, 0x4b, 0x86, 0x9c, 0x2d,
+  0x63, 0x88, 0x3c, 0x5a, 0x14, 0xf3, 0x49, 0x13, 0xae, 0x61, 0x58, 0xfb, 0xe4, 0xcc, 0xb9, 0x90,
+  0xa5, 0x2d, 0x57, 0x32, 0xe5, 0x8c, 0xcf, 0xbc, 0x3b, 0xb1, 0x47, 0xe4, 0xd4, 0x8c, 0x54, 0x9e,
+  0x4a, 0xd2, 0xb9, 0x46, 0xa8, 0xdc, 0xd5, 0x63, 0xda, 0x57, 0x2e, 0xc4, 0xa1, 0xbc, 0x21, 0xab,
+  0x11, 0x4c, 0x49, 0x64, 0x4b, 0xf3, 0x52, 0x23, 0x81, 0x43, 0x44, 0x45, 0x64, 0x41, 0x3f, 0x83,
+  0xe0, 0xdb, 0xd6, 0x3b, 0xb3, 0xec, 0xc1, 0x0e, 0x21, 0x48, 0x56, 0x30, 0x20, 0xda, 0xa2, 0xa2,
+  0x34, 0x94, 0x02, 0xb4, 0x24, 0xa1, 0xac, 0x82, 0x4d, 0x61, 0xb1, 0x0f, 0x9c, 0x3c, 0x74, 0x6d,
+  0x61, 0x31, 0x89, 0x17, 0x6b, 0xf2, 0x92, 0xd1, 0x86, 0x79, 0xb5, 0x88, 0x55, 0xe1, 0xd3, 0xfe,
+  0xa1, 0x96, 0x12, 0x76, 0x17, 0x04, 0x84, 0x54, 0x7c, 0x96, 0x03, 0x66, 0xdf, 0xa0, 0xd2, 0xad,
+  0xe7, 0xc4, 0x00, 0xb2, 0x49, 0x35, 0x49, 0x35, 0x0b, 0x62, 0xee, 0x42, 0x98, 0x26, 0xf0, 0xfe,
+  0x8b, 0x61, 0x26, 0xac, 0xfb, 0x2c, 0x88, 0x19, 0xc4, 0x28, 0x1b, 0xb1, 0x65, 0x75, 0x6c, 0xff,
+  0x15, 0xb2, 0xbf, 0xd6, 0x2a, 0x59, 0x31, 0x73, 0xc4, 0x2c, 0x0b, 0x53, 0x27, 0x7b, 0xee, 0x89,
+  0xc4, 0x6a, 0x67, 0x8e, 0xd3, 0x06, 0x16, 0xd9, 0x16, 0x92, 0x8e, 0x4e, 0xe6, 0xc3, 0xce, 0x7c,
+  0xef, 0x9b, 0x23, 0xff, 0xed, 0x64, 0x64, 0xd4, 0x17, 0x25, 0x13, 0x8a, 0x1e, 0x43, 0x91, 0x64,
+  0x09, 0x9b, 0xa6, 0x74, 0xbb, 0x03, 0xfb, 0x3f, 0xcb, 0xad, 0x10, 0x87, 0x75, 0xb6, 0x1d, 0x51,
+  0xcf, 0x86, 0xd5, 0x0d, 0xea, 0xd3, 0x76, 0x2a, 0x67, 0xa0, 0x33, 0x73, 0x38, 0x80, 0xd4, 0x80,
+  0x67, 0x7c, 0x75, 0x2a, 0x97, 0x0c, 0xf7, 0x5d, 0x92, 0x52, 0x77, 0xce, 0xdb, 0x7e, 0x85, 0xcc,
+  0xed, 0xfd, 0x73, 0xb7, 0xd5, 0x03, 0x71, 0xb7, 0xfc, 0x6d, 0x21, 0x4d, 0x69, 0xe4, 0x75, 0x92,
+  0xdc, 0x19, 0xa7, 0xbf, 0x12, 0xe7, 0x0b, 0x09, 0xc1, 0xaf, 0x90, 0x12, 0xdc, 0x3d, 0x8f, 0x62,
+  0x51, 0xad, 0x13, 0x1b, 0x6d, 0xc2, 0xef, 0xdd, 0xb7, 0xf2, 0x18, 0x63, 0xdc, 0x1d, 0xb5, 0xf7,
+  0x20, 0x14, 0x90, 0xdb, 0x38, 0x39, 0xe3, 0xb2, 0xed, 0x03, 0x7b, 0x6f, 0x21, 0xf8, 0x17, 0xd9,
+  0x46, 0xb0, 0xcd, 0xb9, 0xea, 0xcd, 0x34, 0x55, 0xdb, 0x4c, 0xb4, 0x35, 0x94, 0x57, 0x19, 0xef,
+  0xe0, 0x5c, 0x9d, 0xaa, 0x76, 0x0c, 0xe1, 0x3c, 0x34, 0xed, 0x59, 0xc1, 0x57, 0xf6, 0x7c, 0x93,
+  0xbb, 0xc6, 0xc0, 0x39, 0x40, 0xb6, 0x0b, 0x73, 0x89, 0xe2, 0x6c, 0x85, 0xe1, 0x8c, 0xce, 0xe6,
+  0xce, 0xd1, 0xba, 0xdc, 0xc6, 0x65, 0x04, 0xe3, 0x55, 0xf1, 0xba, 0xa1, 0xc1, 0xc6, 0xde, 0xc4,
+  0xcc, 0x0e, 0xda, 0xed, 0x1d, 0x52, 0x5f, 0x3b, 0x6c, 0x17, 0x89, 0x0d, 0x76, 0x29, 0x74, 0x5d,
+  0x28, 0x6c, 0x5f, 0xd5, 0x6d, 0x64, 0x37, 0x58, 0x46, 0xc1, 0x52, 0x55, 0xaf, 0x2a, 0x28, 0xe2,
+  0x40, 0x94, 0xf7, 0xe3, 0x3f, 0xc5, 0x41, 0x54, 0x72, 0x46, 0xba, 0x56, 0x50, 0x69, 0xd4, 0x50,
+  0x47, 0x52, 0x41, 0x65, 0x5a, 0xc0, 0xd0, 0x90, 0x7e, 0x76, 0x92, 0x4f, 0x4a, 0x6c, 0xc1, 0x34,
+  0x8e, 0x08, 0x4f, 0xc9, 0x30, 0xbe, 0xbd, 0x4f, 0x6e, 0xcc, 0x56, 0xa6, 0x39, 0xc8, 0x0b, 0x39,
+  0x17, 0x68, 0x6d, 0xd4, 0xd8, 0x54, 0x2f, 0x17, 0x95, 0x10, 0x5d, 0xb8, 0xb9, 0xfc, 0x64, 0xf7,
+  0x9b, 0xcb, 0x05, 0x5f, 0x4a, 0xae, 0x2e, 0xf7, 0x86, 0xf7, 0x16, 0x43, 0x4b, 0xb2, 0x4a, 0x04,
+  0xf1, 0x9c, 0x31, 0xcb, 0xde, 0x1c, 0xcb, 0x2f, 0x2d, 0x07, 0x76, 0x18, 0xf9, 0xdc, 0x4a, 0x9e,
+  0x1a, 0x39, 0x03, 0xce, 0xfe, 0xca, 0xd4, 0x58, 0x6a, 0xa6, 0x72, 0x79, 0x57, 0x3f, 0x04, 0x0b,
+  0x0c, 0x61, 0x3e, 0xf2, 0xf8, 0xf8, 0x9b, 0x35, 0x03, 0x09, 0xae, 0xb4, 0xb7, 0xf9, 0x28, 0xf2,
+  0xb9, 0x00, 0xd3, 0xe2, 0xf4, 0x47, 0xc6, 0x02, 0xbc, 0x44, 0xfb, 0x9b, 0xb5, 0x86, 0xb1, 0x61,
+  0x3c, 0x93, 0x8f, 0xac, 0x4b, 0xa7, 0xeb, 0x5e, 0x12, 0xd5, 0x5d, 0x7e, 0x6e, 0x00, 0x1c, 0xa0,
+  0xc6, 0x06, 0xb0, 0xe7, 0xf5, 0xe1, 0x15, 0xcd, 0xcc, 0x57, 0x46, 0xaa, 0x17, 0xdf, 0xe0, 0xf0,
+  0x96, 0xb5, 0x74, 0x2e, 0xa4, 0x96, 0x6f, 0x23, 0x24, 0xfa, 0x45, 0x80, 0xc5, 0x37, 0x18, 0xb0,
+  0xbd, 0xc3, 0x1e, 0xc7, 0xdf, 0xf3, 0x0b, 0x6f, 0x24, 0x90, 0x3d, 0x28, 0x56, 0x8a, 0x8b, 0xba,
+  0x92, 0x1b, 0xb5, 0x0b, 0x66, 0x12, 0xb0, 0x8d, 0x19, 0x44, 0x5f, 0xa1, 0x5c, 0xb0, 0x41, 0x95,
+  0xaf, 0x82, 0x60, 0x03, 0x8f, 0xca, 0xad, 0x37, 0x8c, 0xfa, 0xc6, 0x2e, 0x0e, 0x7c, 0x68, 0xee,
+  0x24, 0x65, 0xd7, 0x3d, 0xea, 0xf4, 0x92, 0x7e, 0x39, 0x42, 0xad, 0xdd, 0xd1, 0xd5, 0x4c, 0xe1,
+  0x91, 0x2f, 0x46, 0xd8, 0xd6, 0xf4, 0x0d, 0xbb, 0xbe, 0x4e, 0x60, 0x63, 0xc0, 0xaa, 0x73, 0x21,
+  0xb2, 0x9d, 0xa3, 0xdf, 0xb5, 0x37, 0x8c, 0x5b, 0xef, 0xac, 0xd5, 0xb7, 0xa5, 0xe3, 0x15, 0xe1,
+  0xff, 0xf4, 0x1f, 0x88, 0x62, 0x42, 0x29, 0xa7, 0xd9, 0x85, 0xf2, 0x78, 0xb1, 0xb3, 0xa7, 0xf7,
+  0xf7, 0x08, 0x1e, 0xc3, 0xac, 0x2a, 0xbb, 0x11, 0xef, 0x13, 0xe2, 0xf1, 0x05, 0x84, 0x02, 0xca,
+  0xf5, 0xa7, 0xc9, 0x98, 0x0e, 0xf9, 0xa4, 0x0b, 0x2a, 0x2c, 0x48, 0x90, 0xe1, 0xe7, 0x2d, 0x09,
+  0xd2, 0x14, 0x04, 0x4e, 0xf1, 0x6a, 0x99, 0xcc, 0x71, 0x53, 0xec, 0x2a, 0x9d, 0xa3, 0xad, 0xe0,
+  0xae, 0x03, 0x7e, 0x54, 0x7a, 0x0b, 0xe1, 0x27, 0x04, 0x06, 0xf0, 0xa0, 0x29, 0xf4, 0x2c, 0x6b,
+  0x31, 0xde, 0xc4, 0xec, 0x5e, 0xb2, 0xb4, 0xc3, 0xdf, 0x93, 0x90, 0x21, 0xdf, 0x9b, 0xde, 0x9f,
+  0xda, 0x48, 0x64, 0xfb, 0x22, 0x6e, 0xbf, 0x4b, 0x93, 0xab, 0x94, 0xa7, 0xc4, 0x58, 0x86, 0xac,
+  0xe7, 0x6d, 0x7c, 0xcb, 0x03, 0x95, 0x80, 0xdb, 0xf8, 0x85, 0x44, 0x9b, 0xe8, 0x1e, 0x7d, 0x85,
+  0x60, 0x53, 0xb9, 0x9f, 0x28, 0x1f, 0x2d, 0xc3, 0x91, 0xcb, 0xe6, 0xd2, 0x89, 0x08, 0x13, 0x07,
+  0xfd, 0xa9, 0xa6, 0xa6, 0x0f, 0xe0, 0x36, 0x4b, 0x78, 0xd5, 0x9c, 0x2e, 0x44, 0x7d, 0xdf, 0x77,
+  0xbd, 0x01, 0xdb, 0x22, 0x95, 0x29, 0xb9, 0xdf, 0x86, 0xd1, 0x1d, 0xe5, 0x07, 0xbc, 0x43, 0x41,
+  0x60, 0x40, 0x8c, 0x30, 0x1a, 0x8f, 0x40, 0x93, 0x71, 0x7d, 0xc9, 0x10, 0x9e, 0x92, 0x08, 0x90,
+  0xe5, 0xa9, 0xca, 0xb0, 0x74, 0x57, 0x72, 0x50, 0x4c, 0x30, 0x73, 0xca, 0xb5, 0x9d, 0xbf, 0x43,
+  0xd0, 0xc3, 0x1d, 0x8d, 0x27, 0x5d, 0xc3, 0x29, 0x6a, 0xf5, 0x2e, 0xeb, 0xab, 0x64, 0xe3, 0xf8,
+  0x9d, 0xd7, 0xba, 0x4d, 0x9d, 0x29, 0x78, 0x2f, 0xb5, 0x1e, 0xf5, 0x95, 0x78, 0xcd, 0xa3, 0x7e,
+  0xfe, 0xfa, 0x1a, 0xb1, 0xdf, 0xa0, 0x64, 0x23, 0xa2, 0xc3, 0xe9, 0x6a, 0x72, 0x85, 0x22, 0x97,
+  0xb1, 0xf4, 0x85, 0xd8, 0xa1, 0x3a, 0xea, 0x79, 0xae, 0x0b, 0x96, 0x01, 0x23, 0x48, 0x1d, 0xa3,
+  0x1a, 0xdb, 0x11, 0xf1, 0xae, 0x18, 0xd7, 0x11, 0x17, 0x05, 0xd4, 0x70, 0xc3, 0x0c, 0x42, 0xb5,
+  0x1f, 0x06, 0x22, 0x44, 0x9a, 0x1e, 0xea, 0xf1, 0xfb, 0xcf, 0x85, 0x1b, 0xf6, 0x8c, 0xb7, 0x07,
+  0x4b, 0x6b, 0x24, 0x0c, 0x2e, 0x73, 0x81, 0xe7, 0x58, 0x17, 0x21, 0xf3, 0x85, 0xe4, 0x34, 0xcb,
+  0x22, 0xd0, 0xc7, 0xf6, 0x49, 0x17, 0xb7, 0xe7, 0x5a, 0xef, 0xff, 0xc0, 0x5d, 0xba, 0x46, 0xac,
+  0x65, 0xfc, 0x71, 0xda, 0x3e, 0x31, 0xdb, 0x72, 0x0f, 0xcb, 0x76, 0xf8, 0x1a, 0xaf, 0xd0, 0xf0,
+  0x86, 0x0e, 0x1a, 0x32, 0x35, 0x53, 0x86, 0xc5, 0x65, 0x7d, 0xf7, 0xa5, 0xbd, 0xbf, 0xd5, 0xdd,
+  0xfe, 0x51, 0xf6, 0x27, 0xd9, 0x53, 0x12, 0x7a, 0xb0, 0x4b, 0xf8, 0x39, 0x38, 0xeb, 0x1d, 0x0c,
+  0xfa, 0x75, 0xc7, 0x0d, 0x15, 0x9b, 0x74, 0xf0, 0x27, 0xdb, 0x0e, 0xa2, 0xd5, 0x98, 0x8f, 0x9d,
+  0xb7, 0x11, 0xd7, 0xf9, 0x57, 0x42, 0x5a, 0xe0, 0x1b, 0x27, 0x15, 0x20, 0xf4, 0xf1, 0xea, 0x07,
+  0xc8, 0x67, 0x06, 0x98, 0x7f, 0x24, 0xff, 0xfb, 0x7f, 0x11, 0xab, 0x70, 0x83, 0x6b, 0x04, 0x19,
+  0x16, 0x5f, 0xab, 0xf2, 0x69, 0x94, 0x2e, 0x6e, 0x82, 0x94, 0x6e, 0x3e, 0x22, 0x85, 0x9e, 0x86,
+  0x82, 0x93, 0x47, 0x98, 0x7b, 0x00, 0x07, 0xb0, 0x01, 0xff, 0xe5, 0xf1, 0x3a, 0x06, 0x6e, 0xe6,
+  0x57, 0x13, 0x61, 0xeb, 0xd6, 0x7a, 0xf3, 0xed, 0xcb, 0x80, 0x91, 0x21, 0x2e, 0x1b, 0xa4, 0x41,
+  0x8f, 0xdb, 0x86, 0x34, 0x55, 0xff, 0x38, 0x0a, 0x9b, 0xf0, 0xbb, 0x85, 0x2f, 0x5f, 0xa6, 0x29,
+  0x20, 0xd7, 0x85, 0x42, 0xa0, 0xbc, 0xce, 0x0b, 0xa4, 0x64, 0x10, 0x64, 0xf0, 0x09, 0x63, 0xa1,
+  0x97, 0x61, 0xa8, 0xdf, 0xc2, 0x61, 0xd1, 0xe1, 0x84, 0x43, 0x38, 0xcc, 0x52, 0x13, 0xf1, 0x65,
+  0x52, 0x66, 0x24, 0x6c, 0x1f, 0x6f, 0x63, 0x3d, 0xa9, 0xe4, 0xb7, 0x9c, 0x84, 0xc9, 0x27, 0x75,
+  0x1b, 0x45, 0x17, 0x7f, 0xfb, 0xfd, 0xa1, 0xe5, 0x87, 0x6d, 0x54, 0x9a, 0xe0, 0xef, 0x31, 0x43,
+  0x60, 0x5a, 0x1c, 0xb1, 0x11, 0x5e, 0xef, 0xce, 0x47, 0x16, 0x68, 0xaf, 0xba, 0x53, 0xc0, 0xb6,
+  0x65, 0x96, 0xbd, 0x7d, 0x7f, 0x3c, 0x74, 0xf9, 0x57, 0xdf, 0x65, 0xc5, 0xdd, 0x03, 0x17, 0x83,
+  0xca, 0x8d, 0xec, 0x65, 0x28, 0x16, 0xf7, 0xca, 0xf0, 0x78, 0xbc, 0x42, 0xa2, 0xcc, 0x18, 0x5e,
+  0x09, 0x15, 0x8e, 0x37, 0x3b, 0x84, 0x94, 0x2e, 0x9a, 0x9e, 0x68, 0x8e, 0x27, 0x2e, 0x2d, 0x18,
+  0x2f, 0x3c, 0xb5, 0xff, 0x5a, 0x0a, 0xa1, 0x01, 0x6c, 0x37, 0x39, 0xac, 0x91, 0xc4, 0x2a, 0x59,
+  0xdc, 0x43, 0x1a, 0x77, 0x90, 0xc7, 0x7a, 0x89, 0x2c, 0xc9, 0xe0, 0x14, 0x38, 0xcf, 0x69, 0xbe,
+  0xa3, 0x7c, 0x18, 0x19, 0x1e, 0x45, 0x75, 0x85, 0x94, 0x54, 0xc8, 0x09, 0xeb, 0xbe, 0x46, 0x52,
+  0xb6, 0x61, 0xac, 0x73, 0x28, 0x9b, 0xb2, 0x5d, 0x10, 0x66, 0xb6, 0x4e, 0xbd, 0xe9, 0xb9, 0x7c,
+  0x1b, 0x04, 0x9e, 0x6b, 0x6b, 0xba, 0xdb, 0x1f, 0xf0, 0x01, 0x36, 0xb9, 0x5b, 0x5a, 0xc8, 0x3e,
+  0x19, 0xca, 0xf2, 0x3e, 0xac, 0x8e, 0xc2, 0x99, 0x57, 0xe0, 0xaf, 0x81, 0x12, 0x58, 0x70, 0x2d,
+  0x37, 0xab, 0xdd, 0x67, 0x7b, 0x03, 0x82, 0xa9, 0xde, 0xda, 0x20, 0x6f, 0xdf, 0x37, 0xcf, 0x05,
+  0xb2, 0xac, 0xc5, 0x41, 0xc5, 0x4b, 0x14, 0x0c, 0x12, 0x8c, 0x48, 0x69, 0x6b, 0xde, 0xab, 0xf0,
+  0x8e, 0x34, 0xbd, 0xc1, 0xe1, 0x01, 0x6b, 0xec, 0xcc, 0x78, 0xab, 0xd2, 0x61, 0x07, 0xa6, 0xf2,
+  0x30, 0x02, 0x8d, 0x3c, 0x18, 0xff, 0x5d, 0x32, 0xc1, 0xb1, 0x1e, 0xab, 0xa3, 0xdf, 0x9c, 0x3f,
+  0x8e, 0x93, 0xe0, 0xa5, 0x9d, 0x28, 0x64, 0x4b, 0x49, 0x30, 0x3f, 0xa0, 0xd3, 0x28, 0xa6, 0xa1,
+  0xef, 0x48, 0xb1, 0x9d, 0x22, 0x93, 0xcc, 0xc1, 0x8c, 0x0e, 0x07, 0xd0, 0x92, 0x7d, 0x8a, 0x53,
+  0xca, 0xc3, 0x83, 0xdd, 0xd2, 0x65, 0x9b, 0xaa, 0x5d, 0x40, 0xbb, 0xa4, 0xca, 0x76, 0x7b, 0xc9,
+  0x9f, 0x1d, 0xb8, 0x37, 0xce, 0x6a, 0xde, 0x2e, 0x66, 0xbf, 0xf3, 0xf2, 0x29, 0xab, 0xfe, 0x7f,
+  0xfe, 0xd3, 0x7f, 0x23, 0x38, 0x9b, 0x32, 0x5f, 0x5c, 0x26, 0xde, 0x93, 0x5b, 0xf3, 0xe6, 0xb3,
+  0xc6, 0xd9, 0x3b, 0x08, 0x8b, 0xd4, 0xcc, 0x6b, 0x4c, 0xe7, 0x38, 0xdb, 0x4e, 0x40, 0x48, 0x2d,
+  0xbd, 0x14, 0x70, 0xec, 0xbc, 0xdd, 0xc6, 0x09, 0xef, 0xa5, 0xc8, 0x56, 0x66, 0xd7, 0xca, 0x86,
+  0x43, 0x8e, 0x84, 0x7c, 0x76, 0xd7, 0x74, 0x1b, 0xda, 0xc3, 0x91, 0x40, 0xb9, 0x23, 0x8c, 0x63,
+  0x57, 0x3f, 0x8e, 0x32, 0xc1, 0x98, 0x11, 0xab, 0xf9, 0x9c, 0x9c, 0xe0, 0xab, 0x9e, 0x31, 0x30,
+  0x10, 0xe5, 0x20, 0x63, 0xf2, 0xc0, 0x1e, 0xae, 0x22, 0xc3, 0xe4, 0xf3, 0x44, 0x9e, 0xaf, 0x33,
+  0x80, 0xc8, 0x7d, 0x0c, 0xba, 0x2b, 0x45, 0xf5, 0x68, 0x54, 0xa0, 0x45, 0xe7, 0x3b, 0x7e, 0x87,
+  0x87, 0xd5, 0xc5, 0x79, 0xa6, 0xf6, 0x3c, 0xfa, 0xa4, 0x98, 0x7b, 0xf1, 0xea, 0xc0, 0xde, 0xbe,
+  0x71, 0x11, 0x6a, 0xd8, 0x20, 0xec, 0xe8, 0x81, 0xba, 0xf6, 0xe1, 0xc0, 0x8f, 0x2f, 0x21, 0xde,
+  0x94, 0x15, 0x36, 0xd6, 0x6b, 0x0c, 0x3f, 0x9a, 0x19, 0x16, 0xa8, 0xbe, 0x00, 0x15, 0x11, 0x73,
+  0x0a, 0x7c, 0x81, 0x2f, 0xd3, 0x3f, 0x3c, 0xf5, 0x4b, 0xdd, 0x09, 0x8f, 0x33, 0x41, 0x19, 0x5a,
+  0x95, 0xc4, 0x74, 0x44, 0x4e, 0x23, 0xa4, 0x7d, 0xe0, 0x7c, 0x64, 0xa7, 0x8d, 0xe5, 0x66, 0xa6,
+  0x52, 0x98, 0x62, 0xc2, 0x34, 0x34, 0xaa, 0x48, 0x88, 0x97, 0xfa, 0x91, 0x91, 0x75, 0x40, 0xc0,
+  0x67, 0xe4, 0x68, 0x2b, 0x60, 0x35, 0x77, 0x72, 0xc1, 0xaa, 0x49, 0xce, 0xc6, 0x9c, 0xe2, 0x29,
+  0x53, 0xc7, 0x6b, 0x29, 0x89, 0x80, 0x69, 0x86, 0x62, 0xa8, 0xac, 0xb3, 0x21, 0x93, 0x05, 0x9b,
+  0x4d, 0xb4, 0xdb, 0xc6, 0xec, 0x0c, 0xfa, 0xcf, 0x85, 0x7d, 0x1e, 0x61, 0x23, 0x86, 0xe9, 0x21,
+  0x67, 0x41, 0x27, 0x4f, 0x5e, 0x47, 0x9f, 0x69, 0xd8, 0xec, 0xf9, 0x1b, 0xf6, 0xea, 0xc3, 0x5d,
+  0xf2, 0xbb, 0x72, 0xc8, 0x9d, 0xe4, 0xec, 0x37, 0x6b, 0x43, 0xd2, 0x60, 0xec, 0xe5, 0xbb, 0x20,
+  0xd9, 0x1a, 0xac, 0x49, 0xc5, 0x63, 0x78, 0x76, 0xa8, 0x1e, 0x0e, 0xac, 0x87, 0x75, 0x09, 0xdf,
+  0xda, 0x09, 0x4c, 0x69, 0xfa, 0xf6, 0x9b, 0xb5, 0x26, 0x7e, 0xe3, 0xe6, 0x5d, 0x59, 0x78, 0x7d,
+  0x35, 0x63, 0x17, 0x28, 0x10, 0x9e, 0x0e, 0x16, 0x22, 0xac, 0x12, 0xa8, 0x92, 0x1c, 0x39, 0xa2,
+  0xc8, 0x15, 0x6b, 0x66, 0x6e, 0xbd, 0x1a, 0xd3, 0x1c, 0xbc, 0x62, 0x52, 0x57, 0x0c, 0x81, 0xd5,
+  0x91, 0xbc, 0xbc, 0xdf, 0x75, 0x8f, 0x95, 0x0e, 0x5c, 0x1e, 0x56, 0x7f, 0x1d, 0xe1, 0x7e, 0xf0,
+  0x59, 0x05, 0x38, 0xf8, 0xbc, 0xd6, 0x26, 0x86, 0xd5, 0x78, 0xa5, 0x82, 0xfd, 0xaa, 0xab, 0x32,
+  0x3a, 0xee, 0x7b, 0x52, 0x41, 0x9a, 0x01, 0xce, 0x00, 0x39, 0xd8, 0x9e, 0xa0, 0x6b, 0x29, 0x14,
+  0x18, 0x5e, 0xd7, 0xea, 0xc5, 0xcd, 0x37, 0x6b, 0x17, 0xcb, 0x2d, 0x8d, 0xed, 0x0c, 0x5d, 0x8f,
+  0x2b, 0x99, 0x2d, 0xc9, 0xbc, 0x99, 0x45, 0x93, 0x99, 0xa4, 0x10, 0x62, 0xee, 0x65, 0x0a, 0x01,
+  0x1e, 0x9b, 0x0c, 0x18, 0x0c, 0x00, 0xe4, 0x43, 0x79, 0x76, 0x0a, 0x6d, 0x40, 0x60, 0x70, 0x10,
+  0x88, 0x8e, 0x57, 0xf3, 0xf9, 0xf0, 0x8e, 0xce, 0xdb, 0xb4, 0x95, 0x36, 0x19, 0x80, 0xb8, 0x61,
+  0xba, 0xb9, 0x75, 0x36, 0x5d, 0xbb, 0x83, 0x04, 0xaf, 0x5b, 0xe6, 0x9b, 0x45, 0xae, 0x8e, 0x99,
+  0x11, 0xa3, 0x8d, 0xef, 0xac, 0x07, 0x1a, 0xb6, 0xd6, 0xac, 0x56, 0x63, 0x71, 0x9d, 0x6a, 0x25,
+  0x76, 0x57, 0xe3, 0x29, 0xaf, 0x95, 0x29, 0xaa, 0xbd, 0xca, 0x84, 0x7c, 0xd5, 0xf7, 0x90, 0x6e,
+  0x81, 0xbc, 0xd3, 0xfb, 0x48, 0x0d, 0x63, 0x44, 0xda, 0x98, 0x73, 0x31, 0xc7, 0x67, 0xa3, 0x5f,
+  0x4c, 0xca, 0x7b, 0x12, 0x04, 0x3b, 0xb3, 0x98, 0xaf, 0x49, 0x7d, 0x59, 0x38, 0x73, 0x7f, 0x72,
+  0x31, 0xcc, 0xc2, 0x77, 0x85, 0x56, 0xd1, 0x53, 0xd8, 0xe3, 0xbd, 0x95, 0xa2, 0xaf, 0x46, 0xcf,
+  0x57, 0xa3, 0xe6, 0xa3, 0x19, 0x9b, 0xd5, 0xdc, 0xfe, 0x61, 0x2f, 0xc2, 0xdb, 0x97, 0x80, 0xb8,
+  0xab, 0xf0, 0x7a, 0xb3, 0xf1, 0xdd, 0x57, 0xe2, 0xeb, 0x5e, 0x72, 0x68, 0xec, 0x64, 0x76, 0xb7,
+  0xc8, 0x2e, 0xdc, 0x2d, 0xa3, 0xdb, 0x36, 0x6a, 0xb3, 0x9b, 0x55, 0x5c, 0x28, 0x19, 0xbb, 0x6e,
+  0x65, 0x1f, 0x30, 0xf6, 0xf5, 0x93, 0x12, 0x8e, 0x98, 0xc3, 0x00, 0x20, 0x88, 0x4f, 0x86, 0x35,
+  0x9b, 0x51, 0x6c, 0x9e, 0xeb, 0x9d, 0x28, 0x6c, 0x8b, 0xba, 0x6d, 0x8a, 0xee, 0xbe, 0x0f, 0xdd,
+  0xde, 0x7e, 0xe7, 0x6e, 0x48, 0xdf, 0x67, 0x53, 0x7a, 0x69, 0x4e, 0x62, 0xd7, 0xcd, 0xe9, 0xf7,
+  0x5c, 0xc0, 0xb7, 0x38, 0x55, 0x32, 0x25, 0xbe, 0xe4, 0x2f, 0xba, 0xa9, 0x95, 0x61, 0xbc, 0x49,
+  0xb5, 0x4c, 0x86, 0xe5, 0xf5, 0xf1, 0x38, 0xfa, 0xa3, 0xfd, 0x44, 0xc7, 0x88, 0xfb, 0xf8, 0xa0,
+  0x8f, 0xf6, 0x94, 0x19, 0x0d, 0x20, 0x4f, 0x72, 0x76, 0x71, 0x8f, 0x7a, 0x03, 0x1b, 0x43, 0x08,
+  0xaf, 0xf7, 0x50, 0x25, 0xbc, 0x0f, 0xfb, 0xa0, 0xfe, 0x47, 0x7b, 0x9f, 0x3f, 0xaa, 0xde, 0x0b,
+  0xd6, 0x72, 0x04, 0xd6, 0x1a, 0x3f, 0x37, 0x8f, 0xc4, 0x2d, 0xe7, 0x10, 0x9e, 0xb1, 0x2f, 0x9b,
+  0x47, 0xac, 0x2b, 0xf8, 0xcd, 0x3e, 0x37, 0x1f, 0x7f, 0x63, 0x27, 0x01, 0xd4, 0x15, 0xba, 0x5b,
+  0x44, 0x02, 0xf3, 0xd8, 0xec, 0xfc, 0x18, 0x99, 0x8b, 0x9b, 0xc0, 0xf8, 0xb6, 0x31, 0xbb, 0xe1,
+  0x7e, 0xf7, 0x86, 0x11, 0x7d, 0x71, 0x58, 0xf1, 0x98, 0xc8, 0xe5, 0x7e, 0x12, 0x34, 0x74, 0xdb,
+  0xbf, 0xd9, 0x57, 0x84, 0x8c, 0x88, 0xcf, 0x04, 0xed, 0x1c, 0x36, 0x61, 0x65, 0x25, 0xd4, 0xf1,
+  0x93, 0x79, 0x40, 0x53, 0x41, 0x2f, 0x7c, 0x19, 0x5a, 0x1b, 0x90, 0x79, 0x9f, 0x0e, 0x68, 0x5e,
+  0x78, 0x37, 0xd8, 0x3c, 0xb4, 0x2e, 0xb9, 0x4f, 0x0b, 0xfb, 0x35, 0xaf, 0xce, 0x82, 0xf1, 0xf4,
+  0xf9, 0xe5, 0x5b, 0xe7, 0x73, 0x1a, 0xc4, 0xab, 0x25, 0x3c, 0x16, 0xd7, 0x5c, 0xdd, 0x80, 0x64,
+  0x82, 0xe6, 0x71, 0x81, 0xc0, 0x9b, 0x6b, 0x0e, 0xc4, 0xbb, 0x36, 0x8b, 0x18, 0x8d, 0x29, 0x8c,
+  0x3d, 0x5d, 0xc5, 0x68, 0x51, 0x8a, 0xe3, 0xc8, 0x0e, 0xeb, 0x14, 0xae, 0xd1, 0x92, 0xd4, 0xb2,
+  0xd7, 0x43, 0xab, 0xdb, 0xb4, 0x4a, 0xea, 0x09, 0x6f, 0x0a, 0x9f, 0xe6, 0x3d, 0x63, 0x87, 0xf2,
+  0x5d, 0xf6, 0xb3, 0x7c, 0x31, 0x3f, 0xfb, 0x7f, 0x11, 0x29, 0xf1, 0xbc, 0xba, 0xb5, 0x00, 0x00,
+};
+const size_t page_mesh_gz_len = 10528;
+
+// GET /network
+const uint8_t page_network_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3c, 0x6b, 0x73, 0xdb, 0x46,
+  0x92, 0xdf, 0xfd, 0x2b, 0x10, 0x3a, 0x16, 0x88, 0x15, 0x49, 0x81, 0x94, 0x28, 0xdb, 0x84, 0x28,
+  0x6f, 0x62, 0x3b, 0x7b, 0xaa, 0x92, 0x13, 0x55, 0xe4, 0xe4, 0x6e, 0x2b, 0xb5, 0x75, 0x19, 0x02,
+  0x43, 0x12, 0x31, 0x08, 0x70, 0x01, 0x50, 0x12, 0x43, 0xf3, 0xbf, 0x5f, 0xf7, 0xbc, 0x30, 0x83,
+  0x07, 0x49, 0xd9, 0xa9, 0x5a, 0xfb, 0xac, 0x5d, 0x89, 0x98, 0xe9, 0xee, 0xe9, 0x77, 0xf7, 0x0c,
+  0x86, 0xb9, 0xf8, 0xe6, 0xcd, 0x4f, 0xaf, 0xdf, 0xff, 0xf3, 0xe6, 0xad, 0x35, 0xcf, 0x17, 0xd1,
+  0xe5, 0x93, 0x0b, 0xfc, 0x63, 0x45, 0x24, 0x9e, 0x8d, 0x5b, 0x34, 0x6e, 0xe1, 0x00, 0x25, 0x01,
+  0xfc, 0x59, 0xd0, 0x9c, 0x58, 0xfe, 0x9c, 0xa4, 0x19, 0xcd, 0xc7, 0xad, 0x5f, 0xde, 0xff, 0xd0,
+  0x7d, 0xd1, 0x92, 0xc3, 0xf3, 0x3c, 0x5f, 0x76, 0xe9, 0xbf, 0x57, 0xe1, 0xdd, 0xb8, 0xf5, 0x3a,
+  0x89, 0x73, 0x1a, 0xe7, 0xdd, 0xf7, 0xeb, 0x25, 0x6d, 0x59, 0x3e, 0x7f, 0x1a, 0xb7, 0x72, 0xfa,
+  0x90, 0x9f, 0x20, 0x6d, 0x4f, 0x11, 0x59, 0xe5, 0x53, 0x4e, 0x23, 0x0f, 0xf3, 0x88, 0x5e, 0x7e,
+  0xb7, 0x98, 0x84, 0xb7, 0x34, 0xce, 0xa8, 0xf5, 0xd1, 0x7a, 0x4f, 0xfd, 0xf9, 0x4d, 0x92, 0xe5,
+  0x99, 0xf5, 0x8e, 0x06, 0x21, 0xb9, 0x38, 0xe1, 0x20, 0x62, 0xb9, 0x98, 0x2c, 0xe8, 0xd8, 0xbe,
+  0x0b, 0xe9, 0xfd, 0x32, 0x49, 0x73, 0x5b, 0x2d, 0x62, 0xdf, 0x87, 0x41, 0x3e, 0x1f, 0x07, 0xf4,
+  0x2e, 0xf4, 0x69, 0x97, 0x3d, 0x74, 0xac, 0x30, 0x0e, 0xf3, 0x90, 0x44, 0xdd, 0xcc, 0x27, 0x11,
+  0x1d, 0xf7, 0x6d, 0x20, 0x92, 0xe5, 0x6b, 0x24, 0x36, 0x4a, 0x93, 0x24, 0xdf, 0x74, 0xbb, 0xcb,
+  0x34, 0x5c, 0x90, 0x74, 0x3d, 0x7a, 0x7a, 0x76, 0x7a, 0xde, 0xa7, 0xd4, 0x53, 0x23, 0xdd, 0x28,
+  0x9c, 0xcd, 0x73, 0x18, 0x7f, 0xf1, 0x72, 0x48, 0xa7, 0x30, 0x9e, 0xad, 0x7c, 0x9f, 0x66, 0x19,
+  0x8c, 0xf8, 0xfe, 0xcb, 0xa9, 0x0b, 0x23, 0x93, 0x59, 0x37, 0x20, 0xe9, 0x87, 0xd1, 0xd3, 0xfe,
+  0x00, 0x7f, 0xf8, 0x88, 0x4f, 0xd2, 0x00, 0x46, 0x28, 0xfe, 0xc0, 0x08, 0x8a, 0x3e, 0x7a, 0x3a,
+  0x65, 0xff, 0xc4, 0x63, 0x37, 0xa3, 0xc0, 0x74, 0xc0, 0x56, 0x9d, 0xb8, 0xf8, 0x83, 0x98, 0x49,
+  0x1a, 0xd0, 0xb4, 0x9b, 0x92, 0x20, 0x5c, 0x65, 0xa3, 0xfe, 0x60, 0xf9, 0x80, 0x4b, 0xce, 0x49,
+  0x90, 0xdc, 0x8f, 0x5c, 0xab, 0xef, 0x2e, 0x1f, 0xac, 0x01, 0xfe, 0x4a, 0x67, 0x13, 0xd2, 0x76,
+  0x3b, 0xec, 0xa7, 0x77, 0xea, 0x20, 0xc9, 0x94, 0xc4, 0x19, 0x88, 0x99, 0xc4, 0x23, 0x12, 0x45,
+  0x16, 0x8c, 0x66, 0x16, 0x25, 0x19, 0xdd, 0x3e, 0xf9, 0xdb, 0x06, 0x04, 0x99, 0x85, 0xf1, 0xc8,
+  0xf5, 0x96, 0x24, 0x08, 0xc2, 0x78, 0x06, 0x9f, 0x26, 0xc9, 0x43, 0x37, 0x0b, 0xff, 0xc4, 0x07,
+  0xb1, 0x26, 0x8c, 0x6c, 0x9f, 0x4c, 0x92, 0x60, 0xbd, 0x99, 0x82, 0x2e, 0xbb, 0x53, 0xb2, 0x08,
+  0xa3, 0xf5, 0xc8, 0xbe, 0xa5, 0xb3, 0x84, 0x5a, 0xbf, 0x5c, 0xd9, 0x9d, 0xf7, 0x64, 0x9e, 0x2c,
+  0x48, 0xe7, 0x1f, 0x34, 0xa6, 0x77, 0xa4, 0xf3, 0x2b, 0x4d, 0x03, 0x12, 0x93, 0x4e, 0x06, 0xcb,
+  0x82, 0x28, 0x69, 0x38, 0xf5, 0x26, 0xc4, 0xff, 0x30, 0x4b, 0x93, 0x55, 0x1c, 0x74, 0xfd, 0x24,
+  0x4a, 0xd2, 0xd1, 0x1d, 0x49, 0xdb, 0x4a, 0x3f, 0x8e, 0xa7, 0x0f, 0xa2, 0x06, 0x1c, 0x6f, 0x11,
+  0xc6, 0xdd, 0x39, 0x65, 0x1a, 0xee, 0xbb, 0xee, 0xdd, 0xdc, 0x0b, 0xc2, 0x6c, 0x19, 0x91, 0xf5,
+  0x68, 0x1a, 0xd1, 0x07, 0x0f, 0x7f, 0x75, 0x83, 0x30, 0xa5, 0x3e, 0x13, 0x0b, 0xd0, 0x57, 0x8b,
+  0xd8, 0xfb, 0x63, 0x95, 0xe5, 0xe1, 0x74, 0xdd, 0x15, 0x16, 0x1f, 0x65, 0x4b, 0x02, 0x96, 0x9e,
+  0xd0, 0xfc, 0x9e, 0xd2, 0x58, 0x49, 0x88, 0x5a, 0xd2, 0x18, 0x1a, 0x45, 0x61, 0x4c, 0x49, 0xda,
+  0x9d, 0xa1, 0x66, 0x01, 0xab, 0xdd, 0x3f, 0x1d, 0x06, 0x74, 0xd6, 0x11, 0x36, 0xb3, 0xdc, 0x67,
+  0x9d, 0xa7, 0x03, 0x82, 0x3f, 0xa0, 0x64, 0xf7, 0x99, 0xb3, 0x7d, 0xd2, 0x5b, 0x10, 0x60, 0x4e,
+  0x2c, 0xb2, 0x31, 0xf8, 0x2a, 0x73, 0xe0, 0xc3, 0x2f, 0x9a, 0x7a, 0x04, 0x5c, 0x25, 0xee, 0x86,
+  0x39, 0x5d, 0x64, 0x72, 0x08, 0xc1, 0x47, 0x7d, 0x20, 0x86, 0xa0, 0x40, 0x8f, 0xa6, 0x1b, 0x8d,
+  0x27, 0xa5, 0x1e, 0x74, 0x16, 0xc7, 0x33, 0x6d, 0x2f, 0x26, 0xf5, 0x31, 0x87, 0x5b, 0x8d, 0x7b,
+  0x03, 0x9f, 0xe7, 0x0f, 0x8e, 0xc7, 0x1c, 0x1d, 0x75, 0xf8, 0xcc, 0x5b, 0x90, 0x07, 0xee, 0xf7,
+  0xa3, 0x33, 0xa6, 0x84, 0xe4, 0x8e, 0xa6, 0xd3, 0x08, 0x30, 0xe6, 0x61, 0x10, 0xa0, 0x86, 0x12,
+  0xe1, 0x26, 0x29, 0x8d, 0x48, 0x1e, 0xde, 0x81, 0x87, 0xf4, 0x30, 0xbe, 0x4d, 0xde, 0x1a, 0xf4,
+  0xc5, 0x57, 0x15, 0xb1, 0xe1, 0xa0, 0xda, 0x8c, 0x11, 0x1e, 0x2d, 0x0e, 0xd7, 0x61, 0x61, 0x8b,
+  0xa1, 0x70, 0x5b, 0x8f, 0xf9, 0x3d, 0xd3, 0x93, 0xd4, 0x50, 0x85, 0x9b, 0x32, 0xbf, 0x8a, 0x3b,
+  0x6b, 0xde, 0xe7, 0x9e, 0x09, 0x6e, 0x4b, 0x47, 0x83, 0x33, 0x20, 0xc7, 0x1e, 0xef, 0xb9, 0xff,
+  0x9c, 0xbb, 0xae, 0xc7, 0xfd, 0x1c, 0x94, 0x96, 0xe7, 0xc9, 0x62, 0xf4, 0x42, 0x2e, 0xa8, 0xe2,
+  0x07, 0xc2, 0xc9, 0x1a, 0x96, 0xa3, 0x67, 0xe0, 0xd4, 0x30, 0xf1, 0x67, 0x37, 0x8c, 0x03, 0xb0,
+  0xdd, 0xa0, 0x58, 0x7e, 0xb9, 0x49, 0xc0, 0xd3, 0xc2, 0x7c, 0x3d, 0x72, 0x7b, 0x2f, 0xbd, 0x82,
+  0x93, 0x3e, 0x72, 0x72, 0x08, 0x85, 0xd1, 0x68, 0x42, 0xa7, 0x49, 0x4a, 0x37, 0xd2, 0x6f, 0x6c,
+  0xbb, 0xc0, 0x23, 0x93, 0x0c, 0xdc, 0x3b, 0xa7, 0x5e, 0x9e, 0x2c, 0x47, 0xdd, 0x21, 0xd8, 0x31,
+  0xa2, 0xd3, 0x9c, 0x7f, 0xe2, 0xd6, 0x1c, 0xa0, 0x71, 0x45, 0xb0, 0xb0, 0xcf, 0x9a, 0xb5, 0xd0,
+  0x4a, 0x90, 0xdf, 0x94, 0xb5, 0xfc, 0x30, 0xf5, 0x23, 0xda, 0x61, 0x72, 0x0e, 0x86, 0xc3, 0x8e,
+  0xfc, 0xbf, 0xdb, 0xeb, 0x33, 0xa3, 0x55, 0x27, 0x1c, 0xeb, 0x39, 0x9a, 0x4c, 0x72, 0x2d, 0x7d,
+  0x16, 0x7d, 0x5f, 0x37, 0x23, 0x0c, 0x83, 0x08, 0x8b, 0x2e, 0xae, 0xbb, 0xdc, 0x98, 0xfa, 0x1e,
+  0x0c, 0xea, 0x14, 0x61, 0x60, 0x40, 0x51, 0x99, 0xd0, 0x48, 0x45, 0xd3, 0x24, 0x4a, 0xfc, 0x0f,
+  0x35, 0x56, 0x2b, 0x29, 0xb7, 0x9c, 0x37, 0x8a, 0xcc, 0xe9, 0x18, 0x2e, 0x30, 0x74, 0x5d, 0x58,
+  0x2d, 0x8b, 0x42, 0x0c, 0x99, 0x22, 0xe2, 0x8c, 0xd8, 0xad, 0x09, 0xd2, 0x19, 0x59, 0x8e, 0xfa,
+  0x5c, 0x36, 0x8e, 0xbb, 0xe1, 0x61, 0xeb, 0x01, 0xdd, 0xc9, 0x87, 0x10, 0x1c, 0x76, 0xb9, 0x84,
+  0x58, 0x20, 0xb1, 0x4f, 0x47, 0x71, 0x12, 0x53, 0x69, 0x04, 0xe4, 0xd4, 0x8c, 0xd9, 0xa1, 0x99,
+  0x73, 0x9e, 0x9e, 0x9e, 0x9e, 0x7a, 0xc9, 0x2a, 0xc7, 0x58, 0xe2, 0x98, 0x5a, 0x92, 0x16, 0xe2,
+  0xa8, 0x01, 0x47, 0x2d, 0x3f, 0x1a, 0xc9, 0x85, 0x85, 0x28, 0xf9, 0x7c, 0xb5, 0x98, 0x6c, 0x9a,
+  0xb8, 0x29, 0x3f, 0x8b, 0x54, 0x80, 0xdc, 0xc9, 0xd4, 0x5a, 0xc3, 0xa9, 0xe9, 0x3f, 0x66, 0x58,
+  0x7b, 0xfe, 0x2a, 0xcd, 0x40, 0xe3, 0xcb, 0x24, 0x64, 0x0a, 0xda, 0xc5, 0xb5, 0x9e, 0x92, 0x5c,
+  0x4b, 0x94, 0x28, 0xe6, 0x5e, 0xe7, 0xcf, 0x3b, 0x2f, 0x9f, 0x77, 0x06, 0xa7, 0x2f, 0xc0, 0xeb,
+  0x86, 0x86, 0x74, 0x8b, 0xe4, 0x4f, 0xe0, 0x23, 0x9e, 0x51, 0x21, 0xd9, 0x97, 0xce, 0xf1, 0x1c,
+  0x53, 0x52, 0x83, 0x55, 0x18, 0x61, 0x74, 0xf0, 0x11, 0x6b, 0x2e, 0xda, 0x7d, 0x88, 0xb0, 0xc2,
+  0x09, 0xef, 0x48, 0xb4, 0xa2, 0x1b, 0xac, 0x72, 0x5c, 0xc6, 0x73, 0x4c, 0x82, 0x32, 0x9e, 0x40,
+  0x46, 0x8b, 0x55, 0xf8, 0x43, 0x12, 0x7f, 0xc9, 0xab, 0xaa, 0x89, 0xb4, 0x9c, 0x0b, 0xf7, 0xc4,
+  0x90, 0xc3, 0x02, 0x1c, 0xc6, 0x40, 0x87, 0x14, 0xdb, 0xa8, 0x8d, 0xc6, 0xa1, 0xb0, 0xc2, 0xe9,
+  0xf9, 0x61, 0xcc, 0x95, 0x2b, 0x8c, 0xa6, 0xe0, 0x10, 0x7a, 0xb9, 0xdc, 0x42, 0x35, 0x57, 0xf2,
+  0x2e, 0xd3, 0x30, 0x8c, 0x08, 0x7d, 0x66, 0x32, 0x9b, 0x60, 0x02, 0x14, 0xe1, 0x88, 0xb3, 0x66,
+  0xc6, 0x08, 0x63, 0x0c, 0xa6, 0x2e, 0x4f, 0x1c, 0x32, 0x2f, 0xd6, 0x16, 0x16, 0x5d, 0x1f, 0x93,
+  0x24, 0x0a, 0x64, 0x9a, 0x49, 0x45, 0xb7, 0x61, 0x2e, 0xd0, 0x4b, 0x37, 0x5c, 0x43, 0xd0, 0xa3,
+  0x0d, 0xe1, 0x9f, 0x31, 0x37, 0x93, 0x73, 0xc3, 0x21, 0xce, 0x1a, 0x73, 0x93, 0x62, 0x0e, 0x67,
+  0x61, 0x2e, 0xa2, 0xd8, 0xfe, 0xac, 0x60, 0xf5, 0x4f, 0x4a, 0x41, 0x05, 0x7a, 0x18, 0x2f, 0x57,
+  0xb9, 0xcc, 0x45, 0xd2, 0x69, 0x98, 0xb7, 0x7e, 0xaa, 0xd7, 0xf0, 0x69, 0x9e, 0x26, 0xaa, 0xcd,
+  0x58, 0xc9, 0x63, 0x2a, 0x2a, 0x05, 0xe6, 0x26, 0x2b, 0xc8, 0xd1, 0x71, 0x29, 0x7f, 0x6b, 0xbd,
+  0x87, 0xe2, 0x72, 0x78, 0x50, 0xf7, 0xf5, 0xa8, 0x6e, 0x82, 0x33, 0x7c, 0x3f, 0x07, 0xc5, 0x19,
+  0x82, 0x1c, 0xa0, 0x07, 0x4d, 0xb2, 0xf3, 0x9a, 0xb6, 0xe1, 0x31, 0xc9, 0x43, 0x73, 0xd2, 0x53,
+  0xe5, 0x78, 0x45, 0x12, 0x58, 0x41, 0x32, 0x4e, 0x7d, 0x68, 0xbb, 0xa1, 0x7c, 0xe7, 0x40, 0xac,
+  0x8b, 0xdd, 0x29, 0xd3, 0x08, 0xb3, 0x98, 0x96, 0x78, 0x30, 0x1e, 0xfa, 0xc3, 0xba, 0xd4, 0x73,
+  0xe6, 0x28, 0x4d, 0xf3, 0xd4, 0xa3, 0x25, 0x19, 0xf6, 0x09, 0x0a, 0x2b, 0xfd, 0x67, 0xbb, 0x7b,
+  0xba, 0x7c, 0x28, 0x25, 0xb3, 0x17, 0xc6, 0xf6, 0x40, 0xa7, 0x79, 0xce, 0x92, 0x12, 0xb0, 0x04,
+  0xbc, 0x40, 0xbb, 0x4e, 0xee, 0x68, 0xb0, 0x51, 0xa5, 0x7a, 0x1a, 0x3e, 0xd0, 0x80, 0x35, 0x1e,
+  0x2c, 0x96, 0x52, 0xd1, 0x62, 0x68, 0xa9, 0x8a, 0x31, 0x3a, 0x38, 0xcc, 0xa8, 0x62, 0x63, 0xc4,
+  0x5a, 0x6a, 0xbe, 0x9b, 0x6a, 0x34, 0xe0, 0x4e, 0xa3, 0xd5, 0x08, 0xfd, 0x3f, 0xed, 0x01, 0xa3,
+  0xa4, 0x59, 0x48, 0x41, 0x15, 0x3b, 0x9e, 0x5d, 0x7a, 0xd6, 0x9a, 0x3e, 0xd5, 0xea, 0xb8, 0xbc,
+  0x6d, 0x30, 0x94, 0xd3, 0xcb, 0xe6, 0xc9, 0xfd, 0xa6, 0x96, 0x05, 0xd7, 0x61, 0x2d, 0x4d, 0x92,
+  0xa3, 0x61, 0xaa, 0xfd, 0xac, 0xae, 0x31, 0xb7, 0xe2, 0x2e, 0x9a, 0x27, 0x0e, 0xf6, 0x74, 0x36,
+  0x45, 0x58, 0xa9, 0xf5, 0x2c, 0xd9, 0x72, 0x8d, 0x4e, 0x91, 0x3a, 0xba, 0x09, 0xf0, 0x85, 0xeb,
+  0x6d, 0x2a, 0x3e, 0x5d, 0x93, 0xef, 0xa3, 0x84, 0x20, 0x6c, 0x17, 0x7d, 0x0a, 0xc2, 0x77, 0x53,
+  0xdf, 0x7c, 0xba, 0xbc, 0xf3, 0x74, 0xf5, 0xb8, 0x2e, 0xf6, 0x68, 0x66, 0xdb, 0xa9, 0xab, 0xf4,
+  0xb9, 0xe3, 0x7d, 0xe2, 0x2e, 0x49, 0x5a, 0xe2, 0x25, 0xfc, 0x43, 0x4b, 0x2c, 0xc3, 0x18, 0x93,
+  0x26, 0x5f, 0x7f, 0xa8, 0x15, 0x24, 0xf6, 0x59, 0xc4, 0x3e, 0xea, 0x17, 0xb8, 0x0e, 0x03, 0xd3,
+  0xb0, 0x7d, 0xa7, 0xae, 0x6f, 0xe0, 0x23, 0x20, 0x9d, 0xb1, 0x31, 0x55, 0xdd, 0x03, 0x89, 0xe1,
+  0x03, 0xd3, 0x04, 0xae, 0x6d, 0xf5, 0xb9, 0x1f, 0x01, 0x57, 0x5d, 0xe8, 0xde, 0xac, 0x30, 0x9e,
+  0xe2, 0x01, 0x02, 0x76, 0xb2, 0x39, 0x99, 0x34, 0x65, 0xf5, 0x52, 0x2f, 0x5c, 0x70, 0x2a, 0x87,
+  0xfa, 0x8a, 0x61, 0xde, 0x17, 0x8a, 0xa2, 0xd9, 0x7d, 0x18, 0x91, 0x55, 0x9e, 0x78, 0x2c, 0x2e,
+  0x58, 0xba, 0xc0, 0x3e, 0xee, 0x3e, 0x25, 0x4b, 0xbe, 0x9e, 0x28, 0x00, 0x50, 0x41, 0x19, 0x98,
+  0x51, 0x07, 0xb0, 0x4b, 0x2a, 0x25, 0xaf, 0xca, 0x1e, 0x9c, 0x79, 0xee, 0x92, 0xa4, 0xa0, 0xea,
+  0x9d, 0xf9, 0xbf, 0xd2, 0x54, 0x17, 0x5e, 0x5a, 0xdd, 0xdc, 0x30, 0x04, 0x55, 0xf6, 0x69, 0x14,
+  0x85, 0xcb, 0x2c, 0xcc, 0x2a, 0x8d, 0x40, 0xb1, 0x15, 0x05, 0xcf, 0x61, 0xd5, 0x0d, 0x04, 0xea,
+  0x11, 0x1f, 0x69, 0x6c, 0xea, 0x2c, 0x61, 0x40, 0x8c, 0x46, 0x64, 0x8a, 0x41, 0xb6, 0x73, 0xbb,
+  0x24, 0x94, 0xdb, 0xc5, 0xfc, 0xda, 0xe8, 0xb7, 0x03, 0x23, 0x71, 0x75, 0xeb, 0x57, 0xfe, 0xfb,
+  0x07, 0xba, 0x9e, 0xa6, 0x64, 0x41, 0x33, 0x0b, 0xbd, 0x60, 0x93, 0x27, 0x5a, 0xfc, 0xa7, 0x49,
+  0x0e, 0xc1, 0xdf, 0x3e, 0x3d, 0x77, 0x21, 0xc5, 0x39, 0x5b, 0xe0, 0x13, 0x8c, 0x9f, 0x63, 0xd3,
+  0xdd, 0x15, 0x5e, 0xb0, 0xa9, 0xad, 0x0c, 0xb5, 0xb9, 0x41, 0x77, 0x8e, 0x03, 0xcb, 0x37, 0xf3,
+  0xf1, 0x53, 0xb7, 0xc3, 0xff, 0x87, 0xf9, 0xfc, 0xa0, 0x9d, 0x73, 0x99, 0xc9, 0xc3, 0xb7, 0xa0,
+  0xee, 0xa1, 0xda, 0xac, 0x94, 0x81, 0x97, 0xee, 0xae, 0xd2, 0x2e, 0x8e, 0xcf, 0x1c, 0x75, 0xcc,
+  0xa2, 0x58, 0xe4, 0x8d, 0x5e, 0xa9, 0x09, 0x31, 0xa3, 0x0a, 0x9d, 0x7e, 0x97, 0xe3, 0xea, 0xe4,
+  0x78, 0xeb, 0x5d, 0x90, 0x3b, 0x2d, 0x57, 0xfe, 0xe7, 0xa5, 0x2c, 0x29, 0x39, 0x2b, 0x9d, 0x19,
+  0xe8, 0x1b, 0x84, 0xe7, 0xe7, 0x9d, 0x81, 0xdb, 0xef, 0x0c, 0xce, 0x78, 0xff, 0xba, 0x6f, 0x3b,
+  0xa7, 0x78, 0x59, 0x41, 0xfa, 0xd8, 0x94, 0x9a, 0x90, 0xe2, 0x30, 0xe1, 0xb9, 0x94, 0x92, 0x69,
+  0xbc, 0xe8, 0x02, 0xef, 0xc2, 0x6c, 0x05, 0xfe, 0xf3, 0x27, 0x84, 0x80, 0xcc, 0xbf, 0x75, 0x1b,
+  0xcc, 0x52, 0xdb, 0x5c, 0x72, 0xac, 0xfe, 0xa1, 0x47, 0x40, 0xb8, 0xa2, 0x88, 0xcc, 0xaa, 0x47,
+  0x18, 0xf9, 0xbf, 0x4a, 0x7f, 0x8f, 0x1e, 0xf2, 0x64, 0x36, 0x8b, 0x68, 0x53, 0xe2, 0xdc, 0x7d,
+  0x9e, 0x57, 0x53, 0x2e, 0xaa, 0x99, 0xb6, 0x58, 0xa3, 0xd6, 0x89, 0x76, 0x7b, 0x8c, 0xc0, 0xcc,
+  0xee, 0xc3, 0xdc, 0x9f, 0x6f, 0xaa, 0x51, 0xb5, 0x63, 0xeb, 0x61, 0x6c, 0x96, 0xce, 0x74, 0x3e,
+  0x38, 0x35, 0x8b, 0xb7, 0xf0, 0xca, 0xd4, 0x02, 0xcd, 0x95, 0x38, 0xae, 0x86, 0xc0, 0x4f, 0x1e,
+  0xaa, 0xaa, 0x2f, 0x37, 0xa7, 0x7a, 0x6c, 0xf2, 0x4e, 0xcd, 0x95, 0x49, 0xd0, 0xad, 0x26, 0x39,
+  0xbe, 0x59, 0x2c, 0xcc, 0xd3, 0x3b, 0xcb, 0x4a, 0x06, 0x2c, 0xf1, 0xcd, 0x77, 0xbc, 0x22, 0x4b,
+  0xd4, 0x70, 0x23, 0x8c, 0xd4, 0x6a, 0xa9, 0x6c, 0x80, 0xce, 0x2c, 0x76, 0x62, 0xe7, 0x32, 0x09,
+  0x9f, 0x31, 0x3f, 0x64, 0x4c, 0x9d, 0xd5, 0xe5, 0x5e, 0xde, 0x04, 0xee, 0xe4, 0x6b, 0x88, 0x7d,
+  0x0f, 0xd3, 0xdf, 0xc8, 0x9f, 0x53, 0xff, 0x03, 0x0d, 0x8e, 0x4b, 0xba, 0xda, 0x9b, 0xd1, 0x77,
+  0x61, 0x4b, 0x11, 0xeb, 0xbb, 0x4c, 0x10, 0x04, 0x5d, 0x83, 0x11, 0xe8, 0x06, 0x34, 0xf3, 0xd3,
+  0x70, 0x89, 0x7c, 0xd6, 0x9f, 0x5c, 0xa1, 0x4d, 0x86, 0x8f, 0x6a, 0xee, 0xa0, 0xda, 0x2c, 0xf0,
+  0xa5, 0x86, 0xd5, 0xd6, 0x4e, 0x6b, 0x5f, 0x80, 0x37, 0x39, 0x1b, 0xed, 0xa8, 0xd8, 0x28, 0x9f,
+  0xcf, 0x3c, 0x79, 0x8a, 0xbf, 0x65, 0x87, 0xf4, 0x7a, 0x23, 0xb0, 0xe5, 0x8d, 0x42, 0xb1, 0x7c,
+  0xf9, 0x98, 0x01, 0x6d, 0xbc, 0x7d, 0x72, 0x71, 0x22, 0xde, 0x7a, 0x5c, 0x9c, 0x88, 0x17, 0x3a,
+  0x48, 0x09, 0xfe, 0x04, 0xe1, 0x9d, 0xe5, 0x47, 0x24, 0xcb, 0xc6, 0xad, 0x52, 0x8f, 0xd8, 0xb2,
+  0xc2, 0x40, 0x0d, 0xfe, 0x24, 0xc6, 0x4c, 0x0c, 0xd1, 0xae, 0xb5, 0x2e, 0x2f, 0x4e, 0x60, 0x14,
+  0x89, 0xf3, 0x3f, 0x1a, 0x88, 0x7e, 0x94, 0x5e, 0xc2, 0x56, 0xd2, 0x96, 0xc6, 0xf9, 0x91, 0x29,
+  0x7b, 0xf7, 0xd4, 0x2f, 0x5e, 0x0b, 0x01, 0xe3, 0x7d, 0x18, 0x5a, 0x5e, 0xfe, 0x4c, 0x40, 0x8f,
+  0x8c, 0x64, 0x9a, 0x44, 0x90, 0xba, 0xac, 0xeb, 0xb7, 0x6f, 0xac, 0x2c, 0x07, 0x33, 0xe1, 0x9b,
+  0xa0, 0x69, 0x38, 0x5b, 0xa5, 0xac, 0xa1, 0xbb, 0x38, 0x59, 0xd6, 0x72, 0x54, 0xcf, 0x8c, 0xd1,
+  0xde, 0xe1, 0x1c, 0xdf, 0x85, 0x69, 0xd3, 0x56, 0xcb, 0x4a, 0x62, 0x3f, 0x0a, 0xfd, 0x0f, 0xe3,
+  0xd6, 0x3d, 0x74, 0xad, 0xc9, 0x3d, 0x74, 0xd5, 0x3e, 0x5b, 0xaa, 0x37, 0x4f, 0xe9, 0x74, 0x6c,
+  0x9f, 0xd8, 0xad, 0xcb, 0xef, 0x49, 0x16, 0xfa, 0x17, 0x27, 0x1c, 0xfb, 0x13, 0xc9, 0x90, 0xe0,
+  0x0e, 0x6b, 0x47, 0x00, 0xe4, 0xbe, 0x13, 0x1f, 0x3f, 0x93, 0x22, 0x9d, 0x4e, 0xa9, 0x9f, 0x67,
+  0x40, 0xf0, 0x2d, 0xff, 0xf4, 0x99, 0xf4, 0xa0, 0x53, 0x9a, 0x03, 0xb1, 0x77, 0xab, 0x28, 0x0f,
+  0xbb, 0x68, 0x9e, 0x24, 0xdd, 0x49, 0x91, 0x57, 0x97, 0xfd, 0x74, 0x63, 0x48, 0xfd, 0x49, 0xfa,
+  0x01, 0x48, 0xff, 0xc8, 0x3f, 0x7d, 0x26, 0x9f, 0x10, 0x67, 0xb3, 0x38, 0x81, 0x22, 0xe3, 0xa3,
+  0xec, 0x6f, 0x8a, 0x27, 0x8d, 0x2e, 0xf7, 0x10, 0xee, 0x0c, 0x2c, 0x48, 0xc6, 0xad, 0x72, 0x9d,
+  0x35, 0xcf, 0x36, 0x8c, 0x5c, 0xf5, 0x62, 0x59, 0xdb, 0xff, 0xb7, 0x98, 0xab, 0x5e, 0x80, 0x5b,
+  0x26, 0xf1, 0xec, 0xf2, 0x16, 0x3a, 0x48, 0x80, 0xc5, 0x20, 0x64, 0xcf, 0xd6, 0x05, 0x54, 0xba,
+  0x98, 0xc5, 0xd7, 0x7d, 0x38, 0x0d, 0xff, 0x37, 0x63, 0xf3, 0xad, 0xcb, 0x6b, 0x1e, 0x6c, 0xbd,
+  0x5e, 0x0f, 0x40, 0x01, 0xe2, 0x92, 0xfb, 0x70, 0x41, 0xe8, 0xea, 0xa6, 0x99, 0x48, 0xb8, 0x6c,
+  0x24, 0x20, 0x82, 0x80, 0xed, 0x95, 0x17, 0x34, 0x9f, 0x27, 0x80, 0x03, 0x09, 0x3e, 0x6f, 0x31,
+  0xc3, 0x24, 0xf1, 0xb8, 0x25, 0x35, 0x5f, 0x8a, 0x8a, 0xe2, 0xf8, 0x1e, 0x27, 0x58, 0x85, 0xbd,
+  0xfc, 0xef, 0xf0, 0x87, 0xd0, 0x52, 0xe6, 0xe1, 0x63, 0x4f, 0x2e, 0x58, 0xbe, 0xb4, 0xf2, 0xf5,
+  0x92, 0xf2, 0x97, 0xbd, 0x2d, 0xfe, 0x9a, 0xb6, 0x95, 0x65, 0x61, 0xd0, 0xb2, 0x20, 0x71, 0xfa,
+  0x74, 0x9e, 0x44, 0xa0, 0xb8, 0x71, 0xeb, 0x2d, 0x56, 0x33, 0xeb, 0xf6, 0xf6, 0xea, 0x4d, 0xcb,
+  0x4a, 0xf1, 0xb5, 0x71, 0x0a, 0x41, 0x2c, 0x34, 0x5f, 0x77, 0xa0, 0x34, 0xa8, 0x55, 0x7a, 0xd9,
+  0x46, 0xea, 0x0c, 0x6f, 0x6a, 0xec, 0x75, 0x4a, 0xfd, 0x40, 0xab, 0x36, 0x25, 0xd4, 0x89, 0x79,
+  0x03, 0x33, 0x20, 0x62, 0x50, 0x2f, 0xe2, 0x52, 0xcc, 0x4a, 0x31, 0x8b, 0xe7, 0x1a, 0x51, 0x6f,
+  0xd4, 0xe4, 0x17, 0x27, 0xe5, 0x1b, 0xf6, 0xb2, 0xdc, 0xfa, 0x11, 0x84, 0xd8, 0x6f, 0x4b, 0xfe,
+  0x66, 0x1d, 0x61, 0x6b, 0xc5, 0xd4, 0x68, 0xfd, 0x47, 0x0d, 0x2b, 0x12, 0x05, 0xe7, 0x3f, 0x5b,
+  0x4d, 0x16, 0x21, 0x48, 0x20, 0x74, 0xc0, 0xe7, 0x5a, 0x97, 0xb7, 0xe4, 0x8e, 0x4a, 0x27, 0xb6,
+  0x6e, 0xc5, 0xf9, 0x8f, 0x9e, 0x14, 0x50, 0x59, 0x05, 0x2d, 0x95, 0x67, 0xca, 0x09, 0x26, 0xa5,
+  0x19, 0x10, 0x81, 0xf0, 0xb3, 0xcb, 0x4b, 0xd4, 0xe5, 0x12, 0x3a, 0x3d, 0x83, 0x7f, 0x7a, 0xef,
+  0x20, 0x92, 0xc5, 0xcf, 0x48, 0xc6, 0x62, 0x91, 0x55, 0x65, 0xc6, 0x30, 0x62, 0x79, 0x5b, 0x57,
+  0x0a, 0x58, 0x73, 0x4b, 0xd5, 0xba, 0x7c, 0xbd, 0x4a, 0x71, 0xfb, 0x6f, 0xbd, 0x11, 0xe3, 0x35,
+  0x6e, 0x61, 0x6e, 0x9b, 0x44, 0xd5, 0x87, 0x6c, 0x2d, 0x51, 0x5a, 0x97, 0xdd, 0x2e, 0x4f, 0x35,
+  0x65, 0x04, 0xdc, 0xdb, 0xb4, 0x2e, 0xfd, 0x85, 0xca, 0x35, 0x15, 0xda, 0xe6, 0x5e, 0xa6, 0x55,
+  0x9d, 0x94, 0x85, 0x81, 0x2d, 0x4a, 0x83, 0x5f, 0x0b, 0x58, 0xd3, 0x71, 0x60, 0x17, 0xe9, 0x55,
+  0xda, 0x8c, 0x5d, 0x7f, 0x0c, 0xbf, 0xc7, 0x03, 0x34, 0x96, 0x91, 0x95, 0x8d, 0xc4, 0xd9, 0x59,
+  0x4b, 0xbb, 0x76, 0x32, 0x59, 0x5b, 0x3f, 0x93, 0x3b, 0x30, 0x00, 0x8c, 0xcf, 0xad, 0x76, 0xe9,
+  0x0e, 0x8a, 0x23, 0x53, 0x31, 0x6f, 0x3f, 0x5e, 0x9b, 0xed, 0xc7, 0xed, 0x3a, 0x83, 0x6d, 0x8a,
+  0x04, 0x79, 0x9d, 0x2c, 0xd7, 0xac, 0x3f, 0xb7, 0x8e, 0x7c, 0xf8, 0xe8, 0x59, 0x03, 0x77, 0x30,
+  0x2c, 0x5f, 0x6a, 0xe9, 0x59, 0xdf, 0x45, 0x91, 0xc5, 0xc0, 0x32, 0x0b, 0xdd, 0x28, 0xc5, 0xb3,
+  0xc7, 0xa6, 0xa6, 0xc5, 0x3c, 0xa2, 0xe4, 0xfa, 0x92, 0x63, 0xb7, 0x6c, 0xe8, 0xf2, 0x89, 0xf4,
+  0x1c, 0x8b, 0xc1, 0x58, 0x62, 0x53, 0x3b, 0x5d, 0x45, 0xd1, 0xfa, 0x1b, 0x45, 0x93, 0xf7, 0xb3,
+  0x97, 0x4f, 0xa6, 0xab, 0x98, 0xa5, 0x7e, 0x0b, 0x4f, 0x3b, 0x19, 0x85, 0x1f, 0x13, 0xd8, 0x8b,
+  0x85, 0xdc, 0xbd, 0xdb, 0xce, 0x26, 0x9c, 0xb6, 0x45, 0x51, 0xcd, 0xca, 0xb3, 0xef, 0xc3, 0x05,
+  0x4d, 0x56, 0xb9, 0xb3, 0xf1, 0x23, 0xd8, 0xfe, 0x8b, 0xa7, 0xbd, 0xd0, 0x5b, 0x68, 0xaf, 0xb2,
+  0xdc, 0x8a, 0xb5, 0xa9, 0x71, 0x90, 0xf8, 0xab, 0x05, 0xf8, 0x67, 0x6f, 0x46, 0xf3, 0xb7, 0x11,
+  0xc5, 0x8f, 0xdf, 0xaf, 0xaf, 0x82, 0xb6, 0x6d, 0xc8, 0x66, 0x3b, 0x9e, 0x8e, 0xd5, 0x63, 0x3a,
+  0xb9, 0x06, 0x2f, 0xec, 0xa5, 0x74, 0x01, 0xdd, 0x2a, 0x80, 0x83, 0x10, 0x00, 0x05, 0x58, 0x92,
+  0x9b, 0xb6, 0x33, 0xbe, 0xdc, 0x34, 0x60, 0x41, 0xfe, 0x51, 0x28, 0x7b, 0xb8, 0x1e, 0x1f, 0x48,
+  0xd2, 0x64, 0x64, 0xdb, 0x39, 0x75, 0x5d, 0x17, 0xfe, 0xf4, 0xf1, 0xc4, 0xd8, 0x50, 0xb5, 0x8c,
+  0xaa, 0xb6, 0x8c, 0x22, 0x67, 0xd3, 0xa8, 0x04, 0x3d, 0x0a, 0x6d, 0xa7, 0xc7, 0x7a, 0xed, 0xff,
+  0x7a, 0xff, 0xee, 0x7a, 0x2c, 0x71, 0x8f, 0xed, 0x83, 0x02, 0xd3, 0xf6, 0xb8, 0xea, 0x17, 0x61,
+  0x8c, 0xe4, 0xc6, 0x4b, 0xbc, 0x80, 0x75, 0x15, 0xe7, 0xed, 0xc6, 0x95, 0x05, 0xa4, 0xed, 0xbc,
+  0xea, 0xb1, 0xac, 0xf0, 0xf1, 0xa3, 0x7d, 0xea, 0xda, 0x8e, 0xa4, 0x43, 0x1e, 0x0e, 0xa5, 0xc3,
+  0x21, 0x4d, 0x3a, 0x05, 0x21, 0x7c, 0x61, 0x02, 0xb0, 0x64, 0x46, 0xc7, 0xef, 0x48, 0x3e, 0xef,
+  0xc1, 0xb2, 0x6d, 0x28, 0x11, 0x1d, 0xfe, 0x40, 0x1e, 0xda, 0x6e, 0xa7, 0xad, 0x14, 0xd5, 0x15,
+  0x4c, 0x39, 0x27, 0x6d, 0x41, 0x56, 0x8d, 0x38, 0x7f, 0x03, 0x2c, 0x47, 0x52, 0x35, 0xf2, 0x48,
+  0xb3, 0x8b, 0x19, 0x60, 0x8a, 0x25, 0x75, 0xe7, 0xe8, 0x1a, 0x23, 0x53, 0x20, 0x34, 0x13, 0x31,
+  0xc1, 0x81, 0x0a, 0x84, 0x4d, 0x2d, 0x89, 0xa3, 0xa3, 0xda, 0xe1, 0x9e, 0xd8, 0xa2, 0x3a, 0x1b,
+  0xa1, 0x11, 0xb1, 0xed, 0x1e, 0x83, 0x40, 0xdd, 0x42, 0x3d, 0x9e, 0xc1, 0x6c, 0x8f, 0xa5, 0xc6,
+  0x1e, 0xbf, 0xee, 0x06, 0x0a, 0x7d, 0x66, 0xd7, 0xce, 0xe3, 0x76, 0x7c, 0xfc, 0xfb, 0xb7, 0x6a,
+  0x2b, 0xdf, 0xed, 0x0f, 0xb7, 0xcf, 0x7e, 0xdf, 0xd2, 0x28, 0xa3, 0x9b, 0x66, 0x7a, 0x6d, 0x73,
+  0x65, 0xe7, 0xd8, 0xde, 0x45, 0xde, 0x76, 0x6d, 0x11, 0xd7, 0x50, 0xeb, 0xf7, 0x6a, 0x0b, 0x60,
+  0x7e, 0x45, 0x37, 0x50, 0xda, 0x9e, 0xa5, 0x94, 0xc6, 0x7b, 0xd1, 0x18, 0x94, 0x89, 0x38, 0x81,
+  0x87, 0xbd, 0x78, 0x08, 0x24, 0xd1, 0xc0, 0x2e, 0x05, 0x87, 0x47, 0x47, 0xfa, 0xc2, 0x47, 0x47,
+  0x1a, 0x35, 0x69, 0x08, 0x00, 0x2e, 0xfc, 0xbb, 0xc0, 0xe4, 0x6e, 0x6c, 0xb0, 0x5f, 0x80, 0xe9,
+  0x44, 0x4d, 0x40, 0x5c, 0xa0, 0x80, 0xd3, 0x96, 0x93, 0x60, 0x75, 0x0a, 0x2e, 0x3a, 0x87, 0xf1,
+  0xef, 0xe9, 0x6c, 0xd2, 0xfe, 0x76, 0x03, 0x7c, 0x6c, 0x3b, 0xd6, 0xb7, 0x1b, 0xb6, 0x10, 0xfb,
+  0x84, 0xa4, 0xb6, 0xce, 0xef, 0xdb, 0xad, 0x4a, 0x32, 0xab, 0x65, 0x40, 0x72, 0x95, 0x36, 0x8c,
+  0x44, 0xfe, 0xf6, 0x0e, 0x56, 0xbc, 0x4d, 0x56, 0x60, 0xdb, 0xa3, 0xa3, 0x6f, 0xc4, 0xa0, 0x0c,
+  0xaf, 0xdb, 0x3c, 0xa5, 0x64, 0xf1, 0x03, 0x09, 0xa3, 0xc2, 0x1b, 0x69, 0x36, 0x8e, 0xe9, 0xbd,
+  0xa5, 0xe1, 0xb5, 0x61, 0x2f, 0x89, 0x4f, 0xd9, 0xab, 0xf9, 0x9f, 0xe0, 0xa3, 0xa0, 0x58, 0x9a,
+  0xf5, 0x92, 0x18, 0xf6, 0x83, 0x19, 0x46, 0x31, 0x85, 0x0c, 0x69, 0x64, 0x39, 0x25, 0x33, 0xed,
+  0x01, 0x5b, 0xa4, 0x07, 0x3d, 0x4b, 0x98, 0xb7, 0xed, 0x8e, 0xed, 0xfc, 0xe6, 0xfe, 0xcb, 0x71,
+  0xb6, 0x1c, 0x9d, 0xa6, 0x69, 0x92, 0x8e, 0x59, 0x7e, 0x85, 0x67, 0x3f, 0x4a, 0x32, 0x60, 0xdc,
+  0xdb, 0xc1, 0xe0, 0x38, 0x4f, 0x57, 0x54, 0x4f, 0xf7, 0xa6, 0xd4, 0x9d, 0x21, 0x66, 0x5f, 0x2f,
+  0xa5, 0xf9, 0x2a, 0x8d, 0xb7, 0x53, 0x9a, 0xfb, 0xf3, 0x36, 0x6e, 0x06, 0x55, 0x2a, 0xcd, 0xe7,
+  0x34, 0x06, 0xab, 0x66, 0x4b, 0x10, 0x13, 0x78, 0x96, 0x9f, 0x7a, 0xd8, 0xed, 0xb6, 0x1d, 0x31,
+  0x2f, 0xe1, 0x1b, 0x65, 0x52, 0x29, 0xdc, 0xd9, 0x3a, 0x3d, 0x28, 0x09, 0xb0, 0x0a, 0x97, 0xe4,
+  0x92, 0xe9, 0x2f, 0x01, 0x1b, 0xb2, 0xe7, 0x76, 0xeb, 0x2d, 0xfe, 0xb1, 0x18, 0x23, 0x50, 0xd5,
+  0x2c, 0x89, 0x38, 0x6a, 0x75, 0x18, 0x00, 0xe2, 0x4f, 0xc3, 0x98, 0x40, 0xa5, 0xe6, 0x55, 0x66,
+  0x8f, 0x64, 0x7a, 0x51, 0xe1, 0xf3, 0xaf, 0xb1, 0x49, 0xbe, 0xe1, 0xd7, 0x39, 0xda, 0x9a, 0x0f,
+  0x7f, 0xc9, 0x21, 0xc9, 0xd1, 0x7c, 0x8d, 0xf3, 0x66, 0x3c, 0x1d, 0xea, 0x11, 0xd1, 0x7c, 0x74,
+  0xa4, 0x23, 0xfe, 0x87, 0x62, 0x5b, 0x67, 0xe1, 0x53, 0x42, 0xbb, 0xb0, 0x35, 0xbe, 0x06, 0xc4,
+  0x8e, 0xe8, 0xf5, 0x1c, 0xaf, 0x50, 0x65, 0x6d, 0xd1, 0x25, 0x5d, 0x05, 0x1d, 0xbe, 0x14, 0xa4,
+  0x75, 0x28, 0x21, 0x24, 0x25, 0x8b, 0x6c, 0x6c, 0xdb, 0xa8, 0x25, 0x05, 0x31, 0x1e, 0x8f, 0xed,
+  0x78, 0xb5, 0xb8, 0xa6, 0x41, 0x66, 0x3b, 0x12, 0x44, 0x0c, 0x8c, 0xed, 0x63, 0x86, 0xef, 0x61,
+  0x69, 0xb0, 0xca, 0x58, 0xaa, 0x17, 0x90, 0x58, 0xb2, 0x8d, 0xd8, 0x8d, 0x25, 0x2b, 0xbf, 0xc2,
+  0x12, 0x4d, 0xc3, 0x4e, 0xac, 0x09, 0xeb, 0x87, 0x63, 0xc8, 0x26, 0x05, 0x62, 0x31, 0xb6, 0x1b,
+  0xb7, 0xf0, 0x64, 0x89, 0x29, 0x47, 0x76, 0xe3, 0xe9, 0xae, 0x2c, 0x31, 0x8b, 0xb1, 0x3d, 0xfc,
+  0x16, 0xee, 0xac, 0xd8, 0x95, 0x43, 0xbb, 0x31, 0xd9, 0xfd, 0x96, 0x5b, 0xe8, 0xce, 0x0a, 0x4c,
+  0x35, 0x64, 0x62, 0xf2, 0x2c, 0x26, 0x9c, 0x8d, 0xb0, 0xe3, 0x3b, 0x1a, 0x88, 0xfd, 0x47, 0x63,
+  0xc0, 0xa8, 0xb5, 0xa4, 0x97, 0x26, 0xa0, 0x45, 0xcc, 0x30, 0x9c, 0xb5, 0x12, 0x19, 0xee, 0xa9,
+  0x9e, 0x4c, 0x94, 0x80, 0xfc, 0xca, 0x3e, 0xe6, 0x6c, 0x55, 0x72, 0x25, 0xd6, 0x93, 0x6f, 0x54,
+  0xc2, 0x4c, 0x3e, 0x38, 0x9b, 0x7c, 0x9e, 0x26, 0xf7, 0x16, 0x2b, 0x14, 0x2c, 0xdb, 0xd9, 0xb7,
+  0xb8, 0x97, 0x49, 0x05, 0xe3, 0xec, 0x08, 0x80, 0x1d, 0x7f, 0x59, 0xf6, 0xb1, 0xc2, 0xe3, 0x43,
+  0xce, 0x96, 0xc3, 0x58, 0x6a, 0xfc, 0x8f, 0x0c, 0x37, 0x1f, 0x5b, 0x99, 0x81, 0xa1, 0x64, 0xf0,
+  0x15, 0x79, 0xf1, 0x60, 0x48, 0xa8, 0x3d, 0xb1, 0xb7, 0xb1, 0x9d, 0x4d, 0xc3, 0xf6, 0x65, 0x2b,
+  0x95, 0x5e, 0x42, 0x64, 0xe9, 0x16, 0xd0, 0x6a, 0x15, 0x30, 0x36, 0x94, 0xa4, 0x1a, 0x42, 0xb6,
+  0xcf, 0xde, 0x97, 0xd9, 0x94, 0xc2, 0x8f, 0x8b, 0x8f, 0xd0, 0xb1, 0xfb, 0xd1, 0x2a, 0x80, 0x40,
+  0xb5, 0x85, 0x93, 0xbc, 0xb2, 0xdf, 0x70, 0x72, 0xf6, 0x48, 0x0e, 0x89, 0x96, 0x51, 0x5f, 0xc4,
+  0xd9, 0x98, 0xcf, 0xac, 0x2c, 0x89, 0x2f, 0x56, 0x98, 0x3c, 0x6e, 0x49, 0x44, 0x53, 0xa8, 0xa7,
+  0xbc, 0xbe, 0xc0, 0x26, 0x06, 0xab, 0x8b, 0x58, 0x1f, 0xf5, 0xcd, 0xc5, 0x17, 0xd5, 0x19, 0x9a,
+  0xef, 0x5f, 0xe2, 0x0f, 0x71, 0x72, 0x1f, 0x5b, 0x42, 0x0d, 0xce, 0x76, 0x4f, 0xe1, 0xaa, 0x27,
+  0x6c, 0x8b, 0xaa, 0xe5, 0xfd, 0x3f, 0xd3, 0x22, 0xef, 0x2d, 0xac, 0x3c, 0x61, 0x3b, 0x68, 0x29,
+  0x6e, 0xcf, 0xba, 0x89, 0xf0, 0x4e, 0x88, 0x95, 0xa7, 0x6b, 0x8b, 0xcc, 0x48, 0x18, 0xf7, 0x6c,
+  0xb3, 0x04, 0x03, 0xe0, 0xf7, 0x2a, 0xa1, 0xbf, 0x4b, 0x02, 0xda, 0xa6, 0x31, 0x99, 0xb0, 0x3e,
+  0x4a, 0x0b, 0x29, 0x13, 0xe4, 0x95, 0x00, 0x81, 0x58, 0x97, 0xc0, 0x8d, 0x5d, 0x09, 0x0f, 0x8a,
+  0xcf, 0x8f, 0x89, 0xb2, 0xb1, 0xeb, 0x6c, 0xad, 0x8c, 0xdb, 0x28, 0xe0, 0x35, 0x59, 0xd3, 0xb4,
+  0x2d, 0x0a, 0x8e, 0x21, 0x1f, 0x7c, 0x7c, 0x35, 0x31, 0xe1, 0x64, 0x2a, 0xfb, 0xb2, 0x85, 0x7b,
+  0x23, 0xb7, 0x66, 0x24, 0x62, 0x9b, 0xb3, 0x5a, 0xfb, 0x95, 0x81, 0xbe, 0x36, 0x0b, 0xbe, 0x4b,
+  0xf0, 0xd3, 0xed, 0x22, 0x49, 0x72, 0x6c, 0x42, 0x6b, 0x65, 0x2c, 0xc1, 0x7c, 0x6d, 0x22, 0x32,
+  0xbb, 0xb0, 0x00, 0x5c, 0xc0, 0x2f, 0x43, 0x32, 0x35, 0xf5, 0x0a, 0xa7, 0x40, 0x20, 0x06, 0xf1,
+  0xe5, 0x4a, 0xc3, 0xdb, 0x7a, 0x6e, 0x8f, 0x1b, 0xac, 0xc4, 0x6d, 0x56, 0x8f, 0x3b, 0xd5, 0xb8,
+  0x2b, 0xd9, 0x8c, 0x01, 0xbf, 0x62, 0xc0, 0x63, 0x51, 0xc4, 0x8f, 0xed, 0xa3, 0x3b, 0xbd, 0x23,
+  0xf9, 0xb2, 0x8d, 0xc8, 0xdf, 0x50, 0xde, 0x2e, 0x29, 0x0d, 0x6a, 0xb2, 0x8c, 0x36, 0xfb, 0xea,
+  0xab, 0x13, 0xea, 0x0a, 0x8b, 0x4f, 0x16, 0xe6, 0xeb, 0x46, 0xc1, 0x14, 0xc4, 0xd7, 0x24, 0xdc,
+  0x7b, 0x75, 0x99, 0x03, 0x37, 0xad, 0x8d, 0xa5, 0xa1, 0xb8, 0xf3, 0xf1, 0x2e, 0xfb, 0x3a, 0x04,
+  0xbb, 0x21, 0xec, 0x2a, 0x77, 0xa3, 0x44, 0x4b, 0x3e, 0xff, 0x15, 0x08, 0x43, 0x96, 0xcb, 0x68,
+  0xfd, 0x7a, 0x95, 0xe5, 0xc9, 0x42, 0x0a, 0x25, 0x77, 0xc3, 0x30, 0xb6, 0xcc, 0xc6, 0xbf, 0xb9,
+  0x9d, 0xfe, 0xe0, 0x05, 0x7e, 0x21, 0xec, 0x5f, 0xbd, 0x05, 0x59, 0xb6, 0xdb, 0xf2, 0xd4, 0xb0,
+  0x13, 0x3a, 0xe3, 0x4b, 0xf9, 0x70, 0x0c, 0x1d, 0xd7, 0x71, 0xe3, 0x26, 0x5d, 0xa8, 0xe3, 0x16,
+  0x08, 0xda, 0xc7, 0xa1, 0xc3, 0xdb, 0xc1, 0x5e, 0xb6, 0x9a, 0xe0, 0xed, 0x0c, 0xa8, 0x38, 0x7d,
+  0xd0, 0xc0, 0x1f, 0x49, 0x18, 0xb3, 0xf3, 0x1f, 0x7d, 0xb7, 0x21, 0x58, 0x7a, 0xc5, 0x59, 0xb1,
+  0x8f, 0xd9, 0xdf, 0xcf, 0xd1, 0xe6, 0x37, 0xba, 0x36, 0xcb, 0xfb, 0x13, 0xbd, 0x27, 0x76, 0xbc,
+  0x7d, 0xd2, 0xd8, 0x42, 0x8e, 0xb1, 0x7d, 0x6e, 0x7b, 0x4d, 0x76, 0x39, 0xa4, 0x8b, 0xd6, 0xda,
+  0x66, 0xde, 0x6e, 0x0a, 0xa9, 0xad, 0x7b, 0x92, 0xe1, 0x5b, 0x11, 0xfe, 0xda, 0x06, 0xbb, 0x76,
+  0x06, 0xa6, 0x38, 0x34, 0x5a, 0x4d, 0xbc, 0x8e, 0x53, 0x18, 0x50, 0xaa, 0x70, 0xa6, 0x54, 0xa8,
+  0xce, 0xb6, 0x40, 0x5d, 0xb5, 0x7a, 0x3a, 0x58, 0x5c, 0xa6, 0x25, 0x31, 0xe8, 0x49, 0xed, 0xfa,
+  0xcc, 0x83, 0x7a, 0x11, 0x8d, 0x67, 0xf9, 0x1c, 0x5c, 0xf6, 0x14, 0x9a, 0x6c, 0x6d, 0x7c, 0x9a,
+  0xa4, 0x6f, 0x09, 0x70, 0xd4, 0x46, 0x03, 0x32, 0xc7, 0xd9, 0x3c, 0xce, 0x59, 0xc6, 0xf6, 0x53,
+  0x6e, 0x7d, 0xfe, 0x05, 0xa5, 0x5e, 0x9e, 0x5c, 0x27, 0xf7, 0x34, 0x7d, 0x4d, 0xf0, 0x40, 0x70,
+  0xab, 0xfb, 0x7f, 0xbd, 0xef, 0x5b, 0xe2, 0xba, 0x92, 0x25, 0xa8, 0xa3, 0xce, 0xcd, 0xa0, 0x06,
+  0x1d, 0xcb, 0x3b, 0x35, 0xf2, 0x7d, 0x59, 0x11, 0x09, 0x62, 0x60, 0xbc, 0x51, 0x5b, 0xf1, 0xd1,
+  0x8e, 0x97, 0x33, 0x6a, 0x03, 0xcf, 0x79, 0xef, 0x40, 0x7e, 0x0b, 0xa3, 0x6b, 0xa6, 0x9a, 0x66,
+  0x34, 0x0d, 0x48, 0x21, 0xf2, 0xcb, 0x8d, 0xb7, 0xf3, 0x70, 0x9a, 0x37, 0x23, 0x6a, 0x40, 0x0a,
+  0x51, 0x86, 0xa5, 0x2a, 0xfe, 0xcd, 0xe8, 0x15, 0x50, 0x45, 0xe4, 0x8e, 0x46, 0x09, 0xde, 0x51,
+  0x3c, 0x80, 0x48, 0x05, 0xb4, 0xe0, 0x24, 0xa5, 0x41, 0xc8, 0x54, 0xfc, 0x03, 0xf1, 0x73, 0x70,
+  0xf6, 0x66, 0x46, 0x4a, 0x90, 0x15, 0x61, 0x6e, 0xfe, 0x01, 0x5b, 0xac, 0xfd, 0x82, 0x30, 0xb0,
+  0x0a, 0xf2, 0xd5, 0x61, 0xc8, 0x57, 0x06, 0xf2, 0xc4, 0xd8, 0x99, 0x35, 0x63, 0x9b, 0x70, 0x80,
+  0x2e, 0x5e, 0xde, 0x74, 0xcc, 0x57, 0x3b, 0xa3, 0x83, 0xdf, 0x16, 0x29, 0x02, 0x8b, 0xe4, 0x40,
+  0x33, 0x96, 0x00, 0x0b, 0x12, 0x5b, 0x79, 0x1a, 0x99, 0x04, 0x6b, 0x76, 0x68, 0xff, 0xcb, 0xcf,
+  0xd7, 0xb7, 0x94, 0xa4, 0xfe, 0x9c, 0x35, 0x84, 0x59, 0x5b, 0xf3, 0x69, 0xe9, 0xe7, 0x3d, 0x35,
+  0x64, 0xf8, 0xae, 0x9a, 0xd6, 0x06, 0x0d, 0x1f, 0x55, 0x00, 0xda, 0x60, 0xd5, 0x17, 0x85, 0x23,
+  0x28, 0xe0, 0x0a, 0xc0, 0x09, 0xbe, 0xea, 0xab, 0xb8, 0x54, 0x19, 0xad, 0x02, 0xc0, 0xd0, 0x2a,
+  0xfe, 0x56, 0x2c, 0x53, 0x9a, 0xe1, 0xe0, 0x86, 0x6f, 0x55, 0x58, 0x62, 0xc3, 0x06, 0xe0, 0x55,
+  0x3d, 0xe0, 0x95, 0x02, 0x2c, 0xf9, 0x8c, 0x82, 0x34, 0xc7, 0x0b, 0xcf, 0x10, 0x9b, 0xc6, 0x02,
+  0xd0, 0xf4, 0x85, 0x8a, 0x07, 0x28, 0xb8, 0xd2, 0xc4, 0xd6, 0x28, 0x9c, 0xac, 0x0d, 0xb1, 0x3b,
+  0x1b, 0x7e, 0xa9, 0x6b, 0x64, 0xdf, 0xfc, 0x74, 0xfb, 0xde, 0xee, 0xa0, 0x0f, 0x8c, 0xf0, 0xd7,
+  0x76, 0x5f, 0x35, 0xf8, 0xe4, 0xaa, 0xd9, 0x50, 0x08, 0x65, 0x69, 0xc3, 0xab, 0x0d, 0xf2, 0x16,
+  0xa3, 0x4a, 0xab, 0x75, 0xf7, 0x12, 0x6c, 0xe7, 0x53, 0x4e, 0xa0, 0xb2, 0x4a, 0x2d, 0x55, 0x77,
+  0x1f, 0xa0, 0x5a, 0xd0, 0x47, 0x55, 0xd3, 0x9a, 0x6a, 0xa0, 0x29, 0x98, 0x0d, 0x7d, 0x7a, 0x51,
+  0xad, 0x14, 0x09, 0x5e, 0x56, 0x17, 0x09, 0x4a, 0x73, 0x2d, 0x27, 0x3f, 0x7e, 0x3c, 0x73, 0xbd,
+  0xfd, 0x34, 0xc4, 0x51, 0x97, 0x71, 0x8e, 0xf5, 0x78, 0x72, 0x35, 0x05, 0x88, 0x53, 0xd1, 0x26,
+  0x3e, 0x7e, 0x3c, 0x8c, 0x40, 0x23, 0x47, 0x87, 0xd2, 0xaa, 0x29, 0x6a, 0x9c, 0x80, 0x36, 0x71,
+  0x28, 0x81, 0x46, 0x66, 0x0e, 0xa5, 0xd5, 0x58, 0x22, 0xf9, 0xe5, 0x04, 0x16, 0xd4, 0x6d, 0x1e,
+  0x07, 0x0d, 0xc9, 0x0e, 0xc8, 0xf7, 0x06, 0xfc, 0x32, 0xc2, 0x23, 0x96, 0xa9, 0x63, 0xfc, 0x2f,
+  0x5d, 0xb1, 0xb1, 0x6c, 0x57, 0x97, 0x69, 0x48, 0xc7, 0xb8, 0x4c, 0xff, 0xd1, 0xcb, 0x1c, 0x24,
+  0xd8, 0xe7, 0xac, 0xd8, 0xd4, 0x4b, 0xd4, 0xa8, 0xaf, 0x04, 0x89, 0xe4, 0x87, 0x8f, 0x25, 0x7f,
+  0x98, 0xa1, 0x3e, 0x69, 0xa5, 0xba, 0xa6, 0xa6, 0xd9, 0x09, 0x18, 0xd8, 0x61, 0x1a, 0xd2, 0x31,
+  0x1e, 0xe5, 0x68, 0x8f, 0x5f, 0xe3, 0xea, 0x30, 0xe6, 0xaf, 0x24, 0x61, 0xf7, 0x71, 0x94, 0x1f,
+  0xc5, 0x7d, 0x75, 0x11, 0x2c, 0x75, 0x87, 0x36, 0x76, 0xce, 0xa3, 0x5b, 0x40, 0x9e, 0x69, 0xcc,
+  0xd9, 0x8f, 0x1f, 0xa7, 0x24, 0xca, 0xe8, 0x81, 0x2b, 0xb3, 0xe3, 0xf2, 0xc3, 0x96, 0x16, 0xa0,
+  0x7a, 0xbe, 0x2c, 0x4d, 0x62, 0x9e, 0xdb, 0xb5, 0x6c, 0xb9, 0x11, 0x75, 0x1e, 0xdd, 0xb2, 0xf2,
+  0x65, 0x4b, 0x77, 0x9a, 0xf8, 0x19, 0xf1, 0x21, 0x72, 0x57, 0xfa, 0x58, 0xe7, 0xf1, 0x2d, 0xaf,
+  0x2c, 0x7e, 0xc6, 0x74, 0x89, 0x07, 0x28, 0xe1, 0xab, 0xa5, 0x2a, 0xf1, 0xfc, 0xbf, 0x36, 0xa1,
+  0xef, 0xd7, 0xf7, 0x6c, 0x23, 0x2b, 0x3d, 0x4c, 0x75, 0x43, 0x59, 0xbb, 0x80, 0xdc, 0x50, 0xf2,
+  0xe7, 0xe2, 0x75, 0xd7, 0xbf, 0x57, 0x34, 0x5d, 0xdf, 0xd2, 0x88, 0x62, 0x66, 0x80, 0x26, 0xa9,
+  0x6d, 0x3f, 0x2d, 0x7a, 0xf0, 0xa7, 0x95, 0x1c, 0xdf, 0x79, 0x5a, 0xc9, 0x8e, 0x00, 0x55, 0x4a,
+  0x30, 0x05, 0x1e, 0x0b, 0xd9, 0xe2, 0x51, 0xc4, 0xa3, 0x27, 0xb8, 0x50, 0xbb, 0x73, 0xfe, 0x2c,
+  0x3a, 0xad, 0xdc, 0x62, 0x5e, 0x24, 0x5e, 0xa8, 0x35, 0xbf, 0x98, 0x63, 0x38, 0xbd, 0x30, 0x38,
+  0x96, 0x6f, 0xdc, 0x04, 0xd9, 0x5e, 0x12, 0xb3, 0xeb, 0xe2, 0x63, 0xa9, 0x11, 0x10, 0x5e, 0xa7,
+  0x68, 0x84, 0x2b, 0x48, 0x90, 0x71, 0xaf, 0xdd, 0x1a, 0x7d, 0x18, 0x09, 0x02, 0xae, 0x14, 0x54,
+  0x21, 0xf4, 0x6d, 0xda, 0x8e, 0x9c, 0x8f, 0x36, 0x68, 0xb0, 0x6d, 0xb3, 0xb5, 0x7f, 0x13, 0x5f,
+  0x35, 0xd0, 0x49, 0xb4, 0xfe, 0x25, 0xbf, 0xfd, 0xc5, 0xaf, 0x8b, 0xc8, 0x49, 0x67, 0x83, 0x8b,
+  0xb1, 0x45, 0xe4, 0x90, 0xb8, 0xa7, 0xc1, 0x2f, 0xc6, 0xc9, 0xb3, 0x19, 0xfe, 0xca, 0x8f, 0x83,
+  0x58, 0x04, 0x2c, 0x89, 0x6f, 0x04, 0xf9, 0x05, 0x78, 0x6b, 0x1a, 0xa6, 0x78, 0xb3, 0x41, 0xbf,
+  0x99, 0xc1, 0xef, 0x7f, 0xfe, 0x85, 0x42, 0xfc, 0x08, 0x09, 0xa4, 0x59, 0x06, 0xb1, 0xdc, 0xa3,
+  0xc5, 0x88, 0x81, 0x2a, 0xbe, 0xdf, 0xe4, 0xf8, 0x4c, 0x04, 0xc5, 0x14, 0xe8, 0x85, 0x5d, 0xf4,
+  0xc2, 0xfb, 0xac, 0x34, 0xa6, 0xc0, 0xd7, 0x9b, 0x9f, 0xde, 0x09, 0xcb, 0xe1, 0xf7, 0x4a, 0x80,
+  0x8b, 0x8e, 0x66, 0xe4, 0xf2, 0x3d, 0xb3, 0x9d, 0xe1, 0xae, 0xf5, 0xc1, 0xce, 0xa6, 0xbe, 0xeb,
+  0xde, 0xee, 0xc2, 0x57, 0x87, 0x53, 0x1c, 0x5b, 0x9d, 0x80, 0xed, 0x44, 0xd2, 0xcf, 0x9b, 0x11,
+  0xf3, 0xaf, 0x6b, 0xeb, 0x4d, 0xca, 0xa5, 0x26, 0x5a, 0xcd, 0x78, 0x07, 0xe1, 0xef, 0xea, 0xa1,
+  0x15, 0xd0, 0xc1, 0x09, 0xab, 0x94, 0xa7, 0x9a, 0x0d, 0x62, 0x7c, 0xad, 0x0f, 0x96, 0xe7, 0xf7,
+  0x92, 0xc4, 0x1b, 0xf3, 0xb1, 0x8d, 0x5f, 0xb1, 0xb0, 0xb7, 0x0e, 0x7e, 0x6f, 0x50, 0x5c, 0x18,
+  0xd7, 0xae, 0x8e, 0x3f, 0x56, 0x8f, 0x4f, 0x1a, 0xd9, 0xd0, 0xbe, 0xfd, 0x54, 0x52, 0x81, 0x0d,
+  0x1f, 0x62, 0xe6, 0xd7, 0xb6, 0xb7, 0x07, 0x3f, 0x5c, 0x96, 0x70, 0x8b, 0x2f, 0x69, 0x24, 0x59,
+  0x8e, 0x61, 0xe5, 0x3d, 0x51, 0x0a, 0x64, 0xd7, 0xeb, 0x3e, 0x89, 0xa1, 0xef, 0x6e, 0x2c, 0x56,
+  0xf3, 0xff, 0x1a, 0x76, 0x3c, 0x43, 0xb5, 0x27, 0xe2, 0xdb, 0x98, 0xec, 0x3f, 0x91, 0x79, 0xf9,
+  0x7f, 0xc1, 0xa9, 0x67, 0x96, 0x95, 0x53, 0x00, 0x00,
+};
+const size_t page_network_gz_len = 5129;
+
+#endif // WEB_PAGES_GZ_H
@@ -5,13 +5,25 @@
 
 // Connection timeout constants
 #define WIFI_CONNECTION_TIMEOUT 15000  // 15 seconds
-#define WIFI_RECONNECT_DELAY 500      // Wait between reconnect attempts
-#define MAX_CONNECTION_ATTEMPTS 2      // Attempts before falling back to AP mode
-#define WIFI_CHECK_INTERVAL 30000      // Check connection every 30 seconds
+#define MAX_CONNECTION_ATTEMPTS 2      // Failed attempts before the fallback AP is opened
+#define WIFI_BACKOFF_BASE_MS 1000      // First retry after a lost link
+#define WIFI_BACKOFF_MAX_MS 300000     // Retry at least every 5 minutes
 
 // Global instance
 WifiManager wifiManager;
 
+// Set from the WiFi event task, consumed by process()
+static volatile bool staGotIpEvent = false;
+static volatile bool staDisconnectedEvent = false;
+
+static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    staGotIpEvent = true;
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    staDisconnectedEvent = true;
+  }
+}
+
 void WifiManager::begin() {
   Serial.println("[WiFi] Initializing WiFi manager");
   
@@ -23,6 +35,8 @@ void WifiManager::begin() {
   delay(100);
   WiFi.mode(WIFI_OFF);
   delay(200);  // Give WiFi subsystem time to reset
+  
+  WiFi.onEvent(onWifiEvent);
 
   // Check if WiFi section is properly marked
   uint16_t wifiMarker;
@@ -50,9 +64,14 @@ void WifiManager::begin() {
   if (loadWifiCredentials(ssid, password, deviceName) && strlen(ssid) > 0) {
     Serial.printf("[WiFi] Saved credentials found: SSID='%s'\n", ssid);
     
-    // Try to connect
+    // Kept for reconnecting without touching EEPROM
+    strncpy(_ssid, ssid, sizeof(_ssid) - 1);
+    strncpy(_password, password, sizeof(_password) - 1);
+    
+    // Try to connect. This runs in the network task, so waiting here is fine.
     if (connectToWifi(ssid, password)) {
       _currentMode = WIFI_MANAGER_MODE_STA;
+      _linkState = WIFI_LINK_CONNECTED;
       
       // Setup mDNS with device name
       if (strlen(deviceName) > 0) {
@@ -69,6 +88,10 @@ void WifiManager::begin() {
       Serial.println("[WiFi] Failed to connect. Starting AP mode");
       startAPMode();
       _currentMode = WIFI_MANAGER_MODE_FALLBACK;
+      
+      // Keep trying in the background, starting from the long end of the backoff
+      _failedAttempts = MAX_CONNECTION_ATTEMPTS;
+      scheduleRetry(millis());
     }
   } else {
     Serial.println("[WiFi] No saved credentials. Starting AP mode");
@@ -76,6 +99,10 @@ void WifiManager::begin() {
     _currentMode = WIFI_MANAGER_MODE_AP;
   }
   
+  // Events from the initial connect have been handled above
+  staGotIpEvent = false;
+  staDisconnectedEvent = false;
+  
   // Print current connection status
   if (_currentMode == WIFI_MANAGER_MODE_STA) {
     Serial.printf("[WiFi] Connected: IP=%s, RSSI=%d\n", 
@@ -90,11 +117,6 @@ void WifiManager::begin() {
 bool WifiManager::startAPMode() {
   Serial.println("[WiFi] Starting Access Point mode");
   
-  // Use a more unique AP name based on chip ID and timestamp
-  char apName[32];
-  uint32_t chipId = ESP.getEfuseMac() & 0xFFFF; // Use last 16 bits (4 hex digits)
-  sprintf(apName, "AmbiSense-%04X", chipId);
-  
   // First ensure WiFi is in the correct mode
   WiFi.disconnect(true);
   delay(100);
@@ -103,6 +125,15 @@ bool WifiManager::startAPMode() {
   WiFi.mode(WIFI_AP);
   delay(100);
   
+  return startSoftAP();
+}
+
+bool WifiManager::startSoftAP() {
+  // Use a more unique AP name based on chip ID and timestamp
+  char apName[32];
+  uint32_t chipId = ESP.getEfuseMac() & 0xFFFF; // Use last 16 bits (4 hex digits)
+  sprintf(apName, "AmbiSense-%04X", chipId);
+  
   // Use channel 6 (middle of 1,6,11 non-overlapping channels) for better compatibility
   int channel = 6;  // Channel 6 is often less congested than 1, more compatible than 11
   Serial.printf("[WiFi] Using channel %d for AP mode\n", channel);
@@ -268,7 +299,7 @@ bool WifiManager::connectToWifi(const char* ssid, const char* password) {
   
   // Configure WiFi power and performance
   WiFi.setTxPower(WIFI_POWER_19_5dBm); // Max power for better range
-  WiFi.setAutoReconnect(true);          // Enable auto-reconnect
+  WiFi.setAutoReconnect(false);         // process() reconnects, with backoff
   
   // Start connection
   WiFi.begin(ssid, password);
@@ -328,97 +359,187 @@ bool WifiManager::setupMDNS(const char* hostname) {
   return true;
 }
 
-void WifiManager::checkWifiConnection() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("[WiFi] Connection lost, attempting to reconnect");
+void WifiManager::requestScan(bool force) {
+  if (_scanRunning) return;
+  if (!force && _scanValid && millis() - _scanCompletedTime < WIFI_SCAN_MAX_AGE_MS) return;
+  
+  // Async: the driver hops channels in the background and scanComplete() reports the result
+  int16_t result = WiFi.scanNetworks(true, true, false, 300);  // Include hidden networks, 300 ms per channel
+  if (result == WIFI_SCAN_FAILED) {
+    if (ENABLE_WIFI_LOGGING) Serial.println("[WiFi] Could not start scan");
+    return;
+  }
+  
+  _scanRunning = true;
+  if (ENABLE_WIFI_LOGGING) Serial.println("[WiFi] Background scan started");
+}
+
+void WifiManager::processScan() {
+  if (!_scanRunning) return;
+  
+  int16_t found = WiFi.scanComplete();
+  if (found == WIFI_SCAN_RUNNING) return;
+  
+  _scanRunning = false;
+  if (found < 0) {
+    // Keep serving the previous results
+    if (ENABLE_WIFI_LOGGING) Serial.println("[WiFi] Scan failed");
+    return;
+  }
+  
+  // Keep the strongest networks, sorted by insertion
+  _scanResultCount = 0;
+  for (int i = 0; i < found; i++) {
+    int32_t rssi = WiFi.RSSI(i);
     
-    _connectionAttempts++;
+    int pos = _scanResultCount;
+    while (pos > 0 && _scanResults[pos - 1].rssi < rssi) pos--;
+    if (pos >= WIFI_SCAN_MAX_RESULTS) continue;
     
-    if (_connectionAttempts > MAX_CONNECTION_ATTEMPTS) {
-      Serial.println("[WiFi] Max reconnection attempts reached. Switching to AP mode");
-      
-      startAPMode();
-      _currentMode = WIFI_MANAGER_MODE_FALLBACK;
-      return;
+    int last = min(_scanResultCount, WIFI_SCAN_MAX_RESULTS - 1);
+    for (int j = last; j > pos; j--) {
+      _scanResults[j] = _scanResults[j - 1];
     }
     
-    // Attempt to reconnect with clean WiFi state
-    WiFi.disconnect(true);
-    delay(100);
-    
-    char ssid[MAX_SSID_LENGTH] = {0};
-    char password[MAX_PASSWORD_LENGTH] = {0};
-    char deviceName[MAX_DEVICE_NAME_LENGTH] = {0};
+    WiFiNetwork& network = _scanResults[pos];
+    strncpy(network.ssid, WiFi.SSID(i).c_str(), MAX_SSID_LENGTH);
+    network.ssid[MAX_SSID_LENGTH] = '\0';
+    memcpy(network.bssid, WiFi.BSSID(i), sizeof(network.bssid));
+    network.rssi = rssi;
+    network.encType = WiFi.encryptionType(i);
     
-    if (loadWifiCredentials(ssid, password, deviceName) && strlen(ssid) > 0) {
-      // Reconnect
-      WiFi.begin(ssid, password);
+    if (_scanResultCount < WIFI_SCAN_MAX_RESULTS) _scanResultCount++;
+  }
+  
+  // Clean up scan results to free memory
+  WiFi.scanDelete();
+  
+  _scanCompletedTime = millis();
+  _scanValid = true;
+  
+  if (ENABLE_WIFI_LOGGING) {
+    Serial.printf("[WiFi] Scan found %d networks, kept %d\n", found, _scanResultCount);
+  }
+}
+
+const WiFiNetwork* WifiManager::getScanResults(int& count) {
+  count = _scanResultCount;
+  return _scanResults;
+}
+
+bool WifiManager::isScanning() {
+  return _scanRunning;
+}
+
+long WifiManager::getScanAgeMs() {
+  return _scanValid ? (long)(millis() - _scanCompletedTime) : -1;
+}
+
+void WifiManager::process() {
+  unsigned long start = micros();
+  
+  // Update LED status
+  updateLedStatus();
+  
+  serviceLink(millis());
+  
+  uint32_t elapsed = micros() - start;
+  if (elapsed > _processMaxUs) _processMaxUs = elapsed;
+  _processTotalUs += elapsed;
+  _processCalls++;
+}
+
+void WifiManager::serviceLink(unsigned long now) {
+  bool gotIp = staGotIpEvent;
+  bool lost = staDisconnectedEvent;
+  staGotIpEvent = false;
+  staDisconnectedEvent = false;
+  
+  switch (_linkState) {
+    case WIFI_LINK_IDLE:
+      break;
       
-      // Short wait for quick reconnection
-      unsigned long startTime = millis();
-      Serial.print("[WiFi] Reconnecting");
+    case WIFI_LINK_CONNECTING:
+      if (gotIp) {
+        Serial.printf("[WiFi] Reconnected: IP=%s\n", WiFi.localIP().toString().c_str());
+        _linkState = WIFI_LINK_CONNECTED;
+        _currentMode = WIFI_MANAGER_MODE_STA;
+        _failedAttempts = 0;
+        _reconnects++;
+      } else if (lost || now - _attemptStartTime > WIFI_CONNECTION_TIMEOUT) {
+        if (ENABLE_WIFI_LOGGING) Serial.println("[WiFi] Reconnect attempt failed");
+        scheduleRetry(now);
+      }
+      break;
       
-      while (WiFi.status() != WL_CONNECTED && 
-             (millis() - startTime < WIFI_CONNECTION_TIMEOUT / 2)) {
-        delay(500);
-        Serial.print(".");
+    case WIFI_LINK_CONNECTED:
+      if (lost) {
+        Serial.println("[WiFi] Connection lost");
+        _disconnects++;
+        _failedAttempts = 0;
+        scheduleRetry(now);
       }
+      break;
       
-      if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\n[WiFi] Reconnected successfully");
-        _connectionAttempts = 0;
-        _currentMode = WIFI_MANAGER_MODE_STA;
-      } else {
-        Serial.println("\n[WiFi] Reconnect failed");
+    case WIFI_LINK_BACKOFF:
+      // A scan holds the radio; connecting now would cut it short or fail
+      if (_scanRunning) break;
+      if ((long)(now - _nextAttemptTime) >= 0) {
+        startAttempt(now);
       }
-    }
+      break;
   }
 }
-std::vector<WiFiNetwork> WifiManager::scanNetworks() {
-  std::vector<WiFiNetwork> networks;
+
+void WifiManager::startAttempt(unsigned long now) {
+  if (ENABLE_WIFI_LOGGING) {
+    Serial.printf("[WiFi] Reconnecting to '%s' (attempt %u)\n", _ssid, (unsigned)_failedAttempts + 1);
+  }
   
-  Serial.println("[WiFi] Scanning for networks...");
+  // Only queues the connect; the outcome arrives as an event
+  staGotIpEvent = false;
+  staDisconnectedEvent = false;
+  WiFi.begin(_ssid, _password);
   
-  int numNetworks = WiFi.scanNetworks(false, true);  // Non-blocking, include hidden networks
+  _attemptStartTime = now;
+  _linkState = WIFI_LINK_CONNECTING;
+}
+
+void WifiManager::scheduleRetry(unsigned long now) {
+  _failedAttempts++;
+  
+  // Give clients a way in while the home network is away
+  if (_failedAttempts == MAX_CONNECTION_ATTEMPTS + 1 && _currentMode == WIFI_MANAGER_MODE_STA) {
+    Serial.println("[WiFi] Max reconnection attempts reached. Opening fallback AP");
+    startSoftAP();
+    _currentMode = WIFI_MANAGER_MODE_FALLBACK;
+  }
   
-  if (numNetworks > 0) {
-    Serial.printf("[WiFi] Found %d networks\n", numNetworks);
-    
-    // Sort networks by signal strength
-    for (int i = 0; i < numNetworks; i++) {
-      WiFiNetwork network;
-      network.ssid = WiFi.SSID(i);
-      network.rssi = WiFi.RSSI(i);
-      network.encType = WiFi.encryptionType(i);
-      
-      networks.push_back(network);
-    }
-    
-    // Sort by signal strength
-    std::sort(networks.begin(), networks.end(), 
-              [](const WiFiNetwork& a, const WiFiNetwork& b) {
-                return a.rssi > b.rssi;  // Stronger signal first
-              });
-  } else {
-    Serial.println("[WiFi] No networks found");
+  // Exponential backoff with +/-25% jitter, so devices sharing a router
+  // don't all retry in the same instant after it comes back
+  uint32_t backoff = WIFI_BACKOFF_MAX_MS;
+  if (_failedAttempts <= 16) {
+    backoff = min((uint32_t)WIFI_BACKOFF_MAX_MS, (uint32_t)WIFI_BACKOFF_BASE_MS << (_failedAttempts - 1));
   }
+  backoff = backoff * 3 / 4 + esp_random() % (backoff / 2 + 1);
   
-  // Clean up scan results to free memory
-  WiFi.scanDelete();
+  _nextAttemptTime = now + backoff;
+  _linkState = WIFI_LINK_BACKOFF;
   
-  return networks;
+  if (ENABLE_WIFI_LOGGING) {
+    Serial.printf("[WiFi] Next attempt in %u ms\n", (unsigned)backoff);
+  }
 }
-void WifiManager::process() {
-  unsigned long now = millis();
 
-  // Update LED status
-  updateLedStatus();
-
-  // Less frequent WiFi check to reduce processing overhead
-  if (_currentMode == WIFI_MANAGER_MODE_STA && (now - _lastWifiCheck > WIFI_CHECK_INTERVAL)) {
-    _lastWifiCheck = now;
-    checkWifiConnection();
-  }
+WifiLinkStats WifiManager::getLinkStats() {
+  WifiLinkStats stats;
+  stats.state = _linkState;
+  stats.failedAttempts = _failedAttempts;
+  stats.disconnects = _disconnects;
+  stats.reconnects = _reconnects;
+  stats.processMaxUs = _processMaxUs;
+  stats.processAvgUs = _processCalls ? (uint32_t)(_processTotalUs / _processCalls) : 0;
+  return stats;
 }
 
 void WifiManager::updateLedStatus() {
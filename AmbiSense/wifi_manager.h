@@ -3,7 +3,6 @@
 
 #include <stdexcept>  // For std::exception
 #include <Arduino.h>
-#include <vector>
 #include <WiFi.h>
 #include <ESPmDNS.h>
 
@@ -21,9 +20,31 @@ enum WifiManagerMode {
   WIFI_MANAGER_MODE_FALLBACK  // Fallback to AP mode when connection fails
 };
 
+// Station link state, advanced by WiFi events and process()
+enum WifiLinkState : uint8_t {
+  WIFI_LINK_IDLE,        // No saved network - AP only
+  WIFI_LINK_CONNECTING,  // WiFi.begin() issued, waiting for an IP
+  WIFI_LINK_CONNECTED,
+  WIFI_LINK_BACKOFF      // Waiting before the next attempt
+};
+
+// Reconnect and process() timing counters
+struct WifiLinkStats {
+  WifiLinkState state;
+  uint32_t failedAttempts;  // Consecutive attempts that didn't get an IP
+  uint32_t disconnects;     // Links lost since boot
+  uint32_t reconnects;      // Links re-established since boot
+  uint32_t processMaxUs;    // Slowest process() call
+  uint32_t processAvgUs;
+};
+
+#define WIFI_SCAN_MAX_RESULTS 20     // Strongest networks kept from a scan
+#define WIFI_SCAN_MAX_AGE_MS 30000   // Older results trigger a new background scan
+
 // Network information structure
 struct WiFiNetwork {
-  String ssid;
+  char ssid[MAX_SSID_LENGTH + 1];  // Empty for hidden networks
+  uint8_t bssid[6];
   int32_t rssi;
   uint8_t encType;
 };
@@ -67,29 +88,70 @@ public:
   // Get sanitized mDNS hostname
   String getSanitizedHostname(const char* deviceName);
 
-  // Process WiFi events and maintain connection
+  // Advance the reconnect state machine. Never blocks; call once per loop iteration.
   void process();
   
-  // Scan for available networks and return top results
-  std::vector<WiFiNetwork> scanNetworks();
+  // Get the link state and process() timing
+  WifiLinkStats getLinkStats();
+  
+  // Start a background scan if none is running and the results are missing or
+  // older than WIFI_SCAN_MAX_AGE_MS (or always, with force). Returns immediately.
+  void requestScan(bool force = false);
+  
+  // Collect a finished scan into the result table. Call from the task that
+  // reads the results, once per iteration.
+  void processScan();
+  
+  // Cached scan results, strongest first. Valid until the next processScan().
+  const WiFiNetwork* getScanResults(int& count);
+  
+  // Whether a background scan is running
+  bool isScanning();
+  
+  // Age of the cached results in ms, or -1 if no scan has completed yet
+  long getScanAgeMs();
+  
   
   // Update LED status indicator
   void updateLedStatus();
-  
-  // Check and handle WiFi connection status
-  void checkWifiConnection();
 
 private:
   WifiManagerMode _currentMode = WIFI_MANAGER_MODE_AP;
-  unsigned long _lastWifiCheck = 0;
-  int _connectionAttempts = 0;
   bool _mDNSStarted = false;
+  
+  // Reconnect state machine
+  WifiLinkState _linkState = WIFI_LINK_IDLE;
+  char _ssid[MAX_SSID_LENGTH] = {0};
+  char _password[MAX_PASSWORD_LENGTH] = {0};
+  unsigned long _attemptStartTime = 0;
+  unsigned long _nextAttemptTime = 0;
+  uint32_t _failedAttempts = 0;
+  uint32_t _disconnects = 0;
+  uint32_t _reconnects = 0;
+  uint32_t _processMaxUs = 0;
+  uint64_t _processTotalUs = 0;
+  uint32_t _processCalls = 0;
   unsigned long _lastLedUpdateTime = 0;
   int _ledBlinkPhase = 0;
   bool _ledState = HIGH;
   
+  // Scan result cache
+  WiFiNetwork _scanResults[WIFI_SCAN_MAX_RESULTS];
+  int _scanResultCount = 0;
+  unsigned long _scanCompletedTime = 0;
+  bool _scanValid = false;
+  volatile bool _scanRunning = false;  // Also read by the reconnect state machine
+  
   // Configure static IP if enabled
   void configureStaticIP();
+  
+  // Open the AP named after the chip ID; returns false if it didn't start
+  bool startSoftAP();
+  
+  // Reconnect state machine steps
+  void serviceLink(unsigned long now);
+  void startAttempt(unsigned long now);
+  void scheduleRetry(unsigned long now);
 };
 
 // Global instance
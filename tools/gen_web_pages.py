@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Precompose and gzip the AmbiSense web UI pages.
+
+The page sources live in AmbiSense/compressed_html_full.h. This script
+performs the same placeholder substitution the firmware used to do at
+request time (template + CSS + JS + tab content + tab scripts), gzips each
+finished page and writes them as PROGMEM byte arrays to
+AmbiSense/web_pages_gz.h. The web server streams those arrays straight from
+flash with Content-Encoding: gzip, so serving a page no longer touches the
+heap.
+
+Run it after editing compressed_html_full.h:
+
+    python3 tools/gen_web_pages.py            # regenerate web_pages_gz.h
+    python3 tools/gen_web_pages.py --bench    # also compare against the old path
+"""
+
+import argparse
+import gzip
+import os
+import re
+import sys
+import time
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "AmbiSense")
+SOURCE = os.path.join(ROOT, "compressed_html_full.h")
+OUTPUT = os.path.join(ROOT, "web_pages_gz.h")
+
+# (array name, tab content, active tab, tab scripts)
+PAGES = [
+    ("page_basic_gz", "basic_tab_full", "basic", "basic_tab_js"),
+    ("page_advanced_gz", "advanced_tab_full", "advanced", None),
+    ("page_effects_gz", "effects_tab_full", "effects", None),
+    ("page_mesh_gz", "mesh_tab_full", "mesh", "mesh_tab_js"),
+    ("page_network_gz", "network_tab_full", "network", "network_tab_js"),
+]
+
+TABS = ["basic", "advanced", "effects", "mesh", "network", "diagnostics"]
+
+LITERAL_RE = re.compile(
+    r'const char (\w+)\[\] PROGMEM = R"literal\((.*?)\)literal";', re.S)
+
+
+def load_sources():
+    with open(SOURCE, "r", encoding="utf-8", newline="") as f:
+        text = f.read()
+    # Raw literals keep the file's line endings; the compiler sees LF
+    return {name: body.replace("\r\n", "\n") for name, body in LITERAL_RE.findall(text)}
+
+
+def compose(src, tab_content, active_tab, tab_scripts):
+    # Mirrors the replace order of the former buildFullPage()
+    html = src["html_template_full"]
+    html = html.replace("%CSS%", src["full_css"])
+    html = html.replace("%JS%", src["full_js"])
+    for tab in TABS:
+        placeholder = "%" + tab.upper() + "_TAB_ACTIVE%"
+        html = html.replace(placeholder, "active" if tab == active_tab else "")
+    html = html.replace("%TAB_CONTENT%", src[tab_content])
+    html = html.replace("%TAB_SCRIPTS%", src[tab_scripts] if tab_scripts else "")
+    return html.encode("utf-8")
+
+
+def compress(data):
+    # mtime=0 keeps the output byte-identical between runs
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def emit_array(name, blob):
+    lines = ["const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(blob), 16):
+        chunk = ", ".join("0x%02x" % b for b in blob[i:i + 16])
+        lines.append("  " + chunk + ",")
+    lines.append("};")
+    lines.append("const size_t %s_len = %d;" % (name, len(blob)))
+    return "\n".join(lines)
+
+
+def legacy_request_cost(src, tab_content, active_tab, tab_scripts):
+    """
+    Models the heap traffic of the old per-request path: the template copy,
+    one reallocation per String::replace() that grows the buffer, and the
+    temporary String built for the tab scripts.
+    """
+    allocated = 0
+    html = src["html_template_full"]
+    allocated += len(html) + 1
+    steps = [("%CSS%", src["full_css"]), ("%JS%", src["full_js"])]
+    for tab in TABS:
+        steps.append(("%" + tab.upper() + "_TAB_ACTIVE%", "active" if tab == active_tab else ""))
+    steps.append(("%TAB_CONTENT%", src[tab_content]))
+    scripts = src[tab_scripts] if tab_scripts else ""
+    allocated += len(scripts) + 1
+    steps.append(("%TAB_SCRIPTS%", scripts))
+    for find, repl in steps:
+        grown = html.replace(find, repl)
+        if len(grown) > len(html):
+            allocated += len(grown) + 1
+        html = grown
+    return allocated, len(html)
+
+
+def bench(src, results, iterations):
+    print("%-10s %10s %12s %10s %10s %10s" %
+          ("page", "raw bytes", "legacy heap", "gz bytes", "legacy us", "gz heap"))
+    for name, tab_content, active_tab, tab_scripts in PAGES:
+        start = time.perf_counter()
+        for _ in range(iterations):
+            compose(src, tab_content, active_tab, tab_scripts)
+        per_request_us = (time.perf_counter() - start) * 1e6 / iterations
+        allocated, raw_len = legacy_request_cost(src, tab_content, active_tab, tab_scripts)
+        print("%-10s %10d %12d %10d %10.1f %10d" %
+              (active_tab, raw_len, allocated, len(results[name]), per_request_us, 0))
+    print("\nlegacy us is host-side composition time only; the ESP32 pays roughly"
+          "\nan order of magnitude more plus heap fragmentation. The gz path sends"
+          "\nthe flash-mapped array directly, so it allocates nothing per request.")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("--bench", action="store_true",
+                        help="print per-page size/heap/time comparison with the old path")
+    parser.add_argument("--iterations", type=int, default=200)
+    args = parser.parse_args()
+
+    src = load_sources()
+    results = {}
+    body = []
+    for name, tab_content, active_tab, tab_scripts in PAGES:
+        results[name] = compress(compose(src, tab_content, active_tab, tab_scripts))
+        route = "/" if active_tab == "basic" else "/" + active_tab
+        body.append("// GET %s\n" % route + emit_array(name, results[name]))
+
+    header = (
+        "#ifndef WEB_PAGES_GZ_H\n"
+        "#define WEB_PAGES_GZ_H\n"
+        "\n"
+        "#include <pgmspace.h>\n"
+        "\n"
+        "// GENERATED by tools/gen_web_pages.py from compressed_html_full.h - do not edit.\n"
+        "// Each array is a fully composed page, gzip-compressed, served as-is.\n"
+        "\n" + "\n\n".join(body) + "\n\n"
+        "#endif // WEB_PAGES_GZ_H\n"
+    )
+    with open(OUTPUT, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write(header)
+
+    total = sum(len(v) for v in results.values())
+    print("wrote %s (%d pages, %d bytes gzip)" % (os.path.relpath(OUTPUT), len(results), total))
+    if args.bench:
+        print()
+        bench(src, results, args.iterations)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
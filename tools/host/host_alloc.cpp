@@ -0,0 +1,60 @@
+// Counts every heap allocation in the process by wrapping glibc's malloc
+// family (operator new goes through malloc). This is the host side of the
+// telemetry allocation accounting: leaks and per-call allocations show up
+// as counter deltas in the tests.
+#include <malloc.h>
+#include <stdint.h>
+#include <string.h>
+#include "host_platform.h"
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+static HostAllocStats allocStats;
+
+static void countAlloc(void* ptr) {
+  if (!ptr) return;
+  allocStats.allocs++;
+  allocStats.liveBytes += malloc_usable_size(ptr);
+}
+
+static void countFree(void* ptr) {
+  if (!ptr) return;
+  allocStats.frees++;
+  allocStats.liveBytes -= malloc_usable_size(ptr);
+}
+
+extern "C" void* malloc(size_t size) {
+  void* ptr = __libc_malloc(size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+  void* ptr = __libc_calloc(count, size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+  void* moved = __libc_realloc(ptr, size);
+  if (!moved && size) return nullptr;  // The old block is still there
+  if (ptr) {
+    allocStats.frees++;
+    allocStats.liveBytes -= oldSize;
+  }
+  countAlloc(moved);
+  return moved;
+}
+
+extern "C" void free(void* ptr) {
+  countFree(ptr);
+  __libc_free(ptr);
+}
+
+void hostGetAllocStats(HostAllocStats* stats) { *stats = allocStats; }
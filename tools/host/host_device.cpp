@@ -0,0 +1,132 @@
+// The parts of AmbiSense.ino a host build needs: its globals and the order in
+// which setup() and loop() drive the sketch modules.
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "host_device.h"
+#include "host_platform.h"
+#include "eeprom_manager.h"
+#include "settings_schema.h"
+#include "telemetry.h"
+
+uint8_t deviceRole = DEFAULT_DEVICE_ROLE;
+uint8_t masterAddress[6] = {0};
+uint8_t slaveAddresses[MAX_SLAVE_DEVICES][6] = {0};
+uint8_t numSlaveDevices = 0;
+
+int ledSegmentMode = DEFAULT_LED_SEGMENT_MODE;
+int ledSegmentStart = DEFAULT_LED_SEGMENT_START;
+int ledSegmentLength = DEFAULT_LED_SEGMENT_LENGTH;
+int totalSystemLeds = DEFAULT_TOTAL_SYSTEM_LEDS;
+bool ledSegmentReversed = false;
+
+unsigned long bootLedsReadyMs = 0;
+unsigned long bootFirstLightMs = 0;
+unsigned long bootNetworkReadyMs = 0;
+volatile bool networkReady = false;
+
+// Each device has its own emulated EEPROM
+EEPROMClass EEPROM;
+
+void hostEepromFill(uint8_t value) { memset(EEPROM.getDataPtr(), value, EEPROM_HOST_SIZE); }
+
+static unsigned long previousMillis = 0;
+
+void hostDeviceSetup(const HostDeviceSetup& setup) {
+  telemetryBegin();
+  EEPROM.begin(EEPROM_SIZE);
+  setupEEPROM();
+
+  deviceRole = setup.role;
+  memcpy(masterAddress, setup.masterAddress, 6);
+  numSlaveDevices = constrain(setup.numSlaves, 0, MAX_SLAVE_DEVICES);
+  memcpy(slaveAddresses, setup.slaveAddresses, sizeof(slaveAddresses));
+  sensorPriorityMode = setup.priorityMode;
+  numLeds = setup.numLeds;
+  minDistance = setup.minDistance;
+  maxDistance = setup.maxDistance;
+  ledSegmentMode = setup.segmentMode;
+  if (setup.segmentMap.count > 0) {
+    ledSegmentMap = setup.segmentMap;
+  }
+
+  const SceneSettings& scene = setup.scene;
+  lightMode = scene.lightMode;
+  brightness = scene.brightness;
+  redValue = scene.redValue;
+  greenValue = scene.greenValue;
+  blueValue = scene.blueValue;
+  backgroundMode = scene.backgroundMode;
+  directionLightEnabled = scene.directionLightEnabled;
+  movingLightSpan = scene.movingLightSpan;
+  trailLength = scene.trailLength;
+  effectSpeed = scene.effectSpeed;
+  effectIntensity = scene.effectIntensity;
+  colorPalette = scene.colorPalette;
+  backgroundLayer = scene.backgroundLayer;
+  transitionMs = scene.transitionMs;
+  saveSettings();
+  publishSettingsSnapshot();
+
+  setupLEDs();
+  updateLEDConfig();
+  bootLedsReadyMs = millis();
+
+  // On the device this runs on the network init task while loop() renders
+  setupESPNOW();
+  bootNetworkReadyMs = millis();
+  networkReady = true;
+}
+
+void hostDeviceLoop() {
+  processSettingsSave();
+  processPendingSensorData();
+  processPendingSceneState();
+  if (networkReady) {
+    espnowMaintenance();
+  }
+
+  unsigned long currentMillis = millis();
+  if (currentMillis - previousMillis >= ANIMATION_INTERVAL_MS) {
+    previousMillis = currentMillis;
+    if (isSceneAnimated() && !isFollowingMasterScene()) {
+      updateLEDs(currentDistance);
+    }
+  }
+
+  refreshLEDOutput();
+
+  if (bootFirstLightMs == 0 && getRenderFrame() > 0) {
+    bootFirstLightMs = millis();
+  }
+}
+
+void hostDeviceRadar(int distance, int8_t direction, uint8_t energy) {
+  currentDistance = distance;
+  if (deviceRole == DEVICE_ROLE_SLAVE) {
+    sendSensorData(currentDistance, direction, energy);
+  } else if (numSlaveDevices > 0) {
+    updateLocalSensorReading(currentDistance, direction, energy);
+  } else if (!isSceneAnimated()) {
+    updateLEDs(currentDistance);
+  }
+}
+
+static const uint8_t* stripPixels(int* count) {
+  *count = strip.numPixels();
+  return strip.getPixels();
+}
+
+static const HostDeviceApi deviceApi = {
+  hostDeviceSetup,
+  hostDeviceLoop,
+  hostDeviceRadar,
+  stripPixels,
+  getESPNOWStats,
+  getSensorHealth,
+  getSensorPacketsLost,
+  getSelectedSensor,
+  getRenderFrame,
+  isFollowingMasterScene,
+};
+
+extern "C" const HostDeviceApi* hostDeviceApi() { return &deviceApi; }
@@ -0,0 +1,79 @@
+// One AmbiSense device built from the sketch modules: the globals that
+// AmbiSense.ino defines, and its setup() and loop() without the web server,
+// WiFi manager, button and radar UART. Tests link it directly; the network
+// simulator loads one copy per device (see netsim.cpp) through
+// hostDeviceApi(), so every device has its own settings and state.
+#ifndef HOST_DEVICE_H
+#define HOST_DEVICE_H
+
+#include "config.h"
+#include "espnow_manager.h"
+#include "led_controller.h"
+
+// Settings the device is configured with before its first boot completes,
+// as if set up through the web interface
+struct HostDeviceSetup {
+  uint8_t role;
+  uint8_t masterAddress[6];
+  int numSlaves;
+  uint8_t slaveAddresses[MAX_SLAVE_DEVICES][6];
+  uint8_t priorityMode;
+  int numLeds;
+  int minDistance;
+  int maxDistance;
+  int segmentMode;
+  segment_map_t segmentMap;  // Master only; count 0 = no map
+  SceneSettings scene;
+};
+
+inline HostDeviceSetup hostDeviceDefaults() {
+  HostDeviceSetup setup = {};
+  setup.role = DEFAULT_DEVICE_ROLE;
+  setup.priorityMode = DEFAULT_SENSOR_PRIORITY_MODE;
+  setup.numLeds = DEFAULT_NUM_LEDS;
+  setup.minDistance = DEFAULT_MIN_DISTANCE;
+  setup.maxDistance = DEFAULT_MAX_DISTANCE;
+  setup.segmentMode = DEFAULT_LED_SEGMENT_MODE;
+  setup.segmentMap.packetType = ESPNOW_PACKET_SEGMENT_MAP;
+  setup.scene = {DEFAULT_LIGHT_MODE, DEFAULT_BRIGHTNESS, DEFAULT_RED, DEFAULT_GREEN,
+                 DEFAULT_BLUE, DEFAULT_BACKGROUND_MODE, DEFAULT_DIRECTION_LIGHT,
+                 DEFAULT_MOVING_LIGHT_SPAN, DEFAULT_TRAIL_LENGTH, DEFAULT_EFFECT_SPEED,
+                 DEFAULT_EFFECT_INTENSITY, DEFAULT_PALETTE, DEFAULT_BACKGROUND_LAYER,
+                 DEFAULT_TRANSITION_MS};
+  return setup;
+}
+
+/**
+ * setup(): load settings (first boot: defaults), apply and save the given
+ * ones, then bring up the strip and ESP-NOW
+ */
+void hostDeviceSetup(const HostDeviceSetup& setup);
+
+/**
+ * One pass of loop()
+ */
+void hostDeviceLoop();
+
+/**
+ * A radar reading, handled by role as processRadarReading() does
+ * (motion smoothing left out)
+ */
+void hostDeviceRadar(int distance, int8_t direction, uint8_t energy);
+
+// Entry points of one device, for the simulator's per-device copies
+struct HostDeviceApi {
+  void (*setup)(const HostDeviceSetup& setup);
+  void (*loop)();
+  void (*radar)(int distance, int8_t direction, uint8_t energy);
+  const uint8_t* (*pixels)(int* count);  // Strip buffer, GRB
+  void (*espnowStats)(espnow_stats_t* stats);
+  bool (*sensorHealthy)(uint8_t sensorId);
+  uint32_t (*sensorPacketsLost)(uint8_t sensorId);
+  int (*selectedSensor)();
+  uint32_t (*renderFrame)();
+  bool (*followingMasterScene)();
+};
+
+extern "C" const HostDeviceApi* hostDeviceApi();
+
+#endif // HOST_DEVICE_H
@@ -0,0 +1,438 @@
+// Implementations of the host stand-ins declared in stubs/ and the controls
+// in host_platform.h.
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <EEPROM.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <esp_now.h>
+#include "host_platform.h"
+
+// ---- Devices ------------------------------------------------------------------
+
+struct HostDevice {
+  uint8_t mac[6];
+  bool espnowInit;
+  esp_now_send_cb_t sendCallback;
+  esp_now_recv_cb_t recvCallback;
+  std::set<std::vector<uint8_t>> peers;
+  uint32_t showCount;
+  std::map<std::string, std::vector<uint8_t>> nvs;
+  HostNvsStats nvsStats;
+  int nvsWritesToFail;
+  uint32_t eepromCommits;
+};
+
+static HostDevice devices[HOST_MAX_DEVICES];
+static HostDevice* device = &devices[0];
+
+void hostSelectDevice(int id) {
+  if (id >= 0 && id < HOST_MAX_DEVICES) device = &devices[id];
+}
+
+int hostCurrentDevice() { return device - devices; }
+
+// Default MACs: 24:6F:28:00:00:01 for device 0, and so on
+void hostResetDevices() {
+  for (int i = 0; i < HOST_MAX_DEVICES; i++) {
+    devices[i] = HostDevice();
+    const uint8_t mac[6] = {0x24, 0x6F, 0x28, 0x00, 0x00, (uint8_t)(i + 1)};
+    memcpy(devices[i].mac, mac, 6);
+  }
+  device = &devices[0];
+}
+
+static bool devicesReady = (hostResetDevices(), true);
+
+void hostRestartDevice() {
+  device->espnowInit = false;
+  device->sendCallback = nullptr;
+  device->recvCallback = nullptr;
+  device->peers.clear();
+  device->showCount = 0;
+}
+
+// ---- Time -------------------------------------------------------------------
+
+static uint64_t clockUs = 0;
+
+void hostSetMicros(uint64_t us) { clockUs = us; }
+void hostAdvanceMicros(uint64_t us) { clockUs += us; }
+void hostAdvanceMillis(uint64_t ms) { clockUs += ms * 1000; }
+
+unsigned long millis() { return (unsigned long)(clockUs / 1000); }
+unsigned long micros() { return (unsigned long)clockUs; }
+void delay(unsigned long ms) { clockUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { clockUs += us; }
+
+// Real time, so the profiler's cycle counts measure the host CPU
+uint32_t getCpuFrequencyMhz() { return 240; }
+
+uint32_t EspClass::getCycleCount() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+  return (uint32_t)(ns * getCpuFrequencyMhz() / 1000);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ---- Randomness (deterministic, so every run is the same) -------------------
+
+static uint32_t rngState = 0x9E3779B9;
+
+uint32_t esp_random() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+long random(long howBig) { return howBig > 0 ? esp_random() % howBig : 0; }
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+void randomSeed(unsigned long seed) { rngState = seed ? seed : 1; }
+
+// ---- Serial -------------------------------------------------------------------
+
+HardwareSerial Serial;
+static bool serialEcho = getenv("AMBISENSE_HOST_VERBOSE") != nullptr;
+
+void hostSetSerialEcho(bool echo) { serialEcho = echo; }
+
+size_t Print::print(const char* text) {
+  if (serialEcho) fputs(text, stdout);
+  return strlen(text);
+}
+
+size_t Print::print(int value) { return printf("%d", value); }
+size_t Print::println() { return print("\n"); }
+size_t Print::println(const char* text) { return print(text) + println(); }
+size_t Print::println(int value) { return print(value) + println(); }
+
+size_t Print::printf(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int length = serialEcho ? vprintf(format, args) : vsnprintf(nullptr, 0, format, args);
+  va_end(args);
+  return length > 0 ? length : 0;
+}
+
+// ---- Chip ---------------------------------------------------------------------
+
+EspClass ESP;
+
+#define HOST_HEAP_SIZE (320 * 1024)
+
+static size_t hostFreeHeap() {
+  HostAllocStats stats;
+  hostGetAllocStats(&stats);
+  int64_t free = HOST_HEAP_SIZE - stats.liveBytes;
+  return free > 0 ? free : 0;
+}
+
+static size_t minFreeHeap = HOST_HEAP_SIZE;
+
+static size_t sampleFreeHeap() {
+  size_t free = hostFreeHeap();
+  minFreeHeap = min(minFreeHeap, free);
+  return free;
+}
+
+uint32_t EspClass::getFreeHeap() { return sampleFreeHeap(); }
+uint32_t EspClass::getMinFreeHeap() { sampleFreeHeap(); return minFreeHeap; }
+uint32_t EspClass::getHeapSize() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getMaxAllocHeap() { return sampleFreeHeap(); }
+
+size_t heap_caps_get_free_size(uint32_t) { return sampleFreeHeap(); }
+size_t heap_caps_get_largest_free_block(uint32_t) { return sampleFreeHeap(); }
+size_t heap_caps_get_minimum_free_size(uint32_t) { sampleFreeHeap(); return minFreeHeap; }
+int heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t) { return 0; }
+
+static int hostTask;
+TaskHandle_t xTaskGetCurrentTaskHandle() { return &hostTask; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 4096; }
+
+// ---- WiFi ---------------------------------------------------------------------
+
+WiFiClass WiFi;
+
+void hostSetMac(const uint8_t* mac) { memcpy(device->mac, mac, 6); }
+
+uint64_t EspClass::getEfuseMac() {
+  uint64_t mac = 0;
+  for (int i = 5; i >= 0; i--) mac = (mac << 8) | device->mac[i];
+  return mac;
+}
+
+uint8_t* WiFiClass::macAddress(uint8_t* mac) {
+  memcpy(mac, device->mac, 6);
+  return mac;
+}
+
+String WiFiClass::macAddress() {
+  char text[18];
+  const uint8_t* mac = device->mac;
+  snprintf(text, sizeof(text), "%02X:%02X:%02X:%02X:%02X:%02X",
+           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  return String(text);
+}
+
+uint8_t* WiFiClass::softAPmacAddress(uint8_t* mac) {
+  memcpy(mac, device->mac, 6);
+  mac[5]++;
+  return mac;
+}
+
+// ---- ESP-NOW ------------------------------------------------------------------
+
+static HostEspNowTransport transport = nullptr;
+
+static std::vector<uint8_t> macKey(const uint8_t* mac) {
+  return std::vector<uint8_t>(mac, mac + ESP_NOW_ETH_ALEN);
+}
+
+esp_err_t esp_now_init() {
+  device->espnowInit = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_deinit() {
+  device->espnowInit = false;
+  device->peers.clear();
+  device->sendCallback = nullptr;
+  device->recvCallback = nullptr;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_register_send_cb(esp_now_send_cb_t cb) {
+  device->sendCallback = cb;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+  device->recvCallback = cb;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+  if (!device->espnowInit) return ESP_ERR_ESPNOW_NOT_INIT;
+  if (device->peers.size() >= ESP_NOW_MAX_TOTAL_PEER_NUM) return ESP_ERR_ESPNOW_FULL;
+  device->peers.insert(macKey(peer->peer_addr));
+  return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t* mac) {
+  return device->peers.erase(macKey(mac)) ? ESP_OK : ESP_ERR_ESPNOW_NOT_FOUND;
+}
+
+esp_err_t esp_now_send(const uint8_t* mac, const uint8_t* data, size_t len) {
+  if (!device->espnowInit) return ESP_ERR_ESPNOW_NOT_INIT;
+  if (len > ESP_NOW_MAX_DATA_LEN || !device->peers.count(macKey(mac))) return ESP_ERR_ESPNOW_NOT_FOUND;
+  // The transport may select another device; this send belongs to the caller
+  HostDevice* sender = device;
+  if (transport) transport(sender->mac, mac, data, len);
+  device = sender;
+  if (sender->sendCallback) sender->sendCallback(mac, ESP_NOW_SEND_SUCCESS);
+  return ESP_OK;
+}
+
+void hostSetEspNowTransport(HostEspNowTransport t) { transport = t; }
+
+bool hostDeliverEspNow(const uint8_t* src, const uint8_t* data, int len, int rssi) {
+  if (!device->espnowInit || !device->recvCallback) return false;
+  uint8_t srcAddr[6];
+  uint8_t destAddr[6];
+  memcpy(srcAddr, src, 6);
+  memcpy(destAddr, device->mac, 6);
+  wifi_pkt_rx_ctrl_t rxCtrl = {rssi};
+  esp_now_recv_info_t info = {srcAddr, destAddr, &rxCtrl};
+  device->recvCallback(&info, data, len);
+  return true;
+}
+
+int hostEspNowPeerCount() { return device->peers.size(); }
+
+// ---- NeoPixel -----------------------------------------------------------------
+
+uint32_t hostShowCount() { return device->showCount; }
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t, uint16_t)
+    : count(n), pixels((uint8_t*)calloc(n ? n * 3 : 1, 1)), brightness(0) {}
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(const Adafruit_NeoPixel& other)
+    : count(other.count), pixels((uint8_t*)malloc(other.count ? other.count * 3 : 1)),
+      brightness(other.brightness) {
+  memcpy(pixels, other.pixels, count * 3);
+}
+
+Adafruit_NeoPixel& Adafruit_NeoPixel::operator=(const Adafruit_NeoPixel& other) {
+  if (this != &other) {
+    free(pixels);
+    count = other.count;
+    pixels = (uint8_t*)malloc(count ? count * 3 : 1);
+    memcpy(pixels, other.pixels, count * 3);
+    brightness = other.brightness;
+  }
+  return *this;
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() { free(pixels); }
+
+void Adafruit_NeoPixel::show() { device->showCount++; }
+void Adafruit_NeoPixel::clear() { memset(pixels, 0, count * 3); }
+
+void Adafruit_NeoPixel::setBrightness(uint8_t value) {
+  // As the library does: rescale what is already in the buffer
+  uint8_t newBrightness = value + 1;
+  if (newBrightness == brightness) return;
+  uint8_t oldBrightness = brightness - 1;
+  uint16_t scale;
+  if (oldBrightness == 0) {
+    scale = 0;
+  } else if (value == 255) {
+    scale = 65535 / oldBrightness;
+  } else {
+    scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+  }
+  for (int i = 0; i < count * 3; i++) {
+    pixels[i] = (pixels[i] * scale) >> 8;
+  }
+  brightness = newBrightness;
+}
+
+uint8_t Adafruit_NeoPixel::getBrightness() const { return brightness - 1; }
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  if (n >= count) return;
+  if (brightness) {
+    r = (r * brightness) >> 8;
+    g = (g * brightness) >> 8;
+    b = (b * brightness) >> 8;
+  }
+  uint8_t* p = pixels + n * 3;
+  p[0] = g;
+  p[1] = r;
+  p[2] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t color) {
+  setPixelColor(n, (uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color);
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+  if (n >= count) return 0;
+  const uint8_t* p = pixels + n * 3;
+  return Color(p[1], p[0], p[2]);
+}
+
+// ---- NVS ----------------------------------------------------------------------
+
+#define HOST_NVS_ENTRIES 504  // Three 4 KB pages of 32-byte entries, as the default partition
+
+static std::string nvsKey(const char* space, const char* key) {
+  return std::string(space) + "/" + key;
+}
+
+void hostNvsReset() {
+  device->nvs.clear();
+  device->nvsStats = HostNvsStats();
+  device->nvsWritesToFail = 0;
+}
+
+void hostNvsFailWrites(int count) { device->nvsWritesToFail = count; }
+
+bool hostNvsCorrupt(const char* key, size_t offset, uint8_t mask) {
+  for (auto& item : device->nvs) {
+    size_t slash = item.first.find('/');
+    if (item.first.compare(slash + 1, std::string::npos, key) == 0 && offset < item.second.size()) {
+      item.second[offset] ^= mask;
+      return true;
+    }
+  }
+  return false;
+}
+
+void hostNvsGetStats(HostNvsStats* stats) { *stats = device->nvsStats; }
+
+bool Preferences::begin(const char* name, bool) {
+  space = name;
+  return true;
+}
+
+bool Preferences::isKey(const char* key) { return device->nvs.count(nvsKey(space, key)) != 0; }
+bool Preferences::remove(const char* key) { return device->nvs.erase(nvsKey(space, key)) != 0; }
+
+bool Preferences::clear() {
+  auto& nvs = device->nvs;
+  std::string prefix = nvsKey(space, "");
+  for (auto it = nvs.begin(); it != nvs.end();) {
+    it = it->first.compare(0, prefix.size(), prefix) == 0 ? nvs.erase(it) : std::next(it);
+  }
+  return true;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  auto it = device->nvs.find(nvsKey(space, key));
+  return it == device->nvs.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t length) {
+  auto it = device->nvs.find(nvsKey(space, key));
+  if (it == device->nvs.end() || length < it->second.size()) return 0;
+  memcpy(buffer, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* data, size_t length) {
+  // A write cut short leaves the previous entry in place
+  if (device->nvsWritesToFail > 0) {
+    device->nvsWritesToFail--;
+    device->nvsStats.failedWrites++;
+    return 0;
+  }
+  const uint8_t* bytes = (const uint8_t*)data;
+  device->nvs[nvsKey(space, key)].assign(bytes, bytes + length);
+  device->nvsStats.writes++;
+  return length;
+}
+
+size_t Preferences::freeEntries() {
+  size_t used = 0;
+  for (auto& item : device->nvs) used += 1 + (item.second.size() + 31) / 32;
+  return used < HOST_NVS_ENTRIES ? HOST_NVS_ENTRIES - used : 0;
+}
+
+// ---- EEPROM -------------------------------------------------------------------
+
+// The EEPROM object itself is part of each device (host_device.cpp)
+
+bool EEPROMClass::begin(size_t requested) {
+  if (requested > sizeof(data)) return false;
+  size = requested;
+  return true;
+}
+
+uint8_t EEPROMClass::read(int address) {
+  return (address >= 0 && (size_t)address < size) ? data[address] : 0xFF;
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+  if (address >= 0 && (size_t)address < size) data[address] = value;
+}
+
+bool EEPROMClass::commit() {
+  device->eepromCommits++;
+  return true;
+}
+
+uint32_t hostEepromCommits() { return device->eepromCommits; }
@@ -0,0 +1,66 @@
+// Controls for the host stand-ins in stubs/: the virtual clock, the device
+// identity, the ESP-NOW transport and the flash models. Tests and the
+// simulator use these; the sketch modules only see the Arduino-side API.
+//
+// Radio, strip counters and flash belong to the selected device, so the
+// simulator can run several copies of the firmware in one process (see
+// netsim.cpp). The clock is shared by all of them.
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Virtual clock behind millis()/micros(). delay() advances it too.
+void hostSetMicros(uint64_t us);
+void hostAdvanceMicros(uint64_t us);
+void hostAdvanceMillis(uint64_t ms);
+
+// Device whose radio, strip counters and flash the stand-ins use from now on
+#define HOST_MAX_DEVICES 64
+void hostSelectDevice(int device);
+int hostCurrentDevice();
+void hostResetDevices();  // Radios, counters and flash back to power-on state
+void hostRestartDevice();  // The selected device reboots: radio and counters cleared, flash kept
+
+// Station MAC of this device (the softAP MAC is one higher, as on the ESP32)
+void hostSetMac(const uint8_t* mac);
+
+// Serial output goes to stdout only when echo is on (AMBISENSE_HOST_VERBOSE=1)
+void hostSetSerialEcho(bool echo);
+
+// ESP-NOW: packets sent by any device go to the transport (src is the
+// sender's station MAC); a transport delivers a packet to the selected
+// device with hostDeliverEspNow()
+typedef void (*HostEspNowTransport)(const uint8_t* src, const uint8_t* dest,
+                                    const uint8_t* data, size_t len);
+void hostSetEspNowTransport(HostEspNowTransport transport);
+bool hostDeliverEspNow(const uint8_t* src, const uint8_t* data, int len, int rssi = -50);
+int hostEspNowPeerCount();
+
+// Number of strip.show() calls so far
+uint32_t hostShowCount();
+
+// NVS model behind Preferences
+struct HostNvsStats {
+  uint32_t writes;        // putBytes() calls that landed
+  uint32_t failedWrites;  // putBytes() calls cut short by an injected power loss
+};
+void hostNvsReset();
+void hostNvsFailWrites(int count);  // The next count writes are lost
+bool hostNvsCorrupt(const char* key, size_t offset, uint8_t mask);
+void hostNvsGetStats(HostNvsStats* stats);
+
+// EEPROM model
+void hostEepromFill(uint8_t value);
+uint32_t hostEepromCommits();
+
+// Heap accounting from host_alloc.cpp (every malloc/new in the process)
+struct HostAllocStats {
+  uint64_t allocs;
+  uint64_t frees;
+  int64_t liveBytes;
+};
+void hostGetAllocStats(HostAllocStats* stats);
+
+#endif // HOST_PLATFORM_H
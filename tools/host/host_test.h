@@ -0,0 +1,57 @@
+// A minimal test harness for host_tests: TEST() registers a test, CHECK()
+// and CHECK_EQ() record failures and carry on. Tests run in order on
+// one device (hostSelectDevice(0)); each test resets what it relies on.
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <type_traits>
+
+struct HostTest {
+  const char* name;
+  void (*run)();
+  HostTest* next;
+
+  HostTest(const char* name, void (*run)());
+};
+
+bool hostCheck(bool ok, const char* expression, const char* file, int line);
+
+// Runs hostDeviceSetup() with the default settings on device 0, once per
+// process; later calls do nothing. For tests that need the strip and scene.
+void hostBootTestDevice();
+
+#define TEST(name)                                       \
+  static void test_##name();                             \
+  static HostTest testEntry_##name(#name, test_##name);  \
+  static void test_##name()
+
+#define CHECK(condition) hostCheck((condition), #condition, __FILE__, __LINE__)
+
+// Integers and enums only, compared as long long so signedness does not
+// matter; floats go through CHECK() with a tolerance
+#define CHECK_EQ(actual, expected)                                                      \
+  do {                                                                                  \
+    static_assert(!std::is_floating_point<decltype(actual)>::value &&                   \
+                  !std::is_floating_point<decltype(expected)>::value,                   \
+                  "CHECK_EQ compares integers");                                        \
+    long long actualValue = (long long)(actual);                                        \
+    long long expectedValue = (long long)(expected);                                    \
+    if (!hostCheck(actualValue == expectedValue, #actual " == " #expected, __FILE__, __LINE__)) { \
+      printf("    got %lld, expected %lld\n", actualValue, expectedValue);                \
+    }                                                                                   \
+  } while (0)
+
+#define CHECK_STR(actual, expected)                                                     \
+  do {                                                                                  \
+    const char* actualText = (actual);                                                  \
+    const char* expectedText = (expected);                                              \
+    if (!hostCheck(strcmp(actualText, expectedText) == 0, #actual " == " #expected, __FILE__, __LINE__)) { \
+      printf("    got      %s\n    expected %s\n", actualText, expectedText);           \
+    }                                                                                   \
+  } while (0)
+
+// Benchmarks print one line each, prefixed so they are easy to pick out
+#define BENCH(...) printf("  bench: " __VA_ARGS__)
+
+#endif // HOST_TEST_H
@@ -0,0 +1,58 @@
+// Runs the tests registered with TEST() in the test_*.cpp files.
+//
+//   host_tests            run all tests
+//   host_tests <text>     run the tests whose name contains <text>
+//
+// Exits with 1 if a check fails.
+#include <string.h>
+#include <Arduino.h>
+#include "host_test.h"
+#include "host_device.h"
+#include "host_platform.h"
+
+static HostTest* firstTest = nullptr;
+static HostTest** lastTest = &firstTest;
+static int failedChecks = 0;
+
+// Tests run in registration order: by file in link order, then as written
+HostTest::HostTest(const char* name, void (*run)()) : name(name), run(run), next(nullptr) {
+  *lastTest = this;
+  lastTest = &next;
+}
+
+bool hostCheck(bool ok, const char* expression, const char* file, int line) {
+  if (!ok) {
+    printf("  FAIL %s:%d: %s\n", file, line, expression);
+    failedChecks++;
+  }
+  return ok;
+}
+
+void hostBootTestDevice() {
+  static bool booted = false;
+  if (booted) return;
+  booted = true;
+
+  hostSelectDevice(0);
+  hostDeviceSetup(hostDeviceDefaults());
+}
+
+int main(int argc, char** argv) {
+  const char* filter = argc > 1 ? argv[1] : "";
+  int tests = 0;
+  int failedTests = 0;
+
+  for (HostTest* test = firstTest; test; test = test->next) {
+    if (!strstr(test->name, filter)) continue;
+    hostSelectDevice(0);
+    int failedBefore = failedChecks;
+    test->run();
+    tests++;
+    bool ok = failedChecks == failedBefore;
+    if (!ok) failedTests++;
+    printf("%s %s\n", ok ? "ok  " : "FAIL", test->name);
+  }
+
+  printf("host_tests: %d of %d tests passed\n", tests - failedTests, tests);
+  return failedTests ? 1 : 0;
+}
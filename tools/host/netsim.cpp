@@ -0,0 +1,755 @@
+// ESP-NOW network simulator. Every device is a separate copy of the firmware
+// (libambisense_device.so, loaded once per device so each has its own
+// globals) running the sketch's loop() order on a shared virtual clock. The
+// devices talk through an in-process transport that adds latency and can
+// drop, duplicate and reorder packets.
+//
+//   netsim            run every scenario
+//   netsim scale      a master with 5, 20 and 50 slaves, over a clean and a lossy link
+//   netsim segments   one 1500-LED strip against three 500-LED devices in distributed mode
+//   netsim reboot     a slave restarts and the packets that announce it are lost
+//
+// Times in the report are virtual (what the devices would see) except the
+// CPU columns, which are host time spent in the master's code.
+// Exits with 1 if a check fails.
+#include <dlfcn.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+#include <Arduino.h>
+#include "host_device.h"
+#include "host_platform.h"
+
+#define SIM_TICK_MS 1             // One loop() pass per device per tick
+#define SIM_RADAR_INTERVAL_MS 50  // LD2410 report rate
+#define SIM_LEDS_PER_DEVICE 60
+#define SIM_WARMUP_MS 2000        // Boot traffic settles on a clean link first
+#define SIM_SECTION_MS 2000       // Time the walker spends in each device's section
+#define SIM_SETTLE_MS 500         // Handover time not held against zone selection
+#define SIM_REORDER_DELAY_US 80000  // Held back past the sender's next reading
+#define SIM_NEIGHBOUR_DISTANCE 123  // Someone on the neighbours' stairs
+
+static std::string deviceLibrary;
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  if (!ok) {
+    printf("  FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+// ---- Devices --------------------------------------------------------------------
+
+struct Device {
+  void* handle;
+  const HostDeviceApi* api;
+  uint8_t mac[6];
+};
+
+static std::vector<Device> devices;
+
+// dlopen() returns the already loaded copy for a file it has seen, so every
+// device gets its own copy of the library file
+static const HostDeviceApi* loadDevice(int id, void** handle) {
+  char path[96];
+  snprintf(path, sizeof(path), "/tmp/ambisense_device_%d_%d.so", (int)getpid(), id);
+  {
+    std::ifstream in(deviceLibrary, std::ios::binary);
+    std::ofstream out(path, std::ios::binary);
+    out << in.rdbuf();
+    if (!in || !out) {
+      fprintf(stderr, "netsim: cannot copy %s to %s\n", deviceLibrary.c_str(), path);
+      exit(2);
+    }
+  }
+  *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  unlink(path);
+  if (!*handle) {
+    fprintf(stderr, "netsim: %s\n", dlerror());
+    exit(2);
+  }
+  auto entry = (const HostDeviceApi* (*)())dlsym(*handle, "hostDeviceApi");
+  if (!entry) {
+    fprintf(stderr, "netsim: hostDeviceApi missing from %s\n", deviceLibrary.c_str());
+    exit(2);
+  }
+  return entry();
+}
+
+static void createDevices(int count) {
+  hostResetDevices();
+  hostSetMicros(100 * 1000);  // setup() starts a little after power-up
+  for (int i = 0; i < count; i++) {
+    Device device;
+    device.api = loadDevice(i, &device.handle);
+    const uint8_t mac[6] = {0x24, 0x6F, 0x28, 0x10, 0x00, (uint8_t)(2 * i + 2)};
+    memcpy(device.mac, mac, 6);
+    hostSelectDevice(i);
+    hostSetMac(device.mac);
+    devices.push_back(device);
+  }
+}
+
+static void destroyDevices() {
+  for (Device& device : devices) dlclose(device.handle);
+  devices.clear();
+}
+
+// Station or softAP address of a device
+static int findDevice(const uint8_t* mac) {
+  for (size_t i = 0; i < devices.size(); i++) {
+    const uint8_t* own = devices[i].mac;
+    if (memcmp(own, mac, 5) == 0 && (mac[5] == own[5] || mac[5] == own[5] + 1)) return i;
+  }
+  return -1;
+}
+
+// ---- Transport ------------------------------------------------------------------
+
+struct LinkProfile {
+  const char* name;
+  int lossPercent;
+  int duplicatePercent;
+  int reorderPercent;
+  uint32_t latencyMinUs;
+  uint32_t latencyMaxUs;
+};
+
+static const LinkProfile cleanLink = {"clean", 0, 0, 0, 1000, 3000};
+static const LinkProfile lossyLink = {"lossy", 20, 5, 10, 2000, 15000};
+static const LinkProfile wireLink = {"wire", 0, 0, 0, 0, 0};
+
+struct Packet {
+  uint64_t deliverAt;
+  uint64_t order;  // Send order, for packets due at the same time
+  uint64_t sentAt;
+  int from;
+  int to;
+  std::vector<uint8_t> data;
+
+  bool operator>(const Packet& other) const {
+    return deliverAt != other.deliverAt ? deliverAt > other.deliverAt : order > other.order;
+  }
+};
+
+static std::priority_queue<Packet, std::vector<Packet>, std::greater<Packet>> inFlight;
+static const LinkProfile* activeLink = &cleanLink;
+static bool faultsEnabled = false;
+static std::mt19937 linkRandom;
+static uint64_t packetOrder = 0;
+
+// Scenario hooks
+static void (*onSent)(const Packet& packet, bool broadcast) = nullptr;
+static void (*onDelivered)(const Packet& packet) = nullptr;
+static bool (*dropPacket)(const Packet& packet) = nullptr;
+
+static bool chance(int percent) {
+  return faultsEnabled && percent > 0 && (int)(linkRandom() % 100) < percent;
+}
+
+static uint64_t linkLatency() {
+  uint32_t span = activeLink->latencyMaxUs - activeLink->latencyMinUs;
+  return activeLink->latencyMinUs + (span ? linkRandom() % (span + 1) : 0);
+}
+
+static void queuePacket(const Packet& packet) {
+  if (chance(activeLink->lossPercent) || (dropPacket && dropPacket(packet))) return;
+  Packet queued = packet;
+  queued.deliverAt = packet.sentAt + linkLatency();
+  if (chance(activeLink->reorderPercent)) queued.deliverAt += SIM_REORDER_DELAY_US;
+  queued.order = packetOrder++;
+  inFlight.push(queued);
+  if (chance(activeLink->duplicatePercent)) {
+    queued.deliverAt += linkLatency();
+    queued.order = packetOrder++;
+    inFlight.push(queued);
+  }
+}
+
+static void transport(const uint8_t*, const uint8_t* dest, const uint8_t* data, size_t len) {
+  static const uint8_t broadcastAddress[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+  Packet packet = {};
+  packet.sentAt = micros();
+  packet.from = hostCurrentDevice();
+  packet.data.assign(data, data + len);
+  bool broadcast = memcmp(dest, broadcastAddress, 6) == 0;
+  if (onSent) onSent(packet, broadcast);
+
+  if (broadcast) {
+    for (size_t i = 0; i < devices.size(); i++) {
+      if ((int)i == packet.from) continue;
+      packet.to = i;
+      queuePacket(packet);
+    }
+  } else {
+    packet.to = findDevice(dest);
+    if (packet.to >= 0) queuePacket(packet);
+  }
+}
+
+static void resetTransport(const LinkProfile& profile) {
+  inFlight = decltype(inFlight)();
+  activeLink = &profile;
+  faultsEnabled = false;
+  linkRandom.seed(12345);
+  packetOrder = 0;
+  onSent = nullptr;
+  onDelivered = nullptr;
+  dropPacket = nullptr;
+  hostSetEspNowTransport(transport);
+}
+
+// Time the receive callback of the master (device 0) spends per packet
+static std::vector<uint32_t> masterRxNs;
+
+static void deliverDuePackets() {
+  uint64_t now = micros();
+  while (!inFlight.empty() && inFlight.top().deliverAt <= now) {
+    Packet packet = inFlight.top();
+    inFlight.pop();
+    if (onDelivered) onDelivered(packet);
+    hostSelectDevice(packet.to);
+    auto start = std::chrono::steady_clock::now();
+    hostDeliverEspNow(devices[packet.from].mac, packet.data.data(), packet.data.size());
+    if (packet.to == 0) {
+      masterRxNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start).count());
+    }
+  }
+}
+
+// ---- Statistics -----------------------------------------------------------------
+
+struct Series {
+  std::vector<double> values;
+
+  void add(double value) { values.push_back(value); }
+  double avg() const {
+    double sum = 0;
+    for (double value : values) sum += value;
+    return values.empty() ? 0 : sum / values.size();
+  }
+  double percentile(double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t)(p / 100.0 * values.size()))];
+  }
+  double max() const { return values.empty() ? 0 : *std::max_element(values.begin(), values.end()); }
+};
+
+// ---- Scale scenario -------------------------------------------------------------
+
+// Sensor packets the master received from one sender, to check its counters
+struct SenderTruth {
+  bool started = false;
+  uint16_t first = 0;
+  uint16_t last = 0;
+  std::set<uint16_t> received;
+  uint32_t late = 0;  // Duplicates and packets older than one already received
+};
+
+static struct ScaleRun {
+  int paired;
+  std::vector<SenderTruth> senders;
+  uint32_t unpairedReceived;
+  std::vector<uint64_t> sceneSendTimes;
+  std::vector<std::vector<uint64_t>> awaitingShow;  // Per device: send times of packets it has not shown yet
+  std::vector<uint32_t> lastFrame;                  // Per slave: newest scene frame delivered
+  Series sensorToLedMs;
+  Series sceneToSlaveMs;
+} scale;
+
+static bool isSensorPacket(const Packet& packet) {
+  return packet.data.size() == sizeof(sensor_data_t);
+}
+
+static bool isScenePacket(const Packet& packet) {
+  return packet.data.size() == sizeof(scene_state_t) && packet.data[0] == ESPNOW_PACKET_SCENE_STATE;
+}
+
+static void scaleSent(const Packet& packet, bool broadcast) {
+  if (packet.from == 0 && broadcast && isScenePacket(packet)) {
+    scale.sceneSendTimes.push_back(packet.sentAt);
+  }
+}
+
+static void scaleDelivered(const Packet& packet) {
+  if (packet.to == 0 && isSensorPacket(packet)) {
+    sensor_data_t reading;
+    memcpy(&reading, packet.data.data(), sizeof(reading));
+    if (packet.from > scale.paired) {
+      scale.unpairedReceived++;
+      return;
+    }
+
+    // Late packets are counted but not drawn, so they have no latency to the
+    // LEDs. Sequence 0 (boot test message and first reading) starts the count.
+    SenderTruth& truth = scale.senders[packet.from];
+    bool restart = reading.sequence == 0;
+    if (truth.started && !restart && (int16_t)(reading.sequence - truth.last) <= 0) {
+      truth.late++;
+    } else {
+      if (!truth.started || restart) truth.first = reading.sequence;
+      truth.started = true;
+      truth.last = reading.sequence;
+      if (reading.distance > 0) scale.awaitingShow[0].push_back(packet.sentAt);
+    }
+    truth.received.insert(reading.sequence);
+  } else if (packet.to > 0 && packet.to <= scale.paired && isScenePacket(packet)) {
+    scene_state_t scene;
+    memcpy(&scene, packet.data.data(), sizeof(scene));
+    if (scene.frame > scale.lastFrame[packet.to]) {
+      scale.lastFrame[packet.to] = scene.frame;
+      scale.awaitingShow[packet.to].push_back(packet.sentAt);
+    }
+  }
+}
+
+static bool runScale(int slaves, const LinkProfile& profile) {
+  int failuresBefore = failures;
+  int paired = std::min(slaves, MAX_SLAVE_DEVICES);
+  int silenced = paired;  // Goes quiet early on, so the master must mark it unhealthy
+
+  resetTransport(profile);
+  onSent = scaleSent;
+  onDelivered = scaleDelivered;
+  scale = ScaleRun();
+  scale.paired = paired;
+  scale.senders.resize(paired + 1);
+  scale.awaitingShow.resize(slaves + 1);
+  scale.lastFrame.resize(slaves + 1);
+  masterRxNs.clear();
+  createDevices(slaves + 1);
+
+  // The master has the first section of the stairs, each paired slave the next
+  HostDeviceSetup master = hostDeviceDefaults();
+  master.role = DEVICE_ROLE_MASTER;
+  master.numSlaves = paired;
+  for (int i = 0; i < paired; i++) memcpy(master.slaveAddresses[i], devices[i + 1].mac, 6);
+  master.priorityMode = SENSOR_PRIORITY_ZONE_BASED;
+  master.numLeds = SIM_LEDS_PER_DEVICE;
+  master.segmentMode = LED_SEGMENT_MODE_DISTRIBUTED;
+  master.segmentMap.count = paired + 1;
+  master.segmentMap.totalLeds = (paired + 1) * SIM_LEDS_PER_DEVICE;
+  for (int i = 0; i <= paired; i++) {
+    led_segment_entry_t& entry = master.segmentMap.entries[i];
+    memcpy(entry.mac, devices[i].mac, 6);
+    entry.start = i * SIM_LEDS_PER_DEVICE;
+    entry.length = SIM_LEDS_PER_DEVICE;
+  }
+  hostSelectDevice(0);
+  devices[0].api->setup(master);
+
+  // Slaves past the peer limit believe they are paired, but the master does
+  // not know them (a neighbouring installation on the same channel)
+  for (int i = 1; i <= slaves; i++) {
+    HostDeviceSetup slave = hostDeviceDefaults();
+    slave.role = DEVICE_ROLE_SLAVE;
+    memcpy(slave.masterAddress, devices[0].mac, 6);
+    slave.numLeds = SIM_LEDS_PER_DEVICE;
+    slave.segmentMode = LED_SEGMENT_MODE_DISTRIBUTED;
+    hostSelectDevice(i);
+    devices[i].api->setup(slave);
+  }
+
+  // Walk: master, every live paired slave, then back to the master
+  std::vector<int> route = {0};
+  for (int i = 1; i < paired; i++) route.push_back(i);
+  route.push_back(0);
+
+  const uint64_t startMs = millis();
+  const uint64_t walkStartMs = SIM_WARMUP_MS;
+  const uint64_t walkEndMs = walkStartMs + route.size() * SIM_SECTION_MS;
+  const uint64_t silenceMs = SIM_WARMUP_MS + 1000;
+  // Silent for CONNECTION_HEALTH_TIMEOUT, plus one health check interval
+  const uint64_t endMs = std::max<uint64_t>(walkEndMs, silenceMs + CONNECTION_HEALTH_TIMEOUT + 6000);
+
+  int zoneChecks = 0;
+  int zoneHits = 0;
+  int zoneSwitches = 0;
+  int lastSelected = -1;
+  Series masterLoopUs;
+  std::vector<uint32_t> shows(slaves + 1);
+
+  for (uint64_t t = 0; t < endMs; t += SIM_TICK_MS) {
+    hostAdvanceMillis(SIM_TICK_MS);
+    faultsEnabled = t >= SIM_WARMUP_MS;
+    deliverDuePackets();
+
+    int section = -1;
+    float progress = 0;
+    if (t >= walkStartMs && t < walkEndMs) {
+      section = route[(t - walkStartMs) / SIM_SECTION_MS];
+      progress = (float)((t - walkStartMs) % SIM_SECTION_MS) / SIM_SECTION_MS;
+    }
+
+    for (int i = 0; i <= slaves; i++) {
+      hostSelectDevice(i);
+      const HostDeviceApi* api = devices[i].api;
+
+      // Radar readings, staggered between devices
+      if ((t + i * 7) % SIM_RADAR_INTERVAL_MS == 0 && !(i == silenced && t >= silenceMs)) {
+        if (i > paired) {
+          api->radar(SIM_NEIGHBOUR_DISTANCE, 1, 60);
+        } else if (i == section) {
+          int distance = DEFAULT_MIN_DISTANCE + (int)(progress * (DEFAULT_MAX_DISTANCE - DEFAULT_MIN_DISTANCE));
+          api->radar(std::max(distance, 1), 1, 80);
+        } else {
+          api->radar(0, 0, 0);
+        }
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      api->loop();
+      if (i == 0) {
+        masterLoopUs.add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count() / 1000.0);
+      }
+
+      // Packets a device has received are on its LEDs once it shows a frame
+      uint32_t showCount = hostShowCount();
+      if (showCount != shows[i]) {
+        shows[i] = showCount;
+        Series& latency = i == 0 ? scale.sensorToLedMs : scale.sceneToSlaveMs;
+        for (uint64_t sentAt : scale.awaitingShow[i]) latency.add((micros() - sentAt) / 1000.0);
+        scale.awaitingShow[i].clear();
+      }
+    }
+
+    // The master should follow whichever section the walker is in
+    int selected = devices[0].api->selectedSensor();
+    if (selected != lastSelected && lastSelected >= 0 && t >= walkStartMs) zoneSwitches++;
+    lastSelected = selected;
+    if (section >= 0 && (t - walkStartMs) % SIM_SECTION_MS >= SIM_SETTLE_MS) {
+      zoneChecks++;
+      if (selected == section) zoneHits++;
+    }
+  }
+
+  // Report
+  hostSelectDevice(0);
+  const HostDeviceApi* masterApi = devices[0].api;
+  espnow_stats_t stats;
+  masterApi->espnowStats(&stats);
+  Series rxNs;
+  for (uint32_t ns : masterRxNs) rxNs.add(ns);
+
+  uint32_t expectedLate = 0;
+  bool lossCountsMatch = true;
+  for (int i = 1; i <= paired; i++) {
+    SenderTruth& truth = scale.senders[i];
+    uint32_t lost = truth.started ? (uint16_t)(truth.last - truth.first + 1) - truth.received.size() : 0;
+    if (masterApi->sensorPacketsLost(i) != lost) {
+      printf("  slave %d: master counted %u lost, %u actually missing\n", i,
+             (unsigned)masterApi->sensorPacketsLost(i), (unsigned)lost);
+      lossCountsMatch = false;
+    }
+    expectedLate += truth.late;
+  }
+
+  bool liveHealthy = true;
+  bool following = true;
+  for (int i = 1; i < paired; i++) {
+    liveHealthy = liveHealthy && masterApi->sensorHealthy(i);
+    hostSelectDevice(i);
+    following = following && devices[i].api->followingMasterScene();
+  }
+  hostSelectDevice(0);
+
+  uint64_t minSceneGapUs = UINT64_MAX;
+  for (size_t i = 1; i < scale.sceneSendTimes.size(); i++) {
+    minSceneGapUs = std::min(minSceneGapUs, scale.sceneSendTimes[i] - scale.sceneSendTimes[i - 1]);
+  }
+  double scenesPerSecond = scale.sceneSendTimes.size() * 1000.0 / (millis() - startMs);
+  double zoneHitPercent = zoneChecks ? 100.0 * zoneHits / zoneChecks : 0;
+
+  printf("%3d slaves (%2d paired), %-5s link | rx %5.0f ns/pkt (p99 %5.0f) | loop %5.1f us (max %6.1f) | "
+         "sensor->LED %4.1f ms (p99 %4.1f, max %5.1f) | scene->slave %4.1f ms (max %5.1f) | "
+         "%4.1f scenes/s | zone %5.1f%%, %d switches | lost %u dup %u reord %u unpaired %u\n",
+         slaves, paired, profile.name, rxNs.avg(), rxNs.percentile(99), masterLoopUs.avg(), masterLoopUs.max(),
+         scale.sensorToLedMs.avg(), scale.sensorToLedMs.percentile(99), scale.sensorToLedMs.max(),
+         scale.sceneToSlaveMs.avg(), scale.sceneToSlaveMs.max(), scenesPerSecond, zoneHitPercent, zoneSwitches,
+         (unsigned)stats.packetsLost, (unsigned)stats.packetsDuplicated, (unsigned)stats.packetsReordered,
+         (unsigned)stats.packetsUnpaired);
+
+  check(lossCountsMatch, "per-slave lost counts match the packets that never arrived");
+  check(stats.packetsDuplicated + stats.packetsReordered == expectedLate,
+        "duplicated + reordered matches the late packets delivered");
+  check(stats.packetsUnpaired == scale.unpairedReceived, "every packet from an unpaired sender was dropped");
+  check(liveHealthy, "slaves that keep reporting stay healthy");
+  check(!masterApi->sensorHealthy(silenced), "a slave that went quiet is marked unhealthy");
+  check(following, "slaves follow the master's scene");
+  check(zoneHitPercent >= 95.0, "zone selection follows the walker");
+  check(zoneSwitches <= (int)route.size() + 2, "zone selection does not flap");
+  check(minSceneGapUs >= SCENE_BROADCAST_INTERVAL_MS * 1000ULL, "scene broadcasts respect the rate limit");
+  check(scale.sensorToLedMs.max() <= profile.latencyMaxUs / 1000.0 + SIM_REORDER_DELAY_US / 1000.0 + SIM_TICK_MS * 2,
+        "sensor readings reach the LEDs within the link latency");
+
+  destroyDevices();
+  return failures == failuresBefore;
+}
+
+static void scaleScenario() {
+  printf("== scale: master with N slaves, standard mode, zone-based priority ==\n");
+  for (int slaves : {5, 20, 50}) {
+    runScale(slaves, cleanLink);
+    runScale(slaves, lossyLink);
+  }
+}
+
+// ---- Segments scenario ----------------------------------------------------------
+
+// A walker on a 1500-LED staircase: one device with the whole strip, and a
+// master plus two slaves with 500 LEDs each (the last fed from the top) must
+// light exactly the same pixels
+static bool runSegments(const char* name, const SceneSettings& scene) {
+  int failuresBefore = failures;
+  const int total = 1500;
+  const int segment = 500;
+
+  resetTransport(wireLink);
+  createDevices(4);
+
+  HostDeviceSetup single = hostDeviceDefaults();
+  single.role = DEVICE_ROLE_MASTER;
+  single.numLeds = total;
+  single.scene = scene;
+  hostSelectDevice(0);
+  devices[0].api->setup(single);
+
+  HostDeviceSetup master = hostDeviceDefaults();
+  master.role = DEVICE_ROLE_MASTER;
+  master.numSlaves = 2;
+  memcpy(master.slaveAddresses[0], devices[2].mac, 6);
+  memcpy(master.slaveAddresses[1], devices[3].mac, 6);
+  master.numLeds = segment;
+  master.segmentMode = LED_SEGMENT_MODE_DISTRIBUTED;
+  master.segmentMap.count = 3;
+  master.segmentMap.totalLeds = total;
+  for (int i = 0; i < 3; i++) {
+    led_segment_entry_t& entry = master.segmentMap.entries[i];
+    memcpy(entry.mac, devices[i + 1].mac, 6);
+    entry.start = i * segment;
+    entry.length = segment;
+    entry.flags = i == 2 ? SEGMENT_FLAG_REVERSED : 0;
+  }
+  master.scene = scene;
+  hostSelectDevice(1);
+  devices[1].api->setup(master);
+
+  for (int i = 2; i < 4; i++) {
+    HostDeviceSetup slave = hostDeviceDefaults();
+    slave.role = DEVICE_ROLE_SLAVE;
+    memcpy(slave.masterAddress, devices[1].mac, 6);
+    slave.numLeds = segment;
+    slave.segmentMode = LED_SEGMENT_MODE_DISTRIBUTED;
+    hostSelectDevice(i);
+    devices[i].api->setup(slave);
+  }
+
+  int frames = 0;
+  int mismatchedFrames = 0;
+  int firstMismatch = -1;
+  uint32_t shows[4] = {0};
+  const uint64_t walkMs = 6000;
+
+  // Slaves on their first boot get the segment map with the master's periodic resend
+  const uint64_t warmupMs = 6000;
+  for (uint64_t t = 0; t < warmupMs + walkMs; t += SIM_TICK_MS) {
+    hostAdvanceMillis(SIM_TICK_MS);
+    int distance = 0;
+    if (t >= warmupMs) {
+      float progress = (float)(t - warmupMs) / walkMs;
+      distance = DEFAULT_MIN_DISTANCE + (int)(progress * (DEFAULT_MAX_DISTANCE - DEFAULT_MIN_DISTANCE));
+    }
+
+    bool shown[4];
+    for (int i = 0; i < 4; i++) {
+      deliverDuePackets();  // No latency: a scene sent this tick is drawn this tick
+      hostSelectDevice(i);
+      if (i < 2 && t % SIM_RADAR_INTERVAL_MS == 0 && distance > 0) {
+        devices[i].api->radar(distance, 1, 80);
+      }
+      devices[i].api->loop();
+      shown[i] = hostShowCount() != shows[i];
+      shows[i] = hostShowCount();
+    }
+
+    if (t < warmupMs || !(shown[0] || shown[1] || shown[2] || shown[3])) continue;
+
+    int count[4];
+    const uint8_t* pixels[4];
+    for (int i = 0; i < 4; i++) {
+      hostSelectDevice(i);
+      pixels[i] = devices[i].api->pixels(&count[i]);
+    }
+    frames++;
+    bool same = true;
+    for (int led = 0; led < total && same; led++) {
+      int device = 1 + led / segment;
+      int local = led % segment;
+      if (device == 3) local = segment - 1 - local;
+      if (memcmp(pixels[0] + led * 3, pixels[device] + local * 3, 3) != 0) {
+        same = false;
+        if (firstMismatch < 0) firstMismatch = led;
+      }
+    }
+    if (!same) mismatchedFrames++;
+  }
+
+  printf("%-14s %4d frames compared, %d differ", name, frames, mismatchedFrames);
+  if (firstMismatch >= 0) printf(" (first at LED %d)", firstMismatch);
+  printf("\n");
+  check(frames >= 20, "enough frames drawn on all four devices at once to compare");
+  check(mismatchedFrames == 0, "3 x 500 LEDs match one 1500-LED strip pixel for pixel");
+
+  destroyDevices();
+  return failures == failuresBefore;
+}
+
+static void segmentsScenario() {
+  printf("== segments: 1500 LEDs on one device vs 3 x 500 in distributed mode ==\n");
+  struct Case {
+    const char* name;
+    int lightMode;
+  };
+  // Fire and motion particles draw from each device's own random numbers,
+  // so they cannot match across devices and are left out
+  const Case cases[] = {
+    {"standard", LIGHT_MODE_STANDARD},     {"rainbow", LIGHT_MODE_RAINBOW},
+    {"color wave", LIGHT_MODE_COLOR_WAVE}, {"breathing", LIGHT_MODE_BREATHING},
+    {"solid", LIGHT_MODE_SOLID},           {"comet", LIGHT_MODE_COMET},
+    {"pulse", LIGHT_MODE_PULSE},           {"theater chase", LIGHT_MODE_THEATER_CHASE},
+    {"dual scan", LIGHT_MODE_DUAL_SCAN},
+  };
+  for (const Case& c : cases) {
+    SceneSettings scene = hostDeviceDefaults().scene;
+    scene.lightMode = c.lightMode;
+    runSegments(c.name, scene);
+  }
+
+  // Dimmed, with a background layer and trail, to take the dithered output path
+  SceneSettings scene = hostDeviceDefaults().scene;
+  scene.brightness = 60;
+  scene.backgroundMode = true;
+  scene.backgroundLayer = BACKGROUND_LAYER_PALETTE;
+  scene.trailLength = 20;
+  scene.directionLightEnabled = true;
+  runSegments("standard, dim", scene);
+}
+
+// ---- Reboot scenario ------------------------------------------------------------
+
+// A slave restarts while the master keeps running, and both packets that tell
+// the master its counter started over (the boot test message and the first
+// reading) are lost. Its new readings are far behind the old counter.
+static struct RebootRun {
+  bool dropRestart;
+  uint32_t restartsDropped;
+} reboot;
+
+static bool rebootDrop(const Packet& packet) {
+  if (!reboot.dropRestart || packet.from != 1 || packet.to != 0 || !isSensorPacket(packet)) return false;
+  sensor_data_t reading;
+  memcpy(&reading, packet.data.data(), sizeof(reading));
+  if (reading.sequence != 0) return false;
+  reboot.restartsDropped++;
+  return true;
+}
+
+static HostDeviceSetup rebootSlaveSetup() {
+  HostDeviceSetup slave = hostDeviceDefaults();
+  slave.role = DEVICE_ROLE_SLAVE;
+  memcpy(slave.masterAddress, devices[0].mac, 6);
+  slave.numLeds = SIM_LEDS_PER_DEVICE;
+  return slave;
+}
+
+// The master sees nobody, the slave someone walking up its stairs
+static void rebootRun(uint64_t ms) {
+  for (uint64_t t = 0; t < ms; t += SIM_TICK_MS) {
+    hostAdvanceMillis(SIM_TICK_MS);
+    deliverDuePackets();
+    for (size_t i = 0; i < devices.size(); i++) {
+      hostSelectDevice(i);
+      if ((millis() + i * 7) % SIM_RADAR_INTERVAL_MS == 0) {
+        if (i == 0) {
+          devices[i].api->radar(0, 0, 0);
+        } else {
+          devices[i].api->radar(DEFAULT_MIN_DISTANCE + (millis() / 20) % 200, 1, 80);
+        }
+      }
+      devices[i].api->loop();
+    }
+  }
+}
+
+static void rebootScenario() {
+  printf("== reboot: a slave restarts and its restart packets are lost ==\n");
+  resetTransport(cleanLink);
+  dropPacket = rebootDrop;
+  reboot = RebootRun();
+  createDevices(2);
+
+  HostDeviceSetup master = hostDeviceDefaults();
+  master.role = DEVICE_ROLE_MASTER;
+  master.numSlaves = 1;
+  memcpy(master.slaveAddresses[0], devices[1].mac, 6);
+  master.numLeds = SIM_LEDS_PER_DEVICE;
+  hostSelectDevice(0);
+  devices[0].api->setup(master);
+  hostSelectDevice(1);
+  devices[1].api->setup(rebootSlaveSetup());
+
+  // Long enough for the slave's counter to leave the master's window behind
+  rebootRun(10000);
+  espnow_stats_t before;
+  hostSelectDevice(0);
+  devices[0].api->espnowStats(&before);
+
+  // Power cycle: a fresh copy of the firmware on the same flash
+  hostSelectDevice(1);
+  hostRestartDevice();
+  dlclose(devices[1].handle);
+  devices[1].api = loadDevice(1, &devices[1].handle);
+  reboot.dropRestart = true;
+  devices[1].api->setup(rebootSlaveSetup());
+  rebootRun(CONNECTION_HEALTH_TIMEOUT + 6000);
+
+  hostSelectDevice(0);
+  const HostDeviceApi* masterApi = devices[0].api;
+  espnow_stats_t after;
+  masterApi->espnowStats(&after);
+  printf("%u restart packets dropped | after the reboot: %u reordered, %u duplicated, %u lost\n",
+         (unsigned)reboot.restartsDropped, (unsigned)(after.packetsReordered - before.packetsReordered),
+         (unsigned)(after.packetsDuplicated - before.packetsDuplicated),
+         (unsigned)masterApi->sensorPacketsLost(1));
+
+  check(reboot.restartsDropped == 2, "the boot test message and the first reading both carry sequence 0");
+  check(after.packetsReordered == before.packetsReordered, "readings from the restarted slave are not taken as stale");
+  check(after.packetsDuplicated == before.packetsDuplicated, "readings from the restarted slave are not taken as duplicates");
+  check(masterApi->sensorPacketsLost(1) == 0, "the restart is not counted as lost packets");
+  check(masterApi->sensorHealthy(1), "the restarted slave is healthy");
+
+  destroyDevices();
+}
+
+int main(int argc, char** argv) {
+  std::string self = argv[0];
+  size_t slash = self.rfind('/');
+  deviceLibrary = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) +
+                  "/libambisense_device.so";
+
+  std::string scenario = argc > 1 ? argv[1] : "all";
+  if (scenario == "all" || scenario == "segments") segmentsScenario();
+  if (scenario == "all" || scenario == "scale") scaleScenario();
+  if (scenario == "all" || scenario == "reboot") rebootScenario();
+
+  printf(failures ? "netsim: %d check(s) failed\n" : "netsim: all checks passed\n", failures);
+  return failures ? 1 : 0;
+}
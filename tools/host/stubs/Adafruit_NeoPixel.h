@@ -0,0 +1,40 @@
+// Host stand-in for Adafruit_NeoPixel with a real pixel buffer in strip byte
+// order (NEO_GRB). show() only counts; tests read the buffer directly.
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#include "Arduino.h"
+
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n = 0, int16_t pin = -1, uint16_t type = NEO_GRB + NEO_KHZ800);
+  Adafruit_NeoPixel(const Adafruit_NeoPixel& other);
+  Adafruit_NeoPixel& operator=(const Adafruit_NeoPixel& other);
+  ~Adafruit_NeoPixel();
+
+  void begin() {}
+  void show();
+  void clear();
+  void setBrightness(uint8_t value);
+  uint8_t getBrightness() const;
+  void setPixelColor(uint16_t n, uint32_t color);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  uint32_t getPixelColor(uint16_t n) const;
+  uint16_t numPixels() const { return count; }
+  uint8_t* getPixels() const { return pixels; }
+  bool canShow() const { return true; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+private:
+  uint16_t count;
+  uint8_t* pixels;
+  uint8_t brightness;  // Library encoding: 0 = full, otherwise value + 1
+};
+
+#endif // HOST_ADAFRUIT_NEOPIXEL_H
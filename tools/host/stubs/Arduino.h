@@ -0,0 +1,93 @@
+// Host stand-in for the Arduino-ESP32 core: just what the sketch modules
+// built by tools/host use. Time is virtual and only moves when the test
+// advances it (see host_platform.h), so runs are deterministic.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include "freertos_stub.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+using std::min;
+using std::max;
+
+template <class T, class L, class H>
+inline auto constrain(T value, L low, H high) -> decltype(value + low + high) {
+  return value < low ? low : (value > high ? high : value);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+uint32_t getCpuFrequencyMhz();
+
+class String {
+public:
+  String() {}
+  String(const char* text) : value(text ? text : "") {}
+  String(const std::string& text) : value(text) {}
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.size(); }
+  bool operator==(const char* other) const { return value == other; }
+
+private:
+  std::string value;
+};
+
+class Print {
+public:
+  size_t print(const char* text);
+  size_t print(const String& text) { return print(text.c_str()); }
+  size_t print(int value);
+  size_t println();
+  size_t println(const char* text);
+  size_t println(const String& text) { return println(text.c_str()); }
+  size_t println(int value);
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getCycleCount();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getHeapSize();
+  uint32_t getMaxAllocHeap();
+  uint64_t getEfuseMac();
+  void restart() {}
+};
+
+extern EspClass ESP;
+
+#endif // HOST_ARDUINO_H
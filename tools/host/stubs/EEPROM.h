@@ -0,0 +1,38 @@
+// Host stand-in for the emulated EEPROM: a RAM image that tests can preload
+// (e.g. with a legacy settings layout) and whose commits are counted.
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include "Arduino.h"
+
+#define EEPROM_HOST_SIZE 4096
+
+class EEPROMClass {
+public:
+  EEPROMClass() { memset(data, 0xFF, sizeof(data)); }  // Erased flash
+  bool begin(size_t size);
+  void end() {}
+  uint8_t read(int address);
+  void write(int address, uint8_t value);
+  bool commit();
+  size_t length() const { return size; }
+  uint8_t* getDataPtr() { return data; }
+
+  template <class T> T& get(int address, T& value) {
+    if (address >= 0 && address + sizeof(T) <= size) memcpy(&value, data + address, sizeof(T));
+    return value;
+  }
+
+  template <class T> const T& put(int address, const T& value) {
+    if (address >= 0 && address + sizeof(T) <= size) memcpy(data + address, &value, sizeof(T));
+    return value;
+  }
+
+private:
+  uint8_t data[EEPROM_HOST_SIZE];
+  size_t size = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // HOST_EEPROM_H
@@ -0,0 +1,26 @@
+// Host stand-in for NVS Preferences: keys live in memory. A write either
+// lands whole or, when a power cut is injected, not at all (NVS keeps the
+// previous value), and every landed write is counted.
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false);
+  void end() {}
+  bool isKey(const char* key);
+  bool remove(const char* key);
+  bool clear();
+  size_t getBytesLength(const char* key);
+  size_t getBytes(const char* key, void* buffer, size_t length);
+  size_t putBytes(const char* key, const void* data, size_t length);
+  size_t freeEntries();
+
+private:
+  const char* space = "";
+};
+
+#endif // HOST_PREFERENCES_H
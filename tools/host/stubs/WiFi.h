@@ -0,0 +1,23 @@
+// Host stand-in for the WiFi class: only the MAC addresses are real (set per
+// simulated device with hostSetMac()); mode and channel calls are accepted.
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include "Arduino.h"
+#include "esp_err.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t) { return true; }
+  bool disconnect(bool = false, bool = false) { return true; }
+  int32_t channel(int32_t) { return 0; }
+  uint8_t* macAddress(uint8_t* mac);
+  String macAddress();
+  uint8_t* softAPmacAddress(uint8_t* mac);
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
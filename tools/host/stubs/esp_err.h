@@ -0,0 +1,11 @@
+#ifndef HOST_ESP_ERR_H
+#define HOST_ESP_ERR_H
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_ESPNOW_NOT_INIT 0x3065
+#define ESP_ERR_ESPNOW_FULL 0x3067
+#define ESP_ERR_ESPNOW_NOT_FOUND 0x3069
+
+#endif // HOST_ESP_ERR_H
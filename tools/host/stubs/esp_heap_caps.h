@@ -0,0 +1,19 @@
+// Host stand-in for the heap capabilities API, answered from the allocation
+// counters in host_alloc.cpp against a heap the size of the ESP32's.
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+typedef void (*esp_alloc_failed_hook_t)(size_t size, uint32_t caps, const char* function);
+
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+int heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback);
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,115 @@
+// Scene compositing: the blend modes over every channel value and opacity,
+// standard mode's trail against its background, and the worst-case
+// compositor cost from the render benchmark.
+#include <Arduino.h>
+#include "config.h"
+#include "compositor.h"
+#include "led_controller.h"
+#include "host_device.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+TEST(compositor_blend_exact_ends) {
+  CHECK_EQ(blendWeight(0), 0);
+  CHECK_EQ(blendWeight(255), 256);
+  for (int value = 0; value < 256; value++) {
+    CHECK_EQ(scaleChannel(value, 255), value);
+    CHECK_EQ(scaleChannel(value, 0), 0);
+  }
+
+  // Opacity 255 is the layer, opacity 0 is the frame, for every mode
+  for (int mode = BLEND_ADD; mode <= BLEND_ALPHA; mode++) {
+    uint8_t pixel[3] = {10, 120, 250};
+    blendPixel(pixel, 200, 30, 90, (BlendMode)mode, 0);
+    CHECK(pixel[0] == 10 && pixel[1] == 120 && pixel[2] == 250);
+  }
+  uint8_t pixel[3] = {10, 120, 250};
+  blendPixel(pixel, 200, 30, 90, BLEND_ALPHA, 255);
+  CHECK(pixel[0] == 200 && pixel[1] == 30 && pixel[2] == 90);
+}
+
+TEST(compositor_blend_all_values) {
+  int failures = 0;
+
+  for (int below = 0; below < 256; below++) {
+    for (int layer = 0; layer < 256; layer++) {
+      for (int opacity = 0; opacity < 256; opacity++) {
+        uint8_t scaled = scaleChannel(layer, opacity);
+
+        uint8_t add[3] = {(uint8_t)below, 0, 0};
+        blendPixel(add, layer, 0, 0, BLEND_ADD, opacity);
+        if (add[0] != min(255, below + scaled)) failures++;
+
+        uint8_t brighter[3] = {(uint8_t)below, 0, 0};
+        blendPixel(brighter, layer, 0, 0, BLEND_MAX, opacity);
+        if (brighter[0] != max(below, (int)scaled)) failures++;
+
+        // Alpha stays between the two colors. It is at most 1.5 steps off the
+        // exact mix: the weight is rounded to 1/256 and the result truncated.
+        uint8_t cover[3] = {(uint8_t)below, 0, 0};
+        blendPixel(cover, layer, 0, 0, BLEND_ALPHA, opacity);
+        float exact = below + (layer - below) * opacity / 255.0f;
+        if (cover[0] < min(below, layer) || cover[0] > max(below, layer) || fabs(cover[0] - exact) > 1.5f) {
+          failures++;
+        }
+      }
+    }
+  }
+
+  CHECK_EQ(failures, 0);
+}
+
+TEST(compositor_trail_over_background) {
+  hostBootTestDevice();
+  numLeds = 300;
+  updateLEDConfig();
+
+  lightMode = LIGHT_MODE_STANDARD;
+  redValue = 255;
+  greenValue = 0;
+  blueValue = 0;
+  brightness = 255;
+  backgroundMode = true;
+  backgroundLayer = BACKGROUND_LAYER_COLOR;
+  directionLightEnabled = true;
+  movingLightSpan = 20;
+  trailLength = 40;
+
+  // Walk away from the sensor until the scene transition has finished
+  int distance = minDistance + 20;
+  for (int frame = 0; frame < 60; frame++) {
+    distance += 3;
+    hostDeviceRadar(distance, 1, 50);
+    hostAdvanceMillis(ANIMATION_INTERVAL_MS);
+    hostDeviceLoop();
+  }
+
+  // Strip buffer is GRB; the far end shows only the background
+  const uint8_t* pixels = strip.getPixels();
+  int count = strip.numPixels();
+  uint8_t background = pixels[(count - 1) * 3 + 1];
+  CHECK(background > 1);
+
+  int lit = 0;
+  int belowBackground = 0;
+  for (int i = 0; i < count; i++) {
+    uint8_t red = pixels[i * 3 + 1];
+    if (red > background + 1) lit++;
+    if (red + 1 < background) belowBackground++;  // One step for dithering
+  }
+  CHECK(lit >= movingLightSpan);
+  CHECK_EQ(belowBackground, 0);
+
+  backgroundMode = DEFAULT_BACKGROUND_MODE;
+  directionLightEnabled = DEFAULT_DIRECTION_LIGHT;
+  trailLength = DEFAULT_TRAIL_LENGTH;
+}
+
+TEST(compositor_benchmark) {
+  hostBootTestDevice();
+  RenderBenchmark result;
+  CHECK(runRenderBenchmark(&result));
+  CHECK(result.compositeUs > 0);
+  BENCH("three layers over %d LEDs: %.1f us (output stage %.1f us, animation budget %d us)\n",
+        result.leds, result.compositeUs, result.colorOutputUs, ANIMATION_INTERVAL_MS * 1000);
+}
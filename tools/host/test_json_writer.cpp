@@ -0,0 +1,187 @@
+// JsonWriter: output, escaping, overflow handling, heap use, and speed
+// against the String concatenation it replaced.
+#include <chrono>
+#include <string>
+#include <Arduino.h>
+#include "json_writer.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+TEST(json_writer_document) {
+  char buffer[512];
+  JsonWriter json(buffer, sizeof(buffer));
+  const uint8_t mac[6] = {0x24, 0x6F, 0x28, 0x0A, 0xBC, 0x01};
+
+  json.beginObject();
+  json.field("name", "say \"hi\"\\\n\t\x01");
+  json.field("on", true);
+  json.field("count", -42);
+  json.field("big", 4294967295UL);
+  json.field("ratio", 0.125, 3);
+  json.field("bad", NAN);
+  json.fieldMac("mac", mac);
+  json.fieldNull("none");
+  json.beginArray("list");
+  json.value(1);
+  json.value("two");
+  json.value(false);
+  json.beginObject();
+  json.field("x", 1.5);
+  json.endObject();
+  json.endArray();
+  json.beginObject("empty");
+  json.endObject();
+  json.endObject();
+
+  CHECK(!json.overflowed());
+  CHECK_STR(json.c_str(),
+            "{\"name\":\"say \\\"hi\\\"\\\\\\n\\t\\u0001\",\"on\":true,\"count\":-42,"
+            "\"big\":4294967295,\"ratio\":0.125,\"bad\":null,\"mac\":\"24:6F:28:0A:BC:01\","
+            "\"none\":null,\"list\":[1,\"two\",false,{\"x\":1.50}],\"empty\":{}}");
+  CHECK_EQ(json.length(), strlen(json.c_str()));
+}
+
+TEST(json_writer_overflow) {
+  // Room for {"n": but not the whole number: the partial number is dropped
+  char buffer[9];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.field("n", 123456);
+  json.endObject();
+  CHECK(json.overflowed());
+  CHECK_STR(json.c_str(), "{\"n\":");
+
+  // Nothing more is written once full
+  json.field("m", 1);
+  CHECK_STR(json.c_str(), "{\"n\":");
+
+  // A string that does not fit stops at the buffer end, still terminated
+  char small[6];
+  JsonWriter text(small, sizeof(small));
+  text.value("abcdefgh");
+  CHECK(text.overflowed());
+  CHECK(text.length() < sizeof(small));
+  CHECK_EQ(small[text.length()], '\0');
+
+  char none[1];
+  JsonWriter empty(none, 0);
+  CHECK(empty.overflowed());
+}
+
+TEST(json_writer_depth) {
+  char buffer[64];
+  JsonWriter json(buffer, sizeof(buffer));
+  for (int i = 0; i < JSON_MAX_DEPTH; i++) json.beginArray();
+  CHECK(!json.overflowed());
+  json.beginArray();
+  CHECK(json.overflowed());
+}
+
+// A /settings-sized reply
+static void writeSettings(JsonWriter& json, int i) {
+  static const uint8_t mac[6] = {0x24, 0x6F, 0x28, 0x0A, 0xBC, 0x01};
+  json.beginObject();
+  json.field("minDist", 30 + i % 5);
+  json.field("maxDist", 300);
+  json.field("brightness", 255);
+  json.field("movingLightSpan", 40);
+  json.field("numLeds", 300);
+  json.field("redValue", 255);
+  json.field("greenValue", 128);
+  json.field("blueValue", 0);
+  json.field("centerShift", 0);
+  json.field("trailLength", 10);
+  json.field("directionLightEnabled", true);
+  json.field("backgroundMode", false);
+  json.field("lightMode", 5);
+  json.field("effectSpeed", 50);
+  json.field("effectIntensity", 50);
+  json.field("motionSmoothingEnabled", true);
+  json.field("positionSmoothingFactor", 0.2);
+  json.field("velocitySmoothingFactor", 0.1);
+  json.field("predictionFactor", 0.5);
+  json.field("positionPGain", 0.1);
+  json.field("positionIGain", 0.01);
+  json.field("deviceRole", 0);
+  json.field("sensorPriorityMode", 3);
+  json.fieldMac("mac", mac);
+  json.field("name", "AmbiSense-BC01");
+  json.endObject();
+}
+
+// The same reply built the way the handlers used to: String temporaries
+// concatenated into a growing String (std::string behaves alike on the heap)
+static std::string concatSettings(int i) {
+  std::string json = "{";
+  json += "\"minDist\":" + std::to_string(30 + i % 5) + ",";
+  json += "\"maxDist\":" + std::to_string(300) + ",";
+  json += "\"brightness\":" + std::to_string(255) + ",";
+  json += "\"movingLightSpan\":" + std::to_string(40) + ",";
+  json += "\"numLeds\":" + std::to_string(300) + ",";
+  json += "\"redValue\":" + std::to_string(255) + ",";
+  json += "\"greenValue\":" + std::to_string(128) + ",";
+  json += "\"blueValue\":" + std::to_string(0) + ",";
+  json += "\"centerShift\":" + std::to_string(0) + ",";
+  json += "\"trailLength\":" + std::to_string(10) + ",";
+  json += std::string("\"directionLightEnabled\":") + "true" + ",";
+  json += std::string("\"backgroundMode\":") + "false" + ",";
+  json += "\"lightMode\":" + std::to_string(5) + ",";
+  json += "\"effectSpeed\":" + std::to_string(50) + ",";
+  json += "\"effectIntensity\":" + std::to_string(50) + ",";
+  json += std::string("\"motionSmoothingEnabled\":") + "true" + ",";
+  json += "\"positionSmoothingFactor\":" + std::to_string(0.2) + ",";
+  json += "\"velocitySmoothingFactor\":" + std::to_string(0.1) + ",";
+  json += "\"predictionFactor\":" + std::to_string(0.5) + ",";
+  json += "\"positionPGain\":" + std::to_string(0.1) + ",";
+  json += "\"positionIGain\":" + std::to_string(0.01) + ",";
+  json += "\"deviceRole\":" + std::to_string(0) + ",";
+  json += "\"sensorPriorityMode\":" + std::to_string(3) + ",";
+  json += std::string("\"mac\":\"") + "24:6F:28:0A:BC:01" + "\",";
+  json += std::string("\"name\":\"") + "AmbiSense-BC01" + "\"";
+  json += "}";
+  return json;
+}
+
+TEST(json_writer_no_heap) {
+  HostAllocStats before, after;
+  hostGetAllocStats(&before);
+  char buffer[1024];
+  JsonWriter json(buffer, sizeof(buffer));
+  writeSettings(json, 0);
+  hostGetAllocStats(&after);
+  CHECK(!json.overflowed());
+  CHECK_EQ(after.allocs - before.allocs, 0);
+}
+
+TEST(json_writer_benchmark) {
+  const int documents = 20000;
+  size_t bytes = 0;
+  HostAllocStats before, after;
+
+  hostGetAllocStats(&before);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < documents; i++) {
+    char buffer[1024];
+    JsonWriter json(buffer, sizeof(buffer));
+    writeSettings(json, i);
+    bytes += json.length();
+  }
+  double writerNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  hostGetAllocStats(&after);
+  uint64_t writerAllocs = after.allocs - before.allocs;
+
+  hostGetAllocStats(&before);
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < documents; i++) {
+    bytes += concatSettings(i).size();
+  }
+  double concatNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  hostGetAllocStats(&after);
+  uint64_t concatAllocs = after.allocs - before.allocs;
+
+  BENCH("/settings reply: JsonWriter %.0f ns, %.1f allocs; concatenation %.0f ns, %.1f allocs (%zu bytes)\n",
+        writerNs / documents, (double)writerAllocs / documents, concatNs / documents,
+        (double)concatAllocs / documents, bytes / (2 * documents));
+  CHECK_EQ(writerAllocs, 0);
+  CHECK(concatAllocs > 0);
+}
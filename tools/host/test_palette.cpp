@@ -0,0 +1,158 @@
+// Palettes: the built-in rainbow and heat palettes against the color wheel
+// and fire colors they replaced, gradient expansion, the custom palette and
+// the /setPalette stop parser.
+#include <Arduino.h>
+#include "config.h"
+#include "palette.h"
+#include "host_test.h"
+
+static uint8_t entries[PALETTE_SIZE][3];
+
+static bool entryIs(int index, uint8_t r, uint8_t g, uint8_t b) {
+  return entries[index][0] == r && entries[index][1] == g && entries[index][2] == b;
+}
+
+// The old wheelColor() of the rainbow mode
+static void wheelColor(uint8_t position, uint8_t* rgb) {
+  position = 255 - position;
+  if (position < 85) {
+    rgb[0] = 255 - position * 3; rgb[1] = 0; rgb[2] = position * 3;
+  } else if (position < 170) {
+    position -= 85;
+    rgb[0] = 0; rgb[1] = position * 3; rgb[2] = 255 - position * 3;
+  } else {
+    position -= 170;
+    rgb[0] = position * 3; rgb[1] = 255 - position * 3; rgb[2] = 0;
+  }
+}
+
+// The old heat-to-color step of the fire mode
+static void heatColor(uint8_t t, uint8_t* rgb) {
+  if (t > 240) {
+    rgb[0] = 255; rgb[1] = 255; rgb[2] = 255;
+  } else if (t > 210) {
+    rgb[0] = 255; rgb[1] = 255; rgb[2] = t - 210;
+  } else if (t > 140) {
+    rgb[0] = 255; rgb[1] = map(t, 140, 210, 0, 255); rgb[2] = 0;
+  } else {
+    rgb[0] = map(t, 0, 140, 0, 255); rgb[1] = 0; rgb[2] = 0;
+  }
+}
+
+TEST(palette_rainbow_matches_wheel) {
+  expandPalette(PALETTE_RAINBOW, 0, 0, 0, entries);
+  int mismatches = 0;
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    uint8_t rgb[3];
+    wheelColor(i, rgb);
+    if (!entryIs(i, rgb[0], rgb[1], rgb[2])) mismatches++;
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+TEST(palette_heat_matches_fire) {
+  expandPalette(PALETTE_HEAT, 0, 0, 0, entries);
+  int mismatches = 0;
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    uint8_t rgb[3];
+    heatColor(i, rgb);
+    if (!entryIs(i, rgb[0], rgb[1], rgb[2])) mismatches++;
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+TEST(palette_builtin_expansion) {
+  // Color: black to the selected color
+  expandPalette(PALETTE_COLOR, 200, 100, 50, entries);
+  CHECK(entryIs(0, 0, 0, 0));
+  CHECK(entryIs(255, 200, 100, 50));
+  CHECK(entryIs(128, 100, 50, 25));
+
+  // Every built-in palette starts and ends on its end stops, and the
+  // wrapping ones (all but heat and color) end where they start
+  for (int palette = 0; palette < PALETTE_COUNT; palette++) {
+    expandPalette(palette, 10, 20, 30, entries);
+    if (palette != PALETTE_HEAT && palette != PALETTE_COLOR) {
+      CHECK(entryIs(255, entries[0][0], entries[0][1], entries[0][2]));
+    }
+    CHECK(strcmp(getPaletteName(palette), "Unknown") != 0);
+  }
+
+  // Unknown ids fall back to the rainbow
+  uint8_t rainbow[PALETTE_SIZE][3];
+  expandPalette(PALETTE_RAINBOW, 0, 0, 0, rainbow);
+  expandPalette(PALETTE_COUNT + 3, 0, 0, 0, entries);
+  CHECK(memcmp(rainbow, entries, sizeof(entries)) == 0);
+  CHECK_STR(getPaletteName(PALETTE_COUNT), "Unknown");
+}
+
+TEST(palette_custom) {
+  resetCustomPalette();
+  uint16_t revision = getCustomPaletteRevision();
+
+  // Stops inside the range: the end colors are held outside them
+  const PaletteStop stops[3] = {{32, 255, 0, 0}, {64, 0, 255, 0}, {192, 0, 0, 255}};
+  CHECK(setCustomPalette(stops, 3));
+  CHECK(getCustomPaletteRevision() != revision);
+  expandPalette(PALETTE_CUSTOM, 0, 0, 0, entries);
+  CHECK(entryIs(0, 255, 0, 0));
+  CHECK(entryIs(32, 255, 0, 0));
+  CHECK(entryIs(48, 128, 127, 0));
+  CHECK(entryIs(64, 0, 255, 0));
+  CHECK(entryIs(128, 0, 128, 127));
+  CHECK(entryIs(192, 0, 0, 255));
+  CHECK(entryIs(255, 0, 0, 255));
+
+  // Two stops at one position make a hard edge
+  const PaletteStop edge[3] = {{0, 0, 0, 0}, {100, 0, 0, 0}, {100, 255, 255, 255}};
+  CHECK(setCustomPalette(edge, 3));
+  expandPalette(PALETTE_CUSTOM, 0, 0, 0, entries);
+  CHECK(entryIs(99, 0, 0, 0));
+  CHECK(entryIs(100, 255, 255, 255));
+  CHECK(entryIs(255, 255, 255, 255));
+
+  // Rejected: too few, too many, or out of order; the palette is kept
+  PaletteStop many[PALETTE_MAX_STOPS + 1] = {};
+  const PaletteStop backwards[2] = {{200, 0, 0, 0}, {100, 0, 0, 0}};
+  revision = getCustomPaletteRevision();
+  CHECK(!setCustomPalette(stops, 1));
+  CHECK(!setCustomPalette(many, PALETTE_MAX_STOPS + 1));
+  CHECK(!setCustomPalette(backwards, 2));
+  CHECK_EQ(getCustomPaletteRevision(), revision);
+  CHECK_EQ(getCustomPalette().count, 3);
+
+  // Unused stops are zeroed, so the stored record only depends on the palette
+  const CustomPalette& custom = getCustomPalette();
+  for (int i = 3; i < PALETTE_MAX_STOPS; i++) {
+    CHECK(custom.stops[i].position == 0 && custom.stops[i].r == 0);
+  }
+
+  resetCustomPalette();
+}
+
+TEST(palette_parse_stops) {
+  PaletteStop stops[PALETTE_MAX_STOPS];
+
+  CHECK_EQ(parsePaletteStops("0:FF0000,128:00ff80,255:0000FF", stops), 3);
+  CHECK_EQ(stops[1].position, 128);
+  CHECK_EQ(stops[1].r, 0x00);
+  CHECK_EQ(stops[1].g, 0xFF);
+  CHECK_EQ(stops[1].b, 0x80);
+  CHECK_EQ(stops[2].b, 0xFF);
+
+  CHECK_EQ(parsePaletteStops("", stops), 0);
+  CHECK_EQ(parsePaletteStops("0:FF0000,", stops), 1);
+  CHECK_EQ(parsePaletteStops("256:FF0000", stops), 0);
+  CHECK_EQ(parsePaletteStops("-1:FF0000", stops), 0);
+  CHECK_EQ(parsePaletteStops("0:FF00", stops), 0);
+  CHECK_EQ(parsePaletteStops("0:FF000000", stops), 0);
+  CHECK_EQ(parsePaletteStops("0-FF0000", stops), 0);
+  CHECK_EQ(parsePaletteStops("0:FF0000;1:00FF00", stops), 0);
+  CHECK_EQ(parsePaletteStops("0:GG0000", stops), 0);
+
+  // At most PALETTE_MAX_STOPS
+  CHECK_EQ(parsePaletteStops("0:000000,1:000000,2:000000,3:000000,4:000000,5:000000,6:000000,7:000000", stops),
+           PALETTE_MAX_STOPS);
+  CHECK_EQ(parsePaletteStops("0:000000,1:000000,2:000000,3:000000,4:000000,5:000000,6:000000,7:000000,8:000000",
+                             stops), 0);
+}
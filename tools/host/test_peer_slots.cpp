@@ -0,0 +1,108 @@
+// Slave slots on the master: unpairing a slave moves the ones after it down
+// together with their health, sequence tracking and readings, and a slot
+// that is reused starts clean.
+#include <Arduino.h>
+#include "config.h"
+#include "espnow_manager.h"
+#include "host_device.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+static const uint8_t slaveMacs[3][6] = {
+  {0x24, 0x6F, 0x28, 0x20, 0x00, 0x02},
+  {0x24, 0x6F, 0x28, 0x20, 0x00, 0x04},
+  {0x24, 0x6F, 0x28, 0x20, 0x00, 0x06},
+};
+
+static void sendReading(const uint8_t* mac, uint16_t sequence, int distance) {
+  sensor_data_t reading = {};
+  reading.sensorId = 1;
+  reading.sequence = sequence;
+  reading.distance = distance;
+  reading.energy = 80;
+  hostDeliverEspNow(mac, (const uint8_t*)&reading, sizeof(reading));
+}
+
+static void pairSlaves(int count) {
+  numSlaveDevices = 0;
+  rebuildPeerIndex();
+  initializeConnectionHealth();
+  resetESPNOWStats();
+  for (int i = 0; i < count; i++) CHECK(addSlaveSlot(slaveMacs[i]));
+}
+
+TEST(peer_slots_remove_moves_state) {
+  hostBootTestDevice();
+  pairSlaves(3);
+
+  // Slave 0 has sent 200 readings, slave 1 only 10 with one lost, slave 2 five
+  for (int s = 0; s < 200; s++) sendReading(slaveMacs[0], s, 100);
+  for (int s = 0; s < 10; s++) {
+    if (s != 4) sendReading(slaveMacs[1], s, 200);
+  }
+  for (int s = 0; s < 5; s++) sendReading(slaveMacs[2], s, 300);
+  CHECK_EQ(getSensorPacketsLost(2), 1);
+
+  removeSlaveSlot(0);
+  CHECK_EQ(numSlaveDevices, 2);
+  CHECK_EQ(findSlaveSlot(slaveMacs[0]), -1);
+  CHECK_EQ(findSlaveSlot(slaveMacs[1]), 1);
+  CHECK_EQ(findSlaveSlot(slaveMacs[2]), 2);
+
+  // Readings, loss counts and health moved with their slaves; the vacated
+  // slot has nothing left to fuse
+  CHECK_EQ(latestSensorData[1].distance, 200);
+  CHECK_EQ(latestSensorData[2].distance, 300);
+  CHECK_EQ(latestSensorData[3].distance, 0);
+  CHECK_EQ(getSensorPacketsLost(1), 1);
+  CHECK(getSensorHealth(1) && getSensorHealth(2) && !getSensorHealth(3));
+
+  // Slave 1 continues its own sequence, not the one of the slave it replaced
+  espnow_stats_t before;
+  getESPNOWStats(&before);
+  sendReading(slaveMacs[1], 10, 210);
+  sendReading(slaveMacs[2], 5, 310);
+  espnow_stats_t after;
+  getESPNOWStats(&after);
+  CHECK_EQ(after.packetsReordered, before.packetsReordered);
+  CHECK_EQ(after.packetsDuplicated, before.packetsDuplicated);
+  CHECK_EQ(latestSensorData[1].distance, 210);
+  CHECK_EQ(latestSensorData[2].distance, 310);
+
+  numSlaveDevices = 0;
+  rebuildPeerIndex();
+  initializeConnectionHealth();
+}
+
+TEST(peer_slots_reused_slot_starts_clean) {
+  hostBootTestDevice();
+  pairSlaves(2);
+
+  for (int s = 0; s < 100; s++) sendReading(slaveMacs[1], s, 150);
+  removeSlaveSlot(1);
+
+  // A new slave in the same slot starts its count at 1 (its sequence 0 was
+  // lost); it must not be judged against the old slave's sequence
+  CHECK(addSlaveSlot(slaveMacs[2]));
+  CHECK_EQ(findSlaveSlot(slaveMacs[2]), 2);
+  CHECK_EQ(latestSensorData[2].distance, 0);
+  CHECK(!getSensorHealth(2));
+
+  espnow_stats_t before;
+  getESPNOWStats(&before);
+  for (int s = 1; s <= 5; s++) sendReading(slaveMacs[2], s, 250);
+  espnow_stats_t after;
+  getESPNOWStats(&after);
+  CHECK_EQ(after.packetsReordered, before.packetsReordered);
+  CHECK_EQ(getSensorPacketsLost(2), 0);
+  CHECK_EQ(getSensorPacketCount(2), 5);
+  CHECK_EQ(latestSensorData[2].distance, 250);
+
+  // Every slot taken
+  numSlaveDevices = MAX_SLAVE_DEVICES;
+  CHECK(!addSlaveSlot(slaveMacs[0]));
+
+  numSlaveDevices = 0;
+  rebuildPeerIndex();
+  initializeConnectionHealth();
+}
@@ -0,0 +1,118 @@
+// Profiler zones: statistics from known cycle counts, histogram bucket
+// edges, and PROFILE_ZONE() timing real waits. On the host the cycle
+// counter follows std::chrono::steady_clock at the ESP32's 240 MHz, so
+// timed zones measure the host CPU.
+#include <chrono>
+#include <math.h>
+#include <Arduino.h>
+#include "profiler.h"
+#include "host_test.h"
+
+static uint32_t cyclesFor(uint32_t us) {
+  return us * getCpuFrequencyMhz();
+}
+
+static void spinMicros(uint32_t us) {
+  auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+  while (std::chrono::steady_clock::now() < end) {
+  }
+}
+
+TEST(profiler_stats) {
+  resetProfiler();
+
+  // 98 fast runs and two slow ones: the 99th percentile is a slow one
+  for (int i = 0; i < 98; i++) profilerRecord(PROFILE_ZONE_SHOW, cyclesFor(10));
+  profilerRecord(PROFILE_ZONE_SHOW, cyclesFor(1000));
+  profilerRecord(PROFILE_ZONE_SHOW, cyclesFor(1000));
+
+  ProfileZoneStats stats;
+  getProfileZoneStats(PROFILE_ZONE_SHOW, &stats);
+  CHECK_EQ(stats.count, 100);
+  CHECK_EQ(stats.minUs, 10);
+  CHECK_EQ(stats.maxUs, 1000);
+  CHECK(fabs(stats.avgUs - 29.8) < 0.01);
+  CHECK_EQ(stats.p99Us, 1000);
+
+  // One slow run in 100 is the 1% the percentile leaves out
+  profilerRecord(PROFILE_ZONE_OUTPUT, cyclesFor(1000));
+  for (int i = 0; i < 99; i++) profilerRecord(PROFILE_ZONE_OUTPUT, cyclesFor(10));
+  getProfileZoneStats(PROFILE_ZONE_OUTPUT, &stats);
+  CHECK_EQ(stats.p99Us, 11);  // Upper edge of the 10-11 us bucket
+
+  // Zones are independent, and a reset clears them all
+  getProfileZoneStats(PROFILE_ZONE_LOOP, &stats);
+  CHECK_EQ(stats.count, 0);
+  resetProfiler();
+  getProfileZoneStats(PROFILE_ZONE_SHOW, &stats);
+  CHECK_EQ(stats.count, 0);
+  CHECK_EQ(stats.p99Us, 0);
+  CHECK(stats.avgUs == 0);
+}
+
+TEST(profiler_histogram_buckets) {
+  // A bucket's upper edge is at most a quarter octave above any value in it
+  uint32_t previousEdge = 0;
+  for (uint32_t us = 1; us < 114688; us += 1 + us / 64) {
+    resetProfiler();
+    for (int i = 0; i < 100; i++) profilerRecord(PROFILE_ZONE_LOOP, cyclesFor(us));
+    profilerRecord(PROFILE_ZONE_LOOP, cyclesFor(us * 4 + 100));
+
+    ProfileZoneStats stats;
+    getProfileZoneStats(PROFILE_ZONE_LOOP, &stats);
+    if (!CHECK(stats.p99Us >= us && stats.p99Us <= us + us / 4)) {
+      printf("    %u us went to a bucket ending at %u us\n", us, stats.p99Us);
+      break;
+    }
+    CHECK(stats.p99Us >= previousEdge);
+    previousEdge = stats.p99Us;
+  }
+
+  // The last bucket (from 114.7 ms) has no upper edge: the slowest run counts
+  resetProfiler();
+  for (int i = 0; i < 100; i++) profilerRecord(PROFILE_ZONE_LOOP, cyclesFor(200000));
+  profilerRecord(PROFILE_ZONE_LOOP, cyclesFor(250000));
+  ProfileZoneStats stats;
+  getProfileZoneStats(PROFILE_ZONE_LOOP, &stats);
+  CHECK_EQ(stats.p99Us, 250000);
+  resetProfiler();
+}
+
+TEST(profiler_zone_timing) {
+  resetProfiler();
+
+  for (int i = 0; i < 50; i++) {
+    PROFILE_ZONE(PROFILE_ZONE_EVENTS);
+    spinMicros(i == 0 ? 2000 : 200);
+  }
+
+  // Waits are lower bounds; the upper bounds leave room for a busy host
+  ProfileZoneStats stats;
+  getProfileZoneStats(PROFILE_ZONE_EVENTS, &stats);
+  CHECK_EQ(stats.count, 50);
+  CHECK(stats.minUs >= 200);
+  CHECK(stats.minUs < 5000);
+  CHECK(stats.maxUs >= 2000);
+  CHECK(stats.minUs <= stats.avgUs && stats.avgUs <= stats.maxUs);
+  CHECK(stats.p99Us >= stats.minUs && stats.p99Us <= stats.maxUs);
+
+  // Nested zones each count their own full time
+  resetProfiler();
+  {
+    PROFILE_ZONE(PROFILE_ZONE_LOOP);
+    spinMicros(100);
+    {
+      PROFILE_ZONE(PROFILE_ZONE_ANIMATION);
+      spinMicros(300);
+    }
+  }
+  ProfileZoneStats outer;
+  ProfileZoneStats inner;
+  getProfileZoneStats(PROFILE_ZONE_LOOP, &outer);
+  getProfileZoneStats(PROFILE_ZONE_ANIMATION, &inner);
+  CHECK_EQ(outer.count, 1);
+  CHECK_EQ(inner.count, 1);
+  CHECK(inner.minUs >= 300);
+  CHECK(outer.minUs >= inner.minUs + 100);
+  resetProfiler();
+}
@@ -0,0 +1,169 @@
+// Deferred settings saves: the quiet period before a commit, coalescing of a
+// burst of changes into one write per section, and unchanged sections
+// costing no flash write, and every schema entry validated on the way.
+//
+// A reboot is settingsStoreEnd() plus setupEEPROM(): the store's RAM index
+// is dropped and every section is loaded back from the NVS model.
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "config.h"
+#include "eeprom_manager.h"
+#include "settings_schema.h"
+#include "settings_store.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+// Blank flash and a blank EEPROM: first boot, so defaults are stored
+static void bootFactoryFresh() {
+  settingsStoreEnd();
+  hostNvsReset();
+  hostEepromFill(0xFF);
+  EEPROM.begin(EEPROM_SIZE);
+  setupEEPROM();
+}
+
+static uint32_t nvsWrites() {
+  HostNvsStats stats;
+  hostNvsGetStats(&stats);
+  return stats.writes;
+}
+
+TEST(settings_save_first_boot) {
+  bootFactoryFresh();
+
+  // Nine sections, the wear counter and the completion marker
+  CHECK_EQ(nvsWrites(), SETTINGS_SECTION_COUNT + 2);
+  CHECK(settingsStoreContains("complete"));
+  CHECK_EQ(getPendingSettingsSections(), 0);
+
+  // A second boot finds everything and writes nothing
+  uint32_t writes = nvsWrites();
+  settingsStoreEnd();
+  setupEEPROM();
+  CHECK_EQ(nvsWrites(), writes);
+  CHECK_EQ(brightness, DEFAULT_BRIGHTNESS);
+}
+
+TEST(settings_save_burst_coalesced) {
+  bootFactoryFresh();
+  SettingsSaveStats before = getSettingsSaveStats();
+  uint32_t writes = nvsWrites();
+
+  // A slider drag: a change every 100 ms, plus one change to another section
+  for (int i = 0; i < 20; i++) {
+    brightness = 100 + i;
+    scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
+    if (i == 10) {
+      effectSpeed = 33;
+      scheduleSettingsSave(SETTINGS_SECTION_ADVANCED);
+    }
+    hostAdvanceMillis(100);
+    processSettingsSave();
+  }
+  CHECK_EQ(nvsWrites(), writes);
+  CHECK_EQ(getPendingSettingsSections(), SETTINGS_SECTION_SYSTEM | SETTINGS_SECTION_ADVANCED);
+
+  // Due SETTINGS_SAVE_DELAY_MS after the last change, not the first
+  hostAdvanceMillis(SETTINGS_SAVE_DELAY_MS - 100 - 1);
+  processSettingsSave();
+  CHECK_EQ(nvsWrites(), writes);
+  hostAdvanceMillis(1);
+  processSettingsSave();
+  CHECK_EQ(getPendingSettingsSections(), 0);
+
+  // One write per changed section, plus the wear counter
+  const SettingsSaveStats& after = getSettingsSaveStats();
+  CHECK_EQ(nvsWrites(), writes + 3);
+  CHECK_EQ(after.writes - before.writes, 2);
+  CHECK_EQ(after.coalescedChanges - before.coalescedChanges, 20);
+  CHECK_EQ(after.sectionWrites[0] - before.sectionWrites[0], 1);
+  CHECK_EQ(after.sectionWrites[1] - before.sectionWrites[1], 1);
+  CHECK_EQ(after.lifetimeWrites - before.lifetimeWrites, 2);
+
+  // The last value of the burst is what survives a restart
+  brightness = 0;
+  effectSpeed = 0;
+  settingsStoreEnd();
+  setupEEPROM();
+  CHECK_EQ(brightness, 119);
+  CHECK_EQ(effectSpeed, 33);
+  CHECK_EQ(getSettingsSaveStats().lifetimeWrites, after.lifetimeWrites);
+}
+
+TEST(settings_save_unchanged_skipped) {
+  bootFactoryFresh();
+  SettingsSaveStats before = getSettingsSaveStats();
+  uint32_t writes = nvsWrites();
+
+  // Saving what is already stored touches no flash
+  scheduleSettingsSave(SETTINGS_SECTION_ALL);
+  hostAdvanceMillis(SETTINGS_SAVE_DELAY_MS);
+  processSettingsSave();
+  CHECK_EQ(nvsWrites(), writes);
+  CHECK_EQ(getSettingsSaveStats().skippedWrites - before.skippedWrites, SETTINGS_SECTION_COUNT);
+  CHECK_EQ(getSettingsSaveStats().writes, before.writes);
+
+  // A value changed and changed back before the save is also skipped
+  brightness = 12;
+  scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
+  brightness = DEFAULT_BRIGHTNESS;
+  scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
+  hostAdvanceMillis(SETTINGS_SAVE_DELAY_MS);
+  processSettingsSave();
+  CHECK_EQ(nvsWrites(), writes);
+}
+
+TEST(settings_save_flush) {
+  bootFactoryFresh();
+  uint32_t writes = nvsWrites();
+
+  // Before a restart pending changes are written at once
+  movingLightSpan = 61;
+  scheduleSettingsSave(SETTINGS_SECTION_SYSTEM);
+  flushSettingsSave();
+  CHECK_EQ(getPendingSettingsSections(), 0);
+  CHECK_EQ(nvsWrites(), writes + 2);
+
+  // Nothing left for the timer to do
+  hostAdvanceMillis(SETTINGS_SAVE_DELAY_MS);
+  processSettingsSave();
+  CHECK_EQ(nvsWrites(), writes + 2);
+
+  movingLightSpan = 0;
+  settingsStoreEnd();
+  setupEEPROM();
+  CHECK_EQ(movingLightSpan, 61);
+}
+
+TEST(settings_save_validates_schema) {
+  bootFactoryFresh();
+
+  // Every value out of range goes back to its default when it is saved
+  for (int i = 0; i < SETTINGS_SCHEMA_SIZE; i++) {
+    const SettingDescriptor& setting = settingsSchema[i];
+    if (setting.type != SETTING_BOOL) writeSetting(setting, setting.maxValue + 1);
+  }
+  scheduleSettingsSave(SETTINGS_SECTION_ALL);
+  flushSettingsSave();
+
+  int restored = 0;
+  for (int i = 0; i < SETTINGS_SCHEMA_SIZE; i++) {
+    const SettingDescriptor& setting = settingsSchema[i];
+    if (readSetting(setting) == setting.defaultValue) {
+      restored++;
+    } else {
+      printf("    %s kept %g\n", setting.key, readSetting(setting));
+    }
+  }
+  CHECK_EQ(restored, SETTINGS_SCHEMA_SIZE);
+  CHECK_EQ(sensorPriorityMode, DEFAULT_SENSOR_PRIORITY_MODE);
+
+  // The priority mode is range-checked like any other setting
+  int index = findSetting("sensorPriorityMode");
+  float value;
+  CHECK(index >= 0);
+  CHECK(parseSettingValue(settingsSchema[index], "4", value));
+  CHECK(value == SENSOR_PRIORITY_FUSION);
+  CHECK(!parseSettingValue(settingsSchema[index], "5", value));
+  CHECK(!parseSettingValue(settingsSchema[index], "-1", value));
+}
@@ -0,0 +1,297 @@
+// Settings records: version and CRC checks, power cuts during a write, random
+// flash damage, per-section fallback on boot, and migration from the old
+// EEPROM layout.
+//
+// A reboot is settingsStoreEnd() plus setupEEPROM(), as in
+// test_settings_save.cpp.
+#include <stdlib.h>
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "config.h"
+#include "eeprom_manager.h"
+#include "settings_store.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+// Payload offset in a stored record (version, reserved, size, CRC32)
+#define RECORD_HEADER_SIZE 8
+
+struct TestRecord {
+  uint32_t counter;
+  uint8_t bytes[40];
+};
+
+static void eraseStore() {
+  settingsStoreEnd();
+  hostNvsReset();
+}
+
+static TestRecord makeRecord(uint32_t seed) {
+  TestRecord record;
+  record.counter = seed;
+  for (size_t i = 0; i < sizeof(record.bytes); i++) {
+    record.bytes[i] = (uint8_t)(seed * 31 + i * 7);
+  }
+  return record;
+}
+
+static bool sameRecord(const TestRecord& a, const TestRecord& b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+TEST(settings_store_round_trip) {
+  eraseStore();
+  TestRecord written = makeRecord(1);
+  TestRecord read = {};
+
+  CHECK(!settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK_EQ(settingsStoreWrite("test", 1, &written, sizeof(written)), SETTINGS_STORE_WRITTEN);
+  CHECK(settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK(sameRecord(read, written));
+
+  // Same contents again: no flash write
+  HostNvsStats stats;
+  hostNvsGetStats(&stats);
+  CHECK_EQ(settingsStoreWrite("test", 1, &written, sizeof(written)), SETTINGS_STORE_UNCHANGED);
+  HostNvsStats after;
+  hostNvsGetStats(&after);
+  CHECK_EQ(after.writes, stats.writes);
+
+  // Another layout version or size reads as missing and leaves the destination alone
+  TestRecord untouched = makeRecord(99);
+  read = untouched;
+  CHECK(!settingsStoreRead("test", 2, &read, sizeof(read)));
+  CHECK(!settingsStoreRead("test", 1, &read, sizeof(read) - 1));
+  CHECK(sameRecord(read, untouched));
+  CHECK(settingsStoreContains("test"));
+}
+
+TEST(settings_store_detects_damage) {
+  eraseStore();
+  TestRecord written = makeRecord(2);
+  TestRecord read = {};
+  settingsStoreWrite("test", 1, &written, sizeof(written));
+
+  // One flipped payload bit
+  CHECK(hostNvsCorrupt("test", RECORD_HEADER_SIZE + 5, 0x10));
+  CHECK(!settingsStoreRead("test", 1, &read, sizeof(read)));
+
+  // Saving the same contents again replaces the damaged copy
+  CHECK_EQ(settingsStoreWrite("test", 1, &written, sizeof(written)), SETTINGS_STORE_WRITTEN);
+  CHECK(settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK(sameRecord(read, written));
+}
+
+TEST(settings_store_power_cut) {
+  eraseStore();
+  TestRecord oldRecord = makeRecord(4);
+  TestRecord newRecord = makeRecord(5);
+  TestRecord read = {};
+  settingsStoreWrite("test", 1, &oldRecord, sizeof(oldRecord));
+
+  // Power lost during the write and its retry: the old record is intact
+  hostNvsFailWrites(2);
+  CHECK_EQ(settingsStoreWrite("test", 1, &newRecord, sizeof(newRecord)), SETTINGS_STORE_FAILED);
+  CHECK(settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK(sameRecord(read, oldRecord));
+
+  // A failed write is not remembered, so the next save tries again
+  CHECK_EQ(settingsStoreWrite("test", 1, &newRecord, sizeof(newRecord)), SETTINGS_STORE_WRITTEN);
+  CHECK(settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK(sameRecord(read, newRecord));
+
+  // One lost write is covered by the retry
+  hostNvsFailWrites(1);
+  CHECK_EQ(settingsStoreWrite("test", 1, &oldRecord, sizeof(oldRecord)), SETTINGS_STORE_WRITTEN);
+  CHECK(settingsStoreRead("test", 1, &read, sizeof(read)));
+  CHECK(sameRecord(read, oldRecord));
+
+  HostNvsStats stats;
+  hostNvsGetStats(&stats);
+  CHECK_EQ(stats.failedWrites, 3);
+}
+
+TEST(settings_store_fuzz) {
+  eraseStore();
+  srand(1);
+  int loaded = 0;
+  int rejected = 0;
+
+  // Random damage anywhere in the stored bytes must never load changed data
+  for (int i = 0; i < 5000; i++) {
+    TestRecord written = makeRecord(1000 + i);
+    settingsStoreWrite("test", 1, &written, sizeof(written));
+
+    int damaged = 1 + rand() % 3;
+    for (int d = 0; d < damaged; d++) {
+      size_t offset = rand() % (RECORD_HEADER_SIZE + sizeof(written));
+      hostNvsCorrupt("test", offset, (uint8_t)(1 + rand() % 255));
+    }
+
+    TestRecord read = {};
+    if (settingsStoreRead("test", 1, &read, sizeof(read))) {
+      // Only damage to the reserved header byte goes unnoticed
+      CHECK(sameRecord(read, written));
+      loaded++;
+    } else {
+      rejected++;
+    }
+  }
+
+  CHECK(rejected > 4500);
+  CHECK_EQ(loaded + rejected, 5000);
+}
+
+TEST(settings_store_damaged_section_defaults) {
+  eraseStore();
+  hostEepromFill(0xFF);
+  EEPROM.begin(EEPROM_SIZE);
+  setupEEPROM();
+
+  brightness = 77;
+  effectSpeed = 33;
+  saveSettings();
+
+  // The system record is damaged; the advanced record is fine
+  CHECK(hostNvsCorrupt("system", RECORD_HEADER_SIZE, 0x01));
+  brightness = 0;
+  effectSpeed = 0;
+  settingsStoreEnd();
+  setupEEPROM();
+  CHECK_EQ(brightness, DEFAULT_BRIGHTNESS);
+  CHECK_EQ(effectSpeed, 33);
+
+  // The defaults were written back, so the next boot loads cleanly
+  HostNvsStats stats;
+  hostNvsGetStats(&stats);
+  settingsStoreEnd();
+  setupEEPROM();
+  HostNvsStats after;
+  hostNvsGetStats(&after);
+  CHECK_EQ(after.writes, stats.writes);
+  CHECK_EQ(brightness, DEFAULT_BRIGHTNESS);
+}
+
+// Same layout and checksums as the EEPROM code before the settings store
+struct LegacyHeader {
+  uint16_t magicMarker;
+  uint8_t dataVersion;
+  uint8_t systemSettings;
+  uint8_t advancedSettings;
+  uint8_t motionSettings;
+  uint8_t espnowSettings;
+  uint8_t ledDistSettings;
+  uint8_t reserved[1];
+};
+
+static uint8_t legacyChecksum(int start, int end) {
+  uint8_t crc = 0;
+  for (int i = start; i < end; i++) crc ^= EEPROM.read(i);
+  return crc;
+}
+
+static const uint8_t legacyMaster[6] = {0x24, 0x6F, 0x28, 0x11, 0x22, 0x33};
+static const uint8_t legacySlave[6] = {0x24, 0x6F, 0x28, 0x44, 0x55, 0x66};
+
+static void writeLegacyImage() {
+  hostEepromFill(0);
+  EEPROM.begin(EEPROM_SIZE);
+
+  EEPROM.put(EEPROM_ADDR_CENTER_SHIFT_L, (int16_t)-25);
+  EEPROM.write(EEPROM_ADDR_TRAIL_LENGTH, 9);
+  EEPROM.write(EEPROM_ADDR_DIRECTION_LIGHT, 1);
+  EEPROM.write(EEPROM_ADDR_BACKGROUND_MODE, 1);
+  EEPROM.write(EEPROM_ADDR_LIGHT_MODE, 2);
+  EEPROM.write(EEPROM_ADDR_EFFECT_SPEED, 70);
+  EEPROM.write(EEPROM_ADDR_EFFECT_INTENSITY, 40);
+
+  EEPROM.write(EEPROM_ADDR_MOTION_SMOOTHING, 1);
+  EEPROM.write(EEPROM_ADDR_POSITION_P_GAIN_L, 150);  // 0.150
+
+  EEPROM.write(EEPROM_ADDR_DEVICE_ROLE, DEVICE_ROLE_MASTER);
+  for (int i = 0; i < 6; i++) EEPROM.write(EEPROM_ADDR_MASTER_MAC + i, legacyMaster[i]);
+  EEPROM.write(EEPROM_ADDR_LEGACY_PAIRED_SLAVES, 1);
+  for (int i = 0; i < 6; i++) EEPROM.write(EEPROM_ADDR_LEGACY_PAIRED_SLAVES + 1 + i, legacySlave[i]);
+
+  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_MODE, LED_SEGMENT_MODE_DISTRIBUTED);
+  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_START_L, 200);
+  EEPROM.write(EEPROM_ADDR_LED_SEGMENT_LENGTH_L, 100);
+  EEPROM.write(EEPROM_ADDR_TOTAL_SYSTEM_LEDS_L, 0x2C);
+  EEPROM.write(EEPROM_ADDR_TOTAL_SYSTEM_LEDS_H, 0x01);  // 300
+
+  LegacyHeader header = {};
+  header.magicMarker = 0xA55A;
+  header.dataVersion = 1;
+  header.advancedSettings = legacyChecksum(EEPROM_ADVANCED_START, EEPROM_MOTION_START);
+  header.motionSettings = legacyChecksum(EEPROM_MOTION_START, EEPROM_ESPNOW_START);
+  header.espnowSettings = legacyChecksum(EEPROM_ESPNOW_START, EEPROM_WIFI_START);
+  header.ledDistSettings = legacyChecksum(EEPROM_LED_DIST_START, EEPROM_LED_DIST_START + 7);
+  EEPROM.put(0, header);
+}
+
+static void checkLegacyValues() {
+  CHECK_EQ(centerShift, -25);
+  CHECK_EQ(trailLength, 9);
+  CHECK(directionLightEnabled);
+  CHECK(backgroundMode);
+  CHECK_EQ(lightMode, 2);
+  CHECK_EQ(effectSpeed, 70);
+  CHECK_EQ(effectIntensity, 40);
+  CHECK(motionSmoothingEnabled);
+  CHECK(fabs(positionPGain - 0.150) < 1e-6);
+  CHECK_EQ(deviceRole, DEVICE_ROLE_MASTER);
+  CHECK(memcmp(masterAddress, legacyMaster, 6) == 0);
+  CHECK_EQ(numSlaveDevices, 1);
+  CHECK(memcmp(slaveAddresses[0], legacySlave, 6) == 0);
+  CHECK_EQ(ledSegmentMode, LED_SEGMENT_MODE_DISTRIBUTED);
+  CHECK_EQ(ledSegmentStart, 200);
+  CHECK_EQ(ledSegmentLength, 100);
+  CHECK_EQ(totalSystemLeds, 300);
+}
+
+static void clearLegacyValues() {
+  resetAdvancedSettings();
+  resetMotionSettings();
+  resetEspnowSettings();
+  resetLEDDistributionSettings();
+}
+
+TEST(settings_store_legacy_migration) {
+  eraseStore();
+  writeLegacyImage();
+
+  setupEEPROM();
+  checkLegacyValues();
+  CHECK(settingsStoreContains("complete"));
+
+  // From now on the store is used; the EEPROM copy is never read again
+  uint32_t commits = hostEepromCommits();
+  clearLegacyValues();
+  hostEepromFill(0);
+  settingsStoreEnd();
+  setupEEPROM();
+  checkLegacyValues();
+  CHECK_EQ(hostEepromCommits(), commits);
+}
+
+TEST(settings_store_legacy_migration_interrupted) {
+  eraseStore();
+  writeLegacyImage();
+
+  // Power lost while the first records are written: not marked complete
+  hostNvsFailWrites(4);
+  setupEEPROM();
+  CHECK(!settingsStoreContains("complete"));
+
+  // The next boot migrates again from the untouched EEPROM copy
+  clearLegacyValues();
+  settingsStoreEnd();
+  setupEEPROM();
+  CHECK(settingsStoreContains("complete"));
+  checkLegacyValues();
+
+  clearLegacyValues();
+  settingsStoreEnd();
+  setupEEPROM();
+  checkLegacyValues();
+}
@@ -0,0 +1,111 @@
+// Telemetry allocation counters against the real heap: host_alloc.cpp sees
+// every malloc and free, so the per-subsystem live bytes can be checked
+// across strip length changes and every light mode, and leaks show up as
+// heap that does not come back.
+#include <Arduino.h>
+#include "config.h"
+#include "led_controller.h"
+#include "telemetry.h"
+#include "host_device.h"
+#include "host_platform.h"
+#include "host_test.h"
+
+// Enough frames of each mode for its effect buffers to be allocated
+static void renderEveryMode() {
+  for (int mode = LIGHT_MODE_STANDARD; mode <= LIGHT_MODE_MOTION_PARTICLES; mode++) {
+    lightMode = mode;
+    for (int frame = 0; frame < 20; frame++) {
+      hostDeviceRadar(100 + frame * 10, 1, 50);
+      hostAdvanceMillis(ANIMATION_INTERVAL_MS);
+      hostDeviceLoop();
+    }
+  }
+  lightMode = LIGHT_MODE_STANDARD;
+  hostDeviceLoop();
+}
+
+static void setStripLength(int leds) {
+  numLeds = leds;
+  updateLEDConfig();
+}
+
+static uint32_t trackedLiveBytes() {
+  uint32_t total = 0;
+  for (int s = 0; s < TELEMETRY_SUBSYSTEM_COUNT; s++) {
+    TelemetryAllocStats stats;
+    getTelemetryAllocStats((TelemetrySubsystem)s, &stats);
+    total += stats.liveBytes;
+  }
+  return total;
+}
+
+static int64_t heapLiveBytes() {
+  HostAllocStats stats;
+  hostGetAllocStats(&stats);
+  return stats.liveBytes;
+}
+
+TEST(telemetry_strip_bytes) {
+  hostBootTestDevice();
+  setStripLength(300);
+
+  TelemetryAllocStats strip;
+  getTelemetryAllocStats(TELEMETRY_SUBSYSTEM_STRIP, &strip);
+  CHECK_EQ(strip.liveBytes, 300 * 3);
+
+  setStripLength(900);
+  getTelemetryAllocStats(TELEMETRY_SUBSYSTEM_STRIP, &strip);
+  CHECK_EQ(strip.liveBytes, 900 * 3);
+  CHECK(strip.peakBytes >= 900 * 3);
+  CHECK_EQ(strip.allocs - strip.frees, 1);
+
+  setStripLength(300);
+  getTelemetryAllocStats(TELEMETRY_SUBSYSTEM_STRIP, &strip);
+  CHECK_EQ(strip.liveBytes, 300 * 3);
+  CHECK_EQ(strip.failures, 0);
+}
+
+TEST(telemetry_matches_heap) {
+  hostBootTestDevice();
+  setStripLength(300);
+  renderEveryMode();
+
+  // Growing the strip: the heap grows by what the subsystems report. The
+  // heap counts usable block sizes, which round each of the four buffers
+  // (strip, render arena, fire heat, particles) up by at most 15 bytes.
+  int64_t heapBefore = heapLiveBytes();
+  uint32_t trackedBefore = trackedLiveBytes();
+  setStripLength(900);
+  renderEveryMode();
+  int64_t heapGrowth = heapLiveBytes() - heapBefore;
+  int64_t trackedGrowth = (int64_t)trackedLiveBytes() - trackedBefore;
+  CHECK(trackedGrowth > 0);
+  CHECK(llabs(heapGrowth - trackedGrowth) <= 4 * 15);
+}
+
+TEST(telemetry_no_leak) {
+  hostBootTestDevice();
+  setStripLength(300);
+  renderEveryMode();
+
+  int64_t heapBefore = heapLiveBytes();
+  uint32_t trackedBefore = trackedLiveBytes();
+
+  // Reinitialize the strip and its buffers again and again
+  for (int cycle = 0; cycle < 5; cycle++) {
+    setStripLength(150 + cycle * 300);
+    renderEveryMode();
+    setStripLength(300);
+    renderEveryMode();
+  }
+
+  CHECK_EQ(heapLiveBytes(), heapBefore);
+  CHECK_EQ(trackedLiveBytes(), trackedBefore);
+
+  for (int s = 0; s < TELEMETRY_SUBSYSTEM_COUNT; s++) {
+    TelemetryAllocStats stats;
+    getTelemetryAllocStats((TelemetrySubsystem)s, &stats);
+    CHECK_EQ(stats.failures, 0);
+    CHECK(stats.allocs >= stats.frees);
+  }
+}